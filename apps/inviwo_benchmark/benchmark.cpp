@@ -0,0 +1,372 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#ifdef WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/resourcemanager/resourcemanager.h>
+#include <inviwo/core/util/localetools.h>
+#include <inviwo/core/util/consolelogger.h>
+#include <inviwo/core/util/commandlineparser.h>
+#include <inviwo/core/util/evaluationprofiler.h>
+#include <inviwo/core/util/foreacharg.h>
+#include <inviwo/core/util/settings/systemsettings.h>
+
+#include <inviwo/sys/moduleloading.h>
+
+#include <nlohmann/json.hpp>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace inviwo;
+
+namespace {
+
+using json = nlohmann::json;
+using Animation = std::function<void(double)>;
+
+size_t peakResidentSetSize() {
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+template <typename T>
+T lerp(const T& a, const T& b, double t) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return static_cast<T>(static_cast<double>(a) +
+                              (static_cast<double>(b) - static_cast<double>(a)) * t);
+    } else {
+        using DVec = glm::vec<T::length(), double>;
+        return T{DVec{a} + (DVec{b} - DVec{a}) * t};
+    }
+}
+
+using AnimatedTypes = std::tuple<float, double, int, size_t, glm::i64, vec2, vec3, vec4, dvec2,
+                                 dvec3, dvec4, ivec2, ivec3, ivec4, size2_t, size3_t>;
+
+/**
+ * Create an animation that sweeps an ordinal property from its min to its max value,
+ * or toggles a bool property.
+ */
+std::optional<Animation> makeAnimation(Property* property) {
+    std::optional<Animation> animation;
+    util::for_each_type<AnimatedTypes>{}([&]<typename T>() {
+        if (animation) return;
+        if (auto* ordinal = dynamic_cast<OrdinalProperty<T>*>(property)) {
+            animation = [ordinal, min = ordinal->getMinValue(), max = ordinal->getMaxValue()](
+                            double t) { ordinal->set(lerp(min, max, t)); };
+        }
+    });
+    if (!animation) {
+        if (auto* boolProperty = dynamic_cast<BoolProperty*>(property)) {
+            animation = [boolProperty](double) { boolProperty->set(!boolProperty->get()); };
+        }
+    }
+    return animation;
+}
+
+double toMs(std::chrono::steady_clock::duration d) {
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+
+json latencyStats(std::vector<std::chrono::steady_clock::duration> durations) {
+    if (durations.empty()) return json::object();
+    std::ranges::sort(durations);
+    const auto percentile = [&](double p) {
+        const auto index = static_cast<size_t>(p * static_cast<double>(durations.size() - 1));
+        return toMs(durations[index]);
+    };
+    std::chrono::steady_clock::duration total{};
+    for (const auto& d : durations) total += d;
+
+    return {{"count", durations.size()},
+            {"mean_ms", toMs(total) / static_cast<double>(durations.size())},
+            {"min_ms", toMs(durations.front())},
+            {"p50_ms", percentile(0.50)},
+            {"p95_ms", percentile(0.95)},
+            {"p99_ms", percentile(0.99)},
+            {"max_ms", toMs(durations.back())}};
+}
+
+json processorStats(const EvaluationProfiler& profiler) {
+    json res = json::array();
+    for (const auto category :
+         {EvaluationProfiler::Category::InitializeResources,
+          EvaluationProfiler::Category::PortOnChange, EvaluationProfiler::Category::Process,
+          EvaluationProfiler::Category::BackgroundJob, EvaluationProfiler::Category::Conversion}) {
+        for (const auto& [name, stats] : profiler.getStats(category)) {
+            res.push_back({{"name", name},
+                           {"category", enumToStr(category)},
+                           {"count", stats.count},
+                           {"mean_ms", toMs(stats.mean)},
+                           {"p95_ms", toMs(stats.p95)},
+                           {"max_ms", toMs(stats.max)},
+                           {"total_ms", toMs(stats.total)}});
+        }
+    }
+    return res;
+}
+
+json resourceStats(const ResourceManager& rm) {
+    json res = json::object();
+    for (size_t i = 0; i < ResourceManager::groups; ++i) {
+        const auto& stats = rm.getStats(i);
+        res[std::string{ResourceManager::names[i]}] = {{"usage_bytes", stats.usage},
+                                                       {"peak_bytes", stats.peakUsage},
+                                                       {"evictions", stats.evictions}};
+    }
+    return res;
+}
+
+/**
+ * Process the front queue until the network is evaluated and all background jobs are done
+ */
+void settle(InviwoApplication& app) {
+    auto* network = app.getProcessorNetwork();
+    while (true) {
+        const auto processed = app.processFront();
+        if (processed == 0 && network->runningBackgroundJobs() == 0) break;
+        if (processed == 0) std::this_thread::yield();
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    inviwo::util::configureCodePage();
+
+    inviwo::LogCentral logger;
+    inviwo::LogCentral::init(&logger);
+    auto consoleLogger = std::make_shared<inviwo::ConsoleLogger>();
+    // Keep standard output free for the JSON report
+    consoleLogger->useStdErr = true;
+    logger.registerLogger(consoleLogger);
+
+    InviwoApplication inviwoApp(argc, argv, "Inviwo-Benchmark");
+
+    auto& cmdParser = inviwoApp.getCommandLineParser();
+
+    inviwo::util::registerModules(inviwoApp.getModuleManager(),
+                                  inviwoApp.getSystemSettings().moduleSearchPaths_.get(),
+                                  cmdParser.getModuleSearchPaths());
+
+    TCLAP::ValueArg<size_t> iterationsArg("", "iterations", "Number of measured evaluations",
+                                          false, 100, "count");
+    TCLAP::ValueArg<size_t> warmupArg("", "warmup", "Number of evaluations before measuring",
+                                      false, 5, "count");
+    TCLAP::MultiArg<std::string> invalidateArg(
+        "", "invalidate", "Identifier of a processor to invalidate in each evaluation", false,
+        "processor");
+    TCLAP::MultiArg<std::string> animateArg(
+        "", "animate",
+        "Path of a property to animate in each evaluation, i.e. 'processor.property'. Ordinal "
+        "properties are swept from min to max, bool properties are toggled",
+        false, "property");
+    TCLAP::ValueArg<std::string> reportArg(
+        "", "report", "File to write the JSON report to, defaults to standard output", false, "",
+        "file");
+    TCLAP::ValueArg<std::string> traceArg(
+        "", "trace", "File to write a Chrome trace of the measured evaluations to", false, "",
+        "file");
+    TCLAP::SwitchArg trackResourcesArg(
+        "", "track-resources", "Enable resource tracking to report peak usage per resource group");
+
+    cmdParser.add(&iterationsArg);
+    cmdParser.add(&warmupArg);
+    cmdParser.add(&invalidateArg);
+    cmdParser.add(&animateArg);
+    cmdParser.add(&reportArg);
+    cmdParser.add(&traceArg);
+    cmdParser.add(&trackResourcesArg);
+
+    cmdParser.parse();
+
+    if (!cmdParser.getLoadWorkspaceFromArg()) {
+        log::error("No workspace given, use -w <workspace>");
+        return 1;
+    }
+    const auto workspace = cmdParser.getWorkspacePath();
+
+    if (trackResourcesArg.getValue()) {
+        inviwoApp.getSystemSettings().enableResourceTracking_.set(true);
+    }
+
+    auto* network = inviwoApp.getProcessorNetwork();
+    const auto loadStart = std::chrono::steady_clock::now();
+    try {
+        const NetworkLock lock{network};
+        inviwoApp.getWorkspaceManager()->load(workspace, [&](SourceContext) {
+            try {
+                throw;
+            } catch (const IgnoreException& e) {
+                log::exception(e, "Incomplete network loading {} due to {}", workspace,
+                               e.getMessage());
+            }
+        });
+    } catch (const Exception& e) {
+        log::exception(e, "Unable to load network {} due to {}", workspace, e.getMessage());
+        return 1;
+    }
+    settle(inviwoApp);
+    const auto loadTime = std::chrono::steady_clock::now() - loadStart;
+
+    std::vector<Processor*> processors;
+    for (const auto& identifier : invalidateArg.getValue()) {
+        if (auto* processor = network->getProcessorByIdentifier(identifier)) {
+            processors.push_back(processor);
+        } else {
+            log::error("Processor '{}' not found in {}", identifier, workspace);
+            return 1;
+        }
+    }
+    std::vector<Animation> animations;
+    for (const auto& path : animateArg.getValue()) {
+        auto* property = network->getProperty(path);
+        if (!property) {
+            log::error("Property '{}' not found in {}", path, workspace);
+            return 1;
+        }
+        if (auto animation = makeAnimation(property)) {
+            animations.push_back(std::move(*animation));
+        } else {
+            log::error("Property '{}' of type '{}' can not be animated", path,
+                       property->getClassIdentifier());
+            return 1;
+        }
+    }
+    if (processors.empty() && animations.empty()) {
+        network->forEachProcessor([&](Processor* p) {
+            if (p->isSource()) processors.push_back(p);
+        });
+    }
+
+    const auto warmup = warmupArg.getValue();
+    const auto iterations = iterationsArg.getValue();
+    const auto total = warmup + iterations;
+
+    auto* profiler = EvaluationProfiler::getPtr();
+    profiler->setCapacity(std::max(EvaluationProfiler::defaultCapacity,
+                                   iterations * network->getProcessors().size() * 4));
+
+    std::vector<std::chrono::steady_clock::duration> latencies;
+    latencies.reserve(iterations);
+    for (size_t i = 0; i < total; ++i) {
+        if (i == warmup) {
+            profiler->clear();
+            profiler->setEnabled(true);
+        }
+        const auto t = total > 1 ? static_cast<double>(i) / static_cast<double>(total - 1) : 0.0;
+
+        const auto start = std::chrono::steady_clock::now();
+        {
+            const NetworkLock lock{network};
+            for (auto* processor : processors) {
+                processor->invalidate(InvalidationLevel::InvalidOutput);
+            }
+            for (auto& animation : animations) {
+                animation(t);
+            }
+        }
+        settle(inviwoApp);
+        const auto end = std::chrono::steady_clock::now();
+
+        if (i >= warmup) latencies.push_back(end - start);
+    }
+    profiler->setEnabled(false);
+
+    json report = {{"workspace", workspace.string()},
+                   {"warmup", warmup},
+                   {"iterations", iterations},
+                   {"load_ms", toMs(loadTime)},
+                   {"latency", latencyStats(latencies)},
+                   {"processors", processorStats(*profiler)},
+                   {"memory", {{"peak_rss_bytes", peakResidentSetSize()}}}};
+    if (trackResourcesArg.getValue()) {
+        report["memory"]["resources"] = resourceStats(*inviwoApp.getResourceManager());
+    }
+
+    if (!traceArg.getValue().empty()) {
+        try {
+            profiler->exportChromeTrace(std::filesystem::path{traceArg.getValue()});
+        } catch (const Exception& e) {
+            log::exception(e);
+            return 1;
+        }
+    }
+
+    if (reportArg.getValue().empty()) {
+        std::cout << report.dump(2) << '\n';
+    } else {
+        std::ofstream file{std::filesystem::path{reportArg.getValue()}};
+        if (!file) {
+            log::error("Could not open '{}' for writing", reportArg.getValue());
+            return 1;
+        }
+        file << report.dump(2) << '\n';
+    }
+
+    return 0;
+}
@@ -31,13 +31,17 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/datastructures/histogram.h>
 #include <inviwo/core/algorithm/histogram1d.h>
+#include <inviwo/core/util/exception.h>
 #include <inviwo/core/util/glmcomp.h>
-#include <inviwo/core/util/indexmapper.h>
 
-#include <glm/gtx/component_wise.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <span>
-#include <ranges>
+#include <utility>
+#include <vector>
 
 namespace inviwo::util {
 
@@ -45,13 +49,159 @@ namespace detail {
 
 IVW_CORE_API DataMapper histogramDataMap(const DataMapper& datamap, double effectiveRange);
 
+template <typename T>
+std::pair<size_t, double> binCount(const DataMapper& dataMap, size_t bins,
+                                   HistogramBinning binning) {
+    if (binning == HistogramBinning::Log) {
+        return {bins, dataMap.dataRange.y - dataMap.dataRange.x};
+    }
+    return optimalBinCount<T>(dataMap, bins);
+}
+
 }  // namespace detail
 
+/**
+ * Accumulates a 2D histogram together with the joint statistics of two aligned data channels
+ * over one or more calls to add(). This makes it possible to stream data that does not fit in
+ * memory at once, like bricks or slabs of large volumes, through the same histogram. Each call to
+ * add() splits the data over the thread pool, every task bins its part into a partial histogram
+ * of its own and the partial histograms are merged at the end of the call. The data is processed
+ * in blocks that are first converted to double and then binned, which keeps the type specific
+ * code small. Prefer few large calls to add() over many small ones since the partial histograms
+ * are merged once per call.
+ *
+ * Values are binned as in calculateHistogram2D. NaN values and values below the data range count
+ * as underflow. Pairs where any of the values is not finite are left out of the statistics.
+ *
+ * @see makeHistogram2DAccumulator, calculateHistogram2D
+ */
+class IVW_CORE_API Histogram2DAccumulator {
+public:
+    /**
+     * Callback filling @p first, @p second, and @p include with the values of the block starting
+     * at @p offset. Pairs where @p include is 0 are skipped. The callback is called concurrently
+     * from the thread pool.
+     */
+    using BlockLoader = std::function<void(size_t offset, std::span<double> first,
+                                           std::span<double> second,
+                                           std::span<unsigned char> include)>;
+
+    /**
+     * @param dataMaps        data ranges of the two dimensions
+     * @param numbins         number of bins in each dimension
+     * @param effectiveRange  extent of the data range covered by the bins in each dimension, the
+     *                        last bin starts at `dataRange.x + effectiveRange`
+     * @param binning         placement of the bins in each dimension
+     */
+    Histogram2DAccumulator(const std::array<DataMapper, 2>& dataMaps, size2_t numbins,
+                           dvec2 effectiveRange,
+                           std::array<HistogramBinning, 2> binning = {HistogramBinning::Linear,
+                                                                      HistogramBinning::Linear});
+
+    /**
+     * Add @p size pairs of values provided block by block by @p loader
+     */
+    void add(size_t size, const BlockLoader& loader);
+
+    /**
+     * Add the values of channel @p channel1 of @p data1 and @p channel2 of @p data2. Only pairs
+     * where @p mask is non-zero are added, unless @p mask is empty.
+     * @throws Exception if the sizes of @p data1, @p data2, and a non-empty @p mask do not match
+     */
+    template <typename T, typename U, typename M = unsigned char>
+    void add(std::span<const T> data1, size_t channel1, std::span<const U> data2,
+             size_t channel2, std::span<const M> mask = {});
+
+    /**
+     * The histogram and statistics of all values added so far
+     */
+    Histogram2D histogram() const;
+
+private:
+    struct Axis {
+        double min;
+        double scale;
+        double logScale;  ///< Scale of the relative position within log, see HistogramBinning
+        HistogramBinning binning;
+    };
+    struct Moments {
+        size_t count{0};
+        dvec2 mean{0.0};
+        dvec2 m2{0.0};
+        double cxy{0.0};
+        dvec2 min{0.0};
+        dvec2 max{0.0};
+
+        void merge(const Moments& other);
+    };
+
+    std::array<DataMapper, 2> dataMaps_;
+    size2_t numbins_;
+    dvec2 effectiveRange_;
+    std::array<HistogramBinning, 2> binning_;
+    std::array<Axis, 2> axes_;
+
+    std::vector<size_t> counts_;
+    size_t totalCounts_;
+    size_t underflow_;
+    size_t overflow_;
+    Moments moments_;
+};
+
+template <typename T, typename U, typename M>
+void Histogram2DAccumulator::add(std::span<const T> data1, size_t channel1,
+                                 std::span<const U> data2, size_t channel2,
+                                 std::span<const M> mask) {
+    if (data1.size() != data2.size()) {
+        throw Exception{SourceContext{}, "Dimensions must match ({} and {})", data1.size(),
+                        data2.size()};
+    }
+    if (!mask.empty() && mask.size() != data1.size()) {
+        throw Exception{SourceContext{}, "Mask size must match the data ({} and {})",
+                        mask.size(), data1.size()};
+    }
+
+    add(data1.size(), [&](size_t offset, std::span<double> first, std::span<double> second,
+                          std::span<unsigned char> include) {
+        for (size_t i = 0; i < first.size(); ++i) {
+            first[i] = static_cast<double>(util::glmcomp(data1[offset + i], channel1));
+            second[i] = static_cast<double>(util::glmcomp(data2[offset + i], channel2));
+        }
+        if (mask.empty()) {
+            std::ranges::fill(include, static_cast<unsigned char>(1));
+        } else {
+            for (size_t i = 0; i < include.size(); ++i) {
+                include[i] = mask[offset + i] != M{0} ? 1 : 0;
+            }
+        }
+    });
+}
+
+/**
+ * Create a Histogram2DAccumulator for data of type @p T and @p U. For linear binning, the number
+ * of bins is adjusted to the data types to avoid binning artifacts, see
+ * util::detail::optimalBinCount. For log binning, @p bins is used as is.
+ */
+template <typename T, typename U>
+Histogram2DAccumulator makeHistogram2DAccumulator(
+    const DataMapper& dataMap1, const DataMapper& dataMap2, size2_t bins,
+    std::array<HistogramBinning, 2> binning = {HistogramBinning::Linear,
+                                               HistogramBinning::Linear}) {
+    const auto [numbins1, effectiveRange1] = detail::binCount<T>(dataMap1, bins.x, binning[0]);
+    const auto [numbins2, effectiveRange2] = detail::binCount<U>(dataMap2, bins.y, binning[1]);
+
+    return Histogram2DAccumulator{{dataMap1, dataMap2},
+                                  size2_t{numbins1, numbins2},
+                                  dvec2{effectiveRange1, effectiveRange2},
+                                  binning};
+}
+
 /**
  * Calculate a 2D histogram and statistics for two given spans \p data1 and
  * \p data2 of type \p T and \p U, respectively. This function assumes that the data values between
  * the two spans are aligned, that is <tt>data1[n]</tt> corresponds to <tt>data2[n]</tt>. Note that
- * \p data1 and \p data2 must have the same dimensions. No interpolation is performed.
+ * \p data1 and \p data2 must have the same dimensions. No interpolation is performed. The data is
+ * processed in parallel, see Histogram2DAccumulator.
  *
  * @tparam T        underlying data type of the first dimension, can be a scalar or glm vector type
  * @tparam U        underlying data type of the second dimension, can be a scalar or glm vector type
@@ -63,64 +213,21 @@ IVW_CORE_API DataMapper histogramDataMap(const DataMapper& datamap, double effec
  * @param dataMap2  provides the data range used for bin positions and size of the second dimension
  * @param bins      upper limit of bins to use, actual number of bins might be lower based on data
  *                  range and data types of \p T and \p U
+ * @param binning   placement of the bins in each dimension
+ * @param mask      only pairs where the mask is non-zero are included, unless it is empty
  * @return 2D histogram of \p data1[channel1] and \p data2[channel2]
  * @throws Exception if the sizes of \p data1 and \p data2 do not match
  * \see util::detail::optimalBinCount
  */
-template <typename T, typename U>
-Histogram2D calculateHistogram2D(std::span<const T> data1, size_t channel1,
-                                 const DataMapper& dataMap1, std::span<const U> data2,
-                                 size_t channel2, const DataMapper& dataMap2, size2_t bins) {
-    if (data1.size() != data2.size()) {
-        throw Exception{SourceContext{}, "Dimensions must match ({} and {})", data1.size(),
-                        data2.size()};
-    }
-
-    auto [numbins1, effectiveRange1] = detail::optimalBinCount<T>(dataMap1, bins.x);
-    auto [numbins2, effectiveRange2] = detail::optimalBinCount<U>(dataMap2, bins.y);
-    const dvec2 effectiveRange{effectiveRange1, effectiveRange2};
-    const size2_t numbins{numbins1, numbins2};
-
-    size_t underflow{0u};
-    size_t overflow{0u};
-
-    const dvec2 rangeMin{dataMap1.dataRange.x, dataMap2.dataRange.x};
-    const dvec2 rangeScaleFactor{dvec2{numbins - size2_t{1}} / effectiveRange};
-
-    std::vector<size_t> hist(glm::compMul(numbins), 0);
-    const glm::vec<2, ptrdiff_t> maxBins{static_cast<ptrdiff_t>(numbins.x) - 1,
-                                         static_cast<ptrdiff_t>(numbins.y) - 1};
-    const IndexMapper<2, std::ptrdiff_t> indexMapper{numbins};
-
-    // Do not use util::zip or std::views::zip here. This will increase compile time drastically.
-    for (size_t i = 0; i < data1.size(); ++i) {
-        const dvec2 val{static_cast<double>(util::glmcomp(data1[i], channel1)),
-                        static_cast<double>(util::glmcomp(data2[i], channel2))};
-
-        const glm::vec<2, ptrdiff_t> index{
-            static_cast<std::ptrdiff_t>((val.x - rangeMin.x) * rangeScaleFactor.x),
-            static_cast<std::ptrdiff_t>((val.y - rangeMin.y) * rangeScaleFactor.y)};
-        if (index.x < 0 || index.y < 0) {
-            ++underflow;
-        } else if (index.x > maxBins.x || index.y > maxBins.y) {
-            ++overflow;
-        } else {
-            ++hist[indexMapper(index)];
-        }
-    }
-
-    const auto maxBinCount = *std::ranges::max_element(hist);
-
-    return Histogram2D{
-        .counts = hist,
-        .dimensions = numbins,
-        .totalCounts = data1.size(),
-        .maxCount = maxBinCount,
-        .dataMap = {detail::histogramDataMap(dataMap1, effectiveRange.x),
-                    detail::histogramDataMap(dataMap2, effectiveRange.y)},
-        .underflow = underflow,
-        .overflow = overflow,
-    };
+template <typename T, typename U, typename M = unsigned char>
+Histogram2D calculateHistogram2D(
+    std::span<const T> data1, size_t channel1, const DataMapper& dataMap1,
+    std::span<const U> data2, size_t channel2, const DataMapper& dataMap2, size2_t bins,
+    std::array<HistogramBinning, 2> binning = {HistogramBinning::Linear, HistogramBinning::Linear},
+    std::span<const M> mask = {}) {
+    auto accumulator = makeHistogram2DAccumulator<T, U>(dataMap1, dataMap2, bins, binning);
+    accumulator.add(data1, channel1, data2, channel2, mask);
+    return accumulator.histogram();
 }
 
 }  // namespace inviwo::util
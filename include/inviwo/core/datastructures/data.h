@@ -37,7 +37,9 @@
 #include <inviwo/core/resourcemanager/resource.h>
 
 #include <inviwo/core/util/demangle.h>
+#include <inviwo/core/util/evaluationprofiler.h>
 
+#include <algorithm>
 #include <typeindex>
 #include <mutex>
 #include <unordered_map>
@@ -174,6 +176,29 @@ public:
      */
     void invalidateAllOther(const Repr* repr);
 
+    /**
+     * Try to evict @p representation to free up its resources. The representation is only removed
+     * if @p source is a valid representation of this object that it can be recreated from, and if
+     * nobody else holds a shared reference to it. The next call to getRepresentation will then
+     * transparently recreate it from @p source.
+     * @note Raw pointers retrieved by getRepresentation are not tracked. Since that is how almost
+     * all code reads data, a representation can be freed while it is still being read, for example
+     * by a background job of a PoolProcessor or by the processor that is currently evaluated.
+     * Eviction should therefore only be done from the main thread while neither the network is
+     * evaluating nor any background jobs are running. The ResourceManager postpones its
+     * enforcement of budgets accordingly. @see ResourceManager::setBusyCallback
+     * @return true if the representation was removed.
+     */
+    bool evictRepresentation(const Repr* representation, const Repr* source) const;
+
+    /**
+     * A counter that is incremented every time the data might have been modified, i.e. when an
+     * editable representation is retrieved, when other representations are invalidated, or when
+     * representations are added or replaced. Can be used together with the identity of the object
+     * to cache results derived from the data without having to inspect the data itself.
+     */
+    size_t getModificationCount() const;
+
     void updateResource(const ResourceMeta& meta) const;
 
 protected:
@@ -219,6 +244,7 @@ private:
     mutable std::shared_ptr<Repr> lastValidRepresentation_;
 
     mutable std::optional<ResourceMeta> meta_;
+    size_t modificationCount_ = 0;
 };
 
 template <typename Self, typename Repr>
@@ -260,6 +286,14 @@ std::shared_ptr<T> Data<Self, Repr>::getReprInternal(D& data) {
                 const auto dstType = converter->getConverterID().second;
                 const auto srcRepr = data.lastValidRepresentation_;
 
+                std::string desc;
+                if (EvaluationProfiler::active()) {
+                    desc = fmt::format("{} -> {}", util::demangle(srcRepr->getTypeIndex().name()),
+                                       util::demangle(dstType.name()));
+                }
+                const EvaluationProfiler::Scope scope{EvaluationProfiler::Category::Conversion,
+                                                      desc};
+
                 if (auto dstRepr = data.findRepr(dstType)) {
                     converter->update(srcRepr, dstRepr);
                     data.lastValidRepresentation_ = dstRepr;
@@ -296,14 +330,18 @@ template <typename Self, typename Repr>
 template <typename T>
 std::shared_ptr<const T> Data<Self, Repr>::getRepresentationShared() const {
     std::scoped_lock lock(mutex_);
-    return getReprInternal<const T>(*static_cast<const Self*>(this));
+    auto repr = getReprInternal<const T>(*static_cast<const Self*>(this));
+    repr->touch();
+    return repr;
 }
 
 template <typename Self, typename Repr>
 template <typename T>
 const T* Data<Self, Repr>::getRepresentation() const {
     std::scoped_lock lock(mutex_);
-    return getReprInternal<const T>(*static_cast<const Self*>(this)).get();
+    auto repr = getReprInternal<const T>(*static_cast<const Self*>(this)).get();
+    repr->touch();
+    return repr;
 }
 
 template <typename Self, typename Repr>
@@ -312,6 +350,7 @@ T* Data<Self, Repr>::getEditableRepresentation() {
     std::scoped_lock lock(mutex_);
     auto repr = getReprInternal<T>(*static_cast<const Self*>(this)).get();
     invalidateAllOtherInternal(repr);
+    repr->touch();
     return repr;
 }
 
@@ -329,6 +368,7 @@ void Data<Self, Repr>::invalidateAllOther(const Repr* repr) {
 }
 template <typename Self, typename Repr>
 void Data<Self, Repr>::invalidateAllOtherInternal(const Repr* repr) {
+    ++modificationCount_;
     bool found = false;
     for (auto& elem : representations_) {
         if (elem.second.get() != repr) {
@@ -347,12 +387,20 @@ void Data<Self, Repr>::invalidateAllOtherInternal(const Repr* repr) {
 template <typename Self, typename Repr>
 void Data<Self, Repr>::clearRepresentations() {
     std::scoped_lock lock(mutex_);
+    ++modificationCount_;
     representations_.clear();
 }
 
+template <typename Self, typename Repr>
+size_t Data<Self, Repr>::getModificationCount() const {
+    std::scoped_lock lock(mutex_);
+    return modificationCount_;
+}
+
 template <typename Self, typename Repr>
 void Data<Self, Repr>::copyRepresentationsTo(Data<Self, Repr>* target) const {
     std::scoped_lock targetLock(mutex_, target->mutex_);
+    ++target->modificationCount_;
     target->representations_.clear();
 
     if (lastValidRepresentation_) {
@@ -376,6 +424,7 @@ std::shared_ptr<Repr> Data<Self, Repr>::addRepresentationInternal(
 template <typename Self, typename Repr>
 void Data<Self, Repr>::addRepresentation(std::shared_ptr<Repr> representation) {
     std::scoped_lock lock(mutex_);
+    ++modificationCount_;
     lastValidRepresentation_ = addRepresentationInternal(std::move(representation));
 }
 
@@ -423,6 +472,31 @@ void Data<Self, Repr>::removeOtherRepresentations(const Repr* representation) {
     std::swap(repr, representations_);
 }
 
+template <typename Self, typename Repr>
+bool Data<Self, Repr>::evictRepresentation(const Repr* representation, const Repr* source) const {
+    std::scoped_lock lock(mutex_);
+
+    const auto isRepr = [](const Repr* repr) {
+        return [repr](const auto& elem) { return elem.second.get() == repr; };
+    };
+    const auto it = std::ranges::find_if(representations_, isRepr(representation));
+    const auto src = std::ranges::find_if(representations_, isRepr(source));
+    if (it == representations_.end() || src == representations_.end() || it == src ||
+        !src->second->isValid()) {
+        return false;
+    }
+
+    // Only representations_ and lastValidRepresentation_ are allowed to reference it
+    const long owners = lastValidRepresentation_ == it->second ? 2 : 1;
+    if (it->second.use_count() > owners) return false;
+
+    if (lastValidRepresentation_ == it->second) {
+        lastValidRepresentation_ = src->second;
+    }
+    representations_.erase(it);
+    return true;
+}
+
 template <typename Self, typename Repr>
 bool Data<Self, Repr>::hasRepresentations() const {
     std::scoped_lock lock(mutex_);
@@ -32,6 +32,8 @@
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/exception.h>
 #include <typeindex>
+#include <atomic>
+#include <chrono>
 
 namespace inviwo {
 
@@ -64,15 +66,38 @@ public:
 
     virtual void updateResource(const ResourceMeta&) const {};
 
+    /**
+     * Mark the representation as used. Called by Data every time the representation is accessed,
+     * the time stamp is used to find the least recently used representations when evicting.
+     * @see Data::evictRepresentation
+     */
+    void touch() const;
+    std::chrono::steady_clock::time_point lastAccess() const;
+
 protected:
     DataRepresentation() = default;
-    DataRepresentation(const DataRepresentation& rhs) = default;
-    DataRepresentation& operator=(const DataRepresentation& that) = default;
+    DataRepresentation(const DataRepresentation& rhs);
+    DataRepresentation& operator=(const DataRepresentation& that);
 
     bool isValid_ = true;
     const Owner* owner_ = nullptr;
+    mutable std::atomic<std::chrono::steady_clock::rep> lastAccess_{0};
 };
 
+template <typename Owner>
+DataRepresentation<Owner>::DataRepresentation(const DataRepresentation& rhs)
+    : isValid_{rhs.isValid_}, owner_{rhs.owner_}, lastAccess_{rhs.lastAccess_.load()} {}
+
+template <typename Owner>
+DataRepresentation<Owner>& DataRepresentation<Owner>::operator=(const DataRepresentation& that) {
+    if (this != &that) {
+        isValid_ = that.isValid_;
+        owner_ = that.owner_;
+        lastAccess_ = that.lastAccess_.load();
+    }
+    return *this;
+}
+
 template <typename Owner>
 void DataRepresentation<Owner>::setOwner(const Owner* owner) {
     owner_ = owner;
@@ -93,4 +118,16 @@ void DataRepresentation<Owner>::setValid(bool valid) {
     isValid_ = valid;
 }
 
+template <typename Owner>
+void DataRepresentation<Owner>::touch() const {
+    lastAccess_.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                      std::memory_order_relaxed);
+}
+
+template <typename Owner>
+std::chrono::steady_clock::time_point DataRepresentation<Owner>::lastAccess() const {
+    return std::chrono::steady_clock::time_point{
+        std::chrono::steady_clock::duration{lastAccess_.load(std::memory_order_relaxed)}};
+}
+
 }  // namespace inviwo
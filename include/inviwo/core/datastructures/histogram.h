@@ -37,6 +37,7 @@
 #include <vector>
 #include <bitset>
 #include <array>
+#include <cstdint>
 
 namespace inviwo {
 enum class HistogramMode : int { Off = 0, All, P99, P95, P90, Log };
@@ -65,14 +66,72 @@ struct IVW_CORE_API Histogram1D {
     Statistics histStats;
 };
 
+/**
+ * Placement of histogram bins within the data range. Log places the bins evenly in
+ * `log(1 + s * t)`, where `t = (value - min) / (max - min)` is the relative position in the
+ * binned range and `s = histogramLogBinningScale`. This gives more resolution to values close to
+ * the lower end, independent of the scale of the data.
+ * @see histogramBinPosition, histogramBinValue
+ */
+enum class HistogramBinning : std::uint8_t { Linear, Log };
+
+/**
+ * The ratio between the widths of the last and the first bin of logarithmic binning is about
+ * `histogramLogBinningScale`.
+ */
+constexpr double histogramLogBinningScale = 1000.0;
+
+/**
+ * Map the relative position @p t in the binned range to the relative bin position according to
+ * @p binning. Both are 0 at the start of the first bin and 1 at the start of the last bin.
+ */
+IVW_CORE_API double histogramBinPosition(HistogramBinning binning, double t);
+
+/**
+ * The inverse of histogramBinPosition, map the relative bin position @p p to the relative
+ * position in the binned range.
+ */
+IVW_CORE_API double histogramBinValue(HistogramBinning binning, double p);
+
+/**
+ * Joint statistics of two aligned data channels
+ */
+struct IVW_CORE_API JointStatistics {
+    size_t count{0};
+    dvec2 min{0.0};
+    dvec2 max{0.0};
+    dvec2 mean{0.0};
+    dvec2 standardDeviation{0.0};
+    double covariance{0.0};
+    double correlation{0.0};
+};
+
+/**
+ * A 2D histogram where `counts[x + y * dimensions.x]` is the count of bin (x, y). The data range
+ * of each `dataMap` goes from the start of the first bin to the start of the last bin. With
+ * HistogramBinning::Log the bins are not evenly spaced within that range, use binEdge or
+ * binEdges to get the data values of the bin edges.
+ */
 struct IVW_CORE_API Histogram2D {
     std::vector<size_t> counts;
     size2_t dimensions{0};
-    size_t totalCounts{0};
+    size_t totalCounts{0};  ///< Number of values included, i.e. not masked out
     size_t maxCount{0};
     std::array<DataMapper,2> dataMap{};
-    size_t underflow{0};
+    size_t underflow{0};  ///< Values below the data range, and NaN values
     size_t overflow{0};
+    std::array<HistogramBinning, 2> binning{HistogramBinning::Linear, HistogramBinning::Linear};
+    JointStatistics statistics{};
+
+    /**
+     * The data value at the start of bin @p bin of dimension @p dim. For
+     * `bin == dimensions[dim]` the end of the last bin is returned.
+     */
+    double binEdge(size_t dim, size_t bin) const;
+    /**
+     * The `dimensions[dim] + 1` data values of the edges of the bins of dimension @p dim
+     */
+    std::vector<double> binEdges(size_t dim) const;
 };
 
 }  // namespace inviwo
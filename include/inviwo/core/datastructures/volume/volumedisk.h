@@ -35,9 +35,30 @@
 #include <inviwo/core/datastructures/volume/volume.h>
 
 #include <filesystem>
+#include <memory>
 
 namespace inviwo {
 
+class VolumeRAM;
+
+/**
+ * \ingroup datastructures
+ * Optional interface for loaders of a VolumeDisk that can read a range of z slices without
+ * reading the whole volume. Makes it possible to extract slices and subsets of large volumes that
+ * are kept on disk. \see VolumeDisk::loadSlices
+ */
+class IVW_CORE_API VolumeSliceLoader {
+public:
+    virtual ~VolumeSliceLoader() = default;
+
+    /**
+     * Read the slices [begin, end) of @p src into a new VolumeRAM with the dimensions
+     * {src.getDimensions().x, src.getDimensions().y, end - begin}
+     */
+    virtual std::shared_ptr<VolumeRAM> loadSlices(const VolumeRepresentation& src, size_t begin,
+                                                  size_t end) const = 0;
+};
+
 /**
  * \ingroup datastructures
  */
@@ -83,6 +104,17 @@ public:
     virtual void setWrapping(const Wrapping3D& wrapping) override;
     virtual Wrapping3D getWrapping() const override;
 
+    /**
+     * True if the loader implements VolumeSliceLoader
+     */
+    bool canLoadSlices() const;
+
+    /**
+     * Read only the z slices [begin, end) from disk using the VolumeSliceLoader of the loader.
+     * Returns nullptr if the loader does not support reading slices. \see canLoadSlices
+     */
+    std::shared_ptr<VolumeRAM> loadSlices(size_t begin, size_t end) const;
+
 private:
     const DataFormatBase* dataFormatBase_;
     size3_t dimensions_;
@@ -0,0 +1,95 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <vector>
+
+class TiXmlDocument;
+
+namespace inviwo {
+
+/**
+ * A compact binary encoding of the XML documents written by the Serializer. Intended for
+ * snapshots of the network state, like undo states and session persistence, where the content is
+ * written and read by Inviwo and never edited by hand.
+ *
+ * The encoding stores
+ *   - a header with a magic number and a format version,
+ *   - the nodes of the document, where elements store their attributes followed by a length
+ *     prefixed list of children, which makes it possible to skip a subtree without decoding it,
+ *   - every name and string value only once, later occurrences refer back to the first one,
+ *   - attribute values that are integers or floating point numbers in binary form,
+ *   - runs of sibling elements with a single numeric attribute, as written for containers of
+ *     numbers, as packed numeric arrays.
+ *
+ * Numbers are only stored in binary form if formatting the binary value gives back the exact
+ * same text, hence a document can be converted to the binary form and back to XML without any
+ * loss.
+ */
+namespace binaryxml {
+
+/**
+ * Returns true if data starts with the header of the binary encoding.
+ */
+IVW_CORE_API bool isBinary(std::span<const std::byte> data);
+
+/**
+ * Encode the XML document doc and append the result to data.
+ */
+IVW_CORE_API void encode(const TiXmlDocument& doc, std::pmr::vector<std::byte>& data);
+
+/**
+ * Decode data and append the decoded nodes to doc.
+ * @throw Exception if data is not a valid binary encoding.
+ */
+IVW_CORE_API void decode(std::span<const std::byte> data, TiXmlDocument& doc);
+
+/**
+ * Convert the binary encoded data to XML and append it to xml.
+ * @throw Exception if data is not a valid binary encoding.
+ */
+IVW_CORE_API void toXML(std::span<const std::byte> data, std::pmr::string& xml,
+                        bool format = false);
+
+/**
+ * Parse xml and append its binary encoding to data.
+ * @throw Exception if xml could not be parsed.
+ */
+IVW_CORE_API void fromXML(const std::pmr::string& xml, std::pmr::vector<std::byte>& data);
+
+}  // namespace binaryxml
+
+}  // namespace inviwo
@@ -53,6 +53,7 @@
 #include <filesystem>
 #include <optional>
 #include <concepts>
+#include <span>
 
 #include <fmt/base.h>
 
@@ -160,7 +161,8 @@ concept IndexableFunctions = requires(T& t, Functions f, size_t i, std::string_v
 template <typename K, typename T, typename Functions>
 concept MappableFunctions = requires(const K& k, T& t, Functions f, size_t i, std::string_view s) {
     { std::invoke(f.idTransform, s) } -> std::same_as<K>;
-    { std::invoke(f.makeNew) } -> std::same_as<T>;
+    requires std::is_invocable_r_v<T, decltype(f.makeNew)> ||
+                 std::is_invocable_r_v<T, decltype(f.makeNew), const K&>;
     { std::invoke(f.shouldMakeNew, k) } -> std::same_as<bool>;
     { std::invoke(f.canRecreate, k) } -> std::same_as<bool>;
     { std::invoke(f.onNew, k, t) };
@@ -223,6 +225,17 @@ public:
                           std::string_view rootElement = SerializeConstants::InviwoWorkspace,
                           allocator_type alloc = {});
 
+    /**
+     * @brief Deserialize content in the compact binary format, \see binaryxml.
+     * @param data Binary encoded content that is to be deserialized.
+     * @param refPath Used to calculate paths relative to the data source if any.
+     * @param rootElement Name of the root element to use (default: InviwoWorkspace).
+     * @param alloc Allocator to use for memory resources.
+     */
+    explicit Deserializer(std::span<const std::byte> data, const std::filesystem::path& refPath,
+                          std::string_view rootElement = SerializeConstants::InviwoWorkspace,
+                          allocator_type alloc = {});
+
     Deserializer(const Deserializer&) = delete;
     Deserializer(Deserializer&&) = default;
     Deserializer& operator=(const Deserializer& that) = delete;
@@ -339,6 +352,10 @@ public:
     void deserialize(std::string_view key, C& container, std::string_view itemKey,
                      deserializer::IdentifierFunctions<Funcs...> f);
 
+    /**
+     * Deserialize a map like container. The `makeNew` function can optionally take the key of
+     * the new item, that makes it possible to hand out objects that have been created upfront.
+     */
     template <typename C, typename K = typename C::key_type, typename T = typename C::mapped_type,
               typename... Funcs>
         requires deserializer::MappableFunctions<K, T, deserializer::MapFunctions<Funcs...>>
@@ -870,7 +887,13 @@ void Deserializer::deserialize(std::string_view key, C& container, std::string_v
     }
 
     const auto newItem = [&f, &itemKey, this](const K& key) {
-        T newItem = f.makeNew();
+        T newItem = [&]() {
+            if constexpr (std::is_invocable_r_v<T, decltype(f.makeNew), const K&>) {
+                return f.makeNew(key);
+            } else {
+                return f.makeNew();
+            }
+        }();
         deserializeNoRecreate(itemKey, newItem);
         f.onNew(key, newItem);
     };
@@ -40,6 +40,7 @@
 #include <flags/flags.h>
 
 #include <type_traits>
+#include <functional>
 #include <list>
 #include <bitset>
 #include <vector>
@@ -48,9 +49,12 @@
 #include <unordered_map>
 #include <map>
 #include <memory>
+#include <memory_resource>
 
 namespace inviwo {
 
+class PropertyOwner;
+
 enum class WorkspaceSaveMode : int { Disk = 1 << 0, Undo = 1 << 1 };
 ALLOW_FLAGS_FOR_ENUM(WorkspaceSaveMode)
 using WorkspaceSaveModes = flags::flags<WorkspaceSaveMode>;
@@ -99,6 +103,15 @@ public:
 
     void write(std::pmr::string& xml, bool format = false);
 
+    /**
+     * \brief Writes serialized data in the compact binary format, \see binaryxml.
+     * The data can be deserialized using the Deserializer or converted back to xml without loss.
+     *
+     * @param data Vector to append the encoded data to.
+     * @throws SerializationException
+     */
+    void write(std::pmr::vector<std::byte>& data);
+
     // std containers
     template <typename T, typename Alloc, typename Pred = util::alwaysTrue,
               typename Proj = util::identity>
@@ -205,6 +218,19 @@ public:
     void setWorkspaceSaveMode(WorkspaceSaveMode mode) { workspaceSaveMode_ = mode; }
     WorkspaceSaveMode getWorkspaceSaveMode() const { return workspaceSaveMode_; }
 
+    using PropertyOwnerFilter = std::function<bool(const PropertyOwner&)>;
+    /**
+     * Only serialize the properties of the PropertyOwners for which the filter returns true,
+     * other owners are written without any properties. An empty filter serializes everything.
+     * Makes it possible to serialize the structure of a network without the property values.
+     */
+    void setPropertyOwnerFilter(PropertyOwnerFilter filter) {
+        propertyOwnerFilter_ = std::move(filter);
+    }
+    bool serializeProperties(const PropertyOwner& owner) const {
+        return !propertyOwnerFilter_ || propertyOwnerFilter_(owner);
+    }
+
 protected:
     friend class NodeSwitch;
     TiXmlElement* getLastChild() const;
@@ -212,6 +238,7 @@ protected:
     static std::pmr::string& addAttribute(TiXmlElement* node, std::string_view key);
 
     WorkspaceSaveMode workspaceSaveMode_ = WorkspaceSaveMode::Disk;
+    PropertyOwnerFilter propertyOwnerFilter_;
 };
 
 template <typename T, typename Alloc, typename Pred, typename Proj>
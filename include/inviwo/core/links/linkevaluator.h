@@ -33,6 +33,7 @@
 #include <inviwo/core/processors/processorpair.h>
 #include <inviwo/core/links/propertylink.h>
 
+#include <chrono>
 #include <unordered_map>
 #include <vector>
 
@@ -57,10 +58,49 @@ class IVW_CORE_API LinkEvaluator {
 public:
     using ProcessorLinkMap = std::unordered_map<ProcessorPair, std::vector<PropertyLink>>;
 
+    /**
+     * Counters for the link evaluation, accumulated until resetStats() is called
+     */
+    struct Stats {
+        size_t evaluations = 0;  ///< Number of propagated property changes
+        size_t conversions = 0;  ///< Number of applied property converters
+        size_t coalesced = 0;    ///< Number of conversions avoided by batching
+        std::chrono::steady_clock::duration time{};  ///< Time spent propagating changes
+    };
+
     LinkEvaluator(ProcessorNetwork* network);
 
+    /**
+     * Propagate the value of the given property to all properties that are linked to it. In
+     * batched mode, and if the network is locked, the property is only recorded and the
+     * propagation is done in flushBatch() when the network is unlocked.
+     */
     void evaluateLinksFromProperty(Property*);
 
+    /**
+     * Enable or disable batched link propagation. When batched, changes that happen while the
+     * network is locked, for example during an animation frame or a camera interaction, are
+     * collected and propagated once when the network gets unlocked. Every destination property
+     * is then set only once, from the last modified property linked to it, instead of once for
+     * every change. Disabled by default.
+     */
+    void setBatched(bool batched);
+    bool isBatched() const;
+
+    /**
+     * Propagate all collected changes. Walks the modified properties from the latest to the
+     * first and keeps the first link found for each destination, properties that were set later
+     * are never overwritten by earlier changes. The converters are then applied in propagation
+     * order under a single network lock, changes made by the propagation are flushed under the
+     * same lock. Called by the ProcessorNetwork when it is unlocked, which notifies its observers
+     * once the flush is done.
+     */
+    void flushBatch();
+    bool hasPendingChanges() const;
+
+    const Stats& getStats() const;
+    void resetStats();
+
     /**
      * Properties that are linked to the given property where the given property is a source
      * property
@@ -98,6 +138,11 @@ private:
 
     // Used to make sure we don't end up in circular links
     std::vector<Property*> visited_;
+
+    // Modified properties waiting to be propagated in batched mode, in order of modification
+    std::vector<Property*> pending_;
+    bool batched_ = false;
+    Stats stats_;
 };
 
 }  // namespace inviwo
@@ -41,6 +41,7 @@
 #include <inviwo/core/util/observer.h>
 #include <inviwo/core/util/exception.h>
 #include <inviwo/core/util/iterrange.h>
+#include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/transformiterator.h>
 
 #include <string_view>
@@ -418,6 +419,8 @@ public:
     static int getVersion();
 
     void evaluateLinksFromProperty(Property*);
+    LinkEvaluator& getLinkEvaluator();
+    const LinkEvaluator& getLinkEvaluator() const;
 
     bool isEmpty() const;
     bool isInvalidating() const;
@@ -484,6 +487,7 @@ private:
     static const int processorNetworkVersion_;
 
     unsigned int locked_ = 0;
+    bool flushingLinks_ = false;
     bool deserializing_ = false;
     int backgoundJobs_ = 0;
 
@@ -529,7 +533,15 @@ void ProcessorNetwork::forEachLink(C callback) {
 inline void ProcessorNetwork::lock() { locked_++; }
 inline void ProcessorNetwork::unlock() {
     (locked_ > 0) ? locked_-- : locked_ = 0;
-    if (locked_ == 0) notifyObserversProcessorNetworkUnlocked();
+    if (locked_ == 0 && !flushingLinks_) {
+        // Propagate the property changes collected while locked in batched link mode. The flush
+        // locks the network itself, the observers are only notified once it is done.
+        if (linkEvaluator_.hasPendingChanges()) {
+            const util::KeepTrueWhileInScope flushing{&flushingLinks_};
+            linkEvaluator_.flushBatch();
+        }
+        notifyObserversProcessorNetworkUnlocked();
+    }
 }
 inline bool ProcessorNetwork::islocked() const { return (locked_ != 0); }
 
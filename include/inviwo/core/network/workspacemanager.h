@@ -34,6 +34,7 @@
 #include <inviwo/core/util/exception.h>
 #include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/io/serialization/serializable.h>
+#include <inviwo/core/io/serialization/serializer.h>
 #include <inviwo/core/util/inviwosetupinfo.h>
 
 #include <iostream>
@@ -41,6 +42,8 @@
 #include <vector>
 #include <functional>
 #include <filesystem>
+#include <memory_resource>
+#include <span>
 
 namespace inviwo {
 
@@ -122,6 +125,22 @@ public:
               const ExceptionHandler& exceptionHandler = StandardExceptionHandler(),
               WorkspaceSaveMode mode = WorkspaceSaveMode::Disk);
 
+    /**
+     * Save the current workspace in the compact binary format, \see binaryxml. Useful for
+     * snapshots of the network state that are not meant to be edited by hand.
+     * @param data the vector to append the encoded workspace to.
+     * @param refPath a reference that can be use by the serializer to store relative paths.
+     *      The same refPath should be given when loading.
+     * @param exceptionHandler A callback for handling errors.
+     * @param mode to indicate if we are saving to disk or undo-stack
+     * @param filter only serialize the properties of the owners accepted by the filter,
+     *      \see Serializer::setPropertyOwnerFilter
+     */
+    void save(std::pmr::vector<std::byte>& data, const std::filesystem::path& refPath,
+              const ExceptionHandler& exceptionHandler = StandardExceptionHandler(),
+              WorkspaceSaveMode mode = WorkspaceSaveMode::Disk,
+              Serializer::PropertyOwnerFilter filter = {});
+
     /**
      * Save the current workspace to a file
      * @param path the file to save into.
@@ -158,6 +177,18 @@ public:
               const ExceptionHandler& exceptionHandler = StandardExceptionHandler(),
               WorkspaceSaveMode mode = WorkspaceSaveMode::Disk);
 
+    /**
+     * Load a workspace saved in the compact binary format, \see binaryxml.
+     * @param data the binary encoded workspace.
+     * @param refPath a reference that can be use by the deserializer to calculate relative
+     *      paths. The same refPath should be given when loading.
+     * @param exceptionHandler A callback for handling errors.
+     * @param mode to indicate if we are saving to disk or undo-stack
+     */
+    void load(std::span<const std::byte> data, const std::filesystem::path& refPath,
+              const ExceptionHandler& exceptionHandler = StandardExceptionHandler(),
+              WorkspaceSaveMode mode = WorkspaceSaveMode::Disk);
+
     /**
      * Load a workspace from a file
      * @param path the file to read from.
@@ -220,6 +251,14 @@ public:
         Logger* logger = LogCentral::getPtr(),
         std::pmr::polymorphic_allocator<std::byte> alloc = {}) const;
 
+    /**
+     *	Create a deserializer for a binary encoded workspace, and apply all needed version updates.
+     */
+    std::pair<Deserializer, InviwoSetupInfo> createWorkspaceDeserializerAndInfo(
+        std::span<const std::byte> data, const std::filesystem::path& refPath,
+        Logger* logger = LogCentral::getPtr(),
+        std::pmr::polymorphic_allocator<std::byte> alloc = {}) const;
+
     using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
 
 private:
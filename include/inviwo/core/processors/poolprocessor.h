@@ -170,6 +170,11 @@ public:
      */
     bool hasJobs();
 
+    /**
+     * Are there any ongoing background jobs or jobs waiting to be submitted
+     */
+    bool hasPendingJobs() const;
+
     /**
      * Dispatch a single background job. The job will be executed in a background thread in
      * the thread pool. It is important that the job captures its state by value, since it might
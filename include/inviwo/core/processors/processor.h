@@ -53,6 +53,7 @@ class ProcessorWidget;
 class ProcessorNetwork;
 class NetworkVisitor;
 class InviwoApplication;
+class ProcessorResultCache;
 
 /**
  * \defgroup processors Processors
@@ -436,6 +437,12 @@ public:
      */
     virtual void accept(NetworkVisitor& visitor);
 
+    /**
+     * The result cache of the processor if it opted in to memoization of its outport data,
+     * otherwise nullptr. @see ProcessorResultCache
+     */
+    ProcessorResultCache* getResultCache() const;
+
 protected:
     std::unique_ptr<ProcessorWidget> processorWidget_;
     StateCoordinator<ProcessorStatus> isReady_;
@@ -475,9 +482,13 @@ private:
 
     NameDispatcher identifierDispatcher_;
     NameDispatcher displayNameDispatcher_;
+
+    friend ProcessorResultCache;
+    ProcessorResultCache* resultCache_ = nullptr;
 };
 
 inline ProcessorNetwork* Processor::getNetwork() const { return network_; }
+inline ProcessorResultCache* Processor::getResultCache() const { return resultCache_; }
 
 template <typename T, typename std::enable_if_t<std::is_base_of<Inport, T>::value, int>>
 T& Processor::addPort(std::unique_ptr<T> port, std::string_view portGroup) {
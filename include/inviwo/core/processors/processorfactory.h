@@ -60,6 +60,12 @@ public:
 
     virtual bool hasKey(std::string_view key) const override;
 
+    /**
+     * Returns true if the processor registered for key can be created concurrently from a worker
+     * thread. \see ProcessorFactoryObject::isThreadSafe
+     */
+    bool isThreadSafe(std::string_view key) const;
+
 private:
     InviwoApplication* app_;
 };
@@ -66,6 +66,12 @@ public:
      */
     virtual Document getMetaInformation() const { return Document(); }
 
+    /**
+     * Returns true if create() can be called concurrently from a worker thread. When loading a
+     * workspace such processors are created in parallel on the thread pool. Defaults to false.
+     */
+    virtual bool isThreadSafe() const { return false; }
+
     const std::string& getTypeName() const { return typeName_; }
 
 private:
@@ -73,6 +79,24 @@ private:
     std::string typeName_;
 };
 
+namespace detail {
+
+/**
+ * A processor can opt in to be constructed from a worker thread by declaring
+ * `static constexpr bool threadSafeConstruction = true;`. That requires that the constructor
+ * does not touch any OpenGL state or other state owned by the main thread.
+ */
+template <typename T>
+constexpr bool isThreadSafeConstructible() {
+    if constexpr (requires { T::threadSafeConstruction; }) {
+        return T::threadSafeConstruction;
+    } else {
+        return false;
+    }
+}
+
+}  // namespace detail
+
 #include <warn/push>
 #include <warn/ignore/unused-parameter>
 template <typename T>
@@ -106,6 +130,8 @@ public:
         if (p->getDisplayName().empty()) p->setDisplayName(getDisplayName());
         return p;
     }
+
+    virtual bool isThreadSafe() const override { return detail::isThreadSafeConstructible<T>(); }
 };
 #include <warn/pop>
 
@@ -0,0 +1,224 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/ports/datainport.h>
+#include <inviwo/core/ports/dataoutport.h>
+#include <glm/gtx/component_wise.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace inviwo {
+
+class Processor;
+
+namespace detail {
+
+/**
+ * Estimate the memory footprint of a data object, used to bound the size of a
+ * ProcessorResultCache.
+ */
+template <typename T>
+size_t estimateSizeInBytes(const T& data) {
+    if constexpr (requires {
+                      data.getDimensions();
+                      data.getDataFormat()->getSizeInBytes();
+                  }) {
+        return glm::compMul(data.getDimensions()) * data.getDataFormat()->getSizeInBytes();
+    } else if constexpr (requires { data.getSizeInBytes(); }) {
+        return data.getSizeInBytes();
+    } else if constexpr (requires {
+                             data.getBuffers();
+                             data.getIndexBuffers();
+                         }) {
+        size_t size = 0;
+        for (const auto& item : data.getBuffers()) size += item.second->getSizeInBytes();
+        for (const auto& item : data.getIndexBuffers()) size += item.second->getSizeInBytes();
+        return size;
+    } else {
+        return sizeof(T);
+    }
+}
+
+}  // namespace detail
+
+/**
+ * \ingroup processors
+ * An opt-in, in-memory memoization of the outport data of a processor.
+ *
+ * The cache key is a hash of the serialized property state of the processor combined with the
+ * identities of the data on the registered inports. On evaluation the ProcessorNetworkEvaluator
+ * will first look for the key in the cache, on a hit the cached data is set on the registered
+ * outports and process() is not called. On a miss process() is called as usual and the resulting
+ * outport data is added to the cache. Entries also keep the serialized state, which is compared
+ * on a match, so a hash collision never restores the results of other property values. The cache
+ * is bounded by the size in bytes of the cached data and the least recently used results are
+ * dropped first.
+ *
+ * Computing the key serializes the properties of the processor on every evaluation, also when
+ * the cache is empty. The cache therefore only pays off for processors whose process() is
+ * expensive compared to that.
+ *
+ * Only processors whose outport data is fully determined by their properties and inport data
+ * should use the cache. Any other state that affects the result has to be handled by calling
+ * clear() when it changes. Processors that set their outport data asynchronously, like the
+ * PoolProcessor, can not use the cache.
+ *
+ * Cached results are shared with the outports again on a hit, so the processor must create new
+ * outport data in every call to process() and never modify data after it was set on an outport.
+ * Results whose data is still referenced by anyone but the outport when store() is called, for
+ * example by a member of the processor that is reused between evaluations, are not cached.
+ * ```{.cpp}
+ * MyProcessor::MyProcessor()
+ *     : Processor{}
+ *     , inport_{"inport"}
+ *     , outport_{"outport"}
+ *     , cache_{this, 512 * 1024 * 1024} {
+ *     addPorts(inport_, outport_);
+ *     cache_.addPorts(inport_, outport_);
+ * }
+ * ```
+ */
+class IVW_CORE_API ProcessorResultCache {
+public:
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+        size_t skipped = 0;  ///< Results not cached since their data was still referenced
+    };
+
+    explicit ProcessorResultCache(Processor* processor, size_t capacity = 256 * 1024 * 1024);
+    ProcessorResultCache(const ProcessorResultCache&) = delete;
+    ProcessorResultCache(ProcessorResultCache&&) = delete;
+    ProcessorResultCache& operator=(const ProcessorResultCache&) = delete;
+    ProcessorResultCache& operator=(ProcessorResultCache&&) = delete;
+    ~ProcessorResultCache();
+
+    /**
+     * Register inports and outports. The data identities of all registered inports are part of
+     * the cache key, and the data of all registered outports is cached.
+     */
+    template <typename... Ports>
+    void addPorts(Ports&... ports) {
+        (addPort(ports), ...);
+    }
+
+    template <typename T, size_t N, bool Flat>
+    void addPort(DataInport<T, N, Flat>& port);
+    template <typename T>
+    void addPort(DataOutport<T>& port);
+
+    /**
+     * Look for the current state in the cache and set the outport data on a hit.
+     * @return true on a cache hit
+     */
+    bool restore();
+    /**
+     * Store the current outport data using the key from the last call to restore(). Nothing is
+     * stored if the data of any outport is referenced by anything but the outport.
+     */
+    void store();
+
+    void clear();
+    void setCapacity(size_t bytes);
+    size_t getCapacity() const;
+    const Stats& getStats() const;
+
+private:
+    struct Input {
+        std::function<void(std::vector<std::shared_ptr<const void>>&)> collect;
+    };
+    struct Output {
+        std::function<std::shared_ptr<const void>()> get;
+        std::function<void(std::shared_ptr<const void>)> set;
+        std::function<size_t(const void*)> size;
+    };
+    struct Entry {
+        size_t key;
+        std::string state;
+        std::vector<std::weak_ptr<const void>> inputs;
+        std::vector<std::shared_ptr<const void>> outputs;
+        size_t bytes;
+    };
+
+    size_t propertyHash();
+    std::list<Entry>::iterator find(size_t key, std::string_view state,
+                                    const std::vector<std::shared_ptr<const void>>& inputs);
+    void trim(size_t capacity);
+
+    Processor* processor_;
+    size_t capacity_;
+    std::vector<Input> inputs_;
+    std::vector<Output> outputs_;
+
+    std::list<Entry> lru_;  // most recently used first
+    std::unordered_multimap<size_t, std::list<Entry>::iterator> entries_;
+
+    std::optional<size_t> pendingKey_;
+    std::vector<std::shared_ptr<const void>> pendingInputs_;
+    std::pmr::string xml_;
+    Stats stats_;
+};
+
+template <typename T, size_t N, bool Flat>
+void ProcessorResultCache::addPort(DataInport<T, N, Flat>& port) {
+    inputs_.push_back(Input{[&port](std::vector<std::shared_ptr<const void>>& data) {
+        for (auto&& item : port.getVectorData()) {
+            data.push_back(std::move(item));
+        }
+    }});
+}
+
+template <typename T>
+void ProcessorResultCache::addPort(DataOutport<T>& port) {
+    outputs_.push_back(
+        Output{.get = [&port]() -> std::shared_ptr<const void> { return port.getData(); },
+               .set = [&port](std::shared_ptr<const void> data) {
+                   port.setData(std::static_pointer_cast<const T>(std::move(data)));
+               },
+               .size = [](const void* data) {
+                   return detail::estimateSizeInBytes(*static_cast<const T*>(data));
+               }});
+}
+
+}  // namespace inviwo
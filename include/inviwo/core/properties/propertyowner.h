@@ -160,6 +160,19 @@ public:
     virtual const PropertyOwner* getOwner() const;
     virtual PropertyOwner* getOwner();
 
+    /**
+     * A counter that is incremented every time a property of this owner, or of any owner below
+     * it, is modified, added, or removed. Can be compared against a previously stored value to
+     * find out whether the serialized state of the properties might have changed, without having
+     * to serialize them.
+     */
+    size_t getModificationCount() const;
+    /**
+     * Increment the modification count of this owner and of all owners above it.
+     * Called by the properties when they are modified.
+     */
+    void markModified();
+
     virtual void serialize(Serializer& s) const override;
     virtual void deserialize(Deserializer& d) override;
 
@@ -197,6 +210,7 @@ private:
     void insertPropertyImpl(iterator it, Property* property, bool owner);
     Property* removePropertyImpl(iterator it);
     InvalidationLevel invalidationLevel_;
+    size_t modificationCount_ = 0;
 };
 
 template <std::derived_from<Property> T>
@@ -36,6 +36,11 @@
 #include <string_view>
 #include <cstdint>
 #include <optional>
+#include <functional>
+#include <memory>
+#include <chrono>
+#include <atomic>
+#include <string>
 
 namespace inviwo {
 
@@ -73,6 +78,62 @@ struct IVW_CORE_API PY {
     static constexpr std::string_view name = "PY";
 };
 
+/**
+ * An Evictable describes how a resource can be released when the ResourceManager is over budget.
+ * @see makeEvictable
+ */
+struct IVW_CORE_API Evictable {
+    /// Time of last use or std::nullopt if the resource no longer can be evicted
+    std::function<std::optional<std::chrono::steady_clock::time_point>()> lastAccess;
+    /// Try to release the resource, returns true on success
+    std::function<bool()> evict;
+};
+
+/**
+ * Create an Evictable for the data representation @p repr that can be recreated from @p source.
+ * Only weak references are kept, hence an expired representation is never evicted.
+ * @see Data::evictRepresentation
+ */
+template <typename Repr>
+Evictable makeEvictable(std::weak_ptr<const Repr> repr, std::weak_ptr<const Repr> source) {
+    return Evictable{
+        .lastAccess = [repr]() -> std::optional<std::chrono::steady_clock::time_point> {
+            if (auto r = repr.lock()) return r->lastAccess();
+            return std::nullopt;
+        },
+        .evict =
+            [repr, source]() {
+                const typename Repr::ReprOwner* owner = nullptr;
+                const Repr* reprPtr = nullptr;
+                const Repr* sourcePtr = nullptr;
+                if (auto r = repr.lock()) {
+                    owner = r->getOwner();
+                    reprPtr = r.get();
+                }
+                if (auto s = source.lock()) {
+                    sourcePtr = s.get();
+                }
+                // The locks have to be released here, otherwise the use count check will fail
+                return owner && sourcePtr && owner->evictRepresentation(reprPtr, sourcePtr);
+            }};
+}
+
+/**
+ * Statistics of a ResourcePool. The statistics are shared with the ResourceManager, the counters
+ * are atomic since the pool can be used from any thread.
+ * @see ResourcePool
+ */
+struct IVW_CORE_API PoolStats {
+    explicit PoolStats(std::string_view aName) : name{aName} {}
+    std::string name;
+    std::atomic<size_t> items{0};      ///< Number of items in the pool
+    std::atomic<size_t> bytes{0};      ///< Bytes held by the pool
+    std::atomic<size_t> budget{0};     ///< Budget in bytes
+    std::atomic<size_t> hits{0};       ///< Number of requests served by a pooled item
+    std::atomic<size_t> misses{0};     ///< Number of requests that required a new item
+    std::atomic<size_t> evictions{0};  ///< Number of items evicted to stay within budget
+};
+
 IVW_CORE_API RAM toRAM(const void* ptr);
 
 template <typename T>
@@ -84,16 +145,22 @@ IVW_CORE_API void add(const RAM& key, Resource resource);
 IVW_CORE_API void move(const RAM& oldKey, const RAM& newKey, Resource resource);
 IVW_CORE_API void remove(const RAM& key);
 IVW_CORE_API void meta(const RAM& key, const ResourceMeta& meta);
+IVW_CORE_API void evictable(const RAM& key, Evictable evictable);
 
 IVW_CORE_API void add(const GL& key, Resource resource);
 IVW_CORE_API void move(const GL& oldKey, const GL& newKey, Resource resource);
 IVW_CORE_API void remove(const GL& key);
 IVW_CORE_API void meta(const GL& key, const ResourceMeta& meta);
+IVW_CORE_API void evictable(const GL& key, Evictable evictable);
 
 IVW_CORE_API void add(const PY& key, Resource resource);
 IVW_CORE_API void move(const PY& oldKey, const PY& newKey, Resource resource);
 IVW_CORE_API void remove(const PY& key);
 IVW_CORE_API void meta(const PY& key, const ResourceMeta& meta);
+IVW_CORE_API void evictable(const PY& key, Evictable evictable);
+
+IVW_CORE_API void addPool(std::shared_ptr<const PoolStats> stats);
+IVW_CORE_API void removePool(const PoolStats* stats);
 
 }  // namespace resource
 
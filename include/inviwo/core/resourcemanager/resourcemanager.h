@@ -35,12 +35,19 @@
 #include <inviwo/core/util/foreacharg.h>
 #include <inviwo/core/util/stdextensions.h>
 
+#include <algorithm>
+#include <functional>
 #include <unordered_map>
 #include <tuple>
 #include <variant>
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace inviwo {
 
+class Delay;
+
 class IVW_CORE_API ResourceManager : public ResourceManagerObservable {
 public:
     using Keys = std::tuple<resource::RAM, resource::GL, resource::PY>;
@@ -50,7 +57,27 @@ public:
     using Var = std::variant<std::monostate, const std::vector<std::pair<resource::RAM, Resource>>*,
                              const std::vector<std::pair<resource::GL, Resource>>*,
                              const std::vector<std::pair<resource::PY, Resource>>*>;
+    using Evictables = std::tuple<std::unordered_map<resource::RAM, resource::Evictable>,
+                                  std::unordered_map<resource::GL, resource::Evictable>,
+                                  std::unordered_map<resource::PY, resource::Evictable>>;
     static constexpr std::array<std::string_view, 3> names = {"RAM", "GL", "PY"};
+    static constexpr size_t groups = std::tuple_size_v<Keys>;
+
+    ResourceManager();
+    ResourceManager(const ResourceManager&) = delete;
+    ResourceManager& operator=(const ResourceManager&) = delete;
+    ~ResourceManager();
+
+    /**
+     * Usage statistics of a resource group
+     */
+    struct Stats {
+        size_t usage = 0;         ///< Bytes currently in use
+        size_t peakUsage = 0;     ///< Highest number of bytes in use
+        size_t budget = 0;        ///< Budget in bytes, 0 means unlimited
+        size_t evictions = 0;     ///< Number of evicted resources
+        size_t evictedBytes = 0;  ///< Total number of bytes evicted
+    };
 
     template <typename Key>
     void add(const Key& key, Resource resource) {
@@ -59,21 +86,43 @@ public:
         auto it = std::ranges::find(group, key, &std::pair<Key, Resource>::first);
         if (it == group.end()) {
             notifyWillAddResource(gi, group.size(), resource);
+            addUsage(gi, resource.sizeInBytes());
             group.emplace_back(key, std::move(resource));
             notifyDidAddResource(gi, group.size() - 1, group.back().second);
         } else {
             if (!resource.meta && it->second.meta) resource.meta = std::move(it->second.meta);
             notifyWillUpdateResource(gi, std::distance(group.begin(), it), it->second);
+            stats_[gi].usage -= it->second.sizeInBytes();
+            addUsage(gi, resource.sizeInBytes());
             it->second = std::move(resource);
             notifyDidUpdateResource(gi, std::distance(group.begin(), it), it->second);
         }
+        if (overBudget(gi)) scheduleEnforceBudget();
     }
 
     template <typename Key>
     void move(const Key& oldKey, const Key& newKey, Resource resource) {
+        auto& evictables = std::get<std::unordered_map<Key, resource::Evictable>>(evictables_);
+        auto evictable = evictables.extract(oldKey);
         auto old = remove(oldKey);
         if (!resource.meta && old) resource.meta = std::move(old->meta);
         add(newKey, std::move(resource));
+        if (!evictable.empty()) {
+            evictable.key() = newKey;
+            evictables.insert(std::move(evictable));
+        }
+    }
+
+    /**
+     * Register an Evictable for the resource @p key. When the group of the resource is over its
+     * budget, evictables are released in least recently used order. The evictable is
+     * unregistered when the resource is removed.
+     * @see setBudget, resource::makeEvictable
+     */
+    template <typename Key>
+    void evictable(const Key& key, resource::Evictable evictable) {
+        std::get<std::unordered_map<Key, resource::Evictable>>(evictables_)[key] =
+            std::move(evictable);
     }
 
     template <typename Key>
@@ -94,9 +143,11 @@ public:
         constexpr auto gi = groupIndex<Key>();
         auto& group = get<Key>();
         auto it = std::ranges::find(group, key, &std::pair<Key, Resource>::first);
+        std::get<std::unordered_map<Key, resource::Evictable>>(evictables_).erase(key);
         if (it != group.end()) {
             notifyWillRemoveResource(gi, std::distance(group.begin(), it), it->second);
             Resource resource{std::move(it->second)};
+            stats_[gi].usage -= resource.sizeInBytes();
             it = group.erase(it);
             notifyDidRemoveResource(gi, std::distance(group.begin(), it), resource);
             return resource;
@@ -115,19 +166,61 @@ public:
                           getGroup(groupIndex));
     }
 
-#include <warn/push>
-#include <warn/ignore/unused-but-set-variable>
     size_t totalByteSize(size_t groupIndex) const {
-        static constexpr auto byteSize = [](const auto& elem) { return elem.second.sizeInBytes(); };
-        static constexpr auto sum = [](const auto& vec) {
-            return std::transform_reduce(vec->begin(), vec->end(), size_t{0}, std::plus<>(),
-                                         byteSize);
-        };
-        return std::visit(util::overloaded{[](std::monostate) -> size_t { return 0; },
-                                           [](const auto& list) -> size_t { return sum(list); }},
-                          getGroup(groupIndex));
+        return groupIndex < groups ? stats_[groupIndex].usage : 0;
+    }
+
+    /**
+     * Set the memory budget in bytes of a resource group, 0 means unlimited. When the total size
+     * of the group exceeds the budget, registered evictables are released in least recently used
+     * order until the group is within budget again.
+     * @see evictable, enforceBudget
+     */
+    void setBudget(size_t groupIndex, size_t bytes);
+    size_t getBudget(size_t groupIndex) const;
+
+    const Stats& getStats(size_t groupIndex) const { return stats_.at(groupIndex); }
+
+    /**
+     * Evict least recently used resources of a group until it is within budget.
+     * Has to be called from the main thread.
+     * @return the number of bytes evicted
+     */
+    size_t enforceBudget(size_t groupIndex);
+    /**
+     * Enforce the budgets of all groups.
+     * @return the number of bytes evicted
+     */
+    size_t enforceBudgets();
+
+    /**
+     * Set a callback reporting whether resources might currently be in use through raw pointers,
+     * which evictables cannot detect. Exceeding a budget schedules an enforcement on the main
+     * thread, which is postponed while the callback returns true. The InviwoApplication reports
+     * busy while the network is evaluating or any background jobs are running. To keep memory
+     * bounded during continuous evaluation, like playback, enforcement is only postponed
+     * maxBusyRetries times, and not at all once a group uses more than hardLimitFactor times its
+     * budget. Calling enforceBudget or enforceBudgets directly is not affected.
+     * @see Data::evictRepresentation
+     */
+    void setBusyCallback(std::function<bool()> busy);
+
+    /// Number of times a scheduled enforcement is postponed while busy, 100 ms apart
+    static constexpr size_t maxBusyRetries = 50;
+    /// Usage relative to the budget at which a scheduled enforcement is no longer postponed
+    static constexpr double hardLimitFactor = 1.5;
+
+    /**
+     * Register the statistics of a ResourcePool to make them visible in the resource manager.
+     * The statistics are kept alive until the pool is removed.
+     * @see ResourcePool
+     */
+    void addPool(std::shared_ptr<const resource::PoolStats> stats);
+    void removePool(const resource::PoolStats* stats);
+    size_t poolCount() const { return pools_.size(); }
+    const resource::PoolStats* getPool(size_t index) const {
+        return index < pools_.size() ? pools_[index].get() : nullptr;
     }
-#include <warn/pop>
 
     const Resource* get(size_t groupIndex, size_t index) const {
         return std::visit(
@@ -150,9 +243,31 @@ public:
                 }
             },
             data_);
+        util::for_each_in_tuple([](auto& map) { map.clear(); }, evictables_);
+        while (!pools_.empty()) {
+            removePool(pools_.back().get());
+        }
     }
 
 private:
+    void addUsage(size_t groupIndex, size_t bytes) {
+        auto& stats = stats_[groupIndex];
+        stats.usage += bytes;
+        stats.peakUsage = std::max(stats.peakUsage, stats.usage);
+    }
+    bool overBudget(size_t groupIndex) const {
+        const auto& stats = stats_[groupIndex];
+        return stats.budget != 0 && stats.usage > stats.budget;
+    }
+    bool overHardLimit() const {
+        return std::ranges::any_of(stats_, [](const Stats& stats) {
+            return stats.budget != 0 && static_cast<double>(stats.usage) >
+                                            hardLimitFactor * static_cast<double>(stats.budget);
+        });
+    }
+    void scheduleEnforceBudget();
+    void enforceWhenIdle();
+
     auto getGroup(size_t groupIndex) const -> Var {
         Var v{};
         util::for_each_in_tuple(
@@ -181,6 +296,13 @@ private:
     }
 
     Data data_;
+    Evictables evictables_;
+    std::array<Stats, groups> stats_{};
+    std::vector<std::shared_ptr<const resource::PoolStats>> pools_;
+    bool enforcePending_ = false;
+    std::function<bool()> busy_;
+    std::unique_ptr<Delay> retry_;
+    size_t busyRetries_ = 0;
 };
 
 }  // namespace inviwo
@@ -44,6 +44,10 @@ public:
     virtual void onDidUpdateResource(size_t group, size_t index, const Resource& resource);
     virtual void onWillRemoveResource(size_t group, size_t index, const Resource& resource);
     virtual void onDidRemoveResource(size_t group, size_t index, const Resource& resource);
+    virtual void onWillAddPool(size_t index);
+    virtual void onDidAddPool(size_t index);
+    virtual void onWillRemovePool(size_t index);
+    virtual void onDidRemovePool(size_t index);
 };
 
 class IVW_CORE_API ResourceManagerObservable : public Observable<ResourceManagerObserver> {
@@ -54,6 +58,10 @@ protected:
     void notifyDidUpdateResource(size_t group, size_t index, const Resource& resource);
     void notifyWillRemoveResource(size_t group, size_t index, const Resource& resource);
     void notifyDidRemoveResource(size_t group, size_t index, const Resource& resource);
+    void notifyWillAddPool(size_t index);
+    void notifyDidAddPool(size_t index);
+    void notifyWillRemovePool(size_t index);
+    void notifyDidRemovePool(size_t index);
 };
 
 inline void ResourceManagerObserver::onWillAddResource(size_t, size_t, const Resource&) {}
@@ -62,5 +70,9 @@ inline void ResourceManagerObserver::onWillUpdateResource(size_t, size_t, const
 inline void ResourceManagerObserver::onDidUpdateResource(size_t, size_t, const Resource&) {}
 inline void ResourceManagerObserver::onWillRemoveResource(size_t, size_t, const Resource&) {}
 inline void ResourceManagerObserver::onDidRemoveResource(size_t, size_t, const Resource&) {}
+inline void ResourceManagerObserver::onWillAddPool(size_t) {}
+inline void ResourceManagerObserver::onDidAddPool(size_t) {}
+inline void ResourceManagerObserver::onWillRemovePool(size_t) {}
+inline void ResourceManagerObserver::onDidRemovePool(size_t) {}
 
 }  // namespace inviwo
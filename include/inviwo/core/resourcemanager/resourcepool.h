@@ -0,0 +1,218 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/resourcemanager/resource.h>
+
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+namespace inviwo {
+
+/**
+ * A bounded pool of reusable objects, like images or volumes, ordered by last use.
+ * An item in the pool is considered unused when the pool holds the only reference to it, only
+ * unused items are handed out by acquire(). When the size of the pool exceeds its budget, unused
+ * items are evicted in least recently used order. The statistics of the pool are registered with
+ * the ResourceManager.
+ *
+ * The size of an item is recorded when it is added to the pool, an item that is resized after
+ * being acquired should be added again to update its size.
+ *
+ * The pool is not thread safe, only the statistics can be read from any thread.
+ *
+ * Example usage:
+ * @code
+ * ResourcePool<Volume> pool{"Volumes", [](const Volume& v) { return sizeInBytes(v); }};
+ * auto volume = pool.acquire([&](const Volume& v) { return v.getDimensions() == dims; });
+ * if (!volume) {
+ *     volume = std::make_shared<Volume>(dims);
+ *     pool.add(volume);
+ * }
+ * @endcode
+ */
+template <typename T>
+class ResourcePool {
+public:
+    using SizeFunc = std::function<size_t(const T&)>;
+    static constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+
+    struct Item {
+        std::shared_ptr<T> ptr;
+        size_t bytes;
+    };
+
+    /**
+     * @param name     name of the pool, used in the resource manager
+     * @param sizeFunc function returning the size in bytes of an item
+     * @param budget   budget in bytes
+     */
+    ResourcePool(std::string_view name, SizeFunc sizeFunc, size_t budget = unlimited)
+        : sizeFunc_{std::move(sizeFunc)}, stats_{std::make_shared<resource::PoolStats>(name)} {
+        stats_->budget = budget;
+        resource::addPool(stats_);
+    }
+    ResourcePool(const ResourcePool&) = delete;
+    ResourcePool(ResourcePool&&) = delete;
+    ResourcePool& operator=(const ResourcePool&) = delete;
+    ResourcePool& operator=(ResourcePool&&) = delete;
+    ~ResourcePool() { resource::removePool(stats_.get()); }
+
+    /**
+     * Find the most recently used unused item for which @p pred returns true. If there is none,
+     * the @p fallbacks are tried in order. The item stays in the pool and becomes the most
+     * recently used item. Counts as one hit if an item was found and as one miss otherwise.
+     * @return the item or nullptr if no matching unused item was found
+     */
+    template <std::predicate<const T&> Pred, std::predicate<const T&>... Fallbacks>
+    std::shared_ptr<T> acquire(Pred&& pred, Fallbacks&&... fallbacks) {
+        auto it = findUnused(pred);
+        (void)((it != items_.end() || (it = findUnused(fallbacks)) != items_.end()) || ...);
+        if (it == items_.end()) {
+            ++stats_->misses;
+            return nullptr;
+        }
+        ++stats_->hits;
+        items_.splice(items_.begin(), items_, it);
+        return items_.front().ptr;
+    }
+    std::shared_ptr<T> acquire() {
+        return acquire([](const T&) { return true; });
+    }
+
+    /**
+     * Add @p item to the pool as the most recently used item, and evict unused items if the pool
+     * is over budget. Adding an item that already is in the pool updates its last use and its
+     * size.
+     */
+    void add(std::shared_ptr<T> item) {
+        if (!item) return;
+        const auto bytes = sizeFunc_(*item);
+        auto it = std::ranges::find(items_, item, &Item::ptr);
+        if (it != items_.end()) {
+            bytes_ -= it->bytes;
+            it->bytes = bytes;
+            items_.splice(items_.begin(), items_, it);
+        } else {
+            items_.push_front(Item{std::move(item), bytes});
+        }
+        bytes_ += bytes;
+        trim();
+    }
+
+    /**
+     * Remove @p item from the pool, it will not be handed out again.
+     * @return the removed item or nullptr if it was not found
+     */
+    std::shared_ptr<T> remove(const T* item) {
+        auto it = std::ranges::find(items_, item, [](const Item& i) { return i.ptr.get(); });
+        if (it == items_.end()) return nullptr;
+        auto res = std::move(it->ptr);
+        erase(it);
+        updateStats();
+        return res;
+    }
+
+    /**
+     * Evict unused items in least recently used order until the pool is within its budget.
+     * Items in use are never evicted, releasing the pool's reference would not free any memory.
+     * @return the number of evicted items
+     */
+    size_t trim() {
+        size_t evicted = 0;
+        const auto budget = stats_->budget.load();
+        for (auto it = items_.end(); bytes_ > budget && it != items_.begin();) {
+            --it;
+            if (it->ptr.use_count() == 1) {
+                it = erase(it);
+                ++evicted;
+            }
+        }
+        stats_->evictions += evicted;
+        updateStats();
+        return evicted;
+    }
+
+    void clear() {
+        items_.clear();
+        bytes_ = 0;
+        updateStats();
+    }
+
+    void setBudget(size_t bytes) {
+        stats_->budget = bytes;
+        trim();
+    }
+    size_t getBudget() const { return stats_->budget; }
+
+    /// Number of items in the pool, both used and unused
+    size_t size() const { return items_.size(); }
+    /// Total size in bytes of all items in the pool
+    size_t sizeInBytes() const { return bytes_; }
+    const resource::PoolStats& getStats() const { return *stats_; }
+
+    /// Items in most recently used order
+    auto begin() const { return items_.begin(); }
+    auto end() const { return items_.end(); }
+
+private:
+    using Iterator = typename std::list<Item>::iterator;
+
+    template <typename Pred>
+    Iterator findUnused(Pred& pred) {
+        return std::ranges::find_if(items_, [&](const Item& item) {
+            return item.ptr.use_count() == 1 && std::invoke(pred, std::as_const(*item.ptr));
+        });
+    }
+
+    Iterator erase(Iterator it) {
+        bytes_ -= it->bytes;
+        return items_.erase(it);
+    }
+
+    void updateStats() {
+        stats_->items = items_.size();
+        stats_->bytes = bytes_;
+    }
+
+    SizeFunc sizeFunc_;
+    std::list<Item> items_;
+    size_t bytes_ = 0;
+    std::shared_ptr<resource::PoolStats> stats_;
+};
+
+}  // namespace inviwo
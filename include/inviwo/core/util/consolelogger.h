@@ -36,7 +36,7 @@ namespace inviwo {
 
 /**
  * \class ConsoleLogger
- * \brief A Logger class that log to the console using cout
+ * \brief A Logger class that log to the console using cout, and cerr for errors
  */
 class IVW_CORE_API ConsoleLogger : public Logger {
 public:
@@ -48,6 +48,7 @@ public:
                      std::string_view logMsg) override;
 
     bool useColor;
+    bool useStdErr;  ///< Write all messages to std::cerr, by default only errors are
 };
 
 }  // namespace inviwo
@@ -0,0 +1,123 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <deque>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * \class DeltaHistory
+ * \brief A linear history of snapshots stored as deltas, used for undo and redo.
+ *
+ * Only one snapshot, the cursor, is stored in full. Consecutive snapshots are connected by
+ * deltas that store the byte ranges that differ between them. To find the ranges both snapshots
+ * are split into content defined chunks using a rolling hash, and equal chunks are matched.
+ * Hence a change of a large snapshot only costs the bytes around each edit, even if the edits
+ * are scattered. A property change in a serialized workspace, for example, also updates the
+ * length fields of all enclosing elements. Any snapshot can be reconstructed by moving the cursor
+ * along the deltas, moving one step in either direction applies one delta.
+ *
+ * The memory used by the history is bounded by a budget, when it is exceeded the oldest
+ * snapshots are dropped. The latest snapshot is always kept.
+ */
+class IVW_CORE_API DeltaHistory {
+public:
+    explicit DeltaHistory(size_t budget = 256 * 1024 * 1024);
+
+    /**
+     * Append a snapshot to the end of the history. Returns false if the snapshot is equal to the
+     * last snapshot, then nothing is added. If the memory budget is exceeded the oldest
+     * snapshots are dropped.
+     */
+    bool push(std::span<const std::byte> snapshot);
+
+    /**
+     * Reconstruct the snapshot at index. Moves the cursor to index.
+     * @pre index < size()
+     */
+    const std::vector<std::byte>& at(size_t index);
+
+    /**
+     * Remove all snapshots after the first count snapshots.
+     */
+    void truncate(size_t count);
+
+    void clear();
+
+    /**
+     * The number of snapshots in the history
+     */
+    size_t size() const;
+    bool empty() const;
+
+    /**
+     * The number of bytes used by the cursor snapshot and all deltas
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * Set the memory budget in bytes, drops the oldest snapshots if it is exceeded.
+     */
+    void setBudget(size_t budget);
+    size_t getBudget() const;
+
+private:
+    struct Hunk {
+        size_t offset;  ///< Position of the hunk in the before snapshot
+        std::vector<std::byte> before;
+        std::vector<std::byte> after;
+    };
+    struct Delta {
+        std::vector<Hunk> hunks;
+
+        size_t memoryUsage() const;
+    };
+
+    static Delta diff(std::span<const std::byte> before, std::span<const std::byte> after);
+    static void apply(std::vector<std::byte>& snapshot, const Delta& delta, bool forward);
+
+    void moveTo(size_t index);
+    void enforceBudget();
+
+    size_t budget_;
+    size_t cursorIndex_;
+    std::vector<std::byte> cursor_;
+    std::deque<Delta> deltas_;  // deltas_[i] goes from snapshot i to snapshot i + 1
+    size_t deltaMemory_;
+    bool hasSnapshot_;
+};
+
+}  // namespace inviwo
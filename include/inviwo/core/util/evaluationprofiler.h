@@ -0,0 +1,209 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/singleton.h>
+#include <inviwo/core/util/transparentmaps.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * \class EvaluationProfiler
+ * Records timings of the network evaluation into fixed size ring buffers: initializeResources,
+ * inport onChange and process of each processor, representation conversions, background jobs
+ * of PoolProcessors, and property link propagation. The recorded events can be exported as a
+ * Chrome trace / Perfetto JSON timeline, and rolling statistics per processor can be queried.
+ *
+ * Each recording thread has its own ring buffer and event names are interned, recording an
+ * event only takes the uncontended lock of the thread's buffer and never allocates once a name
+ * has been seen by the thread.
+ *
+ * Recording is disabled by default, a disabled profiler only costs the check of an atomic flag.
+ * Enable it with setEnabled() or from the system settings.
+ */
+class IVW_CORE_API EvaluationProfiler : public Singleton<EvaluationProfiler> {
+public:
+    using clock = std::chrono::steady_clock;
+
+    enum class Category : std::uint8_t {
+        Evaluation,
+        InitializeResources,
+        PortOnChange,
+        Process,
+        Conversion,
+        BackgroundJob,
+        Linking
+    };
+
+    struct Event {
+        std::string name;  ///< Processor identifier, or a description for conversions
+        Category category = Category::Process;
+        clock::time_point start{};
+        clock::duration duration{};
+        std::uint32_t thread = 0;  ///< Sequential id of the recording thread, 0 is the first
+    };
+
+    struct Stats {
+        size_t count = 0;
+        clock::duration mean{};
+        clock::duration p95{};
+        clock::duration max{};
+        clock::duration total{};
+    };
+
+    /**
+     * Records the time between construction and destruction as an event. Nothing is recorded
+     * if the profiler is not initialized or disabled at construction. @p name has to outlive the
+     * scope.
+     */
+    class IVW_CORE_API Scope {
+    public:
+        Scope(Category category, std::string_view name);
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+        ~Scope();
+
+    private:
+        EvaluationProfiler* profiler_;
+        Category category_;
+        std::string_view name_;
+        clock::time_point start_;
+    };
+
+    static constexpr size_t defaultCapacity = 16384;
+
+    explicit EvaluationProfiler(size_t capacity = defaultCapacity);
+    EvaluationProfiler(const EvaluationProfiler&) = delete;
+    EvaluationProfiler(EvaluationProfiler&&) = delete;
+    EvaluationProfiler& operator=(const EvaluationProfiler&) = delete;
+    EvaluationProfiler& operator=(EvaluationProfiler&&) = delete;
+    virtual ~EvaluationProfiler() = default;
+
+    /**
+     * Returns the global profiler if it is initialized and enabled, nullptr otherwise.
+     */
+    static EvaluationProfiler* active();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * Set the number of events kept in the ring buffer of each recording thread, recorded events
+     * are discarded.
+     */
+    void setCapacity(size_t capacity);
+    size_t getCapacity() const;
+
+    void record(Category category, std::string_view name, clock::time_point start,
+                clock::time_point end);
+    void clear();
+
+    /**
+     * Returns the recorded events of all threads, ordered by start time.
+     */
+    std::vector<Event> getEvents() const;
+
+    /**
+     * Statistics of the events of @p category with @p name currently in the ring buffers.
+     */
+    Stats getStats(std::string_view name, Category category = Category::Process) const;
+    /**
+     * Statistics of all recorded names for @p category, ordered by decreasing total time.
+     */
+    std::vector<std::pair<std::string, Stats>> getStats(
+        Category category = Category::Process) const;
+
+    /**
+     * Write the recorded events in the Chrome trace event format, which can be opened in
+     * chrome://tracing or https://ui.perfetto.dev
+     */
+    void exportChromeTrace(std::ostream& os) const;
+    void exportChromeTrace(const std::filesystem::path& path) const;
+
+private:
+    friend Singleton<EvaluationProfiler>;
+    static std::atomic<EvaluationProfiler*> instance_;
+
+    struct Slot {
+        std::uint32_t name = 0;  ///< Index into names_
+        Category category = Category::Process;
+        clock::time_point start{};
+        clock::duration duration{};
+    };
+
+    /// The events of one recording thread, only written by that thread
+    struct ThreadBuffer {
+        explicit ThreadBuffer(size_t capacity) : slots(capacity) {}
+        std::mutex mutex;  ///< Only contended while the events are read
+        std::vector<Slot> slots;
+        size_t next = 0;
+        size_t size = 0;
+        UnorderedStringMap<std::uint32_t> names;  ///< Names already interned by the thread
+    };
+
+    ThreadBuffer& threadBuffer();
+    std::uint32_t intern(ThreadBuffer& buffer, std::string_view name);
+    /// Calls @p func with the thread index and each recorded slot, mutex_ must be held
+    template <typename Func>
+    void forEachSlot(Func&& func) const;
+
+    const std::uint64_t id_;  ///< Unique per instance, identifies the thread local buffer cache
+    std::atomic<bool> enabled_;
+    mutable std::mutex mutex_;  ///< Guards capacity_, buffers_, threads_, and the name table
+    size_t capacity_;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+    std::unordered_map<std::thread::id, std::uint32_t> threads_;
+    std::vector<std::string> names_;
+    UnorderedStringMap<std::uint32_t> nameIds_;
+};
+
+IVW_CORE_API std::string_view enumToStr(EvaluationProfiler::Category category);
+inline std::string_view format_as(EvaluationProfiler::Category category) {
+    return enumToStr(category);
+}
+
+}  // namespace inviwo
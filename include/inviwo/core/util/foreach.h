@@ -33,7 +33,15 @@
 #include <inviwo/core/util/settings/systemsettings.h>
 #include <inviwo/core/util/threadutil.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <latch>
+#include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 namespace inviwo {
 
@@ -140,6 +148,69 @@ void forEachParallel(const Iterable& iterable, Callback&& callback, size_t jobs
     }
 }
 
+/**
+ * Use multiple threads to process the range [0, size) in chunks. The callback is called as
+ * `callback(begin, end)` for each chunk. Chunks are handed out dynamically and the calling thread
+ * processes chunks as well. The caller only waits for chunks that another thread has already
+ * started on, never for jobs still waiting in the queue of the thread pool. Hence this is safe
+ * to call from within a job running in the thread pool even if all pool threads are busy. If the
+ * Inviwo pool size is zero everything is executed in the calling thread. The function returns
+ * once all chunks are processed. If the callback throws, the remaining chunks are skipped and the
+ * first exception is rethrown once all started chunks are done.
+ *
+ * @param size the number of items to process
+ * @param callback to call for each chunk `[](size_t begin, size_t end){}`
+ * @param chunks optional parameter specifying how many chunks to create, if chunks==0 (default)
+ * it will create pool size * 4 chunks
+ */
+template <typename Callback>
+void forEachChunkParallel(size_t size, Callback&& callback, size_t chunks = 0) {
+    const auto poolSize = util::getPoolSize();
+    if (chunks == 0) chunks = 4 * poolSize;
+    chunks = std::min(chunks, size);
+
+    if (poolSize == 0 || chunks <= 1) {
+        if (size > 0) callback(size_t{0}, size);
+        return;
+    }
+
+    // Shared with the helper jobs, which might only start after this function has returned
+    struct State {
+        explicit State(size_t chunks) : remaining{static_cast<std::ptrdiff_t>(chunks)} {}
+        std::atomic<size_t> next{0};
+        std::atomic<bool> failed{false};
+        std::latch remaining;
+        std::mutex mutex;
+        std::exception_ptr exception;
+    };
+    auto state = std::make_shared<State>(chunks);
+
+    // The callback is only used for claimed chunks, and this function waits for all of them.
+    // Helpers starting after all chunks are claimed return without touching it.
+    const auto work = [state, size, chunks, &callback]() {
+        for (auto chunk = state->next++; chunk < chunks; chunk = state->next++) {
+            if (!state->failed) {
+                try {
+                    callback((size * chunk) / chunks, (size * (chunk + 1)) / chunks);
+                } catch (...) {
+                    const std::scoped_lock lock{state->mutex};
+                    if (!state->exception) state->exception = std::current_exception();
+                    state->failed = true;
+                }
+            }
+            state->remaining.count_down();
+        }
+    };
+
+    for (size_t i = 1; i < std::min(poolSize + 1, chunks); ++i) {
+        dispatchPool(work);
+    }
+    work();
+    state->remaining.wait();
+
+    if (state->exception) std::rethrow_exception(state->exception);
+}
+
 }  // namespace util
 
 }  // namespace inviwo
@@ -32,6 +32,7 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/resourcemanager/resourcepool.h>
 #include <glm/gtx/hash.hpp>
 
 #include <unordered_map>
@@ -43,10 +44,16 @@ class Image;
 
 /**
  * \class ImageCache
+ * Keeps resized copies of a master image. Images that are pruned are kept in a ResourcePool and
+ * reused when an image of the same size and layout is requested again, as long as the pool is
+ * within its budget.
  */
 class IVW_CORE_API ImageCache {
 public:
-    ImageCache(std::shared_ptr<const Image> master = std::shared_ptr<const Image>());
+    static constexpr size_t defaultBudget = 128 * 1024 * 1024;
+
+    ImageCache(std::shared_ptr<const Image> master = std::shared_ptr<const Image>(),
+               size_t budget = defaultBudget);
     ~ImageCache() = default;
 
     ImageCache(const ImageCache&) = delete;
@@ -56,7 +63,8 @@ public:
     std::shared_ptr<const Image> getImage(const size2_t dimensions) const;
 
     /**
-     *    Remove all cached images except those in dimensions
+     *    Remove all cached images except those in dimensions. Removed images are returned to the
+     *    pool for later reuse.
      */
     void prune(const std::vector<size2_t>& dimensions) const;
     /**
@@ -71,12 +79,15 @@ public:
     std::shared_ptr<Image> getUnusedImage(const std::vector<size2_t>& dimensions);
     size_t size() const;
 
+    const ResourcePool<Image>& getPool() const { return pool_; }
+
 private:
     mutable bool valid_;
     std::shared_ptr<const Image> master_;  // non-owning reference.
 
     using Cache = std::unordered_map<glm::size2_t, std::shared_ptr<Image>>;
     mutable Cache cache_;
+    mutable ResourcePool<Image> pool_;
 };
 
 }  // namespace inviwo
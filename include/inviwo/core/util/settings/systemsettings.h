@@ -63,6 +63,10 @@ public:
     BoolProperty breakOnException_;
     BoolProperty stackTraceInException_;
     BoolProperty enableResourceTracking_;
+    IntSizeTProperty ramBudget_;
+    IntSizeTProperty glBudget_;
+    BoolProperty enableProfiling_;
+    BoolProperty batchedLinking_;
 
     BoolProperty redirectCout_;
     BoolProperty redirectCerr_;
@@ -97,6 +97,10 @@ public:
     size_t getSize() const;
 
     size_t getQueueSize();
+    /**
+     * The number of workers currently running a task
+     */
+    size_t getActiveCount() const;
 
 private:
     enum class State {
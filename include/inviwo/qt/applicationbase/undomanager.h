@@ -32,30 +32,48 @@
 #include <inviwo/qt/applicationbase/qtapplicationbasemoduledefine.h>
 
 #include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/util/deltahistory.h>
 
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include <QObject>
 
 class QAction;
 class QEvent;
+class QTimer;
 
 namespace inviwo {
 
 class AutoSaver;
 class ProcessorNetwork;
+class Processor;
+class PropertyOwner;
 
 /**
  * \class UndoManager
+ * Keeps a history of workspace states for undo and redo. Most steps only change property values,
+ * hence the network tracks a modification count on each PropertyOwner, and a step where only
+ * properties changed is stored as the serialized properties of the modified processors. Any
+ * other change, like adding a processor or a connection, stores a full snapshot of the workspace
+ * in the binary serialization format as a delta in a DeltaHistory, the memory used is limited by
+ * the historyBudget in MB. To detect those changes the workspace is serialized without the
+ * properties of the processors and compared against the previous state.
  */
 class IVW_QTAPPLICATIONBASE_API UndoManager : public QObject {
 public:
     UndoManager(
         WorkspaceManager* wm, ProcessorNetwork* network,
         std::function<int()> numRestoreFiles = []() -> int { return 100000; },
-        std::function<int()> restoreFrequency = []() -> int { return 1440; });
+        std::function<int()> restoreFrequency = []() -> int { return 1440; },
+        std::function<int()> historyBudget = []() -> int { return 256; });
     UndoManager(const UndoManager&) = delete;
     UndoManager(UndoManager&&) = delete;
     UndoManager& operator=(const UndoManager&) = delete;
@@ -79,8 +97,34 @@ public:
     bool eventFilter(QObject* watched, QEvent* event) override;
 
 private:
-    using DiffType = std::vector<std::pmr::string>::iterator::difference_type;
-
+    using DiffType = std::ptrdiff_t;
+
+    struct OwnerState {
+        std::string processor;
+        std::pmr::vector<std::byte> data;
+    };
+    struct State {
+        size_t snapshot;                 ///< Index of the full snapshot in the history
+        std::vector<OwnerState> owners;  ///< Properties of the processors modified since the
+                                         ///< previous state, empty for a full snapshot
+    };
+
+    /**
+     * The maximum number of consecutive property steps, restoring a state means loading its
+     * full snapshot and applying all the property steps after it.
+     */
+    static constexpr size_t maxPropertySteps = 64;
+
+    void pushSnapshot(std::pmr::vector<std::byte> structure);
+    void restoreState(DiffType index);
+    void applyOwners(const std::vector<OwnerState>& owners);
+    const OwnerState* findPrevious(DiffType index, std::string_view processor) const;
+    DiffType findBase(DiffType index) const;
+    std::pmr::vector<std::byte> serializeStructure() const;
+    std::pmr::vector<std::byte> serializeProperties(const Processor& processor) const;
+    bool isNetworkProcessor(const PropertyOwner& owner) const;
+    void recordModificationCounts();
+    void autoSave();
     void updateActions();
 
     ProcessorNetwork* network_;
@@ -91,10 +135,16 @@ private:
     size_t triggerId_ = 0;
     bool isRestoring = false;
     DiffType head_ = -1;
-    std::vector<std::shared_ptr<const std::pmr::string>> undoBuffer_;
+    std::vector<State> states_;
+    DeltaHistory history_;
+    std::function<int()> historyBudget_;
+
+    std::pmr::vector<std::byte> structure_;  ///< The workspace without properties at head_
+    std::unordered_map<const Processor*, size_t> modificationCounts_;  ///< Counts at head_
 
     QAction* undoAction_;
     QAction* redoAction_;
+    QTimer* autoSaveTimer_;
 
     WorkspaceManager::ClearHandle clearHandle_;
     WorkspaceManager::DeserializationHandle loadHandle_;
@@ -53,6 +53,7 @@ public:
     IntProperty numRecentFiles;
     IntProperty numRestoreFiles;
     IntProperty restoreFrequency;
+    IntProperty undoHistoryBudget;
     ListProperty workspaceDirectories;
 
     BoolProperty showProcessorEvaluationCounts;
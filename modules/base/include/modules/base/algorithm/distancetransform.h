@@ -0,0 +1,266 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>
+
+#include <inviwo/core/util/foreach.h>      // for forEachChunkParallel
+#include <inviwo/core/util/glmutils.h>     // for Vector
+#include <inviwo/core/util/indexmapper.h>  // for IndexMapper
+
+#include <algorithm>    // for fill
+#include <cstddef>      // for size_t
+#include <limits>       // for numeric_limits
+#include <type_traits>  // for is_floating_point_v
+#include <vector>       // for vector
+
+#include <glm/fwd.hpp>                 // for i64
+#include <glm/gtx/component_wise.hpp>  // for compMul
+
+namespace inviwo {
+
+namespace util {
+
+/**
+ * Selects the kind of distance field produced by the distance transforms.
+ *  * __Unsigned__ the distance to the closest feature, zero for all features.
+ *  * __Signed__ like Unsigned for all non-features, features get the negated distance to the
+ *    closest non-feature.
+ */
+enum class DistanceType { Unsigned, Signed };
+
+namespace detail {
+
+/**
+ * Calculates the lower envelope of the parabolas `w * (q - i)^2 + f[i]` and evaluates it for
+ * all q in [0, n), according to
+ *   P. F. Felzenszwalb and D. P. Huttenlocher. Distance Transforms of Sampled Functions.
+ *   Theory of Computing, 8(19), pp. 415-428, 2012.
+ * Values equal to @p inf are considered as "no feature" and are not part of the envelope.
+ * If @p features is not empty the index of the minimizing feature is propagated along.
+ */
+template <typename U>
+void lowerEnvelope(const std::vector<U>& f, const std::vector<glm::i64>& features,
+                   std::vector<U>& d, std::vector<glm::i64>& featuresOut, std::vector<glm::i64>& v,
+                   std::vector<double>& z, double w, U inf) {
+    const auto n = static_cast<glm::i64>(f.size());
+
+    const auto intersection = [&](glm::i64 p, glm::i64 q) {
+        const auto fp = static_cast<double>(f[p]) + w * static_cast<double>(p * p);
+        const auto fq = static_cast<double>(f[q]) + w * static_cast<double>(q * q);
+        return (fq - fp) / (2.0 * w * static_cast<double>(q - p));
+    };
+
+    glm::i64 k = -1;
+    for (glm::i64 q = 0; q < n; ++q) {
+        if (f[q] >= inf) continue;
+        double s = -std::numeric_limits<double>::infinity();
+        while (k >= 0) {
+            s = intersection(v[k], q);
+            if (s > z[k]) break;
+            --k;
+        }
+        ++k;
+        v[k] = q;
+        z[k] = k == 0 ? -std::numeric_limits<double>::infinity() : s;
+    }
+
+    if (k < 0) {
+        std::fill(d.begin(), d.end(), inf);
+        if (!features.empty()) std::fill(featuresOut.begin(), featuresOut.end(), glm::i64{-1});
+        return;
+    }
+    z[k + 1] = std::numeric_limits<double>::infinity();
+
+    glm::i64 j = 0;
+    for (glm::i64 q = 0; q < n; ++q) {
+        while (z[j + 1] < static_cast<double>(q)) ++j;
+        const auto p = v[j];
+        d[q] = static_cast<U>(w * static_cast<double>((q - p) * (q - p))) + f[p];
+        if (!features.empty()) featuresOut[q] = features[p];
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Exact Euclidean distance transform of an N-dimensional grid in linear time, using the
+ * separable lower envelope formulation of
+ *   P. F. Felzenszwalb and D. P. Huttenlocher. Distance Transforms of Sampled Functions.
+ *   Theory of Computing, 8(19), pp. 415-428, 2012.
+ * and
+ *   A. Meijster, J. B. T. M. Roerdink, and W. H. Hesselink. A general algorithm for computing
+ *   distance transforms in linear time. Mathematical Morphology and its Applications to Image
+ *   and Signal Processing, pp. 331-340, 2000.
+ *
+ * Each pass processes all lines along one axis independently, the lines are distributed over the
+ * Inviwo thread pool.
+ *
+ * @param dims the grid dimensions
+ * @param squareVoxelSize the squared extent of a voxel along each axis
+ * @param isFeature function of type `(const Vector<N, glm::i64>& pos) -> bool` deciding whether a
+ *        grid position is a feature
+ * @param dist output of the squared distances, needs to hold `compMul(dims)` elements. Positions
+ *        without any reachable feature get the squared length of the grid diagonal.
+ * @param features optional output of the linear index of the closest feature for each position,
+ *        or -1 if there are no features. Can be nullptr.
+ * @param progress function of type `(double progress) -> void`, only called from the calling
+ *        thread.
+ */
+template <unsigned int N, typename U, typename IsFeature, typename ProgressCallback>
+void squaredDistanceTransform(const Vector<N, glm::i64>& dims, const Vector<N, U>& squareVoxelSize,
+                              IsFeature isFeature, U* dist, glm::i64* features,
+                              ProgressCallback progress) {
+    static_assert(std::is_floating_point_v<U>, "Distances need a floating point type");
+
+    const util::IndexMapper<N, glm::i64> index(dims);
+    const auto size = glm::compMul(dims);
+    if (size == 0) return;
+
+    U inf{0};
+    for (unsigned int i = 0; i < N; ++i) {
+        inf += squareVoxelSize[i] * static_cast<U>(dims[i] * dims[i]);
+    }
+
+    // first pass, forward and backward scan along x, tracking the closest feature
+    progress(0.0);
+    util::forEachChunkParallel(static_cast<size_t>(size / dims[0]), [&](size_t begin, size_t end) {
+        std::vector<glm::i64> left(dims[0]);
+        for (auto line = static_cast<glm::i64>(begin); line < static_cast<glm::i64>(end);
+             ++line) {
+            const auto start = line * dims[0];
+            auto pos = index(start);
+
+            // forward, closest feature to the left
+            glm::i64 closest = -1;
+            for (glm::i64 x = 0; x < dims[0]; ++x) {
+                pos[0] = x;
+                if (isFeature(pos)) closest = x;
+                left[x] = closest;
+            }
+
+            // backward, closest feature to the right
+            closest = -1;
+            for (glm::i64 x = dims[0] - 1; x >= 0; --x) {
+                if (left[x] == x) closest = x;
+                auto best = left[x];
+                if (closest >= 0 && (best < 0 || closest - x < x - best)) best = closest;
+
+                dist[start + x] =
+                    best < 0 ? inf : squareVoxelSize[0] * static_cast<U>((best - x) * (best - x));
+                if (features) features[start + x] = best < 0 ? glm::i64{-1} : start + best;
+            }
+        }
+    });
+
+    // remaining passes, lower envelope along each of the other axes
+    glm::i64 stride = dims[0];
+    for (unsigned int axis = 1; axis < N; ++axis) {
+        progress(static_cast<double>(axis) / static_cast<double>(N));
+
+        const auto n = dims[axis];
+        const auto w = static_cast<double>(squareVoxelSize[axis]);
+        const auto lines = size / n;
+
+        util::forEachChunkParallel(static_cast<size_t>(lines), [&](size_t begin, size_t end) {
+            std::vector<U> f(n);
+            std::vector<U> d(n);
+            std::vector<glm::i64> v(n);
+            std::vector<double> z(n + 1);
+            std::vector<glm::i64> fIn(features ? n : 0);
+            std::vector<glm::i64> fOut(features ? n : 0);
+
+            for (auto line = static_cast<glm::i64>(begin); line < static_cast<glm::i64>(end);
+                 ++line) {
+                const auto start = (line % stride) + (line / stride) * stride * n;
+
+                for (glm::i64 i = 0; i < n; ++i) {
+                    f[i] = dist[start + i * stride];
+                    if (features) fIn[i] = features[start + i * stride];
+                }
+                detail::lowerEnvelope(f, fIn, d, fOut, v, z, w, inf);
+                for (glm::i64 i = 0; i < n; ++i) {
+                    dist[start + i * stride] = d[i];
+                    if (features) features[start + i * stride] = fOut[i];
+                }
+            }
+        });
+        stride *= n;
+    }
+    progress(1.0);
+}
+
+/**
+ * Calculates the (optionally signed) distance transform using squaredDistanceTransform and
+ * applies @p valueTransform to the squared distances. For DistanceType::Signed a second transform
+ * of the complement is computed and features get `-valueTransform(d)` where `d` is the squared
+ * distance to the closest non-feature. The feature output always refers to the closest feature.
+ *
+ * @see squaredDistanceTransform
+ */
+template <unsigned int N, typename U, typename IsFeature, typename ValueTransform,
+          typename ProgressCallback>
+void distanceTransform(const Vector<N, glm::i64>& dims, const Vector<N, U>& squareVoxelSize,
+                       IsFeature isFeature, ValueTransform valueTransform, U* dist,
+                       glm::i64* features, DistanceType type, ProgressCallback progress) {
+    const auto size = static_cast<size_t>(glm::compMul(dims));
+
+    if (type == DistanceType::Unsigned) {
+        squaredDistanceTransform<N>(
+            dims, squareVoxelSize, isFeature, dist, features,
+            [&](double p) { progress(0.9 * p); });
+
+        util::forEachChunkParallel(size, [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                dist[i] = valueTransform(dist[i]);
+            }
+        });
+    } else {
+        squaredDistanceTransform<N>(
+            dims, squareVoxelSize, isFeature, dist, features,
+            [&](double p) { progress(0.45 * p); });
+
+        std::vector<U> inside(size);
+        squaredDistanceTransform<N>(
+            dims, squareVoxelSize, [&](const Vector<N, glm::i64>& pos) { return !isFeature(pos); },
+            inside.data(), nullptr, [&](double p) { progress(0.45 + 0.45 * p); });
+
+        util::forEachChunkParallel(size, [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                dist[i] = dist[i] == U{0} ? -valueTransform(inside[i]) : valueTransform(dist[i]);
+            }
+        });
+    }
+    progress(1.0);
+}
+
+}  // namespace util
+
+}  // namespace inviwo
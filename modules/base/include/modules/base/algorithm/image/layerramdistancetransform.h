@@ -39,33 +39,24 @@
 #include <inviwo/core/util/indexmapper.h>               // for IndexMapper
 #include <inviwo/core/util/logcentral.h>                // for LogCentral
 #include <inviwo/core/util/stringconversion.h>          // for toString
+#include <modules/base/algorithm/distancetransform.h>   // for distanceTransform, DistanceType
 
-#include <stdlib.h>   // for size_t, abs
-#include <algorithm>  // for min
-#include <cmath>      // for sqrt
-#include <string>     // for operator+, basic_string, string
-#include <vector>     // for vector
+#include <stdlib.h>  // for size_t, abs
+#include <cmath>     // for sqrt
+#include <string>    // for operator+, basic_string, string
 
 #include <glm/fwd.hpp>     // for int64
 #include <glm/matrix.hpp>  // for transpose
 #include <glm/vec2.hpp>    // for vec<>::(anonymous), operator*, opera...
 
-#ifdef IVW_USE_OPENMP
-#include <thread>
-
-#include <omp.h>
-#endif
-
 namespace inviwo {
 
 namespace util {
 
 /**
- *	Implementation of Euclidean Distance Transform according to Saito's algorithm:
- *  T. Saito and J.I. Toriwaki. New algorithms for Euclidean distance transformations
- *  of an n-dimensional digitized picture with applications. Pattern Recognition, 27(11).
- *  pp. 1551-1565, 1994.
- *  http://www.cs.jhu.edu/~misha/ReadingSeminar/Papers/Saito94.pdf
+ * Exact Euclidean Distance Transform in linear time using the lower envelope algorithm of
+ * Felzenszwalb and Huttenlocher / Meijster et al., see util::squaredDistanceTransform.
+ * The computation is distributed over the Inviwo thread pool.
  *
  * Calculates the distance in base mat space
  * @tparam Predicate is a function of type <tt>(const T &value) -> bool</tt> to decide if a value in
@@ -74,6 +65,11 @@ namespace util {
  *to all squared distance values at the end of the calculation.
  * @tparam ProcessCallback is a function of type <tt>(double progress) -> void</tt> that is called
  *with a value from 0 to 1 to indicate the progress of the calculation.
+ * @param outFeatures optional feature transform output, will hold the linear index into
+ *        @p outDistanceField of the closest feature of each pixel or -1 if there are no features.
+ *        Needs to have the same dimensions as @p outDistanceField. Can be nullptr.
+ * @param type for DistanceType::Signed features get the negated distance to the closest
+ *        non-feature.
  */
 template <typename T, typename U, typename Predicate, typename ValueTransform,
           typename ProgressCallback>
@@ -82,6 +78,14 @@ void layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
                                size2_t upsample, Predicate predicate, ValueTransform valueTransform,
                                ProgressCallback callback);
 
+template <typename T, typename U, typename Predicate, typename ValueTransform,
+          typename ProgressCallback>
+void layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
+                               LayerRAMPrecision<U>* outDistanceField,
+                               LayerRAMPrecision<glm::i64>* outFeatures, Matrix<3, U> basis,
+                               size2_t upsample, Predicate predicate, ValueTransform valueTransform,
+                               ProgressCallback callback, DistanceType type);
+
 template <typename T, typename U>
 void layerRAMDistanceTransform(const LayerRAMPrecision<T>* inVolume,
                                LayerRAMPrecision<U>* outDistanceField, Matrix<3, U> basis,
@@ -111,29 +115,30 @@ void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
                                      const Matrix<3, U> basis, const size2_t upsample,
                                      Predicate predicate, ValueTransform valueTransform,
                                      ProgressCallback callback) {
+    util::layerRAMDistanceTransform(inLayer, outDistanceField, nullptr, basis, upsample, predicate,
+                                    valueTransform, callback, DistanceType::Unsigned);
+}
 
-#ifdef IVW_USE_OPENMP
-    omp_set_num_threads(std::thread::hardware_concurrency());
-#endif
+template <typename T, typename U, typename Predicate, typename ValueTransform,
+          typename ProgressCallback>
+void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
+                                     LayerRAMPrecision<U>* outDistanceField,
+                                     LayerRAMPrecision<glm::i64>* outFeatures,
+                                     const Matrix<3, U> basis, const size2_t upsample,
+                                     Predicate predicate, ValueTransform valueTransform,
+                                     ProgressCallback callback, DistanceType type) {
 
     using int64 = glm::int64;
 
-    auto square = [](auto a) { return a * a; };
-
-    callback(0.0);
-
     const T* src = inLayer->getDataTyped();
-    U* dst = outDistanceField->getDataTyped();
 
     const i64vec2 srcDim{inLayer->getDimensions()};
     const i64vec2 dstDim{outDistanceField->getDimensions()};
     const i64vec2 sm{upsample};
 
     const auto squareBasis = glm::transpose(basis) * basis;
-    const Vector<3, U> squareBasisDiag{squareBasis[0][0], squareBasis[1][1], squareBasis[2][2]};
-    const Vector<3, U> squareVoxelSize{squareBasisDiag /
-                                       Vector<3, U>{i64vec3{dstDim, 1} * i64vec3{dstDim, 1}}};
-    const Vector<3, U> invSquareVoxelSize{Vector<3, U>{1.0f} / squareVoxelSize};
+    const Vector<2, U> squareBasisDiag{squareBasis[0][0], squareBasis[1][1]};
+    const Vector<2, U> squareVoxelSize{squareBasisDiag / Vector<2, U>{dstDim * dstDim}};
 
     {
         const auto maxdist = glm::compMax(squareBasisDiag);
@@ -161,89 +166,20 @@ void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
             "DistanceTransformRAM: Dimensions does not match src = {} dst = {} scaling = {}",
             srcDim, dstDim, sm);
     }
-
-    util::IndexMapper<2, int64> srcInd(srcDim);
-    util::IndexMapper<2, int64> dstInd(dstDim);
-
-    auto is_feature = [&](const int64 x, const int64 y) {
-        return predicate(src[srcInd(x / sm.x, y / sm.y)]);
-    };
-
-// first pass, forward and backward scan along x
-// result: min distance in x direction
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 y = 0; y < dstDim.y; ++y) {
-        // forward
-        U dist = static_cast<U>(dstDim.x);
-        for (int64 x = 0; x < dstDim.x; ++x) {
-            if (!is_feature(x, y)) {
-                ++dist;
-            } else {
-                dist = U(0);
-            }
-            dst[dstInd(x, y)] = squareVoxelSize.x * square(dist);
-        }
-
-        // backward
-        dist = static_cast<U>(dstDim.x);
-        for (int64 x = dstDim.x - 1; x >= 0; --x) {
-            if (!is_feature(x, y)) {
-                ++dist;
-            } else {
-                dist = U(0);
-            }
-            dst[dstInd(x, y)] = std::min<U>(dst[dstInd(x, y)], squareVoxelSize.x * square(dist));
-        }
+    if (outFeatures && i64vec2{outFeatures->getDimensions()} != dstDim) {
+        throw Exception(SourceContext{},
+                        "DistanceTransformRAM: Feature dimensions does not match dst = {} "
+                        "features = {}",
+                        dstDim, outFeatures->getDimensions());
     }
 
-    // second pass, scan y direction
-    // for each voxel v(x,y,z) find min_i(data(x,i,z) + (y - i)^2), 0 <= i < dimY
-    // result: min distance in x and y direction
-    callback(0.45);
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel
-#endif
-    {
-        std::vector<U> buff;
-        buff.resize(dstDim.y);
-#ifdef IVW_USE_OPENMP
-#pragma omp for
-#endif
-        for (int64 x = 0; x < dstDim.x; ++x) {
-
-            // cache column data into temporary buffer
-            for (int64 y = 0; y < dstDim.y; ++y) {
-                buff[y] = dst[dstInd(x, y)];
-            }
+    const util::IndexMapper<2, int64> srcInd(srcDim);
 
-            for (int64 y = 0; y < dstDim.y; ++y) {
-                auto d = buff[y];
-                if (d != U(0)) {
-                    const auto rMax = static_cast<int64>(std::sqrt(d * invSquareVoxelSize.y)) + 1;
-                    const auto rStart = std::min(rMax, y - 1);
-                    const auto rEnd = std::min(rMax, dstDim.y - y);
-                    for (int64 n = -rStart; n < rEnd; ++n) {
-                        const auto w = buff[y + n] + squareVoxelSize.y * square(n);
-                        if (w < d) d = w;
-                    }
-                }
-                dst[dstInd(x, y)] = d;
-            }
-        }
-    }
+    const auto isFeature = [&](const i64vec2& pos) { return predicate(src[srcInd(pos / sm)]); };
 
-    // scale data
-    callback(0.9);
-    const int64 layerSize = dstDim.x * dstDim.y;
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 i = 0; i < layerSize; ++i) {
-        dst[i] = valueTransform(dst[i]);
-    }
-    callback(1.0);
+    util::distanceTransform<2>(dstDim, squareVoxelSize, isFeature, valueTransform,
+                               outDistanceField->getDataTyped(),
+                               outFeatures ? outFeatures->getDataTyped() : nullptr, type, callback);
 }
 
 template <typename T, typename U>
@@ -0,0 +1,191 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/util/glmvec.h>  // for vec3, vec2, uvec3
+
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint32_t
+#include <limits>    // for numeric_limits
+#include <memory>    // for shared_ptr
+#include <optional>  // for optional
+#include <span>      // for span
+#include <utility>   // for pair
+#include <vector>    // for vector
+
+namespace inviwo {
+
+class Mesh;
+
+namespace meshutil {
+
+struct MeshBVHSettings {
+    /// Ranges with at most this many triangles are made into leaves if the SAH agrees
+    size_t maxLeafSize = 4;
+    /// Number of bins per axis used to evaluate the SAH
+    size_t bins = 16;
+    /// Cost of traversing one inner node relative to intersecting one triangle
+    float traversalCost = 1.0f;
+};
+
+/**
+ * \brief A bounding volume hierarchy over the triangles of a mesh for CPU ray and distance queries.
+ *
+ * The hierarchy is built with the surface area heuristic (SAH) evaluated over a fixed number of
+ * bins per axis. The top levels are split on the calling thread, and the resulting subtrees are
+ * built in parallel on the thread pool. Nodes are stored in a flat array of 32 byte nodes where
+ * the two children of an inner node are adjacent, and the triangles are reordered to match the
+ * leaves.
+ *
+ * All queries are done in the coordinate system of the vertex positions, i.e. model space for a
+ * Mesh. Use the CoordinateTransformer of the mesh to transform rays and points from world space.
+ * Triangles are identified by their index in getTriangles(), which lists the triangles in the
+ * order they are visited by forEachTriangle for each index buffer of the mesh.
+ *
+ * @see meshutil::getBVH for a BVH that is shared between all users of a mesh
+ */
+class IVW_MODULE_BASE_API MeshBVH {
+public:
+    struct Node {
+        vec3 min;
+        /// The first triangle of a leaf, or the first of the two children of an inner node
+        uint32_t index;
+        vec3 max;
+        /// The number of triangles of a leaf, 0 for inner nodes
+        uint32_t count;
+
+        bool isLeaf() const { return count != 0; }
+    };
+
+    struct Ray {
+        vec3 origin;
+        vec3 direction;
+        float tMin = 0.0f;
+        float tMax = std::numeric_limits<float>::infinity();
+    };
+
+    struct Hit {
+        /// Distance along the ray in units of the ray direction
+        float t;
+        /// Barycentric coordinates of the hit for the second and third vertex of the triangle
+        vec2 barycentric;
+        /// Index of the triangle in getTriangles()
+        uint32_t triangle;
+    };
+
+    struct ClosestPoint {
+        vec3 point;
+        float distance;
+        /// Index of the triangle in getTriangles()
+        uint32_t triangle;
+    };
+
+    /**
+     * Build a BVH from all triangle index buffers of @p mesh. If the mesh has no index buffers
+     * and its default draw type is triangles, consecutive vertices form the triangles.
+     * @throw Exception if the mesh has no position buffer or an index is out of range
+     */
+    explicit MeshBVH(const Mesh& mesh, const MeshBVHSettings& settings = {});
+    MeshBVH(std::vector<vec3> positions, std::vector<uvec3> triangles,
+            const MeshBVHSettings& settings = {});
+
+    /**
+     * Find the closest intersection along @p ray within [ray.tMin, ray.tMax].
+     */
+    std::optional<Hit> closestHit(const Ray& ray) const;
+
+    /**
+     * Find the closest intersection of each ray in @p rays and write them to @p hits. The rays
+     * are traversed in packets that share a traversal stack, which is faster than single rays
+     * for coherent rays, like the primary rays of a camera.
+     * @pre hits.size() >= rays.size()
+     */
+    void closestHit(std::span<const Ray> rays, std::span<std::optional<Hit>> hits) const;
+
+    /**
+     * Test if @p ray intersects any triangle within [ray.tMin, ray.tMax]. Stops at the first
+     * intersection found, use this for visibility and shadow rays.
+     */
+    bool anyHit(const Ray& ray) const;
+
+    /**
+     * Find the closest point on the mesh surface to @p point within @p maxDistance.
+     */
+    std::optional<ClosestPoint> closestPoint(
+        const vec3& point, float maxDistance = std::numeric_limits<float>::infinity()) const;
+
+    /**
+     * The bounds of all triangles
+     */
+    std::pair<vec3, vec3> getBounds() const;
+
+    const std::vector<Node>& getNodes() const { return nodes_; }
+    const std::vector<vec3>& getPositions() const { return positions_; }
+    const std::vector<uvec3>& getTriangles() const { return triangles_; }
+
+    /**
+     * The number of bytes used by the BVH, including the copies of the positions and triangles
+     */
+    size_t getSizeInBytes() const;
+
+private:
+    struct Triangle {
+        vec3 v0;
+        vec3 e1;
+        vec3 e2;
+    };
+
+    void build(const MeshBVHSettings& settings);
+
+    std::vector<vec3> positions_;
+    std::vector<uvec3> triangles_;
+    std::vector<Node> nodes_;
+    std::vector<Triangle> ordered_;        // the triangles in leaf order
+    std::vector<uint32_t> orderedIndex_;  // index in triangles_ of each triangle in ordered_
+    size_t depth_ = 0;
+};
+
+/**
+ * Get a BVH for @p mesh. The BVH is built on the first call for a mesh and then cached, hence
+ * all processors querying the same mesh share one BVH. The cache is keyed on the address and the
+ * owner of the mesh, so aliasing pointers into the same owner get separate BVHs. Each call also
+ * compares the identity and the modification count (Data::getModificationCount) of the position
+ * and index buffers, and the BVH is rebuilt if the mesh was modified in place.
+ * The cache is registered as a pool in the ResourceManager. When it exceeds its budget, the least
+ * recently used BVHs that are not in use elsewhere are released. BVHs of destroyed meshes are
+ * released on the next call.
+ */
+IVW_MODULE_BASE_API std::shared_ptr<const MeshBVH> getBVH(const std::shared_ptr<const Mesh>& mesh);
+
+}  // namespace meshutil
+
+}  // namespace inviwo
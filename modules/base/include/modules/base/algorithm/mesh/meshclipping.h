@@ -81,7 +81,10 @@ IVW_MODULE_BASE_API std::vector<std::vector<std::uint32_t>> gatherLoops(
 
 /**
  * Clip mesh against plane using Sutherland-Hodgman.
- * If holes should be closed, the input mesh must be manifold.
+ * Triangles are clipped in parallel chunks, each writing directly into the output buffers.
+ * If holes should be closed, the input mesh must be manifold. The cut edges are joined into loops
+ * by matching their end points exactly, and each loop is closed by a triangle fan around its
+ * centroid.
  * Vertex attributes are interpolated. Floating types use linear interpolation, integer types use
  * nearest. Connectivity types loop and fan are not handled.
  * @param mesh to clip
@@ -0,0 +1,109 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/datastructures/datasequence.h>   // for DataSequence
+#include <inviwo/core/datastructures/geometry/mesh.h>  // for Mesh
+
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+
+namespace inviwo {
+
+namespace meshutil {
+
+struct IVW_MODULE_BASE_API MeshDecimationSettings {
+    /**
+     * Stop when the mesh has at most this many triangles.
+     */
+    size_t targetTriangles = 0;
+    /**
+     * Stop when at most this fraction of the triangles of the input mesh remain. The larger of
+     * this target and targetTriangles is used.
+     */
+    double targetRatio = 0.0;
+    /**
+     * Never do a collapse that moves the surface more than this. The error is the area weighted
+     * RMS distance from the new vertex to the planes of the triangles it replaces, relative to
+     * the largest side of the bounding box of the mesh.
+     */
+    double maxError = 1.0;
+    /**
+     * Weight of the squared change in normals, colors, and texture coordinates relative to the
+     * squared geometric error. A larger weight keeps more vertices where these attributes vary.
+     */
+    double attributeWeight = 0.01;
+    /**
+     * Weight of the planes that keep boundary edges in place, relative to the planes of the
+     * triangles.
+     */
+    double boundaryWeight = 10.0;
+};
+
+/**
+ * Simplify the triangles of @p mesh by repeatedly collapsing the edge with the smallest quadric
+ * error (Garland and Heckbert, Surface Simplification Using Quadric Error Metrics, 1997), until
+ * the number of triangles reaches MeshDecimationSettings::targetTriangles or
+ * MeshDecimationSettings::targetRatio, or until no collapse with
+ * an error below MeshDecimationSettings::maxError remains.
+ *
+ * The collapses are done in passes. Each pass evaluates all edges in parallel and then collapses
+ * the cheapest edges that do not share any triangles, again in parallel. Collapses that would
+ * flip a triangle or make the mesh non-manifold are skipped. All buffers of @p mesh are kept.
+ * Floating point attributes are interpolated along the collapsed edge, and the change of normals,
+ * colors and texture coordinates is added to the error. Other buffers take the value of the
+ * closest end point. The result has a single triangle index buffer, all other index buffers are
+ * ignored.
+ *
+ * @throws Exception if @p mesh has no position buffer
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Mesh> decimate(
+    const Mesh& mesh, const MeshDecimationSettings& settings,
+    std::function<void(float)> progressCallback = nullptr);
+
+/**
+ * Create levels of detail of @p mesh. The first level is the triangles of @p mesh, and each
+ * following level has at most @p ratio times the triangles of the previous one. The levels are
+ * created by continuing the decimation of the previous level, see decimate. The targets of
+ * @p settings are ignored. If MeshDecimationSettings::maxError stops the decimation early,
+ * fewer than @p levels levels are returned.
+ *
+ * @throws Exception if @p mesh has no position buffer
+ */
+IVW_MODULE_BASE_API std::shared_ptr<DataSequence<Mesh>> decimateLevels(
+    const Mesh& mesh, size_t levels, double ratio, const MeshDecimationSettings& settings = {},
+    std::function<void(float)> progressCallback = nullptr);
+
+}  // namespace meshutil
+
+}  // namespace inviwo
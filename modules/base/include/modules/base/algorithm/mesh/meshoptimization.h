@@ -0,0 +1,146 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/datastructures/geometry/mesh.h>  // for Mesh
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <memory>   // for shared_ptr
+#include <span>     // for span
+#include <vector>   // for vector
+
+namespace inviwo {
+
+namespace meshutil {
+
+struct IVW_MODULE_BASE_API MeshOptimizationSettings {
+    /**
+     * Merge vertices that are closer than weldTolerance, see weldVertices.
+     */
+    bool weld = true;
+    /**
+     * Largest distance between welded vertices, relative to the largest side of the bounding box
+     * of the mesh. Zero only welds vertices with identical positions.
+     */
+    double weldTolerance = 0.0;
+    /**
+     * Largest difference of any component of the other buffers of welded vertices. A negative
+     * value ignores the other buffers, and welded vertices take the values of the first one.
+     */
+    double attributeTolerance = 0.0;
+    /**
+     * Remove triangles and line segments that use the same vertex more than once.
+     */
+    bool removeDegenerate = true;
+    /**
+     * Reorder the triangles for the post-transform vertex cache, see optimizeVertexCache.
+     */
+    bool reorderTriangles = true;
+    /**
+     * Reorder the vertices in the order they are first used by the index buffers. Otherwise the
+     * original order of the vertices is kept.
+     */
+    bool reorderVertices = true;
+    /**
+     * Number of vertices in the simulated FIFO vertex cache.
+     */
+    size_t cacheSize = 16;
+};
+
+struct IVW_MODULE_BASE_API MeshStatistics {
+    size_t vertices = 0;
+    size_t triangles = 0;
+    /**
+     * Average cache miss ratio, the number of transformed vertices per triangle. Between 0.5 for
+     * large regular meshes and 3.
+     */
+    double acmr = 0.0;
+    /**
+     * Average transform to vertex ratio, the number of transformed vertices per used vertex. One
+     * is optimal.
+     */
+    double atvr = 0.0;
+};
+
+/**
+ * Count the vertices and triangles of @p mesh, and simulate a FIFO vertex cache of size
+ * @p cacheSize when drawing the triangles of all index buffers in order. Meshes without index
+ * buffers are drawn using their default mesh info.
+ */
+IVW_MODULE_BASE_API MeshStatistics computeStatistics(const Mesh& mesh, size_t cacheSize = 16);
+
+/**
+ * The number of cache misses per triangle of a FIFO vertex cache of size @p cacheSize when
+ * drawing the triangle list @p indices.
+ */
+IVW_MODULE_BASE_API double averageCacheMissRatio(std::span<const std::uint32_t> indices,
+                                                 size_t cacheSize = 16);
+
+/**
+ * Find the vertices of @p mesh that can be merged. Vertices are merged if their positions are
+ * at most @p tolerance times the largest side of the bounding box apart, and all components of
+ * their other buffers differ by at most @p attributeTolerance. A negative @p attributeTolerance
+ * only compares the positions. The vertices are hashed into a grid with cells of the size of the
+ * tolerance, and the neighboring cells of each vertex are searched in parallel.
+ *
+ * @return the vertex each vertex is merged into. Each vertex is merged into the first vertex
+ *         within tolerance of it, or of the vertex that one is merged into, hence the result is
+ *         never larger than the index of the vertex itself.
+ * @throws Exception if @p mesh has no position buffer
+ */
+IVW_MODULE_BASE_API std::vector<std::uint32_t> weldVertices(const Mesh& mesh, double tolerance,
+                                                            double attributeTolerance = 0.0);
+
+/**
+ * Reorder the triangle list @p indices to reduce the cache misses of a vertex cache of size
+ * @p cacheSize, using Tipsify (Sander et al., Fast Triangle Reordering for Vertex Locality and
+ * Reduced Overdraw, 2007). The vertices of each triangle keep their order.
+ */
+IVW_MODULE_BASE_API std::vector<std::uint32_t> optimizeVertexCache(
+    std::span<const std::uint32_t> indices, size_t vertexCount, size_t cacheSize = 16);
+
+/**
+ * Optimize @p mesh for rendering. Depending on @p settings, duplicated vertices are welded,
+ * degenerate primitives are removed, and triangles and vertices are reordered for the vertex
+ * cache and for vertex fetch locality. Vertices not used by any index buffer are always removed.
+ * Triangle index buffers are converted to triangle lists, other index buffers keep their mesh
+ * info. A mesh without index buffers gets one with its default mesh info.
+ *
+ * @throws Exception if @p mesh has no position buffer
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Mesh> optimize(const Mesh& mesh,
+                                                   const MeshOptimizationSettings& settings = {});
+
+}  // namespace meshutil
+
+}  // namespace inviwo
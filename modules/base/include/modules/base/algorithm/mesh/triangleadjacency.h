@@ -0,0 +1,117 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/datastructures/geometry/mesh.h>  // for Mesh, Mesh::MeshInfo
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <limits>   // for numeric_limits
+#include <vector>   // for vector
+
+namespace inviwo {
+
+class IndexBuffer;
+
+namespace meshutil {
+
+/**
+ * \brief Edge adjacency of the triangles of a mesh.
+ *
+ * The triangles are stored as a flat list of vertex indices, three per triangle. Half edge
+ * 3 * t + i goes from corner i to corner (i + 1) % 3 of triangle t, hence next, previous and the
+ * triangle of a half edge follow from its index. The only stored adjacency is the twin of each
+ * half edge, the first half edge of another triangle that goes in the opposite direction, or
+ * noTwin at a boundary. Meshes where an edge is shared by more than two triangles are supported,
+ * but then twins are not necessarily mutual.
+ *
+ * The twins are found by bucketing the half edges by their lowest vertex index with a parallel
+ * counting sort, and then matching the half edges within each bucket, also in parallel. This
+ * uses about 8 bytes per half edge and 8 bytes per vertex of temporary memory.
+ */
+class IVW_MODULE_BASE_API TriangleAdjacency {
+public:
+    static constexpr std::uint32_t noTwin = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * Construct from a list of vertex indices, three per triangle.
+     */
+    explicit TriangleAdjacency(std::vector<std::uint32_t> indices);
+    /**
+     * Construct from the triangles of @p indexBuffer.
+     */
+    TriangleAdjacency(Mesh::MeshInfo info, const IndexBuffer& indexBuffer);
+    /**
+     * Construct from all triangle index buffers of @p mesh. The triangles of each index buffer
+     * follow the triangles of the previous one.
+     */
+    explicit TriangleAdjacency(const Mesh& mesh);
+
+    size_t getNumberOfTriangles() const { return indices_.size() / 3; }
+    size_t getNumberOfHalfEdges() const { return indices_.size(); }
+
+    const std::vector<std::uint32_t>& getIndices() const { return indices_; }
+    const std::vector<std::uint32_t>& getTwins() const { return twins_; }
+
+    static std::uint32_t triangle(std::uint32_t halfEdge) { return halfEdge / 3; }
+    static std::uint32_t next(std::uint32_t halfEdge) {
+        return halfEdge % 3 == 2 ? halfEdge - 2 : halfEdge + 1;
+    }
+    static std::uint32_t prev(std::uint32_t halfEdge) {
+        return halfEdge % 3 == 0 ? halfEdge + 2 : halfEdge - 1;
+    }
+
+    std::uint32_t from(std::uint32_t halfEdge) const { return indices_[halfEdge]; }
+    std::uint32_t to(std::uint32_t halfEdge) const { return indices_[next(halfEdge)]; }
+    std::uint32_t twin(std::uint32_t halfEdge) const { return twins_[halfEdge]; }
+    bool isBoundary(std::uint32_t halfEdge) const { return twins_[halfEdge] == noTwin; }
+
+    /**
+     * All half edges without a twin, in increasing order
+     */
+    std::vector<std::uint32_t> getBoundaryEdges() const;
+
+    /**
+     * The boundary edges joined into loops of vertex indices, following the direction of the
+     * half edges. A boundary that does not close, which can happen for non-manifold meshes, is
+     * returned as an open chain.
+     */
+    std::vector<std::vector<std::uint32_t>> getBoundaryLoops() const;
+
+private:
+    std::vector<std::uint32_t> indices_;
+    std::vector<std::uint32_t> twins_;
+};
+
+}  // namespace meshutil
+
+}  // namespace inviwo
@@ -195,7 +195,7 @@ void forEachTriangle(const Mesh::MeshInfo& info, const IndexBuffer& ib, Callback
 
     else if (info.ct == ConnectivityType::Strip) {
         for (size_t i = 0; i < ram.size() - 2; ++i) {
-            if (1 % 2 == 0) {
+            if (i % 2 == 0) {
                 std::invoke(callback, ram[i], ram[i + 1], ram[i + 2]);
             } else {
                 std::invoke(callback, ram[i + 1], ram[i], ram[i + 2]);
@@ -205,7 +205,7 @@ void forEachTriangle(const Mesh::MeshInfo& info, const IndexBuffer& ib, Callback
 
     else if (info.ct == ConnectivityType::Fan) {
         uint32_t a = static_cast<uint32_t>(ram.front());
-        for (size_t i = 1; i < ram.size(); ++i) {
+        for (size_t i = 1; i + 1 < ram.size(); ++i) {
             std::invoke(callback, a, ram[i], ram[i + 1]);
         }
     }
@@ -220,8 +220,8 @@ void forEachTriangle(const Mesh::MeshInfo& info, const IndexBuffer& ib, Callback
 
     else if (info.ct == ConnectivityType::StripAdjacency) {
         if (ram.size() < 6) return;
-        for (size_t i = 0; i < ram.size(); i += 2) {
-            if (1 % 2 == 0) {
+        for (size_t i = 0; i + 4 < ram.size(); i += 2) {
+            if ((i / 2) % 2 == 0) {
                 std::invoke(callback, ram[i], ram[i + 2], ram[i + 4]);
             } else {
                 std::invoke(callback, ram[i + 2], ram[i], ram[i + 4]);
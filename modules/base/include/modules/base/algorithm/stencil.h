@@ -0,0 +1,208 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/core/datastructures/image/imagetypes.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include <glm/common.hpp>
+
+namespace inviwo::util {
+
+namespace detail {
+
+inline std::ptrdiff_t wrapIndex(std::ptrdiff_t i, std::ptrdiff_t size, Wrapping wrapping) {
+    switch (wrapping) {
+        case Wrapping::Repeat: {
+            const auto r = i % size;
+            return r < 0 ? r + size : r;
+        }
+        case Wrapping::Mirror: {
+            const auto period = 2 * size;
+            auto r = i % period;
+            if (r < 0) r += period;
+            return r < size ? r : period - 1 - r;
+        }
+        case Wrapping::Clamp:
+        default:
+            return std::clamp(i, std::ptrdiff_t{0}, size - 1);
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Neighborhood of a voxel in the interior of a volume, i.e. where all neighbors within the stencil
+ * radius are inside the volume. The neighbors are read using linear offsets from the center
+ * without any bounds checks. With constant arguments, as in `n(1, 0, 0) - n(-1, 0, 0)`, the
+ * offsets fold into constant displacements.
+ */
+template <typename T>
+class InteriorNeighborhood {
+public:
+    InteriorNeighborhood(const T* center, std::ptrdiff_t strideY, std::ptrdiff_t strideZ)
+        : center_{center}, strideY_{strideY}, strideZ_{strideZ} {}
+
+    const T& operator()(int dx, int dy = 0, int dz = 0) const {
+        return center_[dx + dy * strideY_ + dz * strideZ_];
+    }
+
+private:
+    const T* center_;
+    std::ptrdiff_t strideY_;
+    std::ptrdiff_t strideZ_;
+};
+
+/**
+ * Neighborhood of a voxel close to the border of a volume. Neighbors outside of the volume are
+ * mapped back into it using the wrapping of the source.
+ */
+template <typename T>
+class BoundaryNeighborhood {
+public:
+    BoundaryNeighborhood(const T* data, const i64vec3& dims, const i64vec3& pos,
+                         const Wrapping3D& wrapping)
+        : data_{data}, dims_{dims}, pos_{pos}, wrapping_{wrapping} {}
+
+    const T& operator()(int dx, int dy = 0, int dz = 0) const {
+        const auto x = coord(0, pos_.x + dx);
+        const auto y = coord(1, pos_.y + dy);
+        const auto z = coord(2, pos_.z + dz);
+        return data_[x + dims_.x * (y + dims_.y * z)];
+    }
+
+private:
+    std::ptrdiff_t coord(int axis, std::ptrdiff_t i) const {
+        if (i >= 0 && i < dims_[axis]) return i;
+        return detail::wrapIndex(i, dims_[axis], wrapping_[axis]);
+    }
+
+    const T* data_;
+    i64vec3 dims_;
+    i64vec3 pos_;
+    Wrapping3D wrapping_;
+};
+
+/**
+ * Evaluate @p kernel for every voxel of a volume with dimensions @p dims and write the results to
+ * @p dst. The kernel is called with either an InteriorNeighborhood or a BoundaryNeighborhood and
+ * should be a generic lambda, like
+ * ```{.cpp}
+ * util::forEachStencil<1>(src, dst, dims, wrapping, [](const auto& n) {
+ *     return n(1, 0, 0) - n(-1, 0, 0);
+ * });
+ * ```
+ * Voxels further than @p Radius from the border along all axes form the interior, where the
+ * kernel reads its neighbors without any bounds checks or wrapping. Only the remaining shell of
+ * voxels goes through the wrapping. The volume is split into slabs of consecutive rows that are
+ * processed in parallel on the thread pool.
+ *
+ * @tparam Radius  largest offset along any axis that the kernel reads
+ * @tparam Dims    number of axes the kernel reads along, 2 for layers where the kernel only reads
+ *                 neighbors with a z offset of zero
+ */
+template <int Radius, int Dims = 3, typename T, typename U, typename Kernel>
+void forEachStencil(const T* src, U* dst, size3_t dims, const Wrapping3D& wrapping,
+                    Kernel&& kernel) {
+    static_assert(Radius >= 0, "The stencil radius can not be negative");
+    static_assert(Dims == 2 || Dims == 3, "Only 2D and 3D stencils are supported");
+
+    const i64vec3 size{dims};
+    const auto radius = [&](int axis) -> std::ptrdiff_t {
+        return axis < Dims ? std::min<std::ptrdiff_t>(Radius, size[axis]) : 0;
+    };
+    const i64vec3 lower{radius(0), radius(1), radius(2)};
+    const i64vec3 upper = glm::max(lower, size - lower);
+    const auto strideY = size.x;
+    const auto strideZ = size.x * size.y;
+
+    const auto rows = dims.y * dims.z;
+    util::forEachChunkParallel(rows, [&](size_t begin, size_t end) {
+        for (auto row = static_cast<std::ptrdiff_t>(begin); row < static_cast<std::ptrdiff_t>(end);
+             ++row) {
+            const auto y = row % size.y;
+            const auto z = row / size.y;
+            const auto offset = row * strideY;
+
+            const auto boundary = [&](std::ptrdiff_t x) {
+                dst[offset + x] =
+                    kernel(BoundaryNeighborhood<T>{src, size, i64vec3{x, y, z}, wrapping});
+            };
+
+            if (y < lower.y || y >= upper.y || z < lower.z || z >= upper.z) {
+                for (std::ptrdiff_t x = 0; x < size.x; ++x) boundary(x);
+                continue;
+            }
+
+            for (std::ptrdiff_t x = 0; x < lower.x; ++x) boundary(x);
+            for (std::ptrdiff_t x = lower.x; x < upper.x; ++x) {
+                dst[offset + x] =
+                    kernel(InteriorNeighborhood<T>{src + offset + x, strideY, strideZ});
+            }
+            for (std::ptrdiff_t x = upper.x; x < size.x; ++x) boundary(x);
+        }
+    });
+}
+
+/**
+ * Evaluate @p kernel for every voxel of @p src and write the result to the voxel in @p dst.
+ * @see forEachStencil(const T*, U*, size3_t, const Wrapping3D&, Kernel&&)
+ * @pre @p src and @p dst have the same dimensions
+ */
+template <int Radius, typename T, typename U, typename Kernel>
+void forEachStencil(const VolumeRAMPrecision<T>& src, VolumeRAMPrecision<U>& dst,
+                    Kernel&& kernel) {
+    forEachStencil<Radius>(src.getDataTyped(), dst.getDataTyped(), src.getDimensions(),
+                           src.getWrapping(), std::forward<Kernel>(kernel));
+}
+
+/**
+ * Evaluate @p kernel for every pixel of @p src and write the result to the pixel in @p dst. The
+ * kernel is called with a neighborhood `n` where `n(dx, dy)` reads the pixel at offset
+ * (dx, dy).
+ * @see forEachStencil(const T*, U*, size3_t, const Wrapping3D&, Kernel&&)
+ * @pre @p src and @p dst have the same dimensions
+ */
+template <int Radius, typename T, typename U, typename Kernel>
+void forEachStencil(const LayerRAMPrecision<T>& src, LayerRAMPrecision<U>& dst, Kernel&& kernel) {
+    const auto wrapping = src.getWrapping();
+    forEachStencil<Radius, 2>(src.getDataTyped(), dst.getDataTyped(),
+                              size3_t{src.getDimensions(), 1},
+                              Wrapping3D{wrapping[0], wrapping[1], Wrapping::Clamp},
+                              std::forward<Kernel>(kernel));
+}
+
+}  // namespace inviwo::util
@@ -0,0 +1,108 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <modules/base/basemoduledefine.h>
+
+#include <inviwo/core/util/formats.h>
+
+#include <memory>
+
+namespace inviwo {
+
+class DataMapper;
+class Layer;
+class LayerRAM;
+class TFPrimitiveSet;
+class Volume;
+class VolumeRAM;
+
+namespace util {
+
+struct TFMappingOptions {
+    /// channel of the input that is mapped through the transfer function
+    size_t channel = 0;
+    /// format of the result, either DataVec4Float32 or DataVec4UInt8
+    const DataFormatBase* format = DataVec4Float32::get();
+    /// number of samples of the transfer function lookup table
+    size_t lutSize = 1024;
+};
+
+/**
+ * Map a channel of @p volume through the transfer function or iso value collection @p tf on the
+ * CPU and return the resulting RGBA colors. The values are normalized with @p dataMap, mapping the
+ * data range onto the [0,1] range of @p tf, and are then looked up in a table of
+ * TFMappingOptions::lutSize samples of @p tf with linear interpolation. This matches the color
+ * mapping done on the GPU, where the transfer function is sampled as a linearly filtered texture,
+ * and values outside of the data range are clamped to the colors at the ends. NaN values, and all
+ * values of a degenerate data range where min equals max, get the color of the first sample.
+ *
+ * 8 and 16-bit integer formats are mapped with a single table lookup per value, using a table
+ * holding the color of every representable value. The work is split into slabs of slices that are
+ * processed in parallel.
+ *
+ * @throws Exception if TFMappingOptions::channel is not a channel of @p volume or if the output
+ * format is not supported
+ */
+IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> applyTF(const VolumeRAM& volume,
+                                                       const DataMapper& dataMap,
+                                                       const TFPrimitiveSet& tf,
+                                                       const TFMappingOptions& options = {});
+
+/**
+ * Map a channel of @p layer through @p tf on the CPU, processing the rows of @p layer in parallel.
+ * @see applyTF(const VolumeRAM&, const DataMapper&, const TFPrimitiveSet&,
+ * const TFMappingOptions&)
+ */
+IVW_MODULE_BASE_API std::shared_ptr<LayerRAM> applyTF(const LayerRAM& layer,
+                                                      const DataMapper& dataMap,
+                                                      const TFPrimitiveSet& tf,
+                                                      const TFMappingOptions& options = {});
+
+/**
+ * Map a channel of @p volume through @p tf using the data map of @p volume. The result keeps the
+ * meta data and spatial information of @p volume.
+ * @see applyTF(const VolumeRAM&, const DataMapper&, const TFPrimitiveSet&,
+ * const TFMappingOptions&)
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Volume> applyTF(const Volume& volume, const TFPrimitiveSet& tf,
+                                                    const TFMappingOptions& options = {});
+
+/**
+ * Map a channel of @p layer through @p tf using the data map of @p layer. The result keeps the
+ * meta data and spatial information of @p layer.
+ * @see applyTF(const LayerRAM&, const DataMapper&, const TFPrimitiveSet&,
+ * const TFMappingOptions&)
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Layer> applyTF(const Layer& layer, const TFPrimitiveSet& tf,
+                                                   const TFMappingOptions& options = {});
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -31,31 +31,24 @@
 
 #include <inviwo/core/datastructures/volume/volume.h>  // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>
-#include <inviwo/core/util/exception.h>          // for Exception
-#include <inviwo/core/util/formatdispatching.h>  // for Scalars, PrecisionValueType
-#include <inviwo/core/util/glmconvert.h>         // for glm_convert_normalized
-#include <inviwo/core/util/glmutils.h>           // for Vector, Matrix
-#include <inviwo/core/util/glmvec.h>             // for i64vec3, size3_t
-#include <inviwo/core/util/indexmapper.h>        // for IndexMapper
-#include <inviwo/core/util/logcentral.h>         // for LogCentral
-#include <inviwo/core/util/stringconversion.h>   // for toString
-
-#include <cstdlib>    // for size_t, abs
-#include <algorithm>  // for min
-#include <cmath>      // for sqrt
-#include <string>     // for operator+, basic_string, string
-#include <vector>     // for vector
+#include <inviwo/core/util/exception.h>                // for Exception
+#include <inviwo/core/util/formatdispatching.h>        // for Scalars, PrecisionValueType
+#include <inviwo/core/util/glmconvert.h>               // for glm_convert_normalized
+#include <inviwo/core/util/glmutils.h>                 // for Vector, Matrix
+#include <inviwo/core/util/glmvec.h>                   // for i64vec3, size3_t
+#include <inviwo/core/util/indexmapper.h>              // for IndexMapper
+#include <inviwo/core/util/logcentral.h>               // for LogCentral
+#include <inviwo/core/util/stringconversion.h>         // for toString
+#include <modules/base/algorithm/distancetransform.h>  // for distanceTransform, DistanceType
+
+#include <cstdlib>  // for size_t, abs
+#include <cmath>    // for sqrt
+#include <string>   // for operator+, basic_string, string
 
 #include <glm/fwd.hpp>     // for int64
 #include <glm/matrix.hpp>  // for transpose
 #include <glm/vec3.hpp>    // for vec<>::(anonymous), operator*, ope...
 
-#ifdef IVW_USE_OPENMP
-#include <thread>
-
-#include <omp.h>
-#endif
-
 namespace inviwo {
 class VolumeRAM;
 template <typename T>
@@ -64,19 +57,23 @@ class VolumeRAMPrecision;
 namespace util {
 
 /**
- *	Implementation of Euclidean Distance Transform according to Saito's algorithm:
- *  T. Saito and J.I. Toriwaki. New algorithms for Euclidean distance transformations
- *  of an n-dimensional digitized picture with applications. Pattern Recognition, 27(11).
- *  pp. 1551-1565, 1994.
- *  http://www.cs.jhu.edu/~misha/ReadingSeminar/Papers/Saito94.pdf
+ * Exact Euclidean Distance Transform in linear time using the lower envelope algorithm of
+ * Felzenszwalb and Huttenlocher / Meijster et al., see util::squaredDistanceTransform.
+ * The computation is distributed over the Inviwo thread pool.
  *
- * Calculates the distance in grid index space
+ * Calculates the distance in basis space
  *     * Predicate is a function of type (const T &value) -> bool to deside if a value in the input
  *       is a "feature".
  *     * ValueTransform is a function of type (const U& squaredDist) -> U that is appiled to all
  *       squared distance values at the end of the calculation.
  *     * ProcessCallback is a function of type (double progress) -> void that is called with a value
  *       from 0 to 1 to indicate the progress of the calculation.
+ *
+ * @param outFeatures optional feature transform output, will hold the linear index into
+ *        @p outDistanceField of the closest feature of each voxel or -1 if there are no features.
+ *        Needs to have the same dimensions as @p outDistanceField. Can be nullptr.
+ * @param type for DistanceType::Signed features get the negated distance to the closest
+ *        non-feature.
  */
 template <typename T, typename U, typename Predicate, typename ValueTransform,
           typename ProgressCallback>
@@ -85,6 +82,15 @@ void volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                                 const size3_t& upsample, Predicate predicate,
                                 ValueTransform valueTransform, ProgressCallback progress);
 
+template <typename T, typename U, typename Predicate, typename ValueTransform,
+          typename ProgressCallback>
+void volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
+                                VolumeRAMPrecision<U>* outDistanceField,
+                                VolumeRAMPrecision<glm::i64>* outFeatures,
+                                const Matrix<3, U>& basis, const size3_t& upsample,
+                                Predicate predicate, ValueTransform valueTransform,
+                                ProgressCallback progress, DistanceType type);
+
 template <typename T, typename U>
 void volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                                 VolumeRAMPrecision<U>* outDistanceField, const Matrix<3, U>& basis,
@@ -107,7 +113,6 @@ void volumeDistanceTransform(const Volume* inVolume, VolumeRAMPrecision<U>* outD
 
 }  // namespace util
 
-// NOLINTBEGIN(readability-function-cognitive-complexity)
 template <typename T, typename U, typename Predicate, typename ValueTransform,
           typename ProgressCallback>
 void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
@@ -115,19 +120,23 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                                       const Matrix<3, U>& basis, const size3_t& upsample,
                                       Predicate predicate, ValueTransform valueTransform,
                                       ProgressCallback progress) {
+    util::volumeRAMDistanceTransform(inVolume, outDistanceField, nullptr, basis, upsample,
+                                     predicate, valueTransform, progress,
+                                     DistanceType::Unsigned);
+}
 
-#ifdef IVW_USE_OPENMP
-    omp_set_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
-#endif
+template <typename T, typename U, typename Predicate, typename ValueTransform,
+          typename ProgressCallback>
+void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
+                                      VolumeRAMPrecision<U>* outDistanceField,
+                                      VolumeRAMPrecision<glm::i64>* outFeatures,
+                                      const Matrix<3, U>& basis, const size3_t& upsample,
+                                      Predicate predicate, ValueTransform valueTransform,
+                                      ProgressCallback progress, DistanceType type) {
 
     using int64 = glm::int64;
 
-    auto square = [](auto a) { return a * a; };
-
-    progress(0.0);
-
     const auto src = inVolume->getView();
-    auto dst = outDistanceField->getView();
 
     const i64vec3 srcDim{inVolume->getDimensions()};
     const i64vec3 dstDim{outDistanceField->getDimensions()};
@@ -136,7 +145,6 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
     const auto squareBasis = glm::transpose(basis) * basis;
     const Vector<3, U> squareBasisDiag{squareBasis[0][0], squareBasis[1][1], squareBasis[2][2]};
     const Vector<3, U> squareVoxelSize{squareBasisDiag / Vector<3, U>{dstDim * dstDim}};
-    const Vector<3, U> invSquareVoxelSize{Vector<3, U>{1.0f} / squareVoxelSize};
 
     {
         const auto maxdist = glm::compMax(squareBasisDiag);
@@ -164,136 +172,21 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
             "DistanceTransformRAM: Dimensions does not match src = {} dst = {} scaling = {}",
             srcDim, dstDim, sm);
     }
-
-    const util::IndexMapper<3, int64> srcInd(srcDim);
-    const util::IndexMapper<3, int64> dstInd(dstDim);
-
-    auto is_feature = [&](const int64 x, const int64 y, const int64 z) {
-        return predicate(src[srcInd(x / sm.x, y / sm.y, z / sm.z)]);
-    };
-
-// first pass, forward and backward scan along x
-// result: min distance in x direction
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 z = 0; z < dstDim.z; ++z) {
-        for (int64 y = 0; y < dstDim.y; ++y) {
-            // forward
-            U dist = static_cast<U>(dstDim.x);
-            for (int64 x = 0; x < dstDim.x; ++x) {
-                if (!is_feature(x, y, z)) {
-                    ++dist;
-                } else {
-                    dist = U(0);
-                }
-                dst[dstInd(x, y, z)] = squareVoxelSize.x * square(dist);
-            }
-
-            // backward
-            dist = static_cast<U>(dstDim.x);
-            for (int64 x = dstDim.x - 1; x >= 0; --x) {
-                if (!is_feature(x, y, z)) {
-                    ++dist;
-                } else {
-                    dist = U(0);
-                }
-                dst[dstInd(x, y, z)] =
-                    std::min<U>(dst[dstInd(x, y, z)], squareVoxelSize.x * square(dist));
-            }
-        }
-    }
-
-    // second pass, scan y direction
-    // for each voxel v(x,y,z) find min_i(data(x,i,z) + (y - i)^2), 0 <= i < dimY
-    // result: min distance in x and y direction
-    progress(0.3);
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel
-#endif
-    {
-        std::vector<U> buff;
-        buff.resize(dstDim.y);
-#ifdef IVW_USE_OPENMP
-#pragma omp for
-#endif
-        for (int64 z = 0; z < dstDim.z; ++z) {
-            for (int64 x = 0; x < dstDim.x; ++x) {
-
-                // cache column data into temporary buffer
-                for (int64 y = 0; y < dstDim.y; ++y) {
-                    buff[y] = dst[dstInd(x, y, z)];
-                }
-
-                for (int64 y = 0; y < dstDim.y; ++y) {
-                    auto d = buff[y];
-                    if (d != U(0)) {
-                        const auto rMax =
-                            static_cast<int64>(std::sqrt(d * invSquareVoxelSize.y)) + 1;
-                        const auto rStart = std::min(rMax, y - 1);
-                        const auto rEnd = std::min(rMax, dstDim.y - y);
-                        for (int64 n = -rStart; n < rEnd; ++n) {
-                            const auto w = buff[y + n] + squareVoxelSize.y * square(n);
-                            if (w < d) d = w;
-                        }
-                    }
-                    dst[dstInd(x, y, z)] = d;
-                }
-            }
-        }
+    if (outFeatures && i64vec3{outFeatures->getDimensions()} != dstDim) {
+        throw Exception(SourceContext{},
+                        "DistanceTransformRAM: Feature dimensions does not match dst = {} "
+                        "features = {}",
+                        dstDim, outFeatures->getDimensions());
     }
 
-    // third pass, scan z direction
-    // for each voxel v(x,y,z) find min_i(data(x,y,i) + (z - i)^2), 0 <= i < dimZ
-    // result: min distance in x and y direction
-    progress(0.6);
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel
-#endif
-    {
-        std::vector<U> buff;
-        buff.resize(dstDim.z);
-#ifdef IVW_USE_OPENMP
-#pragma omp for
-#endif
-        for (int64 y = 0; y < dstDim.y; ++y) {
-            for (int64 x = 0; x < dstDim.x; ++x) {
-
-                // cache column data into temporary buffer
-                for (int64 z = 0; z < dstDim.z; ++z) {
-                    buff[z] = dst[dstInd(x, y, z)];
-                }
+    const util::IndexMapper<3, int64> srcInd(srcDim);
 
-                for (int64 z = 0; z < dstDim.z; ++z) {
-                    auto d = buff[z];
-                    if (d != U(0)) {
-                        const auto rMax =
-                            static_cast<int64>(std::sqrt(d * invSquareVoxelSize.z)) + 1;
-                        const auto rStart = std::min(rMax, z - 1);
-                        const auto rEnd = std::min(rMax, dstDim.z - z);
-                        for (int64 n = -rStart; n < rEnd; ++n) {
-                            const auto w = buff[z + n] + squareVoxelSize.z * square(n);
-                            if (w < d) d = w;
-                        }
-                    }
-                    dst[dstInd(x, y, z)] = d;
-                }
-            }
-        }
-    }
+    const auto isFeature = [&](const i64vec3& pos) { return predicate(src[srcInd(pos / sm)]); };
 
-    // scale data
-    progress(0.9);
-    const int64 volSize = dstDim.x * dstDim.y * dstDim.z;
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 i = 0; i < volSize; ++i) {
-        dst[i] = valueTransform(dst[i]);
-    }
-    progress(1.0);
+    util::distanceTransform<3>(dstDim, squareVoxelSize, isFeature, valueTransform,
+                               outDistanceField->getDataTyped(),
+                               outFeatures ? outFeatures->getDataTyped() : nullptr, type, progress);
 }
-// NOLINTEND(readability-function-cognitive-complexity)
 
 template <typename T, typename U>
 void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
@@ -40,8 +40,24 @@ class VolumeRAM;
 
 namespace util {
 
-enum class DownsamplingMode { Strided, Averaged };
+/**
+ * Reduction used when downsampling a volume. Each output voxel is computed from a block of
+ * `strides` input voxels.
+ *  * __Strided__ take the first voxel of the block
+ *  * __Averaged__ the mean of the block
+ *  * __Maximum__ the component-wise maximum of the block
+ *  * __Minimum__ the component-wise minimum of the block
+ *  * __Median__ the component-wise median of the block, the lower median for even block sizes
+ *  * __Mode__ the most frequent value of the block, the smallest one in case of ties. Use this
+ *    for label volumes / segmentations.
+ */
+enum class DownsamplingMode { Strided, Averaged, Maximum, Minimum, Median, Mode };
 
+/**
+ * Downsample the volume @p in by the factors in @p strides using @p mode. The output dimensions
+ * are `in->getDimensions() / strides`, remaining voxels are ignored. All data formats are
+ * supported, the work is distributed over the Inviwo thread pool.
+ */
 IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeDownsample(const VolumeRAM* in,
                                                                 size3_t strides,
                                                                 DownsamplingMode mode);
@@ -52,6 +68,18 @@ IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeStridedDownsample(const Vol
 IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeAveragedDownsample(const VolumeRAM* in,
                                                                         size3_t strides);
 
+IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeMaximumDownsample(const VolumeRAM* in,
+                                                                       size3_t strides);
+
+IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeMinimumDownsample(const VolumeRAM* in,
+                                                                       size3_t strides);
+
+IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeMedianDownsample(const VolumeRAM* in,
+                                                                      size3_t strides);
+
+IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeModeDownsample(const VolumeRAM* in,
+                                                                    size3_t strides);
+
 }  // namespace util
 
 }  // namespace inviwo
@@ -37,6 +37,7 @@
 #include <memory>  // for shared_ptr
 
 namespace inviwo {
+class Volume;
 class VolumeRAM;
 class VolumeRepresentation;
 
@@ -48,4 +49,16 @@ public:
                                             bool clampBorderOutsideVolume = true);
 };
 
+namespace util {
+
+/**
+ * Read only the z slices [begin, end) of @p volume from disk. This is possible if the volume
+ * has no VolumeRAM representation yet and its VolumeDisk has a loader that implements
+ * VolumeSliceLoader. Otherwise nullptr is returned and the full VolumeRAM should be used.
+ */
+IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> loadSlicesFromDisk(const Volume& volume,
+                                                                  size_t begin, size_t end);
+
+}  // namespace util
+
 }  // namespace inviwo
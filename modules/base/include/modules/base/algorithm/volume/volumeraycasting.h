@@ -0,0 +1,120 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/datastructures/light/lightingstate.h>  // for LightingState
+#include <inviwo/core/util/glmvec.h>                         // for size3_t, vec2, size2_t
+
+#include <memory>  // for shared_ptr
+#include <vector>  // for vector
+
+namespace inviwo {
+
+class Camera;
+class Image;
+class TransferFunction;
+class Volume;
+
+namespace util {
+
+/**
+ * The normalized minimum and maximum values of one channel of a volume for blocks of
+ * blockSize^3 voxels. Each block also includes the first voxel of the next block along each
+ * axis, so that every trilinearly interpolated sample whose lower corner voxel lies inside a
+ * block is bounded by the range of the block. Used for empty space skipping in
+ * util::volumeRaycast, and can be kept between frames as long as the volume does not change.
+ */
+class IVW_MODULE_BASE_API MinMaxBlockGrid {
+public:
+    MinMaxBlockGrid(const Volume& volume, size_t channel, size_t blockSize = 8);
+
+    /**
+     * The number of blocks along each axis
+     */
+    const size3_t& getDimensions() const { return dims_; }
+    size_t getBlockSize() const { return blockSize_; }
+    size_t getChannel() const { return channel_; }
+
+    /**
+     * The normalized min and max value of @p block
+     */
+    const vec2& operator[](const size3_t& block) const {
+        return minMax_[block.x + dims_.x * (block.y + dims_.y * block.z)];
+    }
+    const std::vector<vec2>& getData() const { return minMax_; }
+
+private:
+    size3_t dims_;
+    size_t blockSize_;
+    size_t channel_;
+    std::vector<vec2> minMax_;
+};
+
+struct VolumeRaycastingSettings {
+    /// The volume channel to render
+    size_t channel = 0;
+    /// Samples per voxel along the ray, same as the sampling rate of the GL raycaster
+    float samplingRate = 2.0f;
+    /// Width and height in pixels of the tiles that are distributed over the thread pool
+    size_t tileSize = 16;
+    /// Number of entries in the transfer function lookup table
+    size_t tfResolution = 1024;
+};
+
+/**
+ * Direct volume rendering on the CPU, for producing images without an OpenGL context.
+ * Follows the volume raycaster of the basegl module: rays go from the near to the far plane of
+ * @p camera and are clipped against the volume, the volume is trilinearly sampled with
+ * settings.samplingRate samples per voxel and classified with a lookup table of @p tf. Samples
+ * with a non-zero opacity are shaded with @p lighting using world space central difference
+ * gradients, and composited front-to-back with opacity correction and early ray termination at
+ * an opacity of 0.99. The image is split into tiles that are rendered in parallel on the thread
+ * pool. If @p grid is given, all samples in blocks that are completely transparent for @p tf
+ * are skipped, this does not change the result.
+ *
+ * @param volume      the volume to render
+ * @param tf          the transfer function, applied to the normalized values of the channel
+ * @param camera      the camera, its aspect ratio should match @p dimensions
+ * @param lighting    the light source and the shading mode
+ * @param dimensions  the size of the output image
+ * @param settings    sampling and parallelization settings
+ * @param grid        optional min max block grid of the same volume and channel
+ * @return an image with a RGBA8 color layer holding premultiplied colors
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Image> volumeRaycast(
+    const Volume& volume, const TransferFunction& tf, const Camera& camera,
+    const LightingState& lighting, size2_t dimensions,
+    const VolumeRaycastingSettings& settings = {}, const MinMaxBlockGrid* grid = nullptr);
+
+}  // namespace util
+
+}  // namespace inviwo
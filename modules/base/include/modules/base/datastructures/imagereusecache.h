@@ -35,6 +35,7 @@
 #include <inviwo/core/datastructures/image/layer.h>  // for Layer
 #include <inviwo/core/util/formats.h>                // for DataFormat
 #include <inviwo/core/util/glmvec.h>                 // for size2_t
+#include <inviwo/core/resourcemanager/resourcepool.h>  // for ResourcePool
 
 #include <memory>       // for shared_ptr, make_shared
 #include <utility>      // for pair
@@ -47,18 +48,37 @@ class LayerRAM;
 template <typename T>
 class LayerRAMPrecision;
 
+/**
+ * @brief Provides a bounded pool of images that are not used elsewhere anymore.
+ *
+ * Images added to the cache are handed out again once no one else holds a reference to them.
+ * Unused images are evicted in least recently used order when the cache exceeds its budget.
+ * @see ResourcePool
+ */
 class IVW_MODULE_BASE_API ImageReuseCache {
 public:
-    ImageReuseCache() = default;
+    static constexpr size_t defaultBudget = 64 * 1024 * 1024;
+
+    explicit ImageReuseCache(size_t budget = defaultBudget);
 
+    /**
+     * Returns the most recently used unused image, or nullptr if there is none.
+     */
     std::shared_ptr<Image> getUnused();
+    /**
+     * Returns an unused image with a single color layer of the given dimensions and format or
+     * nullptr if there is none.
+     */
+    std::shared_ptr<Image> getUnused(const size2_t& dim, const DataFormatBase* format);
 
     template <typename T>
     std::pair<std::shared_ptr<Image>, LayerRAMPrecision<T>*> getTypedUnused(const size2_t& dim);
     void add(std::shared_ptr<Image> image);
 
+    const ResourcePool<Image>& getPool() const { return pool_; }
+
 private:
-    std::vector<std::shared_ptr<Image>> imageCache_;
+    ResourcePool<Image> pool_;
 };
 
 template <typename T>
@@ -67,9 +87,7 @@ std::pair<std::shared_ptr<Image>, LayerRAMPrecision<T>*> ImageReuseCache::getTyp
 
     std::pair<std::shared_ptr<Image>, LayerRAMPrecision<T>*> res;
 
-    auto reuse = getUnused();
-
-    if (reuse && reuse->getDataFormat() == DataFormat<T>::get() && reuse->getDimensions() == dim) {
+    if (auto reuse = getUnused(dim, DataFormat<T>::get())) {
         res.first = reuse;
         res.second = static_cast<LayerRAMPrecision<T>*>(
             reuse->getColorLayer()->getEditableRepresentation<LayerRAM>());
@@ -0,0 +1,272 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/datastructures/datasequence.h>       // for DataSequence
+#include <inviwo/core/datastructures/image/layer.h>        // for Layer
+#include <inviwo/core/datastructures/image/layerdisk.h>    // for LayerDisk
+#include <inviwo/core/datastructures/image/layerram.h>     // for LayerRAM
+#include <inviwo/core/datastructures/volume/volume.h>      // for Volume
+#include <inviwo/core/datastructures/volume/volumedisk.h>  // for VolumeDisk
+#include <inviwo/core/datastructures/volume/volumeram.h>   // for VolumeRAM
+#include <inviwo/core/util/threadutil.h>                   // for dispatchPool, getPoolSize
+
+#include <algorithm>      // for min
+#include <chrono>         // for duration, steady_clock
+#include <cstddef>        // for size_t
+#include <future>         // for shared_future
+#include <memory>         // for shared_ptr
+#include <optional>       // for optional
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for exchange
+
+namespace inviwo {
+
+/**
+ * Maps a data type to its RAM and Disk representations for the SequenceStreamer.
+ * Specialize for data types that should support streaming.
+ */
+template <typename T>
+struct SequenceStreamerTraits {};
+
+template <>
+struct SequenceStreamerTraits<Volume> {
+    using RAM = VolumeRAM;
+    using Disk = VolumeDisk;
+};
+
+template <>
+struct SequenceStreamerTraits<Layer> {
+    using RAM = LayerRAM;
+    using Disk = LayerDisk;
+};
+
+/**
+ * @brief Streams the elements of a DataSequence from disk ahead of playback.
+ *
+ * Every call to select() makes sure the selected element has a RAM representation, waiting for
+ * it if it is not loaded yet, and then starts loading the next `readAhead` elements in the
+ * direction of playback on the thread pool. The direction is deduced from the previously selected
+ * index, and playback is assumed to wrap around at the end of the sequence. RAM representations
+ * loaded by the streamer that fall outside the read-ahead window are evicted again, so at most
+ * `readAhead + 2` elements are kept in RAM. Only representations that can be recreated from a
+ * disk representation are evicted.
+ *
+ * select() is called during network evaluation, while downstream processors and their background
+ * jobs might still read the previously selected element through raw representation pointers.
+ * Hence the previously selected element is never evicted, and neither is any element that is
+ * referenced by someone other than the sequence and the streamer. Such elements are kept and
+ * evicted in a later call to select() once they are no longer in use.
+ *
+ * Hits, misses and the time spent waiting for I/O are reported in getStats() and can be used to
+ * size the read-ahead window.
+ */
+template <typename T>
+class SequenceStreamer {
+public:
+    static constexpr bool supported = requires {
+        typename SequenceStreamerTraits<T>::RAM;
+        typename SequenceStreamerTraits<T>::Disk;
+    };
+
+    struct Stats {
+        size_t hits = 0;        ///< Selected elements that were already in RAM
+        size_t misses = 0;      ///< Selected elements that had to be waited for
+        size_t prefetched = 0;  ///< Elements loaded ahead of playback
+        size_t evicted = 0;     ///< Elements whose RAM representation was evicted again
+        std::chrono::duration<double> stall{0.0};  ///< Total time spent waiting in select()
+
+        double hitRate() const {
+            const auto total = hits + misses;
+            return total == 0 ? 1.0 : static_cast<double>(hits) / static_cast<double>(total);
+        }
+    };
+
+    explicit SequenceStreamer(size_t readAhead = 4) : readAhead_{readAhead} {}
+    SequenceStreamer(const SequenceStreamer&) = delete;
+    SequenceStreamer& operator=(const SequenceStreamer&) = delete;
+    ~SequenceStreamer() { wait(); }
+
+    void setReadAhead(size_t readAhead) { readAhead_ = readAhead; }
+    size_t getReadAhead() const { return readAhead_; }
+
+    /**
+     * Select element @p index of @p sequence, load it into RAM if needed and start prefetching
+     * the following elements. Should be called from the main thread.
+     * @return the selected element.
+     */
+    std::shared_ptr<const T> select(std::shared_ptr<const DataSequence<T>> sequence,
+                                     size_t index);
+
+    /**
+     * Wait for all pending loads and evict all RAM representations loaded by the streamer that
+     * are not in use by anyone else.
+     */
+    void clear();
+
+    const Stats& getStats() const { return stats_; }
+    void resetStats() { stats_ = Stats{}; }
+
+private:
+    // Only used in the member functions, to allow a SequenceStreamer member for any data type
+    using Traits = SequenceStreamerTraits<T>;
+
+    struct Entry {
+        std::shared_ptr<const T> data;
+        std::shared_future<void> loaded;
+        bool owned;  ///< true if the RAM representation was created by the streamer
+    };
+
+    Entry& load(size_t index);
+    bool evict(const Entry& entry);
+    void wait();
+
+    std::shared_ptr<const DataSequence<T>> sequence_;
+    std::unordered_map<size_t, Entry> entries_;
+    std::optional<size_t> last_;
+    size_t readAhead_;
+    Stats stats_;
+};
+
+template <typename T>
+std::shared_ptr<const T> SequenceStreamer<T>::select(
+    std::shared_ptr<const DataSequence<T>> sequence, size_t index) {
+
+    if (sequence != sequence_) {
+        clear();
+        sequence_ = std::move(sequence);
+        last_.reset();
+    }
+    if (!sequence_ || index >= sequence_->size()) return nullptr;
+
+    const auto size = sequence_->size();
+    const bool forward = !last_ || (index + size - *last_) % size <= size / 2;
+    const auto previous = std::exchange(last_, index);
+
+    const auto start = std::chrono::steady_clock::now();
+    const bool known = entries_.contains(index);
+    auto& current = load(index);
+    const bool ready =
+        current.loaded.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+    if (ready && (known || !current.owned)) {
+        ++stats_.hits;
+    } else {
+        current.loaded.wait();
+        stats_.stall += std::chrono::steady_clock::now() - start;
+        ++stats_.misses;
+    }
+    auto selected = current.data;
+
+    const auto window = std::min(readAhead_, size - 1);
+    const auto step = [&](size_t i) {
+        return forward ? (index + i) % size : (index + size - i) % size;
+    };
+    const auto inWindow = [&](size_t i) {
+        const auto dist = forward ? (i + size - index) % size : (index + size - i) % size;
+        return dist <= window;
+    };
+
+    // The previous element might still be in use downstream, keep it as a trailing margin.
+    std::erase_if(entries_, [&](const auto& item) {
+        return !inWindow(item.first) && item.first != previous && evict(item.second);
+    });
+
+    for (size_t i = 1; i <= window; ++i) {
+        const auto next = step(i);
+        if (!entries_.contains(next)) {
+            load(next);
+            ++stats_.prefetched;
+        }
+    }
+
+    return selected;
+}
+
+template <typename T>
+auto SequenceStreamer<T>::load(size_t index) -> Entry& {
+    if (auto it = entries_.find(index); it != entries_.end()) return it->second;
+
+    using RAM = typename Traits::RAM;
+
+    auto data = (*sequence_)[index];
+    const bool owned = !data->template hasRepresentation<RAM>();
+    std::shared_future<void> loaded;
+    if (owned && util::getPoolSize() > 0) {
+        loaded = dispatchPool([data]() { data->template getRepresentation<RAM>(); }).share();
+    } else {
+        // Without a thread pool everything is loaded directly
+        if (owned) data->template getRepresentation<RAM>();
+        std::promise<void> done;
+        done.set_value();
+        loaded = done.get_future().share();
+    }
+    return entries_.emplace(index, Entry{std::move(data), std::move(loaded), owned})
+        .first->second;
+}
+
+template <typename T>
+bool SequenceStreamer<T>::evict(const Entry& entry) {
+    // Pending loads are kept until they are done.
+    if (entry.loaded.wait_for(std::chrono::seconds{0}) != std::future_status::ready) return false;
+    if (!entry.owned) return true;
+    // Referenced by somebody besides the sequence and us, i.e. still in use, try again later.
+    if (entry.data.use_count() > 2) return false;
+
+    using RAM = typename Traits::RAM;
+    using Disk = typename Traits::Disk;
+
+    const auto& data = *entry.data;
+    if (data.template hasRepresentation<RAM>() && data.template hasRepresentation<Disk>()) {
+        const auto* ram = data.template getRepresentation<RAM>();
+        const auto* disk = data.template getRepresentation<Disk>();
+        if (data.evictRepresentation(ram, disk)) ++stats_.evicted;
+    }
+    return true;
+}
+
+template <typename T>
+void SequenceStreamer<T>::wait() {
+    for (auto& [index, entry] : entries_) {
+        if (entry.loaded.valid()) entry.loaded.wait();
+    }
+}
+
+template <typename T>
+void SequenceStreamer<T>::clear() {
+    wait();
+    for (auto& [index, entry] : entries_) {
+        evict(entry);
+    }
+    entries_.clear();
+}
+
+}  // namespace inviwo
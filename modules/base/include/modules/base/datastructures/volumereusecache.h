@@ -32,6 +32,7 @@
 
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeconfig.h>
+#include <inviwo/core/resourcemanager/resourcepool.h>
 
 #include <memory>   // for shared_ptr, make_shared
 #include <utility>  // for pair
@@ -42,12 +43,12 @@ namespace inviwo {
 /**
  * @brief Provides a cache for reusing Volume objects with a specific configuration.
  *
- * The VolumeReuseCache class manages a pool of Volume objects that share the same
- * VolumeConfig. This allows for efficient reuse of Volume instances, reducing the
- * overhead of frequent allocations and deallocations. The cache is initialized with
- * a given VolumeConfig, which can be updated at runtime. When a Volume is requested
- * via get(), the cache will return an existing Volume if available, or create a new
- * one if the cache is empty.
+ * The VolumeReuseCache class manages a pool of Volume objects. This allows for efficient reuse
+ * of Volume instances, reducing the overhead of frequent allocations and deallocations. The cache
+ * is initialized with a given VolumeConfig, which can be updated at runtime. When a Volume is
+ * requested via get(), the cache will return an unused Volume with matching dimensions, format,
+ * and representation settings if available, or create a new one otherwise. Unused volumes are
+ * evicted in least recently used order when the cache exceeds its budget.
  *
  * Copy and move operations are disabled to ensure unique ownership of the cache.
  *
@@ -59,10 +60,13 @@ namespace inviwo {
  *
  * @see Volume
  * @see VolumeConfig
+ * @see ResourcePool
  */
 class IVW_MODULE_BASE_API VolumeReuseCache {
 public:
-    explicit VolumeReuseCache(VolumeConfig config = {});
+    static constexpr size_t defaultBudget = 256 * 1024 * 1024;
+
+    explicit VolumeReuseCache(VolumeConfig config = {}, size_t budget = defaultBudget);
     VolumeReuseCache(const VolumeReuseCache&) = delete;
     VolumeReuseCache(VolumeReuseCache&&) = delete;
     VolumeReuseCache& operator=(const VolumeReuseCache&) = delete;
@@ -80,12 +84,12 @@ public:
      * @brief Sets a new VolumeConfig for the cache.
      *
      * Updates the configuration used for creating new Volume objects.
-     * If the existing config does not match the new config,
-     * existing volumes will be discarded and new Volumes will be created as needed.
+     * If the existing config does not match the new config, volumes of the old config
+     * will not be handed out unless they also match the new config. They are kept in the pool
+     * until evicted, and can be reused if the config changes back.
      *
      * @param config The new VolumeConfig to use.
-     * @returns Status::ClearedCache if the config changed (the cache was cleared),
-     * Status::NoChange otherwise
+     * @returns Status::ClearedCache if the config changed, Status::NoChange otherwise
      */
     Status setConfig(const VolumeConfig& config);
 
@@ -100,9 +104,11 @@ public:
      */
     std::shared_ptr<Volume> get();
 
+    const ResourcePool<Volume>& getPool() const { return pool_; }
+
 private:
     VolumeConfig config_;
-    std::vector<std::shared_ptr<Volume>> cache_;
+    ResourcePool<Volume> pool_;
 };
 
 }  // namespace inviwo
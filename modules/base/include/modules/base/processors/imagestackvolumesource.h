@@ -71,6 +71,7 @@ private:
     FilePatternProperty filePattern_;
     ButtonProperty reload_;
     BoolProperty skipUnsupportedFiles_;
+    BoolProperty loadOnDemand_;
 
     BasisProperty basis_;
     VolumeInformationProperty information_;
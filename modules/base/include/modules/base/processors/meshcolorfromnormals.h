@@ -55,6 +55,7 @@ public:
 
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
+    static constexpr bool threadSafeConstruction = true;
 
 private:
     MeshInport inport_;
@@ -0,0 +1,77 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>
+
+#include <inviwo/core/ports/meshport.h>
+#include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/processors/processorinfo.h>
+#include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/compositeproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+
+namespace inviwo {
+
+class IVW_MODULE_BASE_API MeshOptimizationProcessor : public PoolProcessor {
+public:
+    virtual const ProcessorInfo& getProcessorInfo() const override;
+    static const ProcessorInfo processorInfo_;
+
+    MeshOptimizationProcessor();
+    virtual ~MeshOptimizationProcessor() = default;
+
+    virtual void process() override;
+
+private:
+    MeshInport inport_;
+    MeshOutport outport_;
+
+    BoolProperty enabled_;
+    BoolProperty weld_;
+    FloatProperty weldTolerance_;
+    BoolProperty compareAttributes_;
+    FloatProperty attributeTolerance_;
+    BoolProperty removeDegenerate_;
+    BoolProperty reorderTriangles_;
+    BoolProperty reorderVertices_;
+    IntSizeTProperty cacheSize_;
+
+    CompositeProperty statistics_;
+    IntSizeTProperty verticesBefore_;
+    IntSizeTProperty verticesAfter_;
+    IntSizeTProperty trianglesBefore_;
+    IntSizeTProperty trianglesAfter_;
+    DoubleProperty acmrBefore_;
+    DoubleProperty acmrAfter_;
+};
+
+}  // namespace inviwo
@@ -33,9 +33,11 @@
 #include <inviwo/core/ports/dataoutport.h>
 #include <inviwo/core/datastructures/datasequence.h>
 #include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/boolcompositeproperty.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/stringproperty.h>
 #include <modules/base/basemoduledefine.h>
+#include <modules/base/datastructures/sequencestreamer.h>
 #include <modules/base/properties/sequencetimerproperty.h>
 
 namespace inviwo {
@@ -43,6 +45,8 @@ namespace inviwo {
 /**
  * Template for processors that want to select an element from an
  * input vector and set it as output.
+ * For data types supported by the SequenceStreamer, i.e. Volume and Layer, a streaming mode is
+ * available that loads the next elements from disk ahead of playback.
  * @see VolumeSequenceElementSelectorProcessor for an example
  */
 template <typename T, typename OutportType = DataOutport<T>>
@@ -62,6 +66,12 @@ protected:
 
     StringProperty name_;
     DoubleProperty timestamp_;
+
+    BoolCompositeProperty streaming_;
+    IntSizeTProperty readAhead_;
+    DoubleProperty hitRate_;
+    DoubleProperty stallTime_;
+    SequenceStreamer<T> streamer_;
 };
 
 template <typename T, typename OutportType>
@@ -73,13 +83,43 @@ VectorElementSelectorProcessor<T, OutportType>::VectorElementSelectorProcessor()
     , name_("name", "Name")
     , timestamp_("timestamp", "Timestamp", 0, std::numeric_limits<double>::lowest(),
                  std::numeric_limits<double>::max(), std::numeric_limits<double>::epsilon(),
-                 InvalidationLevel::Valid, PropertySemantics("Text")) {
+                 InvalidationLevel::Valid, PropertySemantics("Text"))
+    , streaming_("streaming", "Streaming",
+                 "Load the next elements of the sequence from disk in the background ahead of "
+                 "playback. Elements that have been played are evicted from RAM again."_help,
+                 false, InvalidationLevel::InvalidOutput)
+    , readAhead_("readAhead", "Read Ahead",
+                 util::ordinalCount<size_t>(4, 64).setMin(size_t{1}).set(
+                     "Number of elements to load ahead of the current one"_help))
+    , hitRate_("hitRate", "Hit Rate",
+               util::ordinalLength(1.0, 1.0)
+                   .set(InvalidationLevel::Valid)
+                   .set(PropertySemantics::Text)
+                   .set("Fraction of selected elements that were already loaded"_help))
+    , stallTime_("stallTime", "I/O Stall (ms)",
+                 util::ordinalLength(0.0, 1000.0)
+                     .set(InvalidationLevel::Valid)
+                     .set(PropertySemantics::Text)
+                     .set("Total time spent waiting for elements to be loaded"_help)) {
     addPorts(inport_, outport_);
 
     addProperties(timeStep_, name_, timestamp_);
     name_.setVisible(false).setReadOnly(true).setCurrentStateAsDefault();
     timestamp_.setVisible(false).setReadOnly(true).setCurrentStateAsDefault();
 
+    if constexpr (SequenceStreamer<T>::supported) {
+        streaming_.addProperties(readAhead_, hitRate_, stallTime_);
+        addProperty(streaming_);
+        for (auto* p : {&hitRate_, &stallTime_}) {
+            p->setReadOnly(true);
+            p->setSerializationMode(PropertySerializationMode::None);
+        }
+        streaming_.getBoolProperty()->onChange([this]() {
+            streamer_.clear();
+            streamer_.resetStats();
+        });
+    }
+
     // This needs to be added by the child class
     // timeStep_.index_.autoLinkToProperty<VectorElementSelectorProcessor<T>>("timeStep.selectedSequenceIndex");
 
@@ -135,6 +175,17 @@ void VectorElementSelectorProcessor<T, OutportType>::process() {
         }
         size_t index = std::min(data->size() - 1, static_cast<size_t>(timeStep_.index_.get() - 1));
 
+        if constexpr (SequenceStreamer<T>::supported) {
+            if (streaming_.isChecked()) {
+                streamer_.setReadAhead(readAhead_.get());
+                outport_.setData(streamer_.select(data, index));
+
+                const auto& stats = streamer_.getStats();
+                hitRate_.set(stats.hitRate());
+                stallTime_.set(1000.0 * stats.stall.count());
+                return;
+            }
+        }
         outport_.setData((*data)[index]);
     } else {
         outport_.detachData();
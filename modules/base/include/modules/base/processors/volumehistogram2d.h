@@ -35,6 +35,7 @@
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/ports/volumeport.h>
 #include <inviwo/core/ports/layerport.h>
+#include <inviwo/core/datastructures/histogram.h>
 #include <modules/base/properties/datarangeproperty.h>
 
 namespace inviwo {
@@ -53,13 +54,17 @@ public:
 private:
     VolumeInport inport1_;
     VolumeInport inport2_;
+    VolumeInport mask_;
     LayerOutport outport_;
 
     IntProperty histogramResolution_;
     OptionPropertyInt channel1_;
     OptionPropertyInt channel2_;
+    OptionProperty<HistogramBinning> binning_;
     OptionProperty<Scaling> scaling_;
     DataRangeProperty dataRange_;
+    DoubleProperty covariance_;
+    DoubleProperty correlation_;
 };
 
 }  // namespace inviwo
@@ -48,6 +48,7 @@ public:
 
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
+    static constexpr bool threadSafeConstruction = true;
 
 private:
     VolumeInport inport_;
@@ -47,6 +47,7 @@ public:
 
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
+    static constexpr bool threadSafeConstruction = true;
 
 protected:
     virtual void process() override;
@@ -0,0 +1,911 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/mesh/meshbvh.h>
+
+#include <inviwo/core/datastructures/buffer/bufferram.h>       // for BufferRAM
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for BufferType, DrawType
+#include <inviwo/core/datastructures/geometry/mesh.h>          // for Mesh
+#include <inviwo/core/resourcemanager/resource.h>              // for PoolStats, addPool
+#include <inviwo/core/util/exception.h>                        // for Exception
+#include <inviwo/core/util/foreach.h>                          // for forEachChunkParallel
+#include <inviwo/core/util/glmconvert.h>                       // for glm_convert
+#include <inviwo/core/util/threadutil.h>                       // for getPoolSize
+#include <modules/base/algorithm/meshutils.h>                  // for forEachTriangle
+
+#include <algorithm>    // for min, max, partition, find_if
+#include <array>        // for array
+#include <cmath>        // for sqrt
+#include <deque>        // for deque
+#include <iterator>     // for back_inserter
+#include <list>         // for list
+#include <mutex>        // for mutex, scoped_lock
+#include <numeric>      // for iota
+#include <vector>       // for vector
+
+#include <glm/common.hpp>     // for min, max
+#include <glm/geometric.hpp>  // for dot, cross
+
+namespace inviwo {
+
+namespace meshutil {
+
+namespace {
+
+constexpr float inf = std::numeric_limits<float>::infinity();
+
+// Ranges with more triangles than this are reduced in parallel during the build
+constexpr uint32_t parallelThreshold = 1 << 16;
+// Ranges with fewer triangles than this are not split further on the calling thread
+constexpr uint32_t minSubtreeSize = 1 << 12;
+
+struct Box {
+    vec3 min{std::numeric_limits<float>::max()};
+    vec3 max{std::numeric_limits<float>::lowest()};
+
+    void extend(const vec3& p) {
+        min = glm::min(min, p);
+        max = glm::max(max, p);
+    }
+    void extend(const Box& box) {
+        min = glm::min(min, box.min);
+        max = glm::max(max, box.max);
+    }
+    float area() const {
+        const auto d = glm::max(max - min, vec3{0.0f});
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+};
+
+struct Bin {
+    Box box;
+    uint32_t count = 0;
+};
+
+struct Range {
+    uint32_t node;
+    uint32_t begin;
+    uint32_t end;
+    uint32_t depth;
+};
+
+/*
+ * Reduce [begin, end) with accumulate(T&, begin, end), in parallel chunks for large ranges.
+ */
+template <typename T, typename Accumulate, typename Merge>
+T reduce(uint32_t begin, uint32_t end, const T& init, Accumulate&& accumulate, Merge&& merge) {
+    T result = init;
+    if (end - begin < parallelThreshold) {
+        accumulate(result, begin, end);
+        return result;
+    }
+
+    std::mutex mutex;
+    util::forEachChunkParallel(end - begin, [&](size_t chunkBegin, size_t chunkEnd) {
+        T local = init;
+        accumulate(local, begin + static_cast<uint32_t>(chunkBegin),
+                   begin + static_cast<uint32_t>(chunkEnd));
+        const std::scoped_lock lock{mutex};
+        merge(result, local);
+    });
+    return result;
+}
+
+class Builder {
+public:
+    Builder(const std::vector<Box>& boxes, const std::vector<vec3>& centroids,
+            std::vector<uint32_t>& order, const MeshBVHSettings& settings)
+        : boxes_{boxes}
+        , centroids_{centroids}
+        , order_{order}
+        , bins_{std::max(size_t{2}, settings.bins)}
+        , maxLeafSize_{std::max(size_t{1}, settings.maxLeafSize)}
+        , traversalCost_{settings.traversalCost} {}
+
+    Box bounds(uint32_t begin, uint32_t end) const {
+        return reduce(
+            begin, end, Box{},
+            [&](Box& box, uint32_t first, uint32_t last) {
+                for (auto i = first; i < last; ++i) box.extend(boxes_[order_[i]]);
+            },
+            [](Box& box, const Box& other) { box.extend(other); });
+    }
+
+    /*
+     * Find the split of [begin, end) with the lowest SAH cost and partition the range. Returns
+     * the start of the right half, or nothing if a leaf is cheaper.
+     */
+    std::optional<uint32_t> split(uint32_t begin, uint32_t end, const Box& bounds) const {
+        const auto count = end - begin;
+        if (count <= 1) return std::nullopt;
+
+        const auto centroidBounds = reduce(
+            begin, end, Box{},
+            [&](Box& box, uint32_t first, uint32_t last) {
+                for (auto i = first; i < last; ++i) box.extend(centroids_[order_[i]]);
+            },
+            [](Box& box, const Box& other) { box.extend(other); });
+        const auto extent = centroidBounds.max - centroidBounds.min;
+        vec3 scale{0.0f};
+        for (int axis = 0; axis < 3; ++axis) {
+            if (extent[axis] > 0.0f) scale[axis] = static_cast<float>(bins_) / extent[axis];
+        }
+
+        const auto binIndex = [&](const vec3& centroid, int axis) {
+            const auto pos = (centroid[axis] - centroidBounds.min[axis]) * scale[axis];
+            return std::min(bins_ - 1, static_cast<size_t>(pos));
+        };
+
+        const auto bins = reduce(
+            begin, end, std::vector<Bin>(3 * bins_),
+            [&](std::vector<Bin>& res, uint32_t first, uint32_t last) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    if (extent[axis] <= 0.0f) continue;
+                    auto* axisBins = res.data() + axis * bins_;
+                    for (auto i = first; i < last; ++i) {
+                        const auto tri = order_[i];
+                        auto& bin = axisBins[binIndex(centroids_[tri], axis)];
+                        bin.box.extend(boxes_[tri]);
+                        ++bin.count;
+                    }
+                }
+            },
+            [](std::vector<Bin>& res, const std::vector<Bin>& other) {
+                for (size_t i = 0; i < res.size(); ++i) {
+                    res[i].box.extend(other[i].box);
+                    res[i].count += other[i].count;
+                }
+            });
+
+        // Sweep the bins from both sides to find the split plane with the lowest cost
+        float bestCost = inf;
+        int bestAxis = -1;
+        size_t bestBin = 0;
+        std::vector<float> rightCost(bins_);
+        for (int axis = 0; axis < 3; ++axis) {
+            if (extent[axis] <= 0.0f) continue;
+            const auto* axisBins = bins.data() + axis * bins_;
+
+            Box right;
+            uint32_t rightCount = 0;
+            for (size_t i = bins_ - 1; i > 0; --i) {
+                right.extend(axisBins[i].box);
+                rightCount += axisBins[i].count;
+                rightCost[i] = rightCount > 0 ? right.area() * static_cast<float>(rightCount) : inf;
+            }
+            Box left;
+            uint32_t leftCount = 0;
+            for (size_t i = 0; i + 1 < bins_; ++i) {
+                left.extend(axisBins[i].box);
+                leftCount += axisBins[i].count;
+                if (leftCount == 0) continue;
+                const auto cost = left.area() * static_cast<float>(leftCount) + rightCost[i + 1];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = i;
+                }
+            }
+        }
+
+        if (bestAxis < 0) {
+            // All centroids coincide, split in the middle if there are too many for a leaf
+            if (count <= maxLeafSize_) return std::nullopt;
+            return begin + count / 2;
+        }
+
+        const auto area = bounds.area();
+        if (count <= maxLeafSize_ &&
+            static_cast<float>(count) * area <= traversalCost_ * area + bestCost) {
+            return std::nullopt;
+        }
+
+        const auto mid = std::partition(
+            order_.begin() + begin, order_.begin() + end,
+            [&](uint32_t tri) { return binIndex(centroids_[tri], bestAxis) <= bestBin; });
+        return static_cast<uint32_t>(mid - order_.begin());
+    }
+
+    /*
+     * Split the range at nodes[range.node], appending new nodes to nodes. Returns the children
+     * ranges if the node was split.
+     */
+    std::optional<std::array<Range, 2>> buildNode(std::vector<MeshBVH::Node>& nodes,
+                                                  const Range& range) const {
+        const auto box = bounds(range.begin, range.end);
+        nodes[range.node].min = box.min;
+        nodes[range.node].max = box.max;
+
+        if (const auto mid = split(range.begin, range.end, box)) {
+            const auto left = static_cast<uint32_t>(nodes.size());
+            nodes.resize(nodes.size() + 2);
+            nodes[range.node].index = left;
+            nodes[range.node].count = 0;
+            return std::array<Range, 2>{Range{left, range.begin, *mid, range.depth + 1},
+                                        Range{left + 1, *mid, range.end, range.depth + 1}};
+        } else {
+            nodes[range.node].index = range.begin;
+            nodes[range.node].count = range.end - range.begin;
+            return std::nullopt;
+        }
+    }
+
+    /*
+     * Build the whole subtree of range, returns the depth of the deepest leaf.
+     */
+    uint32_t build(std::vector<MeshBVH::Node>& nodes, const Range& range) const {
+        uint32_t depth = range.depth;
+        std::vector<Range> stack{range};
+        while (!stack.empty()) {
+            const auto current = stack.back();
+            stack.pop_back();
+            depth = std::max(depth, current.depth);
+            if (const auto children = buildNode(nodes, current)) {
+                stack.push_back((*children)[1]);
+                stack.push_back((*children)[0]);
+            }
+        }
+        return depth;
+    }
+
+private:
+    const std::vector<Box>& boxes_;
+    const std::vector<vec3>& centroids_;
+    std::vector<uint32_t>& order_;
+    size_t bins_;
+    size_t maxLeafSize_;
+    float traversalCost_;
+};
+
+/*
+ * A stack of nodes to visit, on the stack for trees of normal depth.
+ */
+template <typename T>
+class TraversalStack {
+public:
+    explicit TraversalStack(size_t depth) : data_{local_.data()} {
+        if (depth + 1 > local_.size()) {
+            heap_.resize(depth + 1);
+            data_ = heap_.data();
+        }
+    }
+    void push(const T& item) { data_[size_++] = item; }
+    T pop() { return data_[--size_]; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    std::array<T, 64> local_;
+    std::vector<T> heap_;
+    T* data_;
+    size_t size_ = 0;
+};
+
+struct StackItem {
+    uint32_t node;
+    float distance;
+};
+
+/*
+ * Slab test, returns the entry distance of the ray into the box or infinity if it misses.
+ */
+float intersect(const MeshBVH::Node& node, const vec3& origin, const vec3& invDir, float tMin,
+                float tMax) {
+    const auto t0 = (node.min - origin) * invDir;
+    const auto t1 = (node.max - origin) * invDir;
+    const auto tNear = glm::min(t0, t1);
+    const auto tFar = glm::max(t0, t1);
+    const auto near = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, tMin));
+    const auto far = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, tMax));
+    return near <= far ? near : inf;
+}
+
+/*
+ * Möller-Trumbore ray triangle intersection
+ */
+template <typename Triangle>
+bool intersect(const Triangle& tri, const vec3& origin, const vec3& dir, float tMin, float tMax,
+               float& t, vec2& uv) {
+    const auto p = glm::cross(dir, tri.e2);
+    const auto det = glm::dot(tri.e1, p);
+    if (det == 0.0f) return false;
+    const auto invDet = 1.0f / det;
+
+    const auto s = origin - tri.v0;
+    const auto u = glm::dot(s, p) * invDet;
+    if (u < 0.0f || u > 1.0f) return false;
+
+    const auto q = glm::cross(s, tri.e1);
+    const auto v = glm::dot(dir, q) * invDet;
+    if (v < 0.0f || u + v > 1.0f) return false;
+
+    const auto hit = glm::dot(tri.e2, q) * invDet;
+    if (hit < tMin || hit > tMax) return false;
+
+    t = hit;
+    uv = vec2{u, v};
+    return true;
+}
+
+float distance2(const MeshBVH::Node& node, const vec3& point) {
+    const auto d = glm::max(glm::max(node.min - point, point - node.max), vec3{0.0f});
+    return glm::dot(d, d);
+}
+
+/*
+ * Closest point on the triangle (a, a + ab, a + ac) to p, from Ericson, Real-Time Collision
+ * Detection, section 5.1.5
+ */
+vec3 closestPointOnTriangle(const vec3& p, const vec3& a, const vec3& ab, const vec3& ac) {
+    const auto ap = p - a;
+    const auto d1 = glm::dot(ab, ap);
+    const auto d2 = glm::dot(ac, ap);
+    if (d1 <= 0.0f && d2 <= 0.0f) return a;
+
+    const auto b = a + ab;
+    const auto bp = p - b;
+    const auto d3 = glm::dot(ab, bp);
+    const auto d4 = glm::dot(ac, bp);
+    if (d3 >= 0.0f && d4 <= d3) return b;
+
+    const auto vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return a + ab * (d1 / (d1 - d3));
+
+    const auto c = a + ac;
+    const auto cp = p - c;
+    const auto d5 = glm::dot(ab, cp);
+    const auto d6 = glm::dot(ac, cp);
+    if (d6 >= 0.0f && d5 <= d6) return c;
+
+    const auto vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return a + ac * (d2 / (d2 - d6));
+
+    const auto va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    const auto denom = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+constexpr size_t packetSize = 8;
+
+/*
+ * Rays stored as structure of arrays to let the compiler vectorize the box tests over the packet.
+ * Unused lanes have an empty interval and never hit anything.
+ */
+struct Packet {
+    std::array<float, packetSize> ox{}, oy{}, oz{};
+    std::array<float, packetSize> ix{}, iy{}, iz{};
+    std::array<float, packetSize> tMin{}, tMax{};
+};
+
+/*
+ * Test all rays of the packet against the box, writes the entry distance of each lane to near
+ * and returns the smallest one.
+ */
+float intersect(const MeshBVH::Node& node, const Packet& p, std::array<float, packetSize>& near) {
+    float nearest = inf;
+    for (size_t i = 0; i < packetSize; ++i) {
+        const auto tx0 = (node.min.x - p.ox[i]) * p.ix[i];
+        const auto tx1 = (node.max.x - p.ox[i]) * p.ix[i];
+        const auto ty0 = (node.min.y - p.oy[i]) * p.iy[i];
+        const auto ty1 = (node.max.y - p.oy[i]) * p.iy[i];
+        const auto tz0 = (node.min.z - p.oz[i]) * p.iz[i];
+        const auto tz1 = (node.max.z - p.oz[i]) * p.iz[i];
+        const auto tNear = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)),
+                                    std::max(std::min(tz0, tz1), p.tMin[i]));
+        const auto tFar = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)),
+                                   std::min(std::max(tz0, tz1), p.tMax[i]));
+        near[i] = tNear <= tFar ? tNear : inf;
+        nearest = std::min(nearest, near[i]);
+    }
+    return nearest;
+}
+
+std::vector<vec3> collectPositions(const Mesh& mesh) {
+    const auto* buffer = mesh.findBuffer(BufferType::PositionAttrib).first;
+    if (!buffer) {
+        throw Exception(SourceContext{}, "Mesh has no position buffer");
+    }
+
+    return buffer->getRepresentation<BufferRAM>()->dispatch<std::vector<vec3>>([](auto ram) {
+        const auto& data = ram->getDataContainer();
+        std::vector<vec3> positions;
+        positions.reserve(data.size());
+        std::transform(data.begin(), data.end(), std::back_inserter(positions),
+                       [](const auto& pos) { return util::glm_convert<vec3>(pos); });
+        return positions;
+    });
+}
+
+std::vector<uvec3> collectTriangles(const Mesh& mesh) {
+    std::vector<uvec3> triangles;
+    for (const auto& [info, indices] : mesh.getIndexBuffers()) {
+        if (info.dt != DrawType::Triangles) continue;
+        forEachTriangle(info, *indices, [&](uint32_t a, uint32_t b, uint32_t c) {
+            triangles.emplace_back(a, b, c);
+        });
+    }
+
+    if (mesh.getIndexBuffers().empty() && mesh.getDefaultMeshInfo().dt == DrawType::Triangles) {
+        const auto* buffer = mesh.findBuffer(BufferType::PositionAttrib).first;
+        const auto size = buffer ? static_cast<uint32_t>(buffer->getSize()) : uint32_t{0};
+        for (uint32_t i = 0; i + 2 < size; i += 3) {
+            triangles.emplace_back(i, i + 1, i + 2);
+        }
+    }
+    return triangles;
+}
+
+}  // namespace
+
+MeshBVH::MeshBVH(const Mesh& mesh, const MeshBVHSettings& settings)
+    : MeshBVH(collectPositions(mesh), collectTriangles(mesh), settings) {}
+
+MeshBVH::MeshBVH(std::vector<vec3> positions, std::vector<uvec3> triangles,
+                 const MeshBVHSettings& settings)
+    : positions_{std::move(positions)}, triangles_{std::move(triangles)} {
+
+    const auto size = positions_.size();
+    for (const auto& tri : triangles_) {
+        if (tri.x >= size || tri.y >= size || tri.z >= size) {
+            throw Exception(SourceContext{}, "Triangle index out of range, got {} for {} vertices",
+                            std::max(tri.x, std::max(tri.y, tri.z)), size);
+        }
+    }
+
+    build(settings);
+}
+
+void MeshBVH::build(const MeshBVHSettings& settings) {
+    nodes_.clear();
+    ordered_.clear();
+    orderedIndex_.clear();
+    depth_ = 0;
+
+    const auto count = static_cast<uint32_t>(triangles_.size());
+    if (count == 0) return;
+
+    std::vector<Box> boxes(count);
+    std::vector<vec3> centroids(count);
+    util::forEachChunkParallel(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& tri = triangles_[i];
+            boxes[i].extend(positions_[tri.x]);
+            boxes[i].extend(positions_[tri.y]);
+            boxes[i].extend(positions_[tri.z]);
+            centroids[i] = (boxes[i].min + boxes[i].max) * 0.5f;
+        }
+    });
+
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), uint32_t{0});
+    const Builder builder{boxes, centroids, order, settings};
+
+    nodes_.reserve(2 * static_cast<size_t>(count));
+    nodes_.resize(1);
+
+    // Split the top of the tree breadth first on this thread, until there are enough subtrees to
+    // keep the thread pool busy
+    const auto poolSize = util::getPoolSize();
+    const size_t targetSubtrees = poolSize == 0 ? 1 : 4 * poolSize;
+    std::deque<Range> queue{Range{0, 0, count, 0}};
+    std::vector<Range> subtrees;
+    while (!queue.empty() && queue.size() + subtrees.size() < targetSubtrees) {
+        const auto range = queue.front();
+        queue.pop_front();
+        depth_ = std::max(depth_, size_t{range.depth});
+        if (range.end - range.begin < minSubtreeSize) {
+            subtrees.push_back(range);
+        } else if (const auto children = builder.buildNode(nodes_, range)) {
+            queue.push_back((*children)[0]);
+            queue.push_back((*children)[1]);
+        }
+    }
+    subtrees.insert(subtrees.end(), queue.begin(), queue.end());
+
+    // Build the subtrees in parallel, each into its own node array with the root at index 0
+    std::vector<std::vector<Node>> subtreeNodes(subtrees.size());
+    std::vector<uint32_t> subtreeDepths(subtrees.size());
+    util::forEachChunkParallel(
+        subtrees.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                auto& nodes = subtreeNodes[i];
+                nodes.resize(1);
+                subtreeDepths[i] =
+                    builder.build(nodes, Range{0, subtrees[i].begin, subtrees[i].end,
+                                               subtrees[i].depth});
+            }
+        },
+        subtrees.size());
+
+    // Move the subtree nodes into the flat array, the roots replace the placeholder nodes
+    for (size_t i = 0; i < subtrees.size(); ++i) {
+        const auto& nodes = subtreeNodes[i];
+        const auto offset = static_cast<uint32_t>(nodes_.size()) - 1;
+        const auto relocate = [&](Node node) {
+            if (!node.isLeaf()) node.index += offset;
+            return node;
+        };
+        nodes_[subtrees[i].node] = relocate(nodes.front());
+        std::transform(nodes.begin() + 1, nodes.end(), std::back_inserter(nodes_), relocate);
+        depth_ = std::max(depth_, size_t{subtreeDepths[i]});
+    }
+    nodes_.shrink_to_fit();
+
+    ordered_.resize(count);
+    orderedIndex_ = std::move(order);
+    util::forEachChunkParallel(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& tri = triangles_[orderedIndex_[i]];
+            const auto& v0 = positions_[tri.x];
+            ordered_[i] = Triangle{v0, positions_[tri.y] - v0, positions_[tri.z] - v0};
+        }
+    });
+}
+
+auto MeshBVH::closestHit(const Ray& ray) const -> std::optional<Hit> {
+    if (nodes_.empty()) return std::nullopt;
+
+    const auto invDir = 1.0f / ray.direction;
+    auto tMax = ray.tMax;
+    std::optional<Hit> hit;
+
+    TraversalStack<StackItem> stack{depth_};
+    if (const auto d = intersect(nodes_.front(), ray.origin, invDir, ray.tMin, tMax); d != inf) {
+        stack.push({0, d});
+    }
+    while (!stack.empty()) {
+        const auto item = stack.pop();
+        if (item.distance > tMax) continue;
+
+        const auto& node = nodes_[item.node];
+        if (node.isLeaf()) {
+            for (auto i = node.index; i < node.index + node.count; ++i) {
+                float t;
+                vec2 uv;
+                if (intersect(ordered_[i], ray.origin, ray.direction, ray.tMin, tMax, t, uv)) {
+                    tMax = t;
+                    hit = Hit{t, uv, orderedIndex_[i]};
+                }
+            }
+            continue;
+        }
+
+        StackItem near{node.index,
+                       intersect(nodes_[node.index], ray.origin, invDir, ray.tMin, tMax)};
+        StackItem far{node.index + 1,
+                      intersect(nodes_[node.index + 1], ray.origin, invDir, ray.tMin, tMax)};
+        if (far.distance < near.distance) std::swap(near, far);
+        if (far.distance != inf) stack.push(far);
+        if (near.distance != inf) stack.push(near);
+    }
+    return hit;
+}
+
+void MeshBVH::closestHit(std::span<const Ray> rays, std::span<std::optional<Hit>> hits) const {
+    for (size_t first = 0; first < rays.size(); first += packetSize) {
+        const auto size = std::min(packetSize, rays.size() - first);
+
+        Packet packet;
+        packet.tMin.fill(inf);
+        packet.tMax.fill(-inf);
+        for (size_t i = 0; i < size; ++i) {
+            const auto& ray = rays[first + i];
+            const auto invDir = 1.0f / ray.direction;
+            packet.ox[i] = ray.origin.x;
+            packet.oy[i] = ray.origin.y;
+            packet.oz[i] = ray.origin.z;
+            packet.ix[i] = invDir.x;
+            packet.iy[i] = invDir.y;
+            packet.iz[i] = invDir.z;
+            packet.tMin[i] = ray.tMin;
+            packet.tMax[i] = ray.tMax;
+            hits[first + i] = std::nullopt;
+        }
+        if (nodes_.empty()) continue;
+
+        std::array<float, packetSize> near;
+        TraversalStack<uint32_t> stack{depth_};
+        if (intersect(nodes_.front(), packet, near) != inf) stack.push(0);
+
+        while (!stack.empty()) {
+            const auto& node = nodes_[stack.pop()];
+            if (node.isLeaf()) {
+                // Only test the triangles for the lanes that hit the leaf
+                if (intersect(node, packet, near) == inf) continue;
+                for (size_t lane = 0; lane < size; ++lane) {
+                    if (near[lane] == inf) continue;
+                    const auto& ray = rays[first + lane];
+                    for (auto i = node.index; i < node.index + node.count; ++i) {
+                        float t;
+                        vec2 uv;
+                        if (intersect(ordered_[i], ray.origin, ray.direction, ray.tMin,
+                                      packet.tMax[lane], t, uv)) {
+                            packet.tMax[lane] = t;
+                            hits[first + lane] = Hit{t, uv, orderedIndex_[i]};
+                        }
+                    }
+                }
+                continue;
+            }
+
+            auto nearChild = node.index;
+            auto farChild = node.index + 1;
+            auto nearDistance = intersect(nodes_[nearChild], packet, near);
+            auto farDistance = intersect(nodes_[farChild], packet, near);
+            if (farDistance < nearDistance) {
+                std::swap(nearChild, farChild);
+                std::swap(nearDistance, farDistance);
+            }
+            if (farDistance != inf) stack.push(farChild);
+            if (nearDistance != inf) stack.push(nearChild);
+        }
+    }
+}
+
+bool MeshBVH::anyHit(const Ray& ray) const {
+    if (nodes_.empty()) return false;
+
+    const auto invDir = 1.0f / ray.direction;
+    TraversalStack<uint32_t> stack{depth_};
+    if (intersect(nodes_.front(), ray.origin, invDir, ray.tMin, ray.tMax) != inf) stack.push(0);
+
+    while (!stack.empty()) {
+        const auto& node = nodes_[stack.pop()];
+        if (node.isLeaf()) {
+            for (auto i = node.index; i < node.index + node.count; ++i) {
+                float t;
+                vec2 uv;
+                if (intersect(ordered_[i], ray.origin, ray.direction, ray.tMin, ray.tMax, t, uv)) {
+                    return true;
+                }
+            }
+            continue;
+        }
+        for (auto child : {node.index, node.index + 1}) {
+            if (intersect(nodes_[child], ray.origin, invDir, ray.tMin, ray.tMax) != inf) {
+                stack.push(child);
+            }
+        }
+    }
+    return false;
+}
+
+auto MeshBVH::closestPoint(const vec3& point, float maxDistance) const
+    -> std::optional<ClosestPoint> {
+    if (nodes_.empty()) return std::nullopt;
+
+    auto best = maxDistance * maxDistance;
+    std::optional<ClosestPoint> result;
+
+    TraversalStack<StackItem> stack{depth_};
+    if (const auto d = distance2(nodes_.front(), point); d <= best) stack.push({0, d});
+
+    while (!stack.empty()) {
+        const auto item = stack.pop();
+        if (item.distance > best) continue;
+
+        const auto& node = nodes_[item.node];
+        if (node.isLeaf()) {
+            for (auto i = node.index; i < node.index + node.count; ++i) {
+                const auto& tri = ordered_[i];
+                const auto closest = closestPointOnTriangle(point, tri.v0, tri.e1, tri.e2);
+                const auto d = glm::dot(closest - point, closest - point);
+                if (d <= best) {
+                    best = d;
+                    result = ClosestPoint{closest, std::sqrt(d), orderedIndex_[i]};
+                }
+            }
+            continue;
+        }
+
+        StackItem near{node.index, distance2(nodes_[node.index], point)};
+        StackItem far{node.index + 1, distance2(nodes_[node.index + 1], point)};
+        if (far.distance < near.distance) std::swap(near, far);
+        if (far.distance <= best) stack.push(far);
+        if (near.distance <= best) stack.push(near);
+    }
+    return result;
+}
+
+std::pair<vec3, vec3> MeshBVH::getBounds() const {
+    if (nodes_.empty()) return {vec3{0.0f}, vec3{0.0f}};
+    return {nodes_.front().min, nodes_.front().max};
+}
+
+size_t MeshBVH::getSizeInBytes() const {
+    return sizeof(MeshBVH) + positions_.size() * sizeof(vec3) + triangles_.size() * sizeof(uvec3) +
+           nodes_.size() * sizeof(Node) + ordered_.size() * sizeof(Triangle) +
+           orderedIndex_.size() * sizeof(uint32_t);
+}
+
+namespace {
+
+// Visit the buffers a BVH is built from, i.e. the position buffer and the index buffers
+template <typename F>
+void forEachGeometryBuffer(const Mesh& mesh, F&& f) {
+    const auto& buffers = mesh.getBuffers();
+    if (const auto it = std::ranges::find(buffers, BufferType::PositionAttrib,
+                                          [](const auto& item) { return item.first.type; });
+        it != buffers.end()) {
+        f(it->second, Mesh::MeshInfo{});
+    }
+    for (const auto& [info, indices] : mesh.getIndexBuffers()) {
+        f(indices, info);
+    }
+}
+
+// Identifies the state of the geometry a BVH is built from without looking at the data. The buffers
+// are compared by identity and modification count, which detects meshes that are modified in place.
+class GeometryVersion {
+public:
+    explicit GeometryVersion(const Mesh& mesh) : drawType_{mesh.getDefaultMeshInfo().dt} {
+        forEachGeometryBuffer(mesh, [&](const auto& buffer, const Mesh::MeshInfo& info) {
+            buffers_.push_back(Item{buffer, buffer->getModificationCount(), info});
+        });
+    }
+
+    bool matches(const Mesh& mesh) const {
+        if (mesh.getDefaultMeshInfo().dt != drawType_) return false;
+        size_t i = 0;
+        bool same = true;
+        forEachGeometryBuffer(mesh, [&](const auto& buffer, const Mesh::MeshInfo& info) {
+            same = same && i < buffers_.size() && buffers_[i].matches(buffer, info);
+            ++i;
+        });
+        return same && i == buffers_.size();
+    }
+
+private:
+    struct Item {
+        std::weak_ptr<const BufferBase> buffer;
+        size_t modificationCount;
+        Mesh::MeshInfo info;
+
+        bool matches(const std::shared_ptr<const BufferBase>& other,
+                     const Mesh::MeshInfo& otherInfo) const {
+            return info == otherInfo && !buffer.owner_before(other) &&
+                   !other.owner_before(buffer) &&
+                   modificationCount == other->getModificationCount();
+        }
+    };
+
+    std::vector<Item> buffers_;
+    DrawType drawType_;
+};
+
+class BVHCache {
+public:
+    static constexpr size_t defaultBudget = 512 * 1024 * 1024;
+
+    BVHCache() : stats_{std::make_shared<resource::PoolStats>("Mesh BVH")} {
+        stats_->budget = defaultBudget;
+        resource::addPool(stats_);
+    }
+    BVHCache(const BVHCache&) = delete;
+    BVHCache& operator=(const BVHCache&) = delete;
+    ~BVHCache() { resource::removePool(stats_.get()); }
+
+    std::shared_ptr<const MeshBVH> get(const std::shared_ptr<const Mesh>& mesh) {
+        {
+            const std::scoped_lock lock{mutex_};
+            if (auto bvh = find(mesh)) {
+                ++stats_->hits;
+                return bvh;
+            }
+        }
+
+        // Build without holding the lock, the build uses the thread pool and can take a while.
+        // Take the version before building, a modification during the build gives a stale entry
+        // that is rebuilt on the next call.
+        GeometryVersion version{*mesh};
+        auto bvh = std::make_shared<const MeshBVH>(*mesh);
+
+        const std::scoped_lock lock{mutex_};
+        if (auto existing = find(mesh)) {
+            ++stats_->hits;
+            return existing;
+        }
+        ++stats_->misses;
+        entries_.push_front(Entry{mesh.get(), mesh, std::move(version), bvh});
+        trim();
+        return bvh;
+    }
+
+private:
+    struct Entry {
+        const Mesh* mesh;
+        std::weak_ptr<const Mesh> owner;
+        GeometryVersion version;
+        std::shared_ptr<const MeshBVH> bvh;
+    };
+
+    // Find the BVH of mesh and make it the most recently used one, drops outdated entries
+    std::shared_ptr<const MeshBVH> find(const std::shared_ptr<const Mesh>& mesh) {
+        std::erase_if(entries_, [&](const Entry& entry) {
+            return entry.owner.expired() || (isSame(entry, mesh) && !entry.version.matches(*mesh));
+        });
+        const auto it = std::ranges::find_if(
+            entries_, [&](const Entry& entry) { return isSame(entry, mesh); });
+        if (it == entries_.end()) {
+            updateStats();
+            return nullptr;
+        }
+        entries_.splice(entries_.begin(), entries_, it);
+        return it->bvh;
+    }
+
+    static bool isSame(const Entry& entry, const std::shared_ptr<const Mesh>& mesh) {
+        return entry.mesh == mesh.get() && !entry.owner.owner_before(mesh) &&
+               !mesh.owner_before(entry.owner);
+    }
+
+    // Release least recently used BVHs that are not in use elsewhere until within budget
+    void trim() {
+        auto bytes = updateStats();
+        const auto budget = stats_->budget.load();
+        for (auto it = entries_.end(); bytes > budget && it != entries_.begin();) {
+            --it;
+            if (it->bvh.use_count() == 1) {
+                bytes -= it->bvh->getSizeInBytes();
+                it = entries_.erase(it);
+                ++stats_->evictions;
+            }
+        }
+        updateStats();
+    }
+
+    size_t updateStats() {
+        size_t bytes = 0;
+        for (const auto& entry : entries_) bytes += entry.bvh->getSizeInBytes();
+        stats_->items = entries_.size();
+        stats_->bytes = bytes;
+        return bytes;
+    }
+
+    std::mutex mutex_;
+    std::list<Entry> entries_;  // most recently used first
+    std::shared_ptr<resource::PoolStats> stats_;
+};
+
+}  // namespace
+
+std::shared_ptr<const MeshBVH> getBVH(const std::shared_ptr<const Mesh>& mesh) {
+    if (!mesh) return nullptr;
+
+    static BVHCache cache;
+    return cache.get(mesh);
+}
+
+}  // namespace meshutil
+
+}  // namespace inviwo
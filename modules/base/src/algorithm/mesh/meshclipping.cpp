@@ -38,6 +38,7 @@
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/util/exception.h>                                 // for Exception
+#include <inviwo/core/util/foreach.h>                                   // for forEachChunkPa...
 #include <inviwo/core/util/formatdispatching.h>                         // for PrecisionType
 #include <inviwo/core/util/formats.h>                                   // for DataFormat, Numer...
 #include <inviwo/core/util/glmutils.h>                                  // for same_extent
@@ -45,14 +46,16 @@
 #include <inviwo/core/util/logcentral.h>                                // for LogCentral, LogWa...
 
 #include <algorithm>      // for transform, find_if
+#include <array>          // for array
 #include <cstddef>        // for size_t
 #include <iterator>       // for back_insert_iterator
-#include <numeric>        // for accumulate, iota
+#include <limits>         // for numeric_limits
+#include <numeric>        // for partial_sum, iota
+#include <span>           // for span
 #include <string>         // for string
 #include <string_view>    // for string_view
 #include <tuple>          // for make_tuple, tuple...
 #include <type_traits>    // for remove_extent_t
-#include <unordered_set>  // for unordered_set
 #include <utility>        // for pair
 
 #include <glm/common.hpp>                 // for abs, max
@@ -61,7 +64,6 @@
 #include <glm/fwd.hpp>                    // for u32vec2, u32vec3
 #include <glm/geometric.hpp>              // for dot, cross, length
 #include <glm/gtc/type_ptr.hpp>           // for value_ptr
-#include <glm/gtx/component_wise.hpp>     // for compMax
 #include <glm/gtx/scalar_relational.hpp>  // for all
 #include <glm/mat4x4.hpp>                 // for operator*, mat
 #include <glm/matrix.hpp>                 // for inverse
@@ -285,103 +287,230 @@ vec2 polygonCentroid(const std::vector<vec2>& polygon) {
     return center;
 }
 
-void capHoles(std::vector<glm::u32vec2>& edges, const Plane& plane,
-              const std::vector<vec3>& positions, std::vector<std::uint32_t>& indices,
-              const InterpolateFunctor& addInterpolatedVertex) {
+}  // namespace detail
+
+namespace {
 
-    constexpr float relError = 0.000001f;
-    const auto eps =
-        relError * std::accumulate(edges.begin(), edges.end(), 0.0f, [&](float m, glm::u32vec2 e) {
-            return glm::max(m, glm::max(glm::compMax(glm::abs(positions[e[0]])),
-                                        glm::compMax(glm::abs(positions[e[1]]))));
+/*
+ * One term of the weighted sum of input vertices that make up a vertex added by the clipping
+ */
+struct Source {
+    std::uint32_t vertex;
+    float weight;
+};
+
+/*
+ * Clips the index buffers of a mesh against a plane. Added vertices are stored as weighted sums
+ * of input vertices, and all vertex buffers are interpolated from those in one typed pass at the
+ * end.
+ */
+class PlaneClipper {
+public:
+    PlaneClipper(const Plane& plane, const std::vector<vec3>& positions)
+        : plane_{plane}, positions_{positions}, distances_(positions.size()) {
+        util::forEachChunkParallel(positions.size(), [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; ++i) distances_[i] = plane_.distance(positions_[i]);
         });
+    }
 
-    removeDuplicateEdges(edges, positions, eps);
-    const auto loops = gatherLoops(edges, positions, eps);
+    void clip(const Mesh::MeshInfo& meshInfo, const std::vector<std::uint32_t>& indices,
+              Mesh& clippedMesh);
 
-    for (const auto& loop : loops) {
-        if (loop.size() < 2) continue;
+    /*
+     * Close the cuts of the triangles with triangle fans in the plane
+     */
+    std::vector<std::uint32_t> capHoles();
 
-        const auto trans = glm::inverse(plane.inPlaneBasis());
+    bool hasCuts() const { return !cuts_.empty(); }
 
-        std::vector<vec3> pos;
-        std::transform(loop.begin(), loop.end(), std::back_inserter(pos),
-                       [&](uint32_t p) { return positions[p]; });
+    std::shared_ptr<BufferBase> interpolate(const BufferBase& buffer, bool isNormal) const;
 
-        std::vector<vec4> uv4;
-        std::transform(loop.begin(), loop.end(), std::back_inserter(uv4),
-                       [&](uint32_t p) { return trans * vec4{positions[p], 1.0f}; });
+private:
+    bool isInside(std::uint32_t vertex) const { return distances_[vertex] >= 0.0f; }
+    std::uint32_t vertexCount() const {
+        return static_cast<std::uint32_t>(positions_.size() + offsets_.size() - 1);
+    }
 
-        std::vector<vec2> uv;
-        std::transform(loop.begin(), loop.end(), std::back_inserter(uv),
-                       [&](uint32_t p) { return vec2{trans * vec4{positions[p], 1.0f}}; });
-
-        const auto uvCenter = polygonCentroid(uv);
-        const auto center = vec3{glm::inverse(trans) * vec4{uvCenter, 0.0f, 1.0f}};
-        const auto weights = barycentricInsidePolygon(uvCenter, uv);
-
-        const auto orientation =
-            glm::cross(positions[loop[0]] - center, positions[loop[1]] - center);
-        const auto dir = glm::dot(plane.getNormal(), orientation);
-
-        const auto centerIndex = addInterpolatedVertex(loop, weights, -plane.getNormal());
-        for (size_t i = 0; i < loop.size(); ++i) {
-            const auto j = (i + 1) % loop.size();
-            indices.push_back(centerIndex);
-            indices.push_back(
-                addInterpolatedVertex({loop[dir < 0 ? i : j]}, {1.0f}, -plane.getNormal()));
-            indices.push_back(
-                addInterpolatedVertex({loop[dir < 0 ? j : i]}, {1.0f}, -plane.getNormal()));
+    /*
+     * The intersection of the edge between a and b with the plane. The end points are ordered by
+     * position, so the triangles on both sides of an edge get bitwise identical intersections,
+     * also when they do not share vertices.
+     */
+    std::array<Source, 2> intersection(std::uint32_t a, std::uint32_t b) const {
+        const auto pa = glm::value_ptr(positions_[a]);
+        const auto pb = glm::value_ptr(positions_[b]);
+        if (std::lexicographical_compare(pb, pb + 3, pa, pa + 3)) std::swap(a, b);
+        const auto t = distances_[a] / (distances_[a] - distances_[b]);
+        return {Source{a, 1.0f - t}, Source{b, t}};
+    }
+    std::span<const Source> sources(std::uint32_t vertex) const {
+        const auto i = vertex - positions_.size();
+        return std::span{sources_}.subspan(offsets_[i], offsets_[i + 1] - offsets_[i]);
+    }
+    vec3 position(std::uint32_t vertex) const {
+        vec3 position{0.0f};
+        for (const auto& source : sources(vertex)) {
+            position += positions_[source.vertex] * source.weight;
         }
+        return position;
+    }
+    std::uint32_t addEdgeVertex(std::uint32_t a, std::uint32_t b) {
+        const auto edge = intersection(a, b);
+        sources_.insert(sources_.end(), edge.begin(), edge.end());
+        offsets_.push_back(sources_.size());
+        return vertexCount() - 1;
     }
-}
 
-std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
-                                      std::shared_ptr<Mesh>& clippedMesh,
-                                      const std::vector<uint32_t>& indices, const Plane& plane,
-                                      const std::vector<vec3>& positions,
-                                      const InterpolateFunctor& addInterpolatedVertex) {
+    std::vector<std::uint32_t> clipTriangles(const std::vector<std::uint32_t>& indices,
+                                             ConnectivityType ct);
 
-    std::vector<glm::u32vec2> newEdges;
+    const Plane& plane_;
+    const std::vector<vec3>& positions_;
+    std::vector<float> distances_;
 
+    std::vector<Source> sources_;
+    std::vector<size_t> offsets_{0};
+    std::uint32_t capBegin_ = std::numeric_limits<std::uint32_t>::max();
+    std::vector<glm::u32vec2> cuts_;
+};
+
+/* Sutherland-Hodgman clipping of all triangles in parallel, see detail::sutherlandHodgman.
+ * The number of inside corners of a triangle determines how many indices and vertices it adds,
+ * so each chunk first counts its output and then writes it directly to its place in the result.
+ */
+std::vector<std::uint32_t> PlaneClipper::clipTriangles(const std::vector<std::uint32_t>& indices,
+                                                       ConnectivityType ct) {
+    const auto strip = ct == ConnectivityType::Strip;
+    const auto triangles = strip ? indices.size() - 2 : indices.size() / 3;
+    const auto triangle = [&](size_t t) -> std::array<std::uint32_t, 3> {
+        if (strip) {
+            return {indices[t], indices[t & 1 ? t + 2 : t + 1], indices[t & 1 ? t + 1 : t + 2]};
+        }
+        return {indices[3 * t], indices[3 * t + 1], indices[3 * t + 2]};
+    };
+    const auto insideCount = [&](const std::array<std::uint32_t, 3>& tri) {
+        return static_cast<size_t>(isInside(tri[0])) + static_cast<size_t>(isInside(tri[1])) +
+               static_cast<size_t>(isInside(tri[2]));
+    };
+    // Indices and added vertices for 0, 1, 2, and 3 inside corners
+    constexpr std::array<size_t, 4> addedIndices{0, 3, 6, 3};
+    constexpr std::array<size_t, 4> addedVertices{0, 2, 2, 0};
+
+    const auto chunks = std::min(std::max<size_t>(4 * util::getPoolSize(), 1), triangles);
+    const auto chunkBegin = [&](size_t chunk) { return (triangles * chunk) / chunks; };
+
+    std::vector<size_t> indexOffsets(chunks + 1, 0);
+    std::vector<size_t> vertexOffsets(chunks + 1, 0);
+    util::forEachChunkParallel(
+        chunks,
+        [&](size_t begin, size_t end) {
+            for (auto chunk = begin; chunk < end; ++chunk) {
+                for (auto t = chunkBegin(chunk); t < chunkBegin(chunk + 1); ++t) {
+                    const auto inside = insideCount(triangle(t));
+                    indexOffsets[chunk + 1] += addedIndices[inside];
+                    vertexOffsets[chunk + 1] += addedVertices[inside];
+                }
+            }
+        },
+        chunks);
+    std::partial_sum(indexOffsets.begin(), indexOffsets.end(), indexOffsets.begin());
+    std::partial_sum(vertexOffsets.begin(), vertexOffsets.end(), vertexOffsets.begin());
+
+    const auto firstVertex = vertexCount();
+    const auto firstSource = sources_.size();
+    const auto firstCut = cuts_.size();
+    std::vector<std::uint32_t> res(indexOffsets.back());
+    sources_.resize(firstSource + 2 * vertexOffsets.back());
+    offsets_.resize(offsets_.size() + vertexOffsets.back());
+    cuts_.resize(firstCut + vertexOffsets.back() / 2);
+
+    util::forEachChunkParallel(
+        chunks,
+        [&](size_t begin, size_t end) {
+            for (auto chunk = begin; chunk < end; ++chunk) {
+                auto out = res.begin() + indexOffsets[chunk];
+                auto added = vertexOffsets[chunk];
+                const auto addEdgeVertex = [&](std::uint32_t a, std::uint32_t b) {
+                    const auto edge = intersection(a, b);
+                    std::copy(edge.begin(), edge.end(), sources_.begin() + firstSource + 2 * added);
+                    offsets_[firstVertex - positions_.size() + added + 1] =
+                        firstSource + 2 * (added + 1);
+                    return static_cast<std::uint32_t>(firstVertex + added++);
+                };
+
+                for (auto t = chunkBegin(chunk); t < chunkBegin(chunk + 1); ++t) {
+                    const auto tri = triangle(t);
+                    const auto inside = insideCount(tri);
+                    if (inside == 0) continue;
+                    if (inside == 3) {
+                        out = std::copy(tri.begin(), tri.end(), out);
+                        continue;
+                    }
+
+                    std::array<std::uint32_t, 4> polygon{};
+                    size_t corners = 0;
+                    std::array<std::uint32_t, 2> cut{};
+                    size_t cutEnds = 0;
+                    for (size_t i = 0; i < 3; ++i) {
+                        const auto i1 = tri[i];
+                        const auto i2 = tri[(i + 1) % 3];
+                        if (isInside(i1) != isInside(i2)) {
+                            const auto vertex = addEdgeVertex(i1, i2);
+                            polygon[corners++] = vertex;
+                            cut[cutEnds++] = vertex;
+                        }
+                        if (isInside(i2)) polygon[corners++] = i2;
+                    }
+                    out = std::copy(polygon.begin(), polygon.begin() + 3, out);
+                    if (corners == 4) {
+                        out = std::copy_n(std::array{polygon[0], polygon[2], polygon[3]}.begin(),
+                                          3, out);
+                    }
+                    cuts_[firstCut + added / 2 - 1] = glm::u32vec2{cut[0], cut[1]};
+                }
+            }
+        },
+        chunks);
+
+    return res;
+}
+
+void PlaneClipper::clip(const Mesh::MeshInfo& meshInfo, const std::vector<std::uint32_t>& indices,
+                        Mesh& clippedMesh) {
     if (meshInfo.dt == DrawType::Points) {
-        auto outIndices = clippedMesh->addIndexBuffer(DrawType::Points, meshInfo.ct);
+        auto outIndices = clippedMesh.addIndexBuffer(DrawType::Points, meshInfo.ct);
         for (auto i : indices) {
-            if (plane.isInside(positions[i])) {
+            if (isInside(i)) {
                 outIndices->add(i);
             }
         }
 
     } else if (meshInfo.dt == DrawType::Lines) {
         if (meshInfo.ct == ConnectivityType::None) {
-            if (indices.size() < 2) return {};
-            auto outIndices = clippedMesh->addIndexBuffer(DrawType::Lines, ConnectivityType::None);
+            if (indices.size() < 2) return;
+            auto outIndices = clippedMesh.addIndexBuffer(DrawType::Lines, ConnectivityType::None);
             for (unsigned int l = 0; l < indices.size() - 1; l += 2) {
                 const auto i1 = indices[l];
                 const auto i2 = indices[l + 1];
 
-                const auto in1 = plane.isInside(positions[i1]);
-                const auto in2 = plane.isInside(positions[i2]);
+                const auto in1 = isInside(i1);
+                const auto in2 = isInside(i2);
 
                 if (in1 && in2) {
                     outIndices->add(i1);
                     outIndices->add(i2);
                 } else if (in1) {
-                    const auto weight = *plane.getIntersectionWeight(positions[i1], positions[i2]);
                     outIndices->add(i1);
-                    outIndices->add(
-                        addInterpolatedVertex({i1, i2}, {1.0f - weight, weight}, std::nullopt));
+                    outIndices->add(addEdgeVertex(i1, i2));
                 } else if (in2) {
-                    const auto weight = *plane.getIntersectionWeight(positions[i1], positions[i2]);
-                    outIndices->add(
-                        addInterpolatedVertex({i1, i2}, {1.0f - weight, weight}, std::nullopt));
+                    outIndices->add(addEdgeVertex(i1, i2));
                     outIndices->add(i2);
                 }
             }
         } else if (meshInfo.ct == ConnectivityType::Adjacency) {
-            if (indices.size() < 4) return newEdges;
+            if (indices.size() < 4) return;
             auto outIndices =
-                clippedMesh->addIndexBuffer(DrawType::Lines, ConnectivityType::Adjacency);
+                clippedMesh.addIndexBuffer(DrawType::Lines, ConnectivityType::Adjacency);
             for (unsigned int l = 0; l < indices.size() - 3; l += 4) {
 
                 const auto i1 = indices[l];
@@ -389,8 +518,8 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
                 const auto i3 = indices[l + 2];
                 const auto i4 = indices[l + 3];
 
-                const auto in2 = plane.isInside(positions[i2]);
-                const auto in3 = plane.isInside(positions[i3]);
+                const auto in2 = isInside(i2);
+                const auto in3 = isInside(i3);
 
                 if (in2 && in3) {
                     outIndices->add(i1);
@@ -398,35 +527,30 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
                     outIndices->add(i3);
                     outIndices->add(i4);
                 } else if (in2) {
-                    const auto weight = *plane.getIntersectionWeight(positions[i2], positions[i3]);
                     outIndices->add(i1);
                     outIndices->add(i2);
-                    outIndices->add(
-                        addInterpolatedVertex({i2, i3}, {1.0f - weight, weight}, std::nullopt));
+                    outIndices->add(addEdgeVertex(i2, i3));
                     outIndices->add(i3);
-                } else if (in2) {
-                    const auto weight = *plane.getIntersectionWeight(positions[i2], positions[i3]);
+                } else if (in3) {
                     outIndices->add(i2);
-                    outIndices->add(
-                        addInterpolatedVertex({i2, i3}, {1.0f - weight, weight}, std::nullopt));
+                    outIndices->add(addEdgeVertex(i2, i3));
                     outIndices->add(i3);
                     outIndices->add(i4);
                 }
             }
         } else if (meshInfo.ct == ConnectivityType::Strip) {
-            if (indices.size() < 2) return newEdges;
+            if (indices.size() < 2) return;
 
             auto start = indices.begin();
             const auto end = indices.end();
 
             while (start != end) {
-                start = std::find_if(start, end,
-                                     [&](uint32_t i) { return plane.isInside(positions[i]); });
-                const auto lineEnd = std::find_if(
-                    start, end, [&](uint32_t i) { return !plane.isInside(positions[i]); });
+                start = std::find_if(start, end, [&](uint32_t i) { return isInside(i); });
+                const auto lineEnd =
+                    std::find_if(start, end, [&](uint32_t i) { return !isInside(i); });
                 if (start != end) {
                     auto& outIndices =
-                        clippedMesh->addIndexBuffer(DrawType::Lines, ConnectivityType::Strip)
+                        clippedMesh.addIndexBuffer(DrawType::Lines, ConnectivityType::Strip)
                             ->getDataContainer();
                     std::copy(start, lineEnd, std::back_inserter(outIndices));
                 }
@@ -434,19 +558,18 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
             }
 
         } else if (meshInfo.ct == ConnectivityType::StripAdjacency) {
-            if (indices.size() < 4) return newEdges;
+            if (indices.size() < 4) return;
             auto start = indices.begin() + 1;
             const auto end = indices.end() - 1;
 
             while (start != end) {
-                start = std::find_if(start, end,
-                                     [&](uint32_t i) { return plane.isInside(positions[i]); });
-                const auto lineEnd = std::find_if(
-                    start, end, [&](uint32_t i) { return !plane.isInside(positions[i]); });
+                start = std::find_if(start, end, [&](uint32_t i) { return isInside(i); });
+                const auto lineEnd =
+                    std::find_if(start, end, [&](uint32_t i) { return !isInside(i); });
                 if (start != end) {
                     auto& outIndices =
                         clippedMesh
-                            ->addIndexBuffer(DrawType::Lines, ConnectivityType::StripAdjacency)
+                            .addIndexBuffer(DrawType::Lines, ConnectivityType::StripAdjacency)
                             ->getDataContainer();
 
                     outIndices.push_back(*std::prev(start));
@@ -460,152 +583,248 @@ std::vector<glm::u32vec2> clipIndices(const Mesh::MeshInfo& meshInfo,
             throw Exception("Cannot clip, need line connectivity Strip or None");
         }
     } else if (meshInfo.dt == DrawType::Triangles) {
-        if (indices.size() < 3) return newEdges;
-        auto outIndices = clippedMesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
-
-        if (meshInfo.ct == ConnectivityType::Strip) {
-            for (unsigned int t = 0; t < indices.size() - 2; ++t) {
-                const glm::u32vec3 triangle{indices[t], indices[t & 1 ? t + 2 : t + 1],
-                                            indices[t & 1 ? t + 1 : t + 2]};
-                auto newEdge = detail::sutherlandHodgman(triangle, plane, positions,
-                                                         outIndices->getDataContainer(),
-                                                         addInterpolatedVertex);
-                if (newEdge) newEdges.push_back(*newEdge);
-            }
-        } else if (meshInfo.ct == ConnectivityType::None) {
-            for (unsigned int t = 0; t < indices.size() - 2; t += 3) {
-                const glm::u32vec3 triangle{indices[t], indices[t + 1], indices[t + 2]};
-                auto newEdge = detail::sutherlandHodgman(triangle, plane, positions,
-                                                         outIndices->getDataContainer(),
-                                                         addInterpolatedVertex);
-                if (newEdge) newEdges.push_back(*newEdge);
-            }
-        } else {
+        if (meshInfo.ct != ConnectivityType::None && meshInfo.ct != ConnectivityType::Strip) {
             throw Exception("Cannot clip, need triangle connectivity Strip or None");
         }
+        if (indices.size() < 3) return;
+        clippedMesh.addIndices(Mesh::MeshInfo{DrawType::Triangles, ConnectivityType::None},
+                               util::makeIndexBuffer(clipTriangles(indices, meshInfo.ct)));
     }
-    return newEdges;
 }
 
-template <typename PB, typename T>
-struct BufferAccess {
-    BufferAccess(const PB& buffer) : buffer(buffer) {}
-    T operator()(uint32_t index, float weight) { return static_cast<T>(buffer[index]) * weight; }
-    const PB& buffer;
-};
+/* The end points of the cuts are matched by position, which is exact since the intersections are
+ * computed in the same order for both sides of an edge. Each closed loop of cuts is capped with a
+ * fan around the centroid of the loop, using one new vertex per loop vertex.
+ */
+std::vector<std::uint32_t> PlaneClipper::capHoles() {
+    // Give end points at the same position the same node
+    std::vector<vec3> points(2 * cuts_.size());
+    util::forEachChunkParallel(points.size(), [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) points[i] = position(cuts_[i / 2][i % 2]);
+    });
+    const auto less = [&](std::uint32_t a, std::uint32_t b) {
+        const auto pa = glm::value_ptr(points[a]);
+        const auto pb = glm::value_ptr(points[b]);
+        return std::lexicographical_compare(pa, pa + 3, pb, pb + 3);
+    };
+    std::vector<std::uint32_t> order(points.size());
+    std::iota(order.begin(), order.end(), std::uint32_t{0});
+    std::sort(order.begin(), order.end(), less);
+
+    std::vector<std::uint32_t> node(points.size());
+    std::vector<std::uint32_t> nodeVertex;
+    for (size_t i = 0; i < order.size(); ++i) {
+        if (i == 0 || less(order[i - 1], order[i])) {
+            nodeVertex.push_back(cuts_[order[i] / 2][order[i] % 2]);
+        }
+        node[order[i]] = static_cast<std::uint32_t>(nodeVertex.size() - 1);
+    }
 
-}  // namespace detail
+    // Remove degenerate and duplicated cuts
+    std::vector<glm::u32vec2> edges;
+    edges.reserve(cuts_.size());
+    for (size_t i = 0; i < cuts_.size(); ++i) {
+        const auto a = node[2 * i];
+        const auto b = node[2 * i + 1];
+        if (a != b) edges.emplace_back(std::min(a, b), std::max(a, b));
+    }
+    std::sort(edges.begin(), edges.end(), [](glm::u32vec2 a, glm::u32vec2 b) {
+        return a[0] < b[0] || (a[0] == b[0] && a[1] < b[1]);
+    });
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
 
-std::shared_ptr<Mesh> clipMeshAgainstPlane(const Mesh& mesh, const Plane& worldSpacePlane,
-                                           bool capClippedHoles) {
+    // The edges of each node
+    std::vector<std::uint32_t> nodeOffsets(nodeVertex.size() + 1, 0);
+    for (const auto& edge : edges) {
+        ++nodeOffsets[edge[0] + 1];
+        ++nodeOffsets[edge[1] + 1];
+    }
+    std::partial_sum(nodeOffsets.begin(), nodeOffsets.end(), nodeOffsets.begin());
+    std::vector<std::uint32_t> nodeEdges(nodeOffsets.back());
+    {
+        auto next = nodeOffsets;
+        for (std::uint32_t e = 0; e < edges.size(); ++e) {
+            nodeEdges[next[edges[e][0]]++] = e;
+            nodeEdges[next[edges[e][1]]++] = e;
+        }
+    }
 
-    const auto plane =
-        worldSpacePlane.transform(mesh.getCoordinateTransformer().getWorldToDataMatrix());
+    // Walk the loops
+    std::vector<std::uint8_t> visited(edges.size(), 0);
+    std::vector<std::uint32_t> loopOffsets{0};
+    std::vector<std::uint32_t> loops;
+    bool unclosed = false;
+    for (std::uint32_t first = 0; first < edges.size(); ++first) {
+        if (visited[first]) continue;
+        visited[first] = 1;
+        const auto start = edges[first][0];
+        auto current = edges[first][1];
+        const auto loopBegin = loops.size();
+        loops.push_back(nodeVertex[start]);
+
+        while (current != start) {
+            loops.push_back(nodeVertex[current]);
+            const auto begin = nodeEdges.begin() + nodeOffsets[current];
+            const auto end = nodeEdges.begin() + nodeOffsets[current + 1];
+            const auto it = std::find_if(begin, end, [&](std::uint32_t e) { return !visited[e]; });
+            if (it == end) {
+                unclosed = true;
+                break;
+            }
+            visited[*it] = 1;
+            current = edges[*it][0] == current ? edges[*it][1] : edges[*it][0];
+        }
 
-    auto clippedMesh = std::make_shared<Mesh>();
-    clippedMesh->setModelMatrix(mesh.getModelMatrix());
-    clippedMesh->setWorldMatrix(mesh.getWorldMatrix());
-    clippedMesh->copyMetaDataFrom(mesh);
+        if (loops.size() - loopBegin < 3) {
+            loops.resize(loopBegin);
+        } else {
+            loopOffsets.push_back(static_cast<std::uint32_t>(loops.size()));
+        }
+    }
+    if (unclosed) {
+        log::warn(
+            "Found edge that is not connected to any other edge. This could mean "
+            "the clipped mesh was not a manifold.");
+    }
 
-    std::vector<detail::InterpolateFunctor> interpolateFunctors;
-    std::shared_ptr<BufferRAMPrecision<vec3, BufferTarget::Data>> posBuffer;
-
-    for (const auto& item : mesh.getBuffers()) {
-        const auto& bufferType = item.first;
-        const auto& inBuffer = item.second;
-        auto functor =
-            inBuffer->getRepresentation<BufferRAM>()->dispatch<detail::InterpolateFunctor>(
-                [&clippedMesh, bufferType, &posBuffer](auto inRam) -> detail::InterpolateFunctor {
-                    using PB = util::PrecisionType<decltype(inRam)>;
-                    using ValueType = util::PrecisionValueType<decltype(inRam)>;
-                    using T = typename util::same_extent<ValueType, float>::type;
-
-                    static const auto mix = [](const PB& buffer,
-                                               const std::vector<uint32_t>& indices,
-                                               const std::vector<float>& weights) {
-                        return static_cast<ValueType>(std::inner_product(
-                            indices.begin(), indices.end(), weights.begin(), T{0}, std::plus<T>{},
-                            detail::BufferAccess<PB, T>{buffer}));
-                    };
-                    (void)mix;
-
-                    auto outRam =
-                        std::make_shared<BufferRAMPrecision<ValueType, PB::target>>(*inRam);
-                    auto outBuffer = std::make_shared<Buffer<ValueType, PB::target>>(outRam);
-                    clippedMesh->addBuffer(bufferType, outBuffer);
-
-                    if constexpr (std::is_same_v<ValueType, vec3> &&
-                                  PB::target == BufferTarget::Data) {
-                        if (bufferType == BufferType::NormalAttrib) {
-                            return [outRam](const std::vector<uint32_t>& indices,
-                                            const std::vector<float>& weights,
-                                            std::optional<vec3> normal) {
-                                outRam->add(normal ? *normal : mix(*outRam, indices, weights));
-                                return static_cast<uint32_t>(outRam->getSize() - 1);
-                            };
-                        } else if (bufferType == BufferType::PositionAttrib) {
-                            posBuffer = outRam;
-                        }
-                    }
+    // Each loop of n vertices adds a center and n ring vertices with 4n sources, and n triangles
+    const auto loopCount = loopOffsets.size() - 1;
+    capBegin_ = vertexCount();
+    const auto firstOffset = offsets_.size();
+    const auto firstSource = sources_.size();
+    offsets_.resize(firstOffset + loopCount + loops.size());
+    sources_.resize(firstSource + 4 * loops.size());
+    std::vector<std::uint32_t> res(3 * loops.size());
+
+    const auto basis = plane_.inPlaneBasis();
+    const auto toPlane = glm::inverse(basis);
+    util::forEachChunkParallel(loopCount, [&](size_t begin, size_t end) {
+        std::vector<vec2> uv;
+        for (auto l = begin; l < end; ++l) {
+            const auto loop =
+                std::span{loops}.subspan(loopOffsets[l], loopOffsets[l + 1] - loopOffsets[l]);
+
+            uv.clear();
+            std::transform(loop.begin(), loop.end(), std::back_inserter(uv), [&](uint32_t v) {
+                return vec2{toPlane * vec4{position(v), 1.0f}};
+            });
+            const auto uvCenter = detail::polygonCentroid(uv);
+            const auto center = vec3{basis * vec4{uvCenter, 0.0f, 1.0f}};
+            const auto weights = detail::barycentricInsidePolygon(uvCenter, uv);
+
+            const auto orientation =
+                glm::cross(position(loop[0]) - center, position(loop[1]) - center);
+            const auto dir = glm::dot(plane_.getNormal(), orientation);
+
+            auto offset = offsets_.begin() + firstOffset + loopOffsets[l] + l;
+            auto source = sources_.begin() + firstSource + 4 * loopOffsets[l];
+            for (size_t i = 0; i < loop.size(); ++i) {
+                for (const auto& s : sources(loop[i])) {
+                    *source++ = Source{s.vertex, s.weight * weights[i]};
+                }
+            }
+            *offset++ = static_cast<size_t>(source - sources_.begin());
+            for (const auto vertex : loop) {
+                const auto edge = sources(vertex);
+                source = std::copy(edge.begin(), edge.end(), source);
+                *offset++ = static_cast<size_t>(source - sources_.begin());
+            }
+
+            const auto centerIndex = capBegin_ + loopOffsets[l] + static_cast<std::uint32_t>(l);
+            auto out = res.begin() + 3 * loopOffsets[l];
+            for (std::uint32_t i = 0; i < loop.size(); ++i) {
+                const auto j = (i + 1) % static_cast<std::uint32_t>(loop.size());
+                *out++ = centerIndex;
+                *out++ = centerIndex + 1 + (dir < 0 ? i : j);
+                *out++ = centerIndex + 1 + (dir < 0 ? j : i);
+            }
+        }
+    });
+
+    return res;
+}
 
+std::shared_ptr<BufferBase> PlaneClipper::interpolate(const BufferBase& buffer,
+                                                      bool isNormal) const {
+    return buffer.getRepresentation<BufferRAM>()->dispatch<std::shared_ptr<BufferBase>>(
+        [&](auto inRam) -> std::shared_ptr<BufferBase> {
+            using PB = util::PrecisionType<decltype(inRam)>;
+            using ValueType = util::PrecisionValueType<decltype(inRam)>;
+            using T = typename util::same_extent<ValueType, float>::type;
+
+            const auto& in = inRam->getDataContainer();
+            const auto first = positions_.size();
+            std::vector<ValueType> out(vertexCount());
+            std::copy_n(in.begin(), std::min(in.size(), first), out.begin());
+
+            // Only interpolate floating point buffers, use the nearest vertex for the others
+            util::forEachChunkParallel(out.size() - first, [&](size_t begin, size_t end) {
+                for (auto i = first + begin; i < first + end; ++i) {
+                    const auto vertexSources = sources(static_cast<std::uint32_t>(i));
                     if constexpr (DataFormat<ValueType>::numtype == NumericType::Float) {
-                        return [outRam](const std::vector<uint32_t>& indices,
-                                        const std::vector<float>& weights, std::optional<vec3>) {
-                            outRam->add(mix(*outRam, indices, weights));
-                            return static_cast<uint32_t>(outRam->getSize() - 1);
-                        };
-                    } else {  // Only interpolate floating point buffers;
-                        return [outRam](const std::vector<uint32_t>& indices,
-                                        const std::vector<float>& weights, std::optional<vec3>) {
-                            const auto it = std::max_element(weights.begin(), weights.end());
-                            const auto index = std::distance(weights.begin(), it);
-
-                            outRam->add(static_cast<ValueType>((*outRam)[indices[index]]));
-                            return static_cast<uint32_t>(outRam->getSize() - 1);
-                        };
+                        T value{0};
+                        for (const auto& s : vertexSources) {
+                            value += static_cast<T>(in[s.vertex]) * s.weight;
+                        }
+                        out[i] = static_cast<ValueType>(value);
+                    } else {
+                        out[i] = in[std::ranges::max_element(vertexSources, {}, &Source::weight)
+                                        ->vertex];
                     }
-                });
-        interpolateFunctors.push_back(functor);
-    }
+                }
+            });
 
-    const detail::InterpolateFunctor addInterpolatedVertex =
-        [&interpolateFunctors](const std::vector<uint32_t>& indices,
-                               const std::vector<float>& weights,
-                               std::optional<vec3> normal) -> uint32_t {
-        uint32_t res = 0;
-        for (auto& fun : interpolateFunctors) res = fun(indices, weights, normal);
-        return res;
-    };
+            if constexpr (std::is_same_v<ValueType, vec3> && PB::target == BufferTarget::Data) {
+                if (isNormal && capBegin_ < out.size()) {
+                    std::fill(out.begin() + capBegin_, out.end(), -plane_.getNormal());
+                }
+            }
+
+            return std::make_shared<Buffer<ValueType, PB::target>>(
+                std::make_shared<BufferRAMPrecision<ValueType, PB::target>>(
+                    std::move(out), inRam->getBufferUsage()));
+        });
+}
+
+}  // namespace
+
+std::shared_ptr<Mesh> clipMeshAgainstPlane(const Mesh& mesh, const Plane& worldSpacePlane,
+                                           bool capClippedHoles) {
+
+    const auto plane =
+        worldSpacePlane.transform(mesh.getCoordinateTransformer().getWorldToDataMatrix());
 
+    const auto* posBuffer =
+        dynamic_cast<const Buffer<vec3>*>(mesh.findBuffer(BufferType::PositionAttrib).first);
     if (!posBuffer) {
         throw Exception("Unsupported mesh type, vec3 position buffer not found");
     }
+    const auto& positions = posBuffer->getRAMRepresentation()->getDataContainer();
 
-    const auto& positions = posBuffer->getDataContainer();
-    std::vector<glm::u32vec2> newEdges;
-
-    for (const auto& item : mesh.getIndexBuffers()) {
-        const auto meshInfo = item.first;
-        const auto indexBuffer = item.second;
-        const auto& indices = indexBuffer->getRAMRepresentation()->getDataContainer();
+    auto clippedMesh = std::make_shared<Mesh>();
+    clippedMesh->setModelMatrix(mesh.getModelMatrix());
+    clippedMesh->setWorldMatrix(mesh.getWorldMatrix());
+    clippedMesh->copyMetaDataFrom(mesh);
 
-        auto edges = detail::clipIndices(meshInfo, clippedMesh, indices, plane, positions,
-                                         addInterpolatedVertex);
-        newEdges.insert(newEdges.end(), edges.begin(), edges.end());
+    PlaneClipper clipper{plane, positions};
+    for (const auto& [meshInfo, indexBuffer] : mesh.getIndexBuffers()) {
+        clipper.clip(meshInfo, indexBuffer->getRAMRepresentation()->getDataContainer(),
+                     *clippedMesh);
     }
     if (mesh.getIndexBuffers().empty()) {
-        const auto meshInfo = mesh.getDefaultMeshInfo();
         std::vector<uint32_t> indices(mesh.getBuffer(0)->getSize());
         std::iota(indices.begin(), indices.end(), 0);
-        auto edges = detail::clipIndices(meshInfo, clippedMesh, indices, plane, positions,
-                                         addInterpolatedVertex);
-        newEdges.insert(newEdges.end(), edges.begin(), edges.end());
+        clipper.clip(mesh.getDefaultMeshInfo(), indices, *clippedMesh);
+    }
+
+    if (capClippedHoles && clipper.hasCuts()) {
+        clippedMesh->addIndices(Mesh::MeshInfo{DrawType::Triangles, ConnectivityType::None},
+                                util::makeIndexBuffer(clipper.capHoles()));
     }
 
-    if (capClippedHoles && !newEdges.empty()) {
-        auto outIndices = clippedMesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
-        detail::capHoles(newEdges, plane, positions, outIndices->getDataContainer(),
-                         addInterpolatedVertex);
+    for (const auto& [bufferInfo, buffer] : mesh.getBuffers()) {
+        clippedMesh->addBuffer(
+            bufferInfo, clipper.interpolate(*buffer, bufferInfo.type == BufferType::NormalAttrib));
     }
 
     return clippedMesh;
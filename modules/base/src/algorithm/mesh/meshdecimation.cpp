@@ -0,0 +1,756 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/mesh/meshdecimation.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>              // for IndexBuffer, Buffer
+#include <inviwo/core/datastructures/buffer/bufferram.h>           // for BufferRAM
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>  // for BufferRAMPrecision
+#include <inviwo/core/datastructures/geometry/geometrytype.h>      // for BufferType, DrawType
+#include <inviwo/core/util/exception.h>                            // for Exception
+#include <inviwo/core/util/foreach.h>                              // for forEachChunkParallel
+#include <inviwo/core/util/formatdispatching.h>                    // for PrecisionValueType
+#include <inviwo/core/util/formats.h>                              // for DataFormat, NumericType
+#include <inviwo/core/util/glmcomp.h>                              // for glmcomp
+#include <inviwo/core/util/glmvec.h>                               // for vec3, dvec3
+#include <inviwo/core/util/zip.h>                                  // for zip
+#include <modules/base/algorithm/mesh/triangleadjacency.h>         // for TriangleAdjacency
+#include <modules/base/algorithm/meshutils.h>                      // for forEachTriangle
+
+#include <algorithm>    // for min, max, sort, nth_element, any_of
+#include <array>        // for array
+#include <atomic>       // for atomic_ref
+#include <bit>          // for bit_cast
+#include <cmath>        // for sqrt, abs, pow
+#include <limits>       // for numeric_limits
+#include <numeric>      // for partial_sum, iota
+#include <optional>     // for optional
+#include <span>         // for span
+#include <type_traits>  // for is_floating_point_v
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include <glm/common.hpp>              // for min, max, clamp
+#include <glm/geometric.hpp>           // for cross, dot, length, normalize
+#include <glm/gtx/component_wise.hpp>  // for compMax
+
+namespace inviwo {
+
+namespace meshutil {
+
+namespace {
+
+/*
+ * The quadric error p^T A p + 2 b^T p + c of a sum of planes, A is symmetric and only the upper
+ * triangle is stored. The planes of triangles are weighted by their area, and the sum of those
+ * weights is kept to turn the error into an average squared distance.
+ */
+struct Quadric {
+    double a00 = 0.0, a01 = 0.0, a02 = 0.0, a11 = 0.0, a12 = 0.0, a22 = 0.0;
+    double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+    double c = 0.0;
+    double area = 0.0;
+
+    /*
+     * The squared distance to the plane dot(n, p) + d = 0 times weight, n must be normalized.
+     */
+    static Quadric plane(const dvec3& n, double d, double weight) {
+        return {weight * n.x * n.x, weight * n.x * n.y, weight * n.x * n.z,
+                weight * n.y * n.y, weight * n.y * n.z, weight * n.z * n.z,
+                weight * n.x * d,   weight * n.y * d,   weight * n.z * d,
+                weight * d * d,     0.0};
+    }
+
+    Quadric& operator+=(const Quadric& q) {
+        a00 += q.a00;
+        a01 += q.a01;
+        a02 += q.a02;
+        a11 += q.a11;
+        a12 += q.a12;
+        a22 += q.a22;
+        b0 += q.b0;
+        b1 += q.b1;
+        b2 += q.b2;
+        c += q.c;
+        area += q.area;
+        return *this;
+    }
+
+    double error(const dvec3& p) const {
+        return p.x * (a00 * p.x + 2.0 * (a01 * p.y + a02 * p.z + b0)) +
+               p.y * (a11 * p.y + 2.0 * (a12 * p.z + b1)) + p.z * (a22 * p.z + 2.0 * b2) + c;
+    }
+
+    /*
+     * The point with the smallest error, if A is well conditioned
+     */
+    std::optional<dvec3> minimum() const {
+        const double c00 = a11 * a22 - a12 * a12;
+        const double c01 = a02 * a12 - a01 * a22;
+        const double c02 = a01 * a12 - a02 * a11;
+        const double det = a00 * c00 + a01 * c01 + a02 * c02;
+        const double scale = std::max({std::abs(a00), std::abs(a11), std::abs(a22)});
+        if (std::abs(det) <= 1e-8 * scale * scale * scale) return std::nullopt;
+
+        const double c11 = a00 * a22 - a02 * a02;
+        const double c12 = a01 * a02 - a00 * a12;
+        const double c22 = a00 * a11 - a01 * a01;
+        return -dvec3{c00 * b0 + c01 * b1 + c02 * b2, c01 * b0 + c11 * b1 + c12 * b2,
+                      c02 * b0 + c12 * b1 + c22 * b2} /
+               det;
+    }
+};
+
+/*
+ * The corners (half edges starting in a vertex) of the triangles around each vertex
+ */
+struct VertexCorners {
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> corners;
+
+    std::span<const std::uint32_t> operator()(std::uint32_t vertex) const {
+        return {corners.data() + offsets[vertex], corners.data() + offsets[vertex + 1]};
+    }
+};
+
+VertexCorners vertexCorners(const std::vector<std::uint32_t>& indices, size_t vertices) {
+    VertexCorners res{std::vector<std::uint32_t>(vertices + 1, 0),
+                      std::vector<std::uint32_t>(indices.size())};
+
+    util::forEachChunkParallel(indices.size(), [&](size_t begin, size_t end) {
+        for (auto k = begin; k < end; ++k) {
+            std::atomic_ref{res.offsets[indices[k] + 1]}.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    std::partial_sum(res.offsets.begin(), res.offsets.end(), res.offsets.begin());
+
+    std::vector<std::uint32_t> cursors(res.offsets.begin(), res.offsets.end() - 1);
+    util::forEachChunkParallel(indices.size(), [&](size_t begin, size_t end) {
+        for (auto k = static_cast<std::uint32_t>(begin); k < end; ++k) {
+            const auto pos =
+                std::atomic_ref{cursors[indices[k]]}.fetch_add(1, std::memory_order_relaxed);
+            res.corners[pos] = k;
+        }
+    });
+    // Make the order independent of the scatter order above
+    util::forEachChunkParallel(vertices, [&](size_t begin, size_t end) {
+        for (auto v = begin; v < end; ++v) {
+            std::sort(res.corners.begin() + res.offsets[v],
+                      res.corners.begin() + res.offsets[v + 1]);
+        }
+    });
+    return res;
+}
+
+/*
+ * Copy the triangles of indices, with each vertex v replaced by remap(v), and drop triangles
+ * with repeated vertices.
+ */
+template <typename Remap>
+std::vector<std::uint32_t> compact(const std::vector<std::uint32_t>& indices, Remap remap) {
+    const auto triangles = indices.size() / 3;
+    const auto chunks = std::min(std::max<size_t>(4 * util::getPoolSize(), 1), triangles);
+    const auto chunkBegin = [&](size_t chunk) { return (triangles * chunk) / chunks; };
+
+    const auto forEachKept = [&](size_t chunk, auto&& callback) {
+        for (auto t = chunkBegin(chunk); t < chunkBegin(chunk + 1); ++t) {
+            const std::array<std::uint32_t, 3> triangle{
+                remap(indices[3 * t]), remap(indices[3 * t + 1]), remap(indices[3 * t + 2])};
+            if (triangle[0] != triangle[1] && triangle[1] != triangle[2] &&
+                triangle[2] != triangle[0]) {
+                callback(triangle);
+            }
+        }
+    };
+
+    std::vector<size_t> offsets(chunks + 1, 0);
+    util::forEachChunkParallel(
+        chunks,
+        [&](size_t begin, size_t end) {
+            for (auto chunk = begin; chunk < end; ++chunk) {
+                forEachKept(chunk, [&](const auto&) { ++offsets[chunk + 1]; });
+            }
+        },
+        chunks);
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<std::uint32_t> res(3 * offsets.back());
+    util::forEachChunkParallel(
+        chunks,
+        [&](size_t begin, size_t end) {
+            for (auto chunk = begin; chunk < end; ++chunk) {
+                auto out = res.begin() + 3 * offsets[chunk];
+                forEachKept(chunk, [&](const auto& triangle) {
+                    out = std::copy(triangle.begin(), triangle.end(), out);
+                });
+            }
+        },
+        chunks);
+    return res;
+}
+
+class Decimator {
+public:
+    Decimator(const Mesh& mesh, const MeshDecimationSettings& settings);
+
+    size_t getNumberOfTriangles() const { return indices_.size() / 3; }
+
+    /*
+     * Collapse edges until at most targetTriangles remain. Returns false if it stopped before
+     * that since no valid collapse was left.
+     */
+    bool decimate(size_t targetTriangles, const std::function<void(float)>& progressCallback);
+
+    std::shared_ptr<Mesh> toMesh() const;
+
+private:
+    enum class Kind { Position, Interpolated, Nearest };
+    struct BufferData {
+        Kind kind = Kind::Nearest;
+        size_t offset = 0;
+        size_t components = 0;
+    };
+
+    /*
+     * Collapse of the edge of a half edge into a vertex at position. t is the parameter of the
+     * position projected onto the edge, and removed the number of triangles that share the edge.
+     */
+    struct Collapse {
+        static constexpr std::uint64_t invalid = std::numeric_limits<std::uint64_t>::max();
+
+        float cost = std::numeric_limits<float>::infinity();
+        vec3 position{0.0f};
+        float t = 0.0f;
+        std::uint32_t removed = 0;
+    };
+
+    static constexpr std::uint8_t boundaryFlag = 1;
+    static constexpr std::uint8_t lockedFlag = 2;
+    // Collapses around vertices with more triangles than this are skipped
+    static constexpr size_t maxStar = 32;
+    // The smallest allowed cosine of the angle between the normals of a triangle before and
+    // after a collapse
+    static constexpr double minCosine = 0.2;
+    // Only this fraction of the cheapest edges are considered in each pass, to keep the order of
+    // the collapses close to the order of a sequential greedy decimation
+    static constexpr double passFraction = 0.25;
+
+    bool pass(size_t targetTriangles);
+    Collapse evaluate(const TriangleAdjacency& adjacency, const std::vector<std::uint8_t>& flags,
+                      std::uint32_t halfEdge) const;
+    bool isValid(const TriangleAdjacency& adjacency, const VertexCorners& corners,
+                 std::uint32_t halfEdge, Collapse& collapse) const;
+    void computeQuadrics();
+
+    const Mesh& mesh_;
+    MeshDecimationSettings settings_;
+    dvec3 center_{0.0};
+    double scale_ = 1.0;
+
+    std::vector<BufferData> buffers_;
+    std::vector<vec3> positions_;
+    std::vector<Quadric> quadrics_;
+    size_t stride_ = 0;
+    std::vector<float> attributes_;
+    std::vector<float> attributeWeights_;
+    std::vector<std::uint32_t> sources_;
+    std::vector<std::uint32_t> indices_;
+};
+
+Decimator::Decimator(const Mesh& mesh, const MeshDecimationSettings& settings)
+    : mesh_{mesh}, settings_{settings} {
+
+    const auto* positionBuffer = mesh.findBuffer(BufferType::PositionAttrib).first;
+    if (!positionBuffer) {
+        throw Exception("Error: could not find a position buffer");
+    }
+    const auto vertices = positionBuffer->getSize();
+
+    for (const auto& [info, buffer] : mesh.getBuffers()) {
+        if (buffer->getSize() != vertices) {
+            throw Exception("Error: all buffers need to have the same number of elements");
+        }
+        auto& data = buffers_.emplace_back();
+        if (buffer.get() == positionBuffer) {
+            data.kind = Kind::Position;
+        } else if (buffer->getDataFormat()->getNumericType() == NumericType::Float) {
+            data = {Kind::Interpolated, stride_, buffer->getDataFormat()->getComponents()};
+            stride_ += data.components;
+            const bool weighted = info.type == BufferType::NormalAttrib ||
+                                  info.type == BufferType::ColorAttrib ||
+                                  info.type == BufferType::TexCoordAttrib;
+            attributeWeights_.insert(attributeWeights_.end(), data.components,
+                                     weighted ? 1.0f : 0.0f);
+        }
+    }
+
+    positions_.resize(vertices);
+    attributes_.resize(vertices * stride_);
+    for (auto&& [buffer, data] : util::zip(mesh.getBuffers(), buffers_)) {
+        if (data.kind == Kind::Nearest) continue;
+        buffer.second->getRepresentation<BufferRAM>()->dispatch<void>([&](auto ram) {
+            using ValueType = util::PrecisionValueType<decltype(ram)>;
+            constexpr auto components = DataFormat<ValueType>::components();
+            const auto& values = ram->getDataContainer();
+
+            util::forEachChunkParallel(vertices, [&](size_t begin, size_t end) {
+                for (auto i = begin; i < end; ++i) {
+                    if (data.kind == Kind::Position) {
+                        for (size_t c = 0; c < std::min<size_t>(components, 3); ++c) {
+                            positions_[i][c] = static_cast<float>(util::glmcomp(values[i], c));
+                        }
+                    } else {
+                        for (size_t c = 0; c < components; ++c) {
+                            attributes_[i * stride_ + data.offset + c] =
+                                static_cast<float>(util::glmcomp(values[i], c));
+                        }
+                    }
+                }
+            });
+        });
+    }
+
+    // Work in a unit sized box to make the errors independent of the size of the mesh
+    if (!positions_.empty()) {
+        auto min = positions_.front();
+        auto max = positions_.front();
+        for (const auto& p : positions_) {
+            min = glm::min(min, p);
+            max = glm::max(max, p);
+        }
+        center_ = 0.5 * (dvec3{min} + dvec3{max});
+        const auto extent = static_cast<double>(glm::compMax(max - min));
+        scale_ = extent > 0.0 ? 1.0 / extent : 1.0;
+        util::forEachChunkParallel(vertices, [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                positions_[i] = vec3{(dvec3{positions_[i]} - center_) * scale_};
+            }
+        });
+    }
+
+    sources_.resize(vertices);
+    std::iota(sources_.begin(), sources_.end(), std::uint32_t{0});
+
+    std::vector<std::uint32_t> indices;
+    for (const auto& [info, indexBuffer] : mesh.getIndexBuffers()) {
+        if (info.dt != DrawType::Triangles) continue;
+        forEachTriangle(info, *indexBuffer, [&](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+            indices.push_back(a);
+            indices.push_back(b);
+            indices.push_back(c);
+        });
+    }
+    indices_ = compact(indices, [](std::uint32_t v) { return v; });
+
+    computeQuadrics();
+}
+
+void Decimator::computeQuadrics() {
+    const TriangleAdjacency adjacency{indices_};
+    const auto corners = vertexCorners(indices_, positions_.size());
+
+    const auto normal = [&](std::uint32_t triangle) {
+        const dvec3 p0{positions_[indices_[3 * triangle]]};
+        const dvec3 p1{positions_[indices_[3 * triangle + 1]]};
+        const dvec3 p2{positions_[indices_[3 * triangle + 2]]};
+        return glm::cross(p1 - p0, p2 - p0);
+    };
+    // The plane through a boundary edge orthogonal to its triangle
+    const auto boundary = [&](std::uint32_t halfEdge, const dvec3& n) {
+        const dvec3 from{positions_[adjacency.from(halfEdge)]};
+        const dvec3 to{positions_[adjacency.to(halfEdge)]};
+        const auto edge = to - from;
+        const auto m = glm::cross(edge, n);
+        const auto length = glm::length(m);
+        if (length == 0.0) return Quadric{};
+        return Quadric::plane(m / length, -glm::dot(m / length, from),
+                              settings_.boundaryWeight * glm::dot(edge, edge));
+    };
+
+    quadrics_.assign(positions_.size(), Quadric{});
+    util::forEachChunkParallel(positions_.size(), [&](size_t begin, size_t end) {
+        for (auto v = static_cast<std::uint32_t>(begin); v < end; ++v) {
+            auto& q = quadrics_[v];
+            for (const auto corner : corners(v)) {
+                const auto n = normal(TriangleAdjacency::triangle(corner));
+                const auto length = glm::length(n);
+                if (length == 0.0) continue;
+                const auto unit = n / length;
+                auto plane =
+                    Quadric::plane(unit, -glm::dot(unit, dvec3{positions_[v]}), 0.5 * length);
+                plane.area = 0.5 * length;
+                q += plane;
+
+                for (const auto halfEdge : {corner, TriangleAdjacency::prev(corner)}) {
+                    if (adjacency.isBoundary(halfEdge)) q += boundary(halfEdge, unit);
+                }
+            }
+        }
+    });
+}
+
+bool Decimator::decimate(size_t targetTriangles,
+                         const std::function<void(float)>& progressCallback) {
+    const auto initial = getNumberOfTriangles();
+    while (getNumberOfTriangles() > targetTriangles) {
+        if (!pass(targetTriangles)) return false;
+        if (progressCallback) {
+            progressCallback(static_cast<float>(initial - getNumberOfTriangles()) /
+                             static_cast<float>(initial - targetTriangles));
+        }
+    }
+    return true;
+}
+
+auto Decimator::evaluate(const TriangleAdjacency& adjacency,
+                         const std::vector<std::uint8_t>& flags, std::uint32_t halfEdge) const
+    -> Collapse {
+    // Consider each edge once, from the half edge with the lowest index
+    const auto twin = adjacency.twin(halfEdge);
+    if (twin != TriangleAdjacency::noTwin && twin < halfEdge) return {};
+
+    const auto a = adjacency.from(halfEdge);
+    const auto b = adjacency.to(halfEdge);
+    if ((flags[a] | flags[b]) & lockedFlag) return {};
+    // An inner edge between two boundary vertices would pinch the mesh
+    if (twin != TriangleAdjacency::noTwin && (flags[a] & boundaryFlag) &&
+        (flags[b] & boundaryFlag)) {
+        return {};
+    }
+
+    auto q = quadrics_[a];
+    q += quadrics_[b];
+    const dvec3 pa{positions_[a]};
+    const dvec3 pb{positions_[b]};
+    const auto edge = pb - pa;
+    const auto edgeLength2 = glm::dot(edge, edge);
+
+    double attributeDistance = 0.0;
+    for (size_t c = 0; c < stride_; ++c) {
+        const auto diff = attributes_[b * stride_ + c] - attributes_[a * stride_ + c];
+        attributeDistance += attributeWeights_[c] * diff * diff;
+    }
+    attributeDistance *= settings_.attributeWeight;
+
+    const auto parameter = [&](const dvec3& p) {
+        return edgeLength2 > 0.0 ? glm::clamp(glm::dot(p - pa, edge) / edgeLength2, 0.0, 1.0)
+                                 : 0.0;
+    };
+    const auto cost = [&](const dvec3& p) {
+        const auto t = parameter(p);
+        return q.error(p) + attributeDistance * (quadrics_[a].area * t * t +
+                                                 quadrics_[b].area * (1.0 - t) * (1.0 - t));
+    };
+
+    dvec3 position = pa;
+    double minCost = std::numeric_limits<double>::infinity();
+    if (const auto p = q.minimum(); p && glm::dot(*p - 0.5 * (pa + pb), *p - 0.5 * (pa + pb)) <=
+                                             edgeLength2) {
+        position = *p;
+        minCost = cost(position);
+    }
+    for (const auto& p : {pa, pb, 0.5 * (pa + pb)}) {
+        if (const auto c = cost(p); c < minCost) {
+            position = p;
+            minCost = c;
+        }
+    }
+
+    if (q.area > 0.0 && std::sqrt(std::max(q.error(position), 0.0) / q.area) > settings_.maxError) {
+        return {};
+    }
+    return {static_cast<float>(std::max(minCost, 0.0)), vec3{position},
+            static_cast<float>(parameter(position))};
+}
+
+bool Decimator::isValid(const TriangleAdjacency& adjacency, const VertexCorners& corners,
+                        std::uint32_t halfEdge, Collapse& collapse) const {
+    const auto a = adjacency.from(halfEdge);
+    const auto b = adjacency.to(halfEdge);
+    const auto starA = corners(a);
+    const auto starB = corners(b);
+    if (starA.size() + starB.size() > maxStar) return false;
+
+    const auto& indices = adjacency.getIndices();
+    const auto contains = [&](std::uint32_t triangle, std::uint32_t v) {
+        return indices[3 * triangle] == v || indices[3 * triangle + 1] == v ||
+               indices[3 * triangle + 2] == v;
+    };
+
+    // Link condition: the vertices adjacent to both a and b are exactly the opposite vertices of
+    // the triangles sharing the edge, otherwise the collapse is not manifold
+    std::array<std::uint32_t, 2 * maxStar> ringA;
+    size_t sizeA = 0;
+    for (const auto corner : starA) {
+        for (const auto v : {indices[TriangleAdjacency::next(corner)],
+                             indices[TriangleAdjacency::prev(corner)]}) {
+            if (v != b && std::find(ringA.begin(), ringA.begin() + sizeA, v) ==
+                              ringA.begin() + sizeA) {
+                ringA[sizeA++] = v;
+            }
+        }
+    }
+    const auto common = std::count_if(ringA.begin(), ringA.begin() + sizeA, [&](std::uint32_t v) {
+        return std::ranges::any_of(starB, [&](std::uint32_t corner) {
+            return contains(TriangleAdjacency::triangle(corner), v);
+        });
+    });
+    collapse.removed = static_cast<std::uint32_t>(
+        std::count_if(starA.begin(), starA.end(), [&](std::uint32_t corner) {
+            return contains(TriangleAdjacency::triangle(corner), b);
+        }));
+    if (static_cast<std::uint32_t>(common) != collapse.removed) return false;
+
+    // Skip collapses that flip or fold triangles around the edge
+    const dvec3 position{collapse.position};
+    for (const auto star : {starA, starB}) {
+        for (const auto corner : star) {
+            const auto triangle = TriangleAdjacency::triangle(corner);
+            if (contains(triangle, a) && contains(triangle, b)) continue;
+            const dvec3 p0{positions_[indices[corner]]};
+            const dvec3 p1{positions_[indices[TriangleAdjacency::next(corner)]]};
+            const dvec3 p2{positions_[indices[TriangleAdjacency::prev(corner)]]};
+            const auto before = glm::cross(p1 - p0, p2 - p0);
+            const auto after = glm::cross(p1 - position, p2 - position);
+            const auto lengthBefore = glm::length(before);
+            if (lengthBefore > 0.0 &&
+                glm::dot(before, after) <= minCosine * lengthBefore * glm::length(after)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool Decimator::pass(size_t targetTriangles) {
+    const TriangleAdjacency adjacency{std::move(indices_)};
+    const auto& indices = adjacency.getIndices();
+    const auto corners = vertexCorners(indices, positions_.size());
+
+    std::vector<std::uint8_t> flags(positions_.size(), 0);
+    util::forEachChunkParallel(positions_.size(), [&](size_t begin, size_t end) {
+        for (auto v = static_cast<std::uint32_t>(begin); v < end; ++v) {
+            for (const auto corner : corners(v)) {
+                for (const auto halfEdge : {corner, TriangleAdjacency::prev(corner)}) {
+                    const auto twin = adjacency.twin(halfEdge);
+                    if (twin == TriangleAdjacency::noTwin) {
+                        flags[v] |= boundaryFlag;
+                    } else if (adjacency.twin(twin) != halfEdge) {
+                        flags[v] |= lockedFlag;
+                    }
+                }
+            }
+        }
+    });
+
+    // Sort keys of the collapses, the cost in the high bits and the half edge in the low bits.
+    // The bits of non-negative floats compare in the same order as the floats.
+    std::vector<Collapse> collapses(indices.size());
+    std::vector<std::uint64_t> order(indices.size());
+    util::forEachChunkParallel(indices.size(), [&](size_t begin, size_t end) {
+        for (auto e = static_cast<std::uint32_t>(begin); e < end; ++e) {
+            collapses[e] = evaluate(adjacency, flags, e);
+            order[e] = (std::uint64_t{std::bit_cast<std::uint32_t>(collapses[e].cost)} << 32) | e;
+        }
+    });
+    const auto halfEdge = [](std::uint64_t key) { return static_cast<std::uint32_t>(key); };
+    const auto candidates = static_cast<size_t>(std::ranges::count_if(collapses, [](const auto& c) {
+        return c.cost < std::numeric_limits<float>::infinity();
+    }));
+    const auto considered = std::min(
+        candidates,
+        std::max<size_t>(static_cast<size_t>(passFraction * static_cast<double>(candidates)), 1));
+    std::nth_element(order.begin(), order.begin() + considered, order.end());
+    order.resize(considered);
+
+    // The topology and flip checks are more expensive, only do them for the considered edges
+    util::forEachChunkParallel(order.size(), [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            const auto e = halfEdge(order[i]);
+            if (!isValid(adjacency, corners, e, collapses[e])) order[i] = Collapse::invalid;
+        }
+    });
+    std::erase(order, Collapse::invalid);
+    if (order.empty()) {
+        indices_ = adjacency.getIndices();
+        return false;
+    }
+    std::sort(order.begin(), order.end());
+
+    // Greedily pick the cheapest collapses that do not share any triangles, these can be done
+    // independently of each other
+    std::vector<std::uint8_t> claimed(indices.size() / 3, 0);
+    std::vector<std::uint32_t> selected;
+    auto triangles = indices.size() / 3;
+    for (auto it = order.begin(); it != order.end() && triangles > targetTriangles; ++it) {
+        const auto e = halfEdge(*it);
+        const auto starA = corners(adjacency.from(e));
+        const auto starB = corners(adjacency.to(e));
+        const auto isClaimed = [&](std::uint32_t corner) {
+            return claimed[TriangleAdjacency::triangle(corner)] != 0;
+        };
+        if (std::ranges::any_of(starA, isClaimed) || std::ranges::any_of(starB, isClaimed)) {
+            continue;
+        }
+        for (const auto star : {starA, starB}) {
+            for (const auto corner : star) claimed[TriangleAdjacency::triangle(corner)] = 1;
+        }
+        selected.push_back(e);
+        triangles -= collapses[e].removed;
+    }
+
+    std::vector<std::uint32_t> remap(positions_.size());
+    std::iota(remap.begin(), remap.end(), std::uint32_t{0});
+    util::forEachChunkParallel(selected.size(), [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            const auto a = adjacency.from(selected[i]);
+            const auto b = adjacency.to(selected[i]);
+            const auto& collapse = collapses[selected[i]];
+
+            positions_[a] = collapse.position;
+            quadrics_[a] += quadrics_[b];
+            for (size_t c = 0; c < stride_; ++c) {
+                auto& value = attributes_[a * stride_ + c];
+                value += collapse.t * (attributes_[b * stride_ + c] - value);
+            }
+            if (collapse.t > 0.5f) sources_[a] = sources_[b];
+            remap[b] = a;
+        }
+    });
+
+    indices_ = compact(indices, [&](std::uint32_t v) { return remap[v]; });
+    return true;
+}
+
+std::shared_ptr<Mesh> Decimator::toMesh() const {
+    // Keep the vertices that are still used, in their original order
+    std::vector<std::uint32_t> newIndex(positions_.size(), 0);
+    for (const auto v : indices_) newIndex[v] = 1;
+    std::vector<std::uint32_t> vertices;
+    for (std::uint32_t v = 0; v < newIndex.size(); ++v) {
+        if (newIndex[v] != 0) {
+            newIndex[v] = static_cast<std::uint32_t>(vertices.size());
+            vertices.push_back(v);
+        }
+    }
+    std::vector<std::uint32_t> indices(indices_.size());
+    util::forEachChunkParallel(indices.size(), [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) indices[i] = newIndex[indices_[i]];
+    });
+
+    auto res = std::make_shared<Mesh>(DrawType::Triangles, ConnectivityType::None);
+    res->copyMetaDataFrom(mesh_);
+    res->setModelMatrix(mesh_.getModelMatrix());
+    res->setWorldMatrix(mesh_.getWorldMatrix());
+
+    for (auto&& [buffer, data] : util::zip(mesh_.getBuffers(), buffers_)) {
+        const auto& info = buffer.first;
+        auto newBuffer =
+            buffer.second->getRepresentation<BufferRAM>()->dispatch<std::shared_ptr<BufferBase>>(
+                [&](auto ram) -> std::shared_ptr<BufferBase> {
+                    using PB = util::PrecisionType<decltype(ram)>;
+                    using ValueType = util::PrecisionValueType<decltype(ram)>;
+                    using T = typename DataFormat<ValueType>::primitive;
+                    constexpr auto components = DataFormat<ValueType>::components();
+                    const auto& values = ram->getDataContainer();
+
+                    std::vector<ValueType> result(vertices.size());
+                    util::forEachChunkParallel(vertices.size(), [&](size_t begin, size_t end) {
+                        for (auto i = begin; i < end; ++i) {
+                            const auto v = vertices[i];
+                            result[i] = values[sources_[v]];
+                            if (data.kind == Kind::Position) {
+                                for (size_t c = 0; c < std::min<size_t>(components, 3); ++c) {
+                                    util::glmcomp(result[i], c) = static_cast<T>(
+                                        positions_[v][c] / scale_ + center_[c]);
+                                }
+                            } else if (data.kind == Kind::Interpolated) {
+                                for (size_t c = 0; c < components; ++c) {
+                                    util::glmcomp(result[i], c) = static_cast<T>(
+                                        attributes_[v * stride_ + data.offset + c]);
+                                }
+                                if constexpr (components == 3 && std::is_floating_point_v<T>) {
+                                    if (info.type == BufferType::NormalAttrib &&
+                                        glm::length(result[i]) > T{0}) {
+                                        result[i] = glm::normalize(result[i]);
+                                    }
+                                }
+                            }
+                        }
+                    });
+                    return std::make_shared<Buffer<ValueType, PB::target>>(
+                        std::make_shared<BufferRAMPrecision<ValueType, PB::target>>(
+                            std::move(result)));
+                });
+        res->addBuffer(info, newBuffer);
+    }
+    res->addIndices(Mesh::MeshInfo{DrawType::Triangles, ConnectivityType::None},
+                    util::makeIndexBuffer(std::move(indices)));
+    return res;
+}
+
+}  // namespace
+
+std::shared_ptr<Mesh> decimate(const Mesh& mesh, const MeshDecimationSettings& settings,
+                               std::function<void(float)> progressCallback) {
+    Decimator decimator{mesh, settings};
+    const auto target = std::max(
+        settings.targetTriangles,
+        static_cast<size_t>(static_cast<double>(decimator.getNumberOfTriangles()) *
+                            std::clamp(settings.targetRatio, 0.0, 1.0)));
+    decimator.decimate(target, progressCallback);
+    return decimator.toMesh();
+}
+
+std::shared_ptr<DataSequence<Mesh>> decimateLevels(const Mesh& mesh, size_t levels, double ratio,
+                                                   const MeshDecimationSettings& settings,
+                                                   std::function<void(float)> progressCallback) {
+    auto sequence = std::make_shared<DataSequence<Mesh>>();
+    if (levels == 0) return sequence;
+
+    Decimator decimator{mesh, settings};
+    sequence->push_back(decimator.toMesh());
+    for (size_t level = 1; level < levels; ++level) {
+        const auto target = static_cast<size_t>(
+            static_cast<double>(decimator.getNumberOfTriangles()) * std::clamp(ratio, 0.0, 1.0));
+        const auto reached = decimator.decimate(target, [&](float progress) {
+            if (progressCallback) {
+                progressCallback((static_cast<float>(level - 1) + progress) /
+                                 static_cast<float>(levels - 1));
+            }
+        });
+        sequence->push_back(decimator.toMesh());
+        if (!reached) break;
+    }
+    return sequence;
+}
+
+}  // namespace meshutil
+
+}  // namespace inviwo
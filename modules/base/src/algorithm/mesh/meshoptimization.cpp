@@ -0,0 +1,538 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/mesh/meshoptimization.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>              // for IndexBuffer, Buffer
+#include <inviwo/core/datastructures/buffer/bufferram.h>           // for BufferRAM
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>  // for BufferRAMPrecision
+#include <inviwo/core/datastructures/geometry/geometrytype.h>      // for BufferType, DrawType
+#include <inviwo/core/util/exception.h>                            // for Exception
+#include <inviwo/core/util/foreach.h>                              // for forEachChunkParallel
+#include <inviwo/core/util/formatdispatching.h>                    // for PrecisionValueType
+#include <inviwo/core/util/formats.h>                              // for DataFormat
+#include <inviwo/core/util/glmcomp.h>                              // for glmcomp
+#include <inviwo/core/util/glmvec.h>                               // for dvec3
+#include <modules/base/algorithm/meshutils.h>                      // for forEachTriangle
+
+#include <algorithm>  // for min, max, sort, max_element
+#include <array>      // for array
+#include <atomic>     // for atomic_ref
+#include <bit>        // for bit_cast, bit_ceil
+#include <cmath>      // for floor, abs
+#include <limits>     // for numeric_limits
+#include <numeric>    // for partial_sum, iota
+#include <utility>    // for move
+
+#include <glm/common.hpp>              // for min, max
+#include <glm/geometric.hpp>           // for distance
+#include <glm/gtx/component_wise.hpp>  // for compMax
+
+namespace inviwo {
+
+namespace meshutil {
+
+namespace {
+
+constexpr auto none = std::numeric_limits<std::uint32_t>::max();
+
+/*
+ * Copy the first maxComponents components of each element of buffer to
+ * dest[i * stride + offset + c]
+ */
+void copyComponents(const BufferBase& buffer, size_t maxComponents, std::vector<double>& dest,
+                    size_t stride, size_t offset) {
+    buffer.getRepresentation<BufferRAM>()->dispatch<void>([&](auto ram) {
+        using ValueType = util::PrecisionValueType<decltype(ram)>;
+        constexpr auto components = DataFormat<ValueType>::components();
+        const auto& values = ram->getDataContainer();
+
+        util::forEachChunkParallel(values.size(), [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                for (size_t c = 0; c < std::min<size_t>(components, maxComponents); ++c) {
+                    dest[i * stride + offset + c] =
+                        static_cast<double>(util::glmcomp(values[i], c));
+                }
+            }
+        });
+    });
+}
+
+std::shared_ptr<BufferBase> gatherBuffer(const BufferBase& buffer,
+                                         const std::vector<std::uint32_t>& vertices) {
+    return buffer.getRepresentation<BufferRAM>()->dispatch<std::shared_ptr<BufferBase>>(
+        [&](auto ram) -> std::shared_ptr<BufferBase> {
+            using PB = util::PrecisionType<decltype(ram)>;
+            using ValueType = util::PrecisionValueType<decltype(ram)>;
+            const auto& values = ram->getDataContainer();
+
+            std::vector<ValueType> result(vertices.size());
+            util::forEachChunkParallel(vertices.size(), [&](size_t begin, size_t end) {
+                for (auto i = begin; i < end; ++i) result[i] = values[vertices[i]];
+            });
+            return std::make_shared<Buffer<ValueType, PB::target>>(
+                std::make_shared<BufferRAMPrecision<ValueType, PB::target>>(
+                    std::move(result), ram->getBufferUsage()));
+        });
+}
+
+const BufferBase& positionBuffer(const Mesh& mesh) {
+    const auto* positions = mesh.findBuffer(BufferType::PositionAttrib).first;
+    if (!positions) {
+        throw Exception("Error: could not find a position buffer");
+    }
+    for (const auto& buffer : mesh.getBuffers()) {
+        if (buffer.second->getSize() != positions->getSize()) {
+            throw Exception("Error: all buffers need to have the same number of elements");
+        }
+    }
+    return *positions;
+}
+
+struct Primitives {
+    Mesh::MeshInfo info;
+    std::vector<std::uint32_t> indices;
+};
+
+/*
+ * The indices of all index buffers of mesh, with triangles converted to triangle lists. A mesh
+ * without index buffers draws all its vertices with the default mesh info.
+ */
+std::vector<Primitives> gatherPrimitives(const Mesh& mesh, size_t vertices) {
+    std::vector<Primitives> res;
+    const auto add = [&](Mesh::MeshInfo info, const IndexBuffer& indexBuffer) {
+        if (info.dt == DrawType::Triangles) {
+            auto& triangles = res.emplace_back(
+                Primitives{{DrawType::Triangles, ConnectivityType::None}, {}});
+            forEachTriangle(info, indexBuffer,
+                            [&](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+                                triangles.indices.push_back(a);
+                                triangles.indices.push_back(b);
+                                triangles.indices.push_back(c);
+                            });
+        } else {
+            const auto& indices = indexBuffer.getRAMRepresentation()->getDataContainer();
+            res.push_back(Primitives{info, {indices.begin(), indices.end()}});
+        }
+    };
+
+    if (mesh.getNumberOfIndices() == 0) {
+        std::vector<std::uint32_t> indices(vertices);
+        std::iota(indices.begin(), indices.end(), std::uint32_t{0});
+        add(mesh.getDefaultMeshInfo(), *util::makeIndexBuffer(std::move(indices)));
+    } else {
+        for (const auto& [info, indexBuffer] : mesh.getIndexBuffers()) {
+            add(info, *indexBuffer);
+        }
+    }
+    return res;
+}
+
+/*
+ * Copy the primitives of size n of indices, with each vertex v replaced by remap[v]. If
+ * removeDegenerate is set, primitives with repeated vertices are dropped.
+ */
+std::vector<std::uint32_t> compact(const std::vector<std::uint32_t>& indices, size_t n,
+                                   const std::vector<std::uint32_t>& remap,
+                                   bool removeDegenerate) {
+    const auto primitives = indices.size() / n;
+    const auto chunks = std::min(std::max<size_t>(4 * util::getPoolSize(), 1), primitives);
+    const auto chunkBegin = [&](size_t chunk) { return (primitives * chunk) / chunks; };
+
+    const auto isDegenerate = [&](size_t p) {
+        if (!removeDegenerate) return false;
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = i + 1; j < n; ++j) {
+                if (remap[indices[n * p + i]] == remap[indices[n * p + j]]) return true;
+            }
+        }
+        return false;
+    };
+
+    std::vector<size_t> offsets(chunks + 1, 0);
+    util::forEachChunkParallel(
+        chunks,
+        [&](size_t begin, size_t end) {
+            for (auto chunk = begin; chunk < end; ++chunk) {
+                for (auto p = chunkBegin(chunk); p < chunkBegin(chunk + 1); ++p) {
+                    if (!isDegenerate(p)) ++offsets[chunk + 1];
+                }
+            }
+        },
+        chunks);
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<std::uint32_t> res(n * offsets.back());
+    util::forEachChunkParallel(
+        chunks,
+        [&](size_t begin, size_t end) {
+            for (auto chunk = begin; chunk < end; ++chunk) {
+                auto out = res.begin() + n * offsets[chunk];
+                for (auto p = chunkBegin(chunk); p < chunkBegin(chunk + 1); ++p) {
+                    if (isDegenerate(p)) continue;
+                    for (size_t i = 0; i < n; ++i) *out++ = remap[indices[n * p + i]];
+                }
+            }
+        },
+        chunks);
+    return res;
+}
+
+/*
+ * Simulate a FIFO cache. A vertex is in the cache if fewer than cacheSize misses happened since
+ * it was last loaded.
+ */
+class VertexCache {
+public:
+    VertexCache(size_t vertices, size_t cacheSize)
+        : cacheSize_{cacheSize}, time_{cacheSize + 1}, loaded_(vertices, 0) {}
+
+    // Returns true on a cache miss
+    bool use(std::uint32_t vertex) {
+        if (time_ - loaded_[vertex] <= cacheSize_) return false;
+        loaded_[vertex] = time_++;
+        return true;
+    }
+    // The number of misses since vertex was loaded
+    size_t age(std::uint32_t vertex) const { return time_ - loaded_[vertex]; }
+    size_t misses() const { return time_ - cacheSize_ - 1; }
+
+private:
+    size_t cacheSize_;
+    size_t time_;
+    std::vector<size_t> loaded_;
+};
+
+size_t indexRange(std::span<const std::uint32_t> indices) {
+    return indices.empty() ? 0 : size_t{*std::max_element(indices.begin(), indices.end())} + 1;
+}
+
+}  // namespace
+
+MeshStatistics computeStatistics(const Mesh& mesh, size_t cacheSize) {
+    const auto* positions = mesh.findBuffer(BufferType::PositionAttrib).first;
+    MeshStatistics res{};
+    res.vertices = positions ? positions->getSize() : 0;
+
+    std::vector<std::uint32_t> triangles;
+    for (auto& primitives : gatherPrimitives(mesh, res.vertices)) {
+        if (primitives.info.dt != DrawType::Triangles) continue;
+        triangles.insert(triangles.end(), primitives.indices.begin(), primitives.indices.end());
+    }
+    res.triangles = triangles.size() / 3;
+    if (res.triangles == 0) return res;
+
+    const auto vertices = std::max(res.vertices, indexRange(triangles));
+    VertexCache cache{vertices, cacheSize};
+    std::vector<bool> used(vertices, false);
+    for (const auto v : triangles) {
+        cache.use(v);
+        used[v] = true;
+    }
+    res.acmr = static_cast<double>(cache.misses()) / static_cast<double>(res.triangles);
+    res.atvr = static_cast<double>(cache.misses()) /
+               static_cast<double>(std::count(used.begin(), used.end(), true));
+    return res;
+}
+
+double averageCacheMissRatio(std::span<const std::uint32_t> indices, size_t cacheSize) {
+    const auto triangles = indices.size() / 3;
+    if (triangles == 0) return 0.0;
+
+    VertexCache cache{indexRange(indices), cacheSize};
+    for (const auto v : indices.first(3 * triangles)) cache.use(v);
+    return static_cast<double>(cache.misses()) / static_cast<double>(triangles);
+}
+
+std::vector<std::uint32_t> weldVertices(const Mesh& mesh, double tolerance,
+                                        double attributeTolerance) {
+    const auto& positionsBuffer = positionBuffer(mesh);
+    const auto vertices = positionsBuffer.getSize();
+
+    std::vector<double> positions(3 * vertices, 0.0);
+    copyComponents(positionsBuffer, 3, positions, 3, 0);
+    const auto position = [&](size_t v) {
+        return dvec3{positions[3 * v], positions[3 * v + 1], positions[3 * v + 2]};
+    };
+
+    size_t stride = 0;
+    std::vector<double> attributes;
+    if (attributeTolerance >= 0.0) {
+        for (const auto& [info, buffer] : mesh.getBuffers()) {
+            if (buffer.get() == &positionsBuffer) continue;
+            stride += buffer->getDataFormat()->getComponents();
+        }
+        attributes.resize(stride * vertices);
+        size_t offset = 0;
+        for (const auto& [info, buffer] : mesh.getBuffers()) {
+            if (buffer.get() == &positionsBuffer) continue;
+            const auto components = buffer->getDataFormat()->getComponents();
+            copyComponents(*buffer, components, attributes, stride, offset);
+            offset += components;
+        }
+    }
+
+    dvec3 min{0.0};
+    dvec3 max{0.0};
+    if (vertices > 0) {
+        min = max = position(0);
+        for (size_t v = 1; v < vertices; ++v) {
+            min = glm::min(min, position(v));
+            max = glm::max(max, position(v));
+        }
+    }
+    const auto eps = std::max(tolerance, 0.0) * glm::compMax(max - min);
+    const bool exact = !(eps > 0.0);
+
+    // With a zero tolerance only identical positions are welded, use their bits as the cell
+    using Cell = std::array<std::int64_t, 3>;
+    const auto cellOf = [&](const dvec3& p) {
+        Cell cell{};
+        for (size_t c = 0; c < 3; ++c) {
+            cell[c] = exact ? std::bit_cast<std::int64_t>(p[c] + 0.0)
+                            : static_cast<std::int64_t>(std::floor(p[c] / eps));
+        }
+        return cell;
+    };
+    const auto buckets = std::bit_ceil(std::max<size_t>(2 * vertices, 1));
+    const auto bucketOf = [&](const Cell& cell) {
+        std::uint64_t h = 0;
+        for (const auto c : cell) {
+            h = (h ^ static_cast<std::uint64_t>(c)) * 0x9E3779B97F4A7C15ull;
+            h ^= h >> 29;
+        }
+        return static_cast<size_t>(h & (buckets - 1));
+    };
+
+    // Sort the vertices by bucket
+    std::vector<std::uint32_t> offsets(buckets + 1, 0);
+    std::vector<std::uint32_t> bucket(vertices);
+    util::forEachChunkParallel(vertices, [&](size_t begin, size_t end) {
+        for (auto v = begin; v < end; ++v) {
+            bucket[v] = static_cast<std::uint32_t>(bucketOf(cellOf(position(v))));
+            std::atomic_ref{offsets[bucket[v] + 1]}.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<std::uint32_t> sorted(vertices);
+    std::vector<std::uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+    util::forEachChunkParallel(vertices, [&](size_t begin, size_t end) {
+        for (auto v = static_cast<std::uint32_t>(begin); v < end; ++v) {
+            const auto pos =
+                std::atomic_ref{cursors[bucket[v]]}.fetch_add(1, std::memory_order_relaxed);
+            sorted[pos] = v;
+        }
+    });
+    util::forEachChunkParallel(buckets, [&](size_t begin, size_t end) {
+        for (auto b = begin; b < end; ++b) {
+            std::sort(sorted.begin() + offsets[b], sorted.begin() + offsets[b + 1]);
+        }
+    });
+
+    const auto matches = [&](std::uint32_t u, std::uint32_t v) {
+        const auto pu = position(u);
+        const auto pv = position(v);
+        if (exact ? pu != pv : glm::distance(pu, pv) > eps) return false;
+        for (size_t c = 0; c < stride; ++c) {
+            if (!(std::abs(attributes[u * stride + c] - attributes[v * stride + c]) <=
+                  attributeTolerance)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Find the first earlier vertex within tolerance in the neighboring cells
+    std::vector<std::uint32_t> res(vertices);
+    util::forEachChunkParallel(vertices, [&](size_t begin, size_t end) {
+        for (auto v = static_cast<std::uint32_t>(begin); v < end; ++v) {
+            const auto cell = cellOf(position(v));
+            const std::int64_t reach = exact ? 0 : 1;
+            auto first = v;
+            for (auto x = -reach; x <= reach; ++x) {
+                for (auto y = -reach; y <= reach; ++y) {
+                    for (auto z = -reach; z <= reach; ++z) {
+                        const auto b = bucketOf({cell[0] + x, cell[1] + y, cell[2] + z});
+                        for (auto i = offsets[b]; i < offsets[b + 1] && sorted[i] < first; ++i) {
+                            if (matches(sorted[i], v)) {
+                                first = sorted[i];
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+            res[v] = first;
+        }
+    });
+    // Each vertex refers to an earlier one, resolve the chains in order
+    for (size_t v = 0; v < vertices; ++v) res[v] = res[res[v]];
+    return res;
+}
+
+std::vector<std::uint32_t> optimizeVertexCache(std::span<const std::uint32_t> indices,
+                                               size_t vertexCount, size_t cacheSize) {
+    const auto triangles = indices.size() / 3;
+
+    // The triangles around each vertex
+    std::vector<std::uint32_t> offsets(vertexCount + 1, 0);
+    for (size_t k = 0; k < 3 * triangles; ++k) ++offsets[indices[k] + 1];
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<std::uint32_t> adjacent(3 * triangles);
+    {
+        std::vector<std::uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+        for (size_t k = 0; k < 3 * triangles; ++k) {
+            adjacent[cursors[indices[k]]++] = static_cast<std::uint32_t>(k / 3);
+        }
+    }
+
+    std::vector<std::uint32_t> live(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) live[v] = offsets[v + 1] - offsets[v];
+    std::vector<bool> emitted(triangles, false);
+    VertexCache cache{vertexCount, cacheSize};
+    std::vector<std::uint32_t> deadEnds;
+    std::vector<std::uint32_t> candidates;
+    std::uint32_t cursor = 0;
+
+    // Continue with a recently used vertex with live triangles, or the next vertex in order
+    const auto skipDeadEnd = [&]() {
+        while (!deadEnds.empty()) {
+            const auto v = deadEnds.back();
+            deadEnds.pop_back();
+            if (live[v] > 0) return v;
+        }
+        for (; cursor < vertexCount; ++cursor) {
+            if (live[cursor] > 0) return cursor;
+        }
+        return none;
+    };
+
+    std::vector<std::uint32_t> res;
+    res.reserve(3 * triangles);
+    for (auto fanning = skipDeadEnd(); fanning != none;) {
+        candidates.clear();
+        for (auto i = offsets[fanning]; i < offsets[fanning + 1]; ++i) {
+            const auto t = adjacent[i];
+            if (emitted[t]) continue;
+            emitted[t] = true;
+            for (const auto v : indices.subspan(3 * t, 3)) {
+                res.push_back(v);
+                deadEnds.push_back(v);
+                candidates.push_back(v);
+                --live[v];
+                cache.use(v);
+            }
+        }
+
+        // Prefer the oldest candidate that stays in the cache while its triangles are emitted
+        fanning = none;
+        std::ptrdiff_t best = -1;
+        for (const auto v : candidates) {
+            if (live[v] == 0) continue;
+            std::ptrdiff_t priority = 0;
+            if (cache.age(v) + 2 * live[v] <= cacheSize) {
+                priority = static_cast<std::ptrdiff_t>(cache.age(v));
+            }
+            if (priority > best) {
+                best = priority;
+                fanning = v;
+            }
+        }
+        if (fanning == none) fanning = skipDeadEnd();
+    }
+    return res;
+}
+
+std::shared_ptr<Mesh> optimize(const Mesh& mesh, const MeshOptimizationSettings& settings) {
+    const auto vertices = positionBuffer(mesh).getSize();
+
+    std::vector<std::uint32_t> remap;
+    if (settings.weld) {
+        remap = weldVertices(mesh, settings.weldTolerance, settings.attributeTolerance);
+    } else {
+        remap.resize(vertices);
+        std::iota(remap.begin(), remap.end(), std::uint32_t{0});
+    }
+
+    auto primitives = gatherPrimitives(mesh, vertices);
+    for (auto& [info, indices] : primitives) {
+        for (const auto v : indices) {
+            if (v >= vertices) throw Exception("Error: index buffer refers to missing vertices");
+        }
+        const bool segments = info.dt == DrawType::Lines && info.ct == ConnectivityType::None;
+        const size_t n = info.dt == DrawType::Triangles ? 3 : (segments ? 2 : 1);
+        indices = compact(indices, n, remap, settings.removeDegenerate && n > 1);
+
+        if (settings.reorderTriangles && info.dt == DrawType::Triangles) {
+            indices = optimizeVertexCache(indices, vertices, settings.cacheSize);
+        }
+    }
+
+    // Keep the used vertices, in the order of first use or in their original order
+    std::vector<std::uint32_t> newIndex(vertices, none);
+    std::vector<std::uint32_t> order;
+    if (settings.reorderVertices) {
+        for (const auto& primitive : primitives) {
+            for (const auto v : primitive.indices) {
+                if (newIndex[v] != none) continue;
+                newIndex[v] = static_cast<std::uint32_t>(order.size());
+                order.push_back(v);
+            }
+        }
+    } else {
+        for (const auto& primitive : primitives) {
+            for (const auto v : primitive.indices) newIndex[v] = 0;
+        }
+        for (std::uint32_t v = 0; v < vertices; ++v) {
+            if (newIndex[v] == none) continue;
+            newIndex[v] = static_cast<std::uint32_t>(order.size());
+            order.push_back(v);
+        }
+    }
+
+    auto res = std::make_shared<Mesh>(mesh.getDefaultMeshInfo());
+    res->copyMetaDataFrom(mesh);
+    res->setModelMatrix(mesh.getModelMatrix());
+    res->setWorldMatrix(mesh.getWorldMatrix());
+    for (const auto& [info, buffer] : mesh.getBuffers()) {
+        res->addBuffer(info, gatherBuffer(*buffer, order));
+    }
+    for (auto& [info, indices] : primitives) {
+        util::forEachChunkParallel(indices.size(), [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; ++i) indices[i] = newIndex[indices[i]];
+        });
+        res->addIndices(info, util::makeIndexBuffer(std::move(indices)));
+    }
+    return res;
+}
+
+}  // namespace meshutil
+
+}  // namespace inviwo
@@ -0,0 +1,225 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/mesh/triangleadjacency.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>          // for IndexBuffer
+#include <inviwo/core/datastructures/geometry/geometrytype.h>  // for DrawType
+#include <inviwo/core/util/foreach.h>                          // for forEachChunkParallel
+#include <modules/base/algorithm/meshutils.h>                  // for forEachTriangle
+
+#include <algorithm>  // for sort, max, find_if, binary_search, equal_range
+#include <atomic>     // for atomic_ref
+#include <mutex>      // for mutex, scoped_lock
+#include <numeric>    // for partial_sum
+#include <optional>   // for optional
+#include <utility>    // for move, pair
+
+namespace inviwo {
+
+namespace meshutil {
+
+namespace {
+
+void addTriangles(Mesh::MeshInfo info, const IndexBuffer& indexBuffer,
+                  std::vector<std::uint32_t>& indices) {
+    forEachTriangle(info, indexBuffer, [&](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+        indices.push_back(a);
+        indices.push_back(b);
+        indices.push_back(c);
+    });
+}
+
+std::vector<std::uint32_t> triangles(Mesh::MeshInfo info, const IndexBuffer& indexBuffer) {
+    std::vector<std::uint32_t> indices;
+    indices.reserve(indexBuffer.getSize());
+    addTriangles(info, indexBuffer, indices);
+    return indices;
+}
+
+std::vector<std::uint32_t> triangles(const Mesh& mesh) {
+    std::vector<std::uint32_t> indices;
+    for (const auto& [info, indexBuffer] : mesh.getIndexBuffers()) {
+        if (info.dt != DrawType::Triangles) continue;
+        addTriangles(info, *indexBuffer, indices);
+    }
+    return indices;
+}
+
+std::vector<std::uint32_t> matchTwins(const std::vector<std::uint32_t>& indices) {
+    const auto halfEdges = indices.size();
+    std::vector<std::uint32_t> twins(halfEdges, TriangleAdjacency::noTwin);
+    if (halfEdges == 0) return twins;
+
+    const auto from = [&](std::uint32_t e) { return indices[e]; };
+    const auto to = [&](std::uint32_t e) { return indices[TriangleAdjacency::next(e)]; };
+    const auto low = [&](std::uint32_t e) { return std::min(from(e), to(e)); };
+    const auto high = [&](std::uint32_t e) { return std::max(from(e), to(e)); };
+
+    std::uint32_t vertices = 0;
+    {
+        std::mutex mutex;
+        util::forEachChunkParallel(halfEdges, [&](size_t begin, size_t end) {
+            const auto max = *std::max_element(indices.begin() + begin, indices.begin() + end);
+            const std::scoped_lock lock{mutex};
+            vertices = std::max(vertices, max + 1);
+        });
+    }
+
+    // Counting sort of the half edges into one bucket per lowest vertex
+    std::vector<std::uint32_t> offsets(static_cast<size_t>(vertices) + 1, 0);
+    util::forEachChunkParallel(halfEdges, [&](size_t begin, size_t end) {
+        for (auto e = static_cast<std::uint32_t>(begin); e < end; ++e) {
+            std::atomic_ref{offsets[low(e) + 1]}.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<std::uint32_t> buckets(halfEdges);
+    {
+        std::vector<std::uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+        util::forEachChunkParallel(halfEdges, [&](size_t begin, size_t end) {
+            for (auto e = static_cast<std::uint32_t>(begin); e < end; ++e) {
+                const auto pos =
+                    std::atomic_ref{cursors[low(e)]}.fetch_add(1, std::memory_order_relaxed);
+                buckets[pos] = e;
+            }
+        });
+    }
+
+    // Within each bucket, group the half edges by their highest vertex. Sorting by index as well
+    // makes the result independent of the scatter order above. A half edge is paired with the
+    // first half edge of the group going in the other direction.
+    util::forEachChunkParallel(vertices, [&](size_t begin, size_t end) {
+        for (auto v = static_cast<std::uint32_t>(begin); v < end; ++v) {
+            const auto first = buckets.begin() + offsets[v];
+            const auto last = buckets.begin() + offsets[v + 1];
+            std::sort(first, last, [&](std::uint32_t a, std::uint32_t b) {
+                return std::pair{high(a), a} < std::pair{high(b), b};
+            });
+
+            for (auto group = first; group != last;) {
+                const auto other = high(*group);
+                const auto groupEnd =
+                    std::find_if(group, last, [&](std::uint32_t e) { return high(e) != other; });
+
+                auto firstFromLow = TriangleAdjacency::noTwin;
+                auto firstFromHigh = TriangleAdjacency::noTwin;
+                for (auto it = group; it != groupEnd; ++it) {
+                    if (from(*it) == v && firstFromLow == TriangleAdjacency::noTwin) {
+                        firstFromLow = *it;
+                    }
+                    if (from(*it) == other && firstFromHigh == TriangleAdjacency::noTwin) {
+                        firstFromHigh = *it;
+                    }
+                }
+                for (auto it = group; it != groupEnd; ++it) {
+                    twins[*it] = from(*it) == v ? firstFromHigh : firstFromLow;
+                }
+                group = groupEnd;
+            }
+        }
+    });
+
+    return twins;
+}
+
+}  // namespace
+
+TriangleAdjacency::TriangleAdjacency(std::vector<std::uint32_t> indices)
+    : indices_{std::move(indices)}, twins_{matchTwins(indices_)} {}
+
+TriangleAdjacency::TriangleAdjacency(Mesh::MeshInfo info, const IndexBuffer& indexBuffer)
+    : TriangleAdjacency(triangles(info, indexBuffer)) {}
+
+TriangleAdjacency::TriangleAdjacency(const Mesh& mesh) : TriangleAdjacency(triangles(mesh)) {}
+
+std::vector<std::uint32_t> TriangleAdjacency::getBoundaryEdges() const {
+    std::vector<std::uint32_t> boundary;
+    for (std::uint32_t e = 0; e < twins_.size(); ++e) {
+        if (twins_[e] == noTwin) boundary.push_back(e);
+    }
+    return boundary;
+}
+
+std::vector<std::vector<std::uint32_t>> TriangleAdjacency::getBoundaryLoops() const {
+    auto edges = getBoundaryEdges();
+    std::sort(edges.begin(), edges.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return std::pair{from(a), a} < std::pair{from(b), b};
+    });
+    std::vector<std::uint32_t> targets(edges.size());
+    std::transform(edges.begin(), edges.end(), targets.begin(),
+                   [&](std::uint32_t e) { return to(e); });
+    std::sort(targets.begin(), targets.end());
+
+    std::vector<bool> visited(edges.size(), false);
+    const auto unvisitedFrom = [&](std::uint32_t vertex) -> std::optional<size_t> {
+        auto it = std::lower_bound(edges.begin(), edges.end(), vertex,
+                                   [&](std::uint32_t e, std::uint32_t v) { return from(e) < v; });
+        for (; it != edges.end() && from(*it) == vertex; ++it) {
+            const auto pos = static_cast<size_t>(it - edges.begin());
+            if (!visited[pos]) return pos;
+        }
+        return std::nullopt;
+    };
+
+    std::vector<std::vector<std::uint32_t>> loops;
+    const auto walk = [&](size_t start) {
+        auto& loop = loops.emplace_back();
+        loop.push_back(from(edges[start]));
+        visited[start] = true;
+        for (auto current = start;;) {
+            const auto vertex = to(edges[current]);
+            if (vertex == loop.front()) break;
+            loop.push_back(vertex);
+            if (const auto next = unvisitedFrom(vertex)) {
+                current = *next;
+                visited[current] = true;
+            } else {
+                break;
+            }
+        }
+    };
+
+    // Start with the open chains, i.e. edges from vertices without incoming boundary edges, so
+    // that they are not split up. All remaining edges form closed loops.
+    for (size_t i = 0; i < edges.size(); ++i) {
+        if (!visited[i] && !std::binary_search(targets.begin(), targets.end(), from(edges[i]))) {
+            walk(i);
+        }
+    }
+    for (size_t i = 0; i < edges.size(); ++i) {
+        if (!visited[i]) walk(i);
+    }
+    return loops;
+}
+
+}  // namespace meshutil
+
+}  // namespace inviwo
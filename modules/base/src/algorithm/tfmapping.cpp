@@ -0,0 +1,236 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/tfmapping.h>
+
+#include <inviwo/core/datastructures/datamapper.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/tfprimitiveset.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/glmcomp.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace inviwo::util {
+
+namespace {
+
+/**
+ * Linear interpolation in a lookup table, equivalent to sampling a linearly filtered texture with
+ * clamp to edge wrapping at the normalized position @p x.
+ */
+class LookupTable {
+public:
+    LookupTable(const TFPrimitiveSet& tf, size_t size)
+        : lut_(std::max(size, size_t{1})), scale_{static_cast<double>(lut_.size())} {
+        tf.interpolateAndStoreColors(lut_);
+    }
+
+    vec4 operator()(double x) const {
+        const auto last = static_cast<double>(lut_.size() - 1);
+        const auto t = x * scale_ - 0.5;
+        // written so that NaN ends up at the first entry
+        const auto clamped = t > 0.0 ? (t < last ? t : last) : 0.0;
+        const auto i = static_cast<size_t>(clamped);
+        const auto f = static_cast<float>(clamped - static_cast<double>(i));
+        return glm::mix(lut_[i], lut_[std::min(i + 1, lut_.size() - 1)], f);
+    }
+
+private:
+    std::vector<vec4> lut_;
+    double scale_;
+};
+
+template <typename Out>
+Out toOutput(const vec4& color) {
+    if constexpr (std::is_same_v<Out, vec4>) {
+        return color;
+    } else {
+        return Out{glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f};
+    }
+}
+
+/**
+ * Map @p slabs slabs of @p slabSize values each from @p src to @p dst. Slabs are distributed over
+ * the thread pool.
+ */
+template <typename Out, typename T>
+void mapValues(const T* src, Out* dst, size_t slabs, size_t slabSize, size_t channel,
+               const DataMapper& dataMap, const LookupTable& lut) {
+    using Comp = util::value_type_t<T>;
+    const auto count = slabs * slabSize;
+
+    if (dataMap.dataRange.x == dataMap.dataRange.y) {
+        // A degenerate data range has no normalized values, use the first entry of the lut
+        const auto first = toOutput<Out>(lut(0.0));
+        util::forEachChunkParallel(slabs, [&](size_t begin, size_t end) {
+            std::fill(dst + begin * slabSize, dst + end * slabSize, first);
+        });
+        return;
+    }
+
+    if constexpr (std::is_integral_v<Comp> && sizeof(Comp) <= 2) {
+        // Map every representable value once, then use a single lookup per value
+        constexpr auto tableSize = size_t{1} << (8 * sizeof(Comp));
+        if (count >= tableSize || sizeof(Comp) == 1) {
+            constexpr auto min = static_cast<std::int64_t>(std::numeric_limits<Comp>::min());
+            std::vector<Out> table(tableSize);
+            util::forEachChunkParallel(tableSize, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const auto value = static_cast<double>(min + static_cast<std::int64_t>(i));
+                    table[i] = toOutput<Out>(lut(dataMap.mapFromDataToNormalized(value)));
+                }
+            });
+            util::forEachChunkParallel(slabs, [&](size_t begin, size_t end) {
+                for (size_t i = begin * slabSize; i < end * slabSize; ++i) {
+                    const auto value = static_cast<std::int64_t>(util::glmcomp(src[i], channel));
+                    dst[i] = table[static_cast<size_t>(value - min)];
+                }
+            });
+            return;
+        }
+    }
+
+    // (x - min) / (max - min) as x * scale + offset
+    const auto scale = 1.0 / (dataMap.dataRange.y - dataMap.dataRange.x);
+    const auto offset = -dataMap.dataRange.x * scale;
+    util::forEachChunkParallel(slabs, [&](size_t begin, size_t end) {
+        for (size_t i = begin * slabSize; i < end * slabSize; ++i) {
+            const auto value = static_cast<double>(util::glmcomp(src[i], channel));
+            dst[i] = toOutput<Out>(lut(value * scale + offset));
+        }
+    });
+}
+
+void checkOptions(const DataFormatBase* input, const TFMappingOptions& options) {
+    if (options.channel >= input->getComponents()) {
+        throw Exception(SourceContext{}, "Channel {} is out of range for {} with {} channels",
+                        options.channel, input->getString(), input->getComponents());
+    }
+    if (options.format != DataVec4Float32::get() && options.format != DataVec4UInt8::get()) {
+        throw Exception(SourceContext{}, "Unsupported output format {}, expected {} or {}",
+                        options.format->getString(), DataVec4Float32::str(),
+                        DataVec4UInt8::str());
+    }
+}
+
+template <typename Out, typename Repr>
+void mapRepresentation(const Repr& src, size_t slabs, size_t slabSize, const DataMapper& dataMap,
+                       const TFPrimitiveSet& tf, const TFMappingOptions& options, Out* dst) {
+    const LookupTable lut{tf, options.lutSize};
+    src.template dispatch<void>([&](const auto* srcPrecision) {
+        mapValues(srcPrecision->getDataTyped(), dst, slabs, slabSize, options.channel, dataMap,
+                  lut);
+    });
+}
+
+template <typename Out>
+std::shared_ptr<VolumeRAM> applyTF(const VolumeRAM& volume, const DataMapper& dataMap,
+                                   const TFPrimitiveSet& tf, const TFMappingOptions& options) {
+    const auto dims = volume.getDimensions();
+    auto res = std::make_shared<VolumeRAMPrecision<Out>>(dims, swizzlemasks::rgba,
+                                                         volume.getInterpolation(),
+                                                         volume.getWrapping());
+    mapRepresentation(volume, dims.z, dims.x * dims.y, dataMap, tf, options,
+                      res->getDataTyped());
+    return res;
+}
+
+template <typename Out>
+std::shared_ptr<LayerRAM> applyTF(const LayerRAM& layer, const DataMapper& dataMap,
+                                  const TFPrimitiveSet& tf, const TFMappingOptions& options) {
+    const auto dims = layer.getDimensions();
+    auto res = std::make_shared<LayerRAMPrecision<Out>>(dims, layer.getLayerType(),
+                                                        swizzlemasks::rgba,
+                                                        layer.getInterpolation(),
+                                                        layer.getWrapping());
+    mapRepresentation(layer, dims.y, dims.x, dataMap, tf, options, res->getDataTyped());
+    return res;
+}
+
+}  // namespace
+
+std::shared_ptr<VolumeRAM> applyTF(const VolumeRAM& volume, const DataMapper& dataMap,
+                                   const TFPrimitiveSet& tf, const TFMappingOptions& options) {
+    checkOptions(volume.getDataFormat(), options);
+    if (options.format == DataVec4UInt8::get()) {
+        return applyTF<glm::u8vec4>(volume, dataMap, tf, options);
+    } else {
+        return applyTF<vec4>(volume, dataMap, tf, options);
+    }
+}
+
+std::shared_ptr<LayerRAM> applyTF(const LayerRAM& layer, const DataMapper& dataMap,
+                                  const TFPrimitiveSet& tf, const TFMappingOptions& options) {
+    checkOptions(layer.getDataFormat(), options);
+    if (options.format == DataVec4UInt8::get()) {
+        return applyTF<glm::u8vec4>(layer, dataMap, tf, options);
+    } else {
+        return applyTF<vec4>(layer, dataMap, tf, options);
+    }
+}
+
+std::shared_ptr<Volume> applyTF(const Volume& volume, const TFPrimitiveSet& tf,
+                                const TFMappingOptions& options) {
+    auto ram = applyTF(*volume.getRepresentation<VolumeRAM>(), volume.dataMap, tf, options);
+    auto res = std::make_shared<Volume>(
+        volume, noData,
+        VolumeConfig{.format = options.format,
+                     .swizzleMask = swizzlemasks::rgba,
+                     .dataRange = DataMapper::defaultDataRangeFor(options.format),
+                     .valueRange = dvec2{0.0, 1.0}});
+    res->addRepresentation(ram);
+    return res;
+}
+
+std::shared_ptr<Layer> applyTF(const Layer& layer, const TFPrimitiveSet& tf,
+                               const TFMappingOptions& options) {
+    auto ram = applyTF(*layer.getRepresentation<LayerRAM>(), layer.dataMap, tf, options);
+    auto res = std::make_shared<Layer>(
+        layer, noData,
+        LayerConfig{.format = options.format,
+                    .swizzleMask = swizzlemasks::rgba,
+                    .dataRange = DataMapper::defaultDataRangeFor(options.format),
+                    .valueRange = dvec2{0.0, 1.0}});
+    res->addRepresentation(ram);
+    return res;
+}
+
+}  // namespace inviwo::util
@@ -29,31 +29,24 @@
 
 #include <modules/base/algorithm/volume/volumecurl.h>
 
-#include <inviwo/core/datastructures/coordinatetransformer.h>           // for StructuredCoordin...
-#include <inviwo/core/datastructures/data.h>                            // for noData
-#include <inviwo/core/datastructures/datamapper.h>                      // for DataMapper
-#include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
-#include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
-#include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
-#include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAMPrecision
-#include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
-#include <inviwo/core/util/glmutils.h>                                  // for Vector
-#include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, dvec2
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
-#include <inviwo/core/util/templatesampler.h>                           // for TemplateVolumeSam...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxel
-
-#include <stdlib.h>       // for abs
-#include <algorithm>      // for max, min
-#include <cmath>          // for abs
-#include <limits>         // for numeric_limits
-#include <type_traits>    // for conditional_t
-#include <unordered_set>  // for unordered_set
-
-#include <glm/common.hpp>  // for mix
-#include <glm/mat4x4.hpp>  // for operator*, mat
-#include <glm/vec3.hpp>    // for operator/, operator*
-#include <glm/vec4.hpp>    // for operator*, operator+
+#include <inviwo/core/datastructures/coordinatetransformer.h>  // for StructuredCoordin...
+#include <inviwo/core/datastructures/data.h>                   // for noData
+#include <inviwo/core/datastructures/datamapper.h>             // for DataMapper
+#include <inviwo/core/datastructures/volume/volume.h>          // for Volume
+#include <inviwo/core/datastructures/volume/volumeram.h>       // for VolumeRAMPrecision
+#include <inviwo/core/util/formatdispatching.h>                // for Vec3s
+#include <inviwo/core/util/glmmat.h>                           // for dmat3, dmat4
+#include <inviwo/core/util/glmvec.h>                           // for vec3, size3_t, dvec2
+#include <modules/base/algorithm/dataminmax.h>                 // for volumeMinMax
+#include <modules/base/algorithm/stencil.h>                    // for forEachStencil
+
+#include <algorithm>  // for max
+#include <cmath>      // for abs
+
+#include <glm/gtx/component_wise.hpp>    // for compMin, compMax
+#include <glm/gtx/matrix_operation.hpp>  // for diagonal3x3
+#include <glm/mat3x3.hpp>                // for operator*
+#include <glm/matrix.hpp>                // for inverse
 
 namespace inviwo {
 namespace util {
@@ -67,59 +60,31 @@ std::unique_ptr<Volume> curlVolume(const Volume& volume) {
     auto newVolumeRep = std::make_shared<VolumeRAMPrecision<vec3>>(volume.getDimensions());
     newVolume->addRepresentation(newVolumeRep);
 
-    const auto m = newVolume->getCoordinateTransformer().getDataToWorldMatrix();
-
-    const auto a = m * vec4(0, 0, 0, 1);
-    const auto b = m * vec4(1.0f / vec3(volume.getDimensions() - size3_t(1)), 1);
-    const auto spacing = b - a;
-
-    const vec3 ox(spacing.x, 0, 0);
-    const vec3 oy(0, spacing.y, 0);
-    const vec3 oz(0, 0, spacing.z);
+    // The Jacobian along the voxel axes is mapped to world space by the inverse of the world
+    // space step between neighboring voxels
+    const dmat4 m{newVolume->getCoordinateTransformer().getDataToWorldMatrix()};
+    const dmat3 step = dmat3{m} * glm::diagonal3x3(dvec3{1.0} / dvec3{volume.getDimensions()});
+    const dmat3 toWorld = glm::inverse(step) * 0.5;
 
     volume.getRepresentation<VolumeRAM>()->dispatch<void, dispatching::filter::Vec3s>(
-        [&](auto vol) {
-            using DataType = util::PrecisionValueType<decltype(vol)>;
-            using ComponentType = util::value_type_t<DataType>;
-            using SampleType =
-                typename std::conditional_t<std::is_same<float, ComponentType>::value, vec3, dvec3>;
-            using Sampler = TemplateVolumeSampler<SampleType, DataType>;
-
-            util::IndexMapper3D index(volume.getDimensions());
-            auto data = newVolumeRep->getDataTyped();
-            float minV = std::numeric_limits<float>::max();
-            float maxV = std::numeric_limits<float>::lowest();
-
-            const Sampler sampler{volume, CoordinateSpace::World};
-
-            util::forEachVoxel(*vol, [&](const size3_t& pos) {
-                const vec3 world{m *
-                                 vec4(vec3(pos) / vec3(volume.getDimensions() - size3_t(1)), 1)};
-
-                const auto Fxp = static_cast<vec3>(sampler.sample(world + ox));
-                const auto Fxm = static_cast<vec3>(sampler.sample(world - ox));
-                const auto Fyp = static_cast<vec3>(sampler.sample(world + oy));
-                const auto Fym = static_cast<vec3>(sampler.sample(world - oy));
-                const auto Fzp = static_cast<vec3>(sampler.sample(world + oz));
-                const auto Fzm = static_cast<vec3>(sampler.sample(world - oz));
-
-                const vec3 Fx = (Fxp - Fxm) / (2.0f * spacing.x);
-                const vec3 Fy = (Fyp - Fym) / (2.0f * spacing.y);
-                const vec3 Fz = (Fzp - Fzm) / (2.0f * spacing.z);
-
-                const vec3 c{Fy.z - Fz.y, Fz.x - Fx.z, Fx.y - Fy.x};
-
-                minV = std::min({minV, c.x, c.y, c.z});
-                maxV = std::max({maxV, c.x, c.y, c.z});
-
-                data[index(pos)] = c;
+        [&](const auto* ram) {
+            util::forEachStencil<1>(*ram, *newVolumeRep, [&](const auto& n) {
+                const auto d = [&](int dx, int dy, int dz) {
+                    return dvec3{n(dx, dy, dz)} - dvec3{n(-dx, -dy, -dz)};
+                };
+                // column i holds the derivatives along world axis i
+                const dmat3 j = dmat3{d(1, 0, 0), d(0, 1, 0), d(0, 0, 1)} * toWorld;
+                return vec3{j[1][2] - j[2][1], j[2][0] - j[0][2], j[0][1] - j[1][0]};
             });
-
-            auto range = std::max(std::abs(minV), std::abs(maxV));
-            newVolume->dataMap.dataRange = dvec2(-range, range);
-            newVolume->dataMap.valueRange = dvec2(minV, maxV);
         });
 
+    const auto [minV, maxV] = util::volumeMinMax(newVolumeRep.get());
+    const auto min = glm::compMin(dvec3{minV});
+    const auto max = glm::compMax(dvec3{maxV});
+    const auto range = std::max(std::abs(min), std::abs(max));
+    newVolume->dataMap.dataRange = dvec2(-range, range);
+    newVolume->dataMap.valueRange = dvec2(min, max);
+
     return newVolume;
 }
 
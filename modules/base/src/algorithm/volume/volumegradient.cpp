@@ -29,34 +29,26 @@
 
 #include <modules/base/algorithm/volume/volumegradient.h>
 
-#include <inviwo/core/datastructures/coordinatetransformer.h>           // for StructuredCoordin...
-#include <inviwo/core/datastructures/data.h>                            // for noData
-#include <inviwo/core/datastructures/datamapper.h>                      // for DataMapper
-#include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
-#include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
-#include <inviwo/core/datastructures/unitsystem.h>                      // for Axis, Unit
-#include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
-#include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAMPrecision
-#include <inviwo/core/util/glmutils.h>                                  // for Vector
-#include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, dvec2
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper3D
-#include <inviwo/core/util/spatialsampler.h>                            // for SpatialSampler<>:...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxelParallel
-#include <inviwo/core/util/volumesampler.h>                             // for VolumeDoubleSampler
-
-#include <array>          // for array
-#include <functional>     // for __base
-#include <limits>         // for numeric_limits
-#include <string>         // for string
-#include <type_traits>    // for remove_extent_t
-#include <unordered_set>  // for unordered_set
-#include <vector>         // for vector
-
-#include <glm/common.hpp>              // for mix, max, abs
-#include <glm/gtx/component_wise.hpp>  // for compMax
-#include <glm/mat4x4.hpp>              // for operator*, mat
-#include <glm/vec3.hpp>                // for operator-, operator/
-#include <glm/vec4.hpp>                // for operator*, operator+
+#include <inviwo/core/datastructures/coordinatetransformer.h>  // for StructuredCoordin...
+#include <inviwo/core/datastructures/data.h>                   // for noData
+#include <inviwo/core/datastructures/datamapper.h>             // for DataMapper
+#include <inviwo/core/datastructures/unitsystem.h>             // for Axis, Unit
+#include <inviwo/core/datastructures/volume/volume.h>          // for Volume
+#include <inviwo/core/datastructures/volume/volumeram.h>       // for VolumeRAMPrecision
+#include <inviwo/core/util/formatdispatching.h>                // for PrecisionValueType
+#include <inviwo/core/util/glmcomp.h>                          // for glmcomp
+#include <inviwo/core/util/glmmat.h>                           // for dmat3, dmat4
+#include <inviwo/core/util/glmvec.h>                           // for vec3, size3_t, dvec2
+#include <modules/base/algorithm/dataminmax.h>                 // for volumeMinMax
+#include <modules/base/algorithm/stencil.h>                    // for forEachStencil
+
+#include <algorithm>  // for max
+
+#include <glm/common.hpp>                // for abs
+#include <glm/gtx/component_wise.hpp>    // for compMax
+#include <glm/gtx/matrix_operation.hpp>  // for diagonal3x3
+#include <glm/mat3x3.hpp>                // for operator*
+#include <glm/matrix.hpp>                // for inverse, transpose
 
 namespace inviwo {
 namespace util {
@@ -71,40 +63,28 @@ std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume, int
     auto newVolumeRep = std::make_shared<VolumeRAMPrecision<vec3>>(volume->getDimensions());
     newVolume->addRepresentation(newVolumeRep);
 
-    auto m = newVolume->getCoordinateTransformer().getDataToWorldMatrix();
-
-    const auto a = m * vec4(0, 0, 0, 1);
-    const auto b = m * vec4(1.0f / vec3(volume->getDimensions() - size3_t(1)), 1);
-    const auto spacing = b - a;
-
-    const vec3 ox(spacing.x, 0, 0);
-    const vec3 oy(0, spacing.y, 0);
-    const vec3 oz(0, 0, spacing.z);
-
-    VolumeSampler sampler{volume, CoordinateSpace::World};
-
-    util::IndexMapper3D index(volume->getDimensions());
-    auto data = newVolumeRep->getDataTyped();
-
-    const dvec3 spacing2 = spacing * 2.0;
-    float max = std::numeric_limits<float>::lowest();
-    auto func = [&](const size3_t& pos) {
-        const vec3 world{m * vec4(vec3(pos) / vec3(volume->getDimensions() - size3_t(1)), 1)};
-
-        const auto g = static_cast<vec3>(
-            dvec3{(sampler.sample(world + ox) - sampler.sample(world - ox))[channel],
-                  (sampler.sample(world + oy) - sampler.sample(world - oy))[channel],
-                  (sampler.sample(world + oz) - sampler.sample(world - oz))[channel]} /
-            spacing2);
-
-        data[index(pos)] = g;
-        max = glm::max(max, glm::compMax(glm::abs(g)));
-    };
-
-    util::forEachVoxelParallel(*volume->getRepresentation<VolumeRAM>(), func);
-
-    newVolume->dataMap.dataRange = dvec2(-max, max);
-    newVolume->dataMap.valueRange = dvec2(-max, max);
+    // Central differences along the voxel axes are mapped to world space by the inverse transpose
+    // of the world space step between neighboring voxels
+    const dmat4 m{newVolume->getCoordinateTransformer().getDataToWorldMatrix()};
+    const dmat3 step = dmat3{m} * glm::diagonal3x3(dvec3{1.0} / dvec3{volume->getDimensions()});
+    const dmat3 toWorld = glm::transpose(glm::inverse(step)) * 0.5;
+
+    volume->getRepresentation<VolumeRAM>()->dispatch<void>([&](const auto* ram) {
+        util::forEachStencil<1>(*ram, *newVolumeRep, [&](const auto& n) {
+            const auto v = [&](int dx, int dy, int dz) {
+                return static_cast<double>(
+                    util::glmcomp(n(dx, dy, dz), static_cast<size_t>(channel)));
+            };
+            return vec3{toWorld * dvec3{v(1, 0, 0) - v(-1, 0, 0), v(0, 1, 0) - v(0, -1, 0),
+                                        v(0, 0, 1) - v(0, 0, -1)}};
+        });
+    });
+
+    const auto [minV, maxV] = util::volumeMinMax(newVolumeRep.get());
+    const auto range =
+        std::max(glm::compMax(glm::abs(dvec3{minV})), glm::compMax(glm::abs(dvec3{maxV})));
+    newVolume->dataMap.dataRange = dvec2(-range, range);
+    newVolume->dataMap.valueRange = dvec2(-range, range);
 
     return newVolume;
 }
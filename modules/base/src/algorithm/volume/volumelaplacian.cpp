@@ -39,12 +39,13 @@
 #include <inviwo/core/util/formatdispatching.h>                         // for dispatch, All
 #include <inviwo/core/util/formats.h>                                   // for DataFormat
 #include <inviwo/core/util/glmcomp.h>                                   // for glmcomp
-#include <inviwo/core/util/glmmat.h>                                    // for dmat4
+#include <inviwo/core/util/glmmat.h>                                    // for dmat3, dmat4
 #include <inviwo/core/util/glmutils.h>                                  // for same_extent
 #include <inviwo/core/util/glmvec.h>                                    // for dvec3, dvec2, siz...
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper3D
-#include <inviwo/core/util/templatesampler.h>                           // for TemplateVolumeSam...
 #include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxelParallel
+#include <modules/base/algorithm/dataminmax.h>                          // for volumeMinMax
+#include <modules/base/algorithm/stencil.h>                             // for forEachStencil
 
 #include <functional>     // for __base
 #include <unordered_map>  // for unordered_map
@@ -58,6 +59,7 @@
 #include <unordered_set>  // for unordered_set
 
 #include <glm/gtx/matrix_operation.hpp>  // for diagonal3x3
+#include <glm/gtx/norm.hpp>              // for length2
 #include <glm/mat3x3.hpp>                // for mat
 #include <glm/mat4x4.hpp>                // for operator*, mat
 #include <glm/vec3.hpp>                  // for operator-, operator+
@@ -92,49 +94,34 @@ std::shared_ptr<Volume> util::volumeLaplacian(std::shared_ptr<const Volume> volu
             newVolume->dataMap.valueAxis.unit =
                 volume->dataMap.valueAxis.unit / volume->axes[0].unit / volume->axes[0].unit;
 
+            // Second differences along the voxel axes, assuming an orthogonal basis
             const dmat4 m{volume->getCoordinateTransformer().getDataToWorldMatrix()};
-            const auto a = m * dvec4(0, 0, 0, 1);
-            const auto b = m * dvec4(dvec3(1.0) / dvec3(volume->getDimensions() - size3_t(1)), 1);
-            const auto spacing = dvec3(b - a);
-
-            const auto o = glm::diagonal3x3(spacing);
-
-            using Sampler = TemplateVolumeSampler<SampleType, DataType>;
-            const Sampler s(volume, CoordinateSpace::World);
-
-            const util::IndexMapper3D index{volume->getDimensions()};
-
-            const auto resDim = dvec3(1.0) / dvec3(volume->getDimensions() - size3_t(1));
-            const auto resSpace2 = dvec3(1.0) / (spacing * spacing);
-
-            auto minval(std::numeric_limits<double>::max());
-            auto maxval(std::numeric_limits<double>::lowest());
+            const dmat3 step =
+                dmat3{m} * glm::diagonal3x3(dvec3{1.0} / dvec3{volume->getDimensions()});
+            const dvec3 invSpacing2{1.0 / glm::length2(step[0]), 1.0 / glm::length2(step[1]),
+                                    1.0 / glm::length2(step[2])};
+
+            util::forEachStencil<1>(*srcRAM, *dstRAM, [&](const auto& n) {
+                const auto v = [&](int dx, int dy, int dz) {
+                    return static_cast<SampleType>(n(dx, dy, dz));
+                };
+                const auto center = 2.0 * v(0, 0, 0);
+                const auto D2x = (v(1, 0, 0) - center + v(-1, 0, 0)) * invSpacing2.x;
+                const auto D2y = (v(0, 1, 0) - center + v(0, -1, 0)) * invSpacing2.y;
+                const auto D2z = (v(0, 0, 1) - center + v(0, 0, -1)) * invSpacing2.z;
+                return static_cast<DstType>(D2x + D2y + D2z);
+            });
+
+            const auto [minV, maxV] = util::volumeMinMax(dstRAM.get());
+            double minval = minV.x;
+            double maxval = maxV.x;
+            for (size_t i = 1; i < util::extent_v<DataType>; ++i) {
+                minval = std::min(minval, minV[static_cast<glm::length_t>(i)]);
+                maxval = std::max(maxval, maxV[static_cast<glm::length_t>(i)]);
+            }
 
+            const util::IndexMapper3D index{dims};
             auto newData = dstRAM->getView();
-            auto func = [&](const size3_t& pos) {
-                const dvec3 world{m * dvec4((dvec3(pos) + dvec3(0.5)) * resDim, 1.0)};
-
-                const auto center = 2.0 * s.sample(world);
-                const auto D2x =
-                    (s.sample(world + o[0]) + center - s.sample(world - o[0])) * resSpace2.x;
-                const auto D2y =
-                    (s.sample(world + o[1]) + center - s.sample(world - o[1])) * resSpace2.y;
-                const auto D2z =
-                    (s.sample(world + o[2]) + center - s.sample(world - o[2])) * resSpace2.z;
-                const auto laplacian = center + D2x + D2y + D2z;
-
-                if constexpr (1 < util::extent_v<DataType>) {
-                    minval = glm::min(minval, glm::compMin(laplacian));
-                    maxval = glm::max(maxval, glm::compMax(laplacian));
-                } else {
-                    minval = glm::min(minval, laplacian);
-                    maxval = glm::max(maxval, laplacian);
-                }
-
-                newData[index(pos)] = static_cast<DstType>(laplacian);
-            };
-
-            util::forEachVoxelParallel(dims, func);
 
             // Make range symmetric
             auto rangeMax = std::max(std::abs(minval), std::abs(maxval));
@@ -30,23 +30,159 @@
 #include <modules/base/algorithm/volume/volumeramdownsample.h>
 
 #include <inviwo/core/datastructures/volume/volumeram.h>  // for VolumeRAM
+#include <inviwo/core/util/foreach.h>                     // for forEachChunkParallel
 #include <inviwo/core/util/formatdispatching.h>           // for PrecisionValueType
-#include <inviwo/core/util/glmutils.h>                    // for same_extent
+#include <inviwo/core/util/glmcomp.h>                     // for glmcomp
+#include <inviwo/core/util/glmutils.h>                    // for same_extent, flat_extent
 #include <inviwo/core/util/glmvec.h>                      // for size3_t
-#include <inviwo/core/util/indexmapper.h>                 // for IndexMapper, IndexMapper3D
 
-#include <cstddef>  // for size_t
+#include <algorithm>  // for nth_element, sort, find_if, transform
+#include <cstddef>    // for size_t
+#include <iterator>   // for distance
+#include <vector>     // for vector
 
-#include <glm/vec2.hpp>  // for operator*
-#include <glm/vec3.hpp>  // for operator*, vec<>::(anonymous)
-#include <glm/vec4.hpp>  // for operator*
-
-#ifdef IVW_USE_OPENMP
-#include <omp.h>
-#endif
+#include <glm/common.hpp>              // for max, min
+#include <glm/gtx/component_wise.hpp>  // for compMul
+#include <glm/vec2.hpp>                // for operator*
+#include <glm/vec3.hpp>                // for operator*, vec<>::(anonymous)
+#include <glm/vec4.hpp>                // for operator*
 
 namespace inviwo::util {
 
+namespace {
+
+/*
+ * Calls `kernel(dst, y, z)` for each output row, where `dst` points to the first voxel of the
+ * output row. The rows are distributed over the thread pool.
+ */
+template <typename T, typename Kernel>
+std::shared_ptr<VolumeRAM> downsampleRows(const VolumeRAMPrecision<T>* srcVol, size3_t strides,
+                                          Kernel kernel) {
+    const size3_t srcDims{srcVol->getDimensions()};
+    const size3_t destDims{srcDims / strides};
+
+    auto destVol = std::make_shared<VolumeRAMPrecision<T>>(destDims);
+    auto dst = destVol->getDataTyped();
+
+    util::forEachChunkParallel(destDims.y * destDims.z, [&](size_t begin, size_t end) {
+        auto state = kernel.makeState();
+        for (size_t row = begin; row < end; ++row) {
+            kernel(state, dst + row * destDims.x, row % destDims.y, row / destDims.y);
+        }
+    });
+    return destVol;
+}
+
+/*
+ * Reduces a block by first combining all source rows of the block element wise into a row buffer,
+ * which is contiguous and vectorizes well, and then combining the `strides.x` consecutive
+ * elements of the row buffer for each output voxel.
+ */
+template <typename T, typename Acc, typename Combine, typename Finalize>
+struct RowReduction {
+    struct State {
+        std::vector<Acc> acc;
+    };
+    State makeState() const { return State{std::vector<Acc>(destDims.x * strides.x)}; }
+
+    void operator()(State& state, T* dst, size_t y, size_t z) const {
+        const auto rowSize = destDims.x * strides.x;
+        auto* acc = state.acc.data();
+
+        const auto* first = src + (z * strides.z * srcDims.y + y * strides.y) * srcDims.x;
+        for (size_t x = 0; x < rowSize; ++x) {
+            acc[x] = static_cast<Acc>(first[x]);
+        }
+        for (size_t oz = 0; oz < strides.z; ++oz) {
+            for (size_t oy = oz == 0 ? 1 : 0; oy < strides.y; ++oy) {
+                const auto* row =
+                    src + ((z * strides.z + oz) * srcDims.y + y * strides.y + oy) * srcDims.x;
+                for (size_t x = 0; x < rowSize; ++x) {
+                    acc[x] = combine(acc[x], static_cast<Acc>(row[x]));
+                }
+            }
+        }
+        for (size_t x = 0; x < destDims.x; ++x) {
+            auto val = acc[x * strides.x];
+            for (size_t ox = 1; ox < strides.x; ++ox) {
+                val = combine(val, acc[x * strides.x + ox]);
+            }
+            dst[x] = finalize(val);
+        }
+    }
+
+    const T* src;
+    size3_t srcDims;
+    size3_t destDims;
+    size3_t strides;
+    Combine combine;
+    Finalize finalize;
+};
+
+/*
+ * Gathers all values of a block into a buffer and calls `reduce(begin, end)` to compute the
+ * output value. Used for the order statistics, i.e. median and mode.
+ */
+template <typename T, typename Reduce>
+struct BlockReduction {
+    struct State {
+        std::vector<T> block;
+    };
+    State makeState() const { return State{std::vector<T>(glm::compMul(strides))}; }
+
+    void operator()(State& state, T* dst, size_t y, size_t z) const {
+        for (size_t x = 0; x < destDims.x; ++x) {
+            auto* out = state.block.data();
+            for (size_t oz = 0; oz < strides.z; ++oz) {
+                for (size_t oy = 0; oy < strides.y; ++oy) {
+                    const auto* row = src +
+                                      ((z * strides.z + oz) * srcDims.y + y * strides.y + oy) *
+                                          srcDims.x +
+                                      x * strides.x;
+                    out = std::copy(row, row + strides.x, out);
+                }
+            }
+            dst[x] = reduce(state.block);
+        }
+    }
+
+    const T* src;
+    size3_t srcDims;
+    size3_t destDims;
+    size3_t strides;
+    Reduce reduce;
+};
+
+template <typename T, typename Acc, typename Combine, typename Finalize>
+std::shared_ptr<VolumeRAM> rowReduction(const VolumeRAMPrecision<T>* srcVol, size3_t strides,
+                                        Combine combine, Finalize finalize) {
+    const size3_t srcDims{srcVol->getDimensions()};
+    return downsampleRows(srcVol, strides,
+                          RowReduction<T, Acc, Combine, Finalize>{srcVol->getDataTyped(), srcDims,
+                                                                  srcDims / strides, strides,
+                                                                  combine, finalize});
+}
+
+template <typename T, typename Reduce>
+std::shared_ptr<VolumeRAM> blockReduction(const VolumeRAMPrecision<T>* srcVol, size3_t strides,
+                                          Reduce reduce) {
+    const size3_t srcDims{srcVol->getDimensions()};
+    return downsampleRows(srcVol, strides,
+                          BlockReduction<T, Reduce>{srcVol->getDataTyped(), srcDims,
+                                                    srcDims / strides, strides, reduce});
+}
+
+template <typename T>
+bool lexicographicLess(const T& a, const T& b) {
+    for (size_t i = 0; i < util::flat_extent<T>::value; ++i) {
+        if (util::glmcomp(a, i) < util::glmcomp(b, i)) return true;
+        if (util::glmcomp(b, i) < util::glmcomp(a, i)) return false;
+    }
+    return false;
+}
+
+}  // namespace
+
 std::shared_ptr<VolumeRAM> volumeDownsample(const VolumeRAM* volume, size3_t strides,
                                             DownsamplingMode mode) {
     switch (mode) {
@@ -54,6 +190,14 @@ std::shared_ptr<VolumeRAM> volumeDownsample(const VolumeRAM* volume, size3_t str
             return volumeStridedDownsample(volume, strides);
         case DownsamplingMode::Averaged:
             return volumeAveragedDownsample(volume, strides);
+        case DownsamplingMode::Maximum:
+            return volumeMaximumDownsample(volume, strides);
+        case DownsamplingMode::Minimum:
+            return volumeMinimumDownsample(volume, strides);
+        case DownsamplingMode::Median:
+            return volumeMedianDownsample(volume, strides);
+        case DownsamplingMode::Mode:
+            return volumeModeDownsample(volume, strides);
         default:
             return volumeStridedDownsample(volume, strides);
     }
@@ -64,34 +208,31 @@ std::shared_ptr<VolumeRAM> volumeStridedDownsample(const VolumeRAM* volume, size
         [&strides](auto srcVol) -> std::shared_ptr<VolumeRAM> {
             using ValueType = util::PrecisionValueType<decltype(srcVol)>;
 
-            // calculate new size
-            const size3_t srcDims{srcVol->getDimensions()};
-            const size3_t destDims{srcDims / strides};
-
-            auto destVol = std::make_shared<VolumeRAMPrecision<ValueType>>(destDims);
-
-            const auto src = srcVol->getDataTyped();
-            auto dst = destVol->getDataTyped();
-
-            const util::IndexMapper3D sourceMapper(srcDims);
-            const util::IndexMapper3D destMapper(destDims);
-
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-            for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
-                const auto z = static_cast<size_t>(z_);  // OpenMP requires signed integral type
-                for (size_t y = 0; y < destDims.y; ++y) {
-                    for (size_t x = 0; x < destDims.x; ++x) {
-                        const size_t px{x * strides.x};
-                        const size_t py{y * strides.y};
-                        const size_t pz{z * strides.z};
-
-                        dst[destMapper(x, y, z)] = src[sourceMapper(px, py, pz)];
+            struct Strided {
+                struct State {};
+                State makeState() const { return {}; }
+                void operator()(State&, ValueType* dst, size_t y, size_t z) const {
+                    const auto* row =
+                        src + (z * strides.z * srcDims.y + y * strides.y) * srcDims.x;
+                    if (strides.x == 1) {
+                        std::copy(row, row + destDims.x, dst);
+                    } else {
+                        for (size_t x = 0; x < destDims.x; ++x) {
+                            dst[x] = row[x * strides.x];
+                        }
                     }
                 }
-            }
-            return destVol;
+
+                const ValueType* src;
+                size3_t srcDims;
+                size3_t destDims;
+                size3_t strides;
+            };
+
+            const size3_t srcDims{srcVol->getDimensions()};
+            return downsampleRows(
+                srcVol, strides,
+                Strided{srcVol->getDataTyped(), srcDims, srcDims / strides, strides});
         });
 }
 
@@ -103,46 +244,88 @@ std::shared_ptr<VolumeRAM> volumeAveragedDownsample(const VolumeRAM* volume, siz
             // use a double type to perform the summation
             using P = typename util::same_extent<ValueType, double>::type;
 
-            // calculate new size
-            const size3_t srcDims{srcVol->getDimensions()};
-            const size3_t destDims{srcDims / strides};
+            const double samplesInv = 1.0 / static_cast<double>(glm::compMul(strides));
 
-            auto destVol = std::make_shared<VolumeRAMPrecision<ValueType>>(destDims);
+            return rowReduction<ValueType, P>(
+                srcVol, strides, [](const P& a, const P& b) { return a + b; },
+                [samplesInv](const P& sum) { return static_cast<ValueType>(sum * samplesInv); });
+        });
+}
 
-            const auto src = srcVol->getDataTyped();
-            auto dst = destVol->getDataTyped();
+std::shared_ptr<VolumeRAM> volumeMaximumDownsample(const VolumeRAM* volume, size3_t strides) {
+    return volume->dispatch<std::shared_ptr<VolumeRAM>>(
+        [&strides](auto srcVol) -> std::shared_ptr<VolumeRAM> {
+            using ValueType = util::PrecisionValueType<decltype(srcVol)>;
 
-            const util::IndexMapper3D sourceMapper(srcDims);
-            const util::IndexMapper3D destMapper(destDims);
-            const double samplesInv = 1.0 / static_cast<double>(glm::compMul(strides));
+            return rowReduction<ValueType, ValueType>(
+                srcVol, strides,
+                [](const ValueType& a, const ValueType& b) { return glm::max(a, b); },
+                [](const ValueType& val) { return val; });
+        });
+}
 
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-            for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
-                const auto z = static_cast<size_t>(z_);  // OpenMP requires signed integral type
-                for (size_t y = 0; y < destDims.y; ++y) {
-                    for (size_t x = 0; x < destDims.x; ++x) {
-                        const size_t px{x * strides.x};
-                        const size_t py{y * strides.y};
-                        const size_t pz{z * strides.z};
-                        P val{0.0};
-
-                        for (size_t oz = 0; oz < strides.z; ++oz) {
-                            for (size_t oy = 0; oy < strides.y; ++oy) {
-                                for (size_t ox = 0; ox < strides.x; ++ox) {
-                                    val += static_cast<P>(
-                                        src[sourceMapper(px + ox, py + oy, pz + oz)]);
-                                }
-                            }
-                        }
+std::shared_ptr<VolumeRAM> volumeMinimumDownsample(const VolumeRAM* volume, size3_t strides) {
+    return volume->dispatch<std::shared_ptr<VolumeRAM>>(
+        [&strides](auto srcVol) -> std::shared_ptr<VolumeRAM> {
+            using ValueType = util::PrecisionValueType<decltype(srcVol)>;
 
-                        dst[destMapper(x, y, z)] = static_cast<ValueType>(val * samplesInv);
+            return rowReduction<ValueType, ValueType>(
+                srcVol, strides,
+                [](const ValueType& a, const ValueType& b) { return glm::min(a, b); },
+                [](const ValueType& val) { return val; });
+        });
+}
+
+std::shared_ptr<VolumeRAM> volumeMedianDownsample(const VolumeRAM* volume, size3_t strides) {
+    return volume->dispatch<std::shared_ptr<VolumeRAM>>(
+        [&strides](auto srcVol) -> std::shared_ptr<VolumeRAM> {
+            using ValueType = util::PrecisionValueType<decltype(srcVol)>;
+            using B = typename util::value_type<ValueType>::type;
+            constexpr auto components = util::flat_extent<ValueType>::value;
+
+            return blockReduction(srcVol, strides, [](std::vector<ValueType>& block) {
+                const auto mid = (block.size() - 1) / 2;
+                if constexpr (components == 1) {
+                    std::nth_element(block.begin(), block.begin() + mid, block.end());
+                    return block[mid];
+                } else {
+                    thread_local std::vector<B> comp;
+                    comp.resize(block.size());
+                    ValueType res{};
+                    for (size_t c = 0; c < components; ++c) {
+                        std::transform(block.begin(), block.end(), comp.begin(),
+                                       [c](const ValueType& v) { return util::glmcomp(v, c); });
+                        std::nth_element(comp.begin(), comp.begin() + mid, comp.end());
+                        util::glmcomp(res, c) = comp[mid];
                     }
+                    return res;
                 }
-            }
+            });
+        });
+}
+
+std::shared_ptr<VolumeRAM> volumeModeDownsample(const VolumeRAM* volume, size3_t strides) {
+    return volume->dispatch<std::shared_ptr<VolumeRAM>>(
+        [&strides](auto srcVol) -> std::shared_ptr<VolumeRAM> {
+            using ValueType = util::PrecisionValueType<decltype(srcVol)>;
+
+            return blockReduction(srcVol, strides, [](std::vector<ValueType>& block) {
+                std::sort(block.begin(), block.end(), lexicographicLess<ValueType>);
 
-            return destVol;
+                auto mode = block.front();
+                size_t modeCount = 0;
+                for (auto it = block.begin(); it != block.end();) {
+                    const auto next = std::find_if(
+                        it, block.end(), [&](const ValueType& v) { return !(v == *it); });
+                    const auto count = static_cast<size_t>(std::distance(it, next));
+                    if (count > modeCount) {
+                        mode = *it;
+                        modeCount = count;
+                    }
+                    it = next;
+                }
+                return mode;
+            });
         });
 }
 
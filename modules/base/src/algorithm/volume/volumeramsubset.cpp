@@ -29,9 +29,12 @@
 
 #include <modules/base/algorithm/volume/volumeramsubset.h>
 
+#include <inviwo/core/datastructures/volume/volume.h>                // for Volume
 #include <inviwo/core/datastructures/volume/volumeborder.h>          // for VolumeBorders
+#include <inviwo/core/datastructures/volume/volumedisk.h>            // for VolumeDisk
 #include <inviwo/core/datastructures/volume/volumeram.h>             // for VolumeRAM
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>  // for VolumeRepresentation
+#include <inviwo/core/util/foreach.h>                                // for forEachChunkParallel
 #include <inviwo/core/util/formatdispatching.h>                      // for dispatch, All
 #include <inviwo/core/util/formats.h>                                // for DataFormatBase
 #include <inviwo/core/util/glmvec.h>                                 // for size3_t, ivec3
@@ -41,10 +44,6 @@
 #include <glm/common.hpp>  // for max, min
 #include <glm/vec3.hpp>    // for operator-, operator+
 
-#ifdef IVW_USE_OPENMP
-#include <omp.h>
-#endif
-
 namespace inviwo {
 
 namespace {
@@ -109,20 +108,26 @@ constexpr auto dispatcher = []<typename T>(
 
     const T* src = static_cast<const T*>(volume->getData());
     T* dst = static_cast<T*>(newVolume->getData());
-    // memcpy each row for every slice to form sub volume
-
-    for (int i = 0; i < static_cast<int>(copyDimsWithoutBorder.z); i++) {
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-        for (int j = 0; j < static_cast<int>(copyDimsWithoutBorder.y); j++) {
-            size_t volumePos = (j * dataDims.x) + (i * dataDims.x * dataDims.y);
-            size_t subVolumePos = ((j + trueBorder.llf.y) * dimsWithBorder.x) +
-                                  ((i + trueBorder.llf.z) * dimsWithBorder.x * dimsWithBorder.y) +
-                                  trueBorder.llf.x;
-            std::memcpy(dst + subVolumePos, (src + volumePos + initialStartPos), dataSize);
+
+    // memcpy each row for every slice to form sub volume, if the rows are consecutive in both
+    // source and destination whole slices are copied at once.
+    const bool wholeRows =
+        copyDimsWithoutBorder.x == dataDims.x && copyDimsWithoutBorder.x == dimsWithBorder.x;
+    const size_t rowsPerCopy = wholeRows ? copyDimsWithoutBorder.y : 1;
+    const size_t copies = copyDimsWithoutBorder.z * copyDimsWithoutBorder.y / rowsPerCopy;
+
+    util::forEachChunkParallel(copies, [&](size_t begin, size_t end) {
+        for (size_t copy = begin; copy < end; ++copy) {
+            const size_t i = (copy * rowsPerCopy) / copyDimsWithoutBorder.y;
+            const size_t j = (copy * rowsPerCopy) % copyDimsWithoutBorder.y;
+            const size_t volumePos = (j * dataDims.x) + (i * dataDims.x * dataDims.y);
+            const size_t subVolumePos =
+                ((j + trueBorder.llf.y) * dimsWithBorder.x) +
+                ((i + trueBorder.llf.z) * dimsWithBorder.x * dimsWithBorder.y) + trueBorder.llf.x;
+            std::memcpy(dst + subVolumePos, (src + volumePos + initialStartPos),
+                        dataSize * rowsPerCopy);
         }
-    }
+    });
 
     return newVolume;
 };
@@ -138,4 +143,15 @@ std::shared_ptr<VolumeRAM> VolumeRAMSubSet::apply(const VolumeRepresentation* in
         clampBorderOutsideVolume);
 }
 
+std::shared_ptr<VolumeRAM> util::loadSlicesFromDisk(const Volume& volume, size_t begin,
+                                                    size_t end) {
+    if (begin >= end || end > volume.getDimensions().z || volume.hasRepresentation<VolumeRAM>() ||
+        !volume.hasRepresentation<VolumeDisk>()) {
+        return nullptr;
+    }
+    const auto* disk = volume.getRepresentation<VolumeDisk>();
+    if (!disk->canLoadSlices()) return nullptr;
+    return disk->loadSlices(begin, end);
+}
+
 }  // namespace inviwo
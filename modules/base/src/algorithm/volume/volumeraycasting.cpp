@@ -0,0 +1,503 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/algorithm/volume/volumeraycasting.h>
+
+#include <inviwo/core/datastructures/camera/camera.h>              // for Camera
+#include <inviwo/core/datastructures/coordinatetransformer.h>      // for StructuredCoordin...
+#include <inviwo/core/datastructures/image/image.h>                // for Image
+#include <inviwo/core/datastructures/image/layer.h>                // for Layer
+#include <inviwo/core/datastructures/image/layerram.h>             // for LayerRAMPrecision
+#include <inviwo/core/datastructures/transferfunction.h>           // for TransferFunction
+#include <inviwo/core/datastructures/volume/volume.h>              // for Volume
+#include <inviwo/core/datastructures/volume/volumeram.h>           // for VolumeRAM
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>  // for VolumeRAMPrecision
+#include <inviwo/core/util/foreach.h>                              // for forEachChunkParallel
+#include <inviwo/core/util/formatdispatching.h>                    // for All
+#include <inviwo/core/util/glmcomp.h>                              // for glmcomp
+
+#include <algorithm>  // for clamp, max, min
+#include <array>      // for array
+#include <cmath>      // for pow, ceil, floor
+#include <limits>     // for numeric_limits
+#include <span>       // for span
+
+#include <glm/common.hpp>                // for clamp, floor, round
+#include <glm/geometric.hpp>             // for dot, length, normalize
+#include <glm/gtc/matrix_transform.hpp>  // for scale
+#include <glm/gtx/component_wise.hpp>    // for compMul
+
+namespace inviwo {
+
+namespace util {
+
+namespace {
+
+// Same constants as used by the raycasting shaders of the opengl module
+constexpr float refSamplingInterval = 150.0f;
+constexpr float ertThreshold = 0.99f;
+
+/*
+ * Trilinear sampling of one channel with clamp to edge, using the texel center convention of
+ * OpenGL, i.e. voxel i is centered at (i + 0.5) / dim in texture coordinates.
+ */
+template <typename T>
+class ChannelSampler {
+public:
+    ChannelSampler(const VolumeRAMPrecision<T>& ram, size_t channel)
+        : data_{ram.getDataTyped()}
+        , dims_{ram.getDimensions()}
+        , maxIndex_{ivec3(dims_) - 1}
+        , channel_{channel} {}
+
+    float operator()(const vec3& pos) const {
+        const vec3 p = pos * vec3(dims_) - 0.5f;
+        const vec3 f = glm::floor(p);
+        const vec3 w = p - f;
+        const ivec3 i0 = glm::clamp(ivec3(f), ivec3(0), maxIndex_);
+        const ivec3 i1 = glm::clamp(ivec3(f) + 1, ivec3(0), maxIndex_);
+
+        const auto x0 = static_cast<size_t>(i0.x);
+        const auto x1 = static_cast<size_t>(i1.x);
+        const auto y0 = static_cast<size_t>(i0.y) * dims_.x;
+        const auto y1 = static_cast<size_t>(i1.y) * dims_.x;
+        const auto z0 = static_cast<size_t>(i0.z) * dims_.x * dims_.y;
+        const auto z1 = static_cast<size_t>(i1.z) * dims_.x * dims_.y;
+
+        const float c00 = lerp(value(x0 + y0 + z0), value(x1 + y0 + z0), w.x);
+        const float c10 = lerp(value(x0 + y1 + z0), value(x1 + y1 + z0), w.x);
+        const float c01 = lerp(value(x0 + y0 + z1), value(x1 + y0 + z1), w.x);
+        const float c11 = lerp(value(x0 + y1 + z1), value(x1 + y1 + z1), w.x);
+        return lerp(lerp(c00, c10, w.y), lerp(c01, c11, w.y), w.z);
+    }
+
+    float value(size_t index) const { return static_cast<float>(glmcomp(data_[index], channel_)); }
+
+private:
+    static float lerp(float a, float b, float t) { return a + t * (b - a); }
+
+    const T* data_;
+    size3_t dims_;
+    ivec3 maxIndex_;
+    size_t channel_;
+};
+
+/*
+ * Maps raw values of the volume to [0,1] using the data range, like the texToNormalized
+ * parameters in the shaders.
+ */
+struct Normalization {
+    explicit Normalization(const Volume& volume)
+        : offset{static_cast<float>(volume.dataMap.dataRange.x)}
+        , scale{[&]() {
+            const auto range = volume.dataMap.dataRange.y - volume.dataMap.dataRange.x;
+            return range != 0.0 ? static_cast<float>(1.0 / range) : 1.0f;
+        }()} {}
+
+    float operator()(float raw) const { return (raw - offset) * scale; }
+
+    float offset;
+    float scale;
+};
+
+/*
+ * Transfer function lookup table sampled with linear interpolation like a 1D texture, together
+ * with a prefix count of the entries with a non-zero opacity to find transparent ranges.
+ */
+class TFTable {
+public:
+    TFTable(const TransferFunction& tf, size_t size)
+        : table_(std::max(size, size_t{1})), opaque_(table_.size() + 1, 0) {
+        tf.interpolateAndStoreColors(std::span<vec4>{table_});
+        for (size_t i = 0; i < table_.size(); ++i) {
+            opaque_[i + 1] = opaque_[i] + (table_[i].a > 0.0f ? 1 : 0);
+        }
+    }
+
+    vec4 operator()(float v) const {
+        const float p = std::clamp(v, 0.0f, 1.0f) * static_cast<float>(table_.size()) - 0.5f;
+        const auto i0 = index(std::floor(p));
+        const auto i1 = index(std::floor(p) + 1.0f);
+        const float w = p - std::floor(p);
+        return table_[i0] + w * (table_[i1] - table_[i0]);
+    }
+
+    /*
+     * True if all lookups for values in [min, max] give zero opacity. Includes one extra entry
+     * on each side to be robust to rounding.
+     */
+    bool isTransparent(float min, float max) const {
+        const auto size = static_cast<float>(table_.size());
+        const auto lo = index(std::floor(std::clamp(min, 0.0f, 1.0f) * size - 0.5f) - 1.0f);
+        const auto hi = index(std::ceil(std::clamp(max, 0.0f, 1.0f) * size - 0.5f) + 1.0f);
+        return opaque_[hi + 1] == opaque_[lo];
+    }
+
+private:
+    size_t index(float i) const {
+        return static_cast<size_t>(std::clamp(i, 0.0f, static_cast<float>(table_.size() - 1)));
+    }
+
+    std::vector<vec4> table_;
+    std::vector<size_t> opaque_;
+};
+
+float specularBlinnPhong(const vec3& normal, const vec3& toLight, const vec3& toCamera,
+                         float exponent) {
+    const vec3 halfway = toCamera + toLight;
+    // the light source is exactly opposite to the view direction
+    if (glm::dot(halfway, halfway) < 1.0e-6f) return 0.0f;
+    return std::pow(std::max(glm::dot(normal, glm::normalize(halfway)), 0.0f), exponent);
+}
+
+float specularPhong(const vec3& normal, const vec3& toLight, const vec3& toCamera,
+                    float exponent) {
+    if (glm::dot(toLight, normal) < 0.0f) return 0.0f;
+    const vec3 r = 2.0f * glm::dot(toLight, normal) * normal - toLight;
+    // scale the exponent to roughly match the one of the Blinn-Phong model
+    return std::pow(std::max(glm::dot(r, toCamera), 0.0f), exponent * 0.25f);
+}
+
+/*
+ * Port of the shading functions in shading.glsl, using the default volume material where the
+ * ambient and diffuse colors are the sample color and the specular color is white.
+ */
+vec3 shade(const LightingState& light, const vec3& color, const vec3& position, vec3 normal,
+           const vec3& toCamera) {
+    switch (light.shadingMode) {
+        case ShadingMode::Ambient:
+        case ShadingMode::Diffuse:
+        case ShadingMode::Specular:
+        case ShadingMode::BlinnPhong:
+        case ShadingMode::Phong:
+            // two-sided shading
+            if (glm::dot(normal, toCamera) < 0.0f) normal = -normal;
+            break;
+        case ShadingMode::BlinnPhongBack:
+        case ShadingMode::PhongBack:
+            normal = -normal;
+            break;
+        default:
+            break;
+    }
+
+    const vec3 toLight = glm::normalize(light.position - position);
+    const auto diffuse = [&]() {
+        return std::max(glm::dot(normal, toLight), 0.0f) * color * light.diffuse;
+    };
+
+    switch (light.shadingMode) {
+        case ShadingMode::Ambient:
+            return color * light.ambient;
+        case ShadingMode::Diffuse:
+            return diffuse();
+        case ShadingMode::Specular:
+            return specularBlinnPhong(normal, toLight, toCamera, light.exponent) * light.specular;
+        case ShadingMode::BlinnPhong:
+        case ShadingMode::BlinnPhongFront:
+        case ShadingMode::BlinnPhongBack:
+            return color * light.ambient + diffuse() +
+                   specularBlinnPhong(normal, toLight, toCamera, light.exponent) * light.specular;
+        case ShadingMode::Phong:
+        case ShadingMode::PhongFront:
+        case ShadingMode::PhongBack:
+            return color * light.ambient + diffuse() +
+                   specularPhong(normal, toLight, toCamera, light.exponent) * light.specular;
+        case ShadingMode::None:
+        default:
+            return color;
+    }
+}
+
+template <typename T>
+class Raycaster {
+public:
+    Raycaster(const Volume& volume, const VolumeRAMPrecision<T>& ram, const TFTable& tf,
+              const LightingState& lighting, const VolumeRaycastingSettings& settings,
+              const MinMaxBlockGrid* grid)
+        : sampler_{ram, settings.channel}
+        , normalize_{volume}
+        , tf_{tf}
+        , lighting_{lighting}
+        , dims_{volume.getDimensions()}
+        , maxIndex_{ivec3(volume.getDimensions()) - 1}
+        , textureToWorld_{volume.getCoordinateTransformer().getTextureToWorldMatrix()}
+        , gradientSpacing_{volume.getWorldSpaceGradientSpacing()}
+        , samplingRate_{settings.samplingRate}
+        , grid_{grid} {
+
+        const mat3 offsets{glm::scale(volume.getCoordinateTransformer().getWorldToTextureMatrix(),
+                                      gradientSpacing_)};
+        gradientOffsets_ = {offsets[0], offsets[1], offsets[2]};
+
+        if (grid_) {
+            const auto& minMax = grid_->getData();
+            empty_.resize(minMax.size());
+            forEachChunkParallel(minMax.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    empty_[i] = tf_.isTransparent(minMax[i].x, minMax[i].y) ? 1 : 0;
+                }
+            });
+        }
+    }
+
+    vec4 operator()(const vec3& entry, const vec3& exit) const {
+        vec4 result{0.0f};
+
+        const vec3 ray = exit - entry;
+        const float tEnd = glm::length(ray);
+        if (tEnd <= 0.0f) return result;
+
+        float tIncr = std::min(tEnd, tEnd / (samplingRate_ * glm::length(ray * dims_)));
+        const auto samples = static_cast<size_t>(std::ceil(tEnd / tIncr));
+        tIncr = tEnd / static_cast<float>(samples);
+
+        const vec3 dir = ray / tEnd;
+        const vec3 toCamera = glm::normalize(vec3{textureToWorld_ * vec4{entry, 1.0f}} -
+                                             vec3{textureToWorld_ * vec4{exit, 1.0f}});
+        const float alphaExponent = tIncr * refSamplingInterval;
+
+        for (size_t k = 0; k < samples;) {
+            const float t = (static_cast<float>(k) + 0.5f) * tIncr;
+            const vec3 pos = entry + t * dir;
+
+            if (!empty_.empty()) {
+                const size3_t block = blockOf(pos);
+                if (empty_[index(block)]) {
+                    const float tExit = blockExit(block, entry, dir);
+                    if (tExit >= tEnd) break;
+                    const float next = std::max(0.0f, std::ceil(tExit / tIncr - 0.5f));
+                    k = std::max(k + 1, static_cast<size_t>(next));
+                    continue;
+                }
+            }
+
+            const float raw = sampler_(pos);
+            vec4 color = tf_(normalize_(raw));
+            if (color.a > 0.0f) {
+                if (lighting_.shadingMode != ShadingMode::None) {
+                    vec3 gradient = this->gradient(pos);
+                    const float length = glm::length(gradient);
+                    gradient = length > 0.0f ? gradient / length : vec3{0.0f};
+                    // make sure that the gradient always points away from zero
+                    if (raw < 0.0f) gradient = -gradient;
+
+                    // the normal points towards lower intensities, i.e. against the gradient
+                    const vec3 world{textureToWorld_ * vec4{pos, 1.0f}};
+                    color = vec4{shade(lighting_, vec3{color}, world, -gradient, toCamera),
+                                 color.a};
+                }
+
+                color.a = 1.0f - std::pow(1.0f - color.a, alphaExponent);
+                result += (1.0f - result.a) * vec4{vec3{color} * color.a, color.a};
+                if (result.a > ertThreshold) break;
+            }
+            ++k;
+        }
+        return result;
+    }
+
+private:
+    vec3 gradient(const vec3& pos) const {
+        vec3 g;
+        for (int i = 0; i < 3; ++i) {
+            g[i] = normalize_(sampler_(pos + gradientOffsets_[i])) -
+                   normalize_(sampler_(pos - gradientOffsets_[i]));
+        }
+        return g / (2.0f * gradientSpacing_);
+    }
+
+    size3_t blockOf(const vec3& pos) const {
+        const ivec3 voxel =
+            glm::clamp(ivec3(glm::floor(pos * dims_ - 0.5f)), ivec3(0), maxIndex_);
+        return size3_t(voxel) / grid_->getBlockSize();
+    }
+
+    size_t index(const size3_t& block) const {
+        const auto& dims = grid_->getDimensions();
+        return block.x + dims.x * (block.y + dims.y * block.z);
+    }
+
+    /*
+     * The ray parameter where the ray leaves the voxels handled by block. The first and last
+     * blocks along each axis extend to infinity since the sampling clamps to the edge.
+     */
+    float blockExit(const size3_t& block, const vec3& entry, const vec3& dir) const {
+        const auto blockSize = static_cast<float>(grid_->getBlockSize());
+        const vec3 start = entry * dims_ - 0.5f;
+        const vec3 speed = dir * dims_;
+        float tExit = std::numeric_limits<float>::infinity();
+        for (int i = 0; i < 3; ++i) {
+            if (speed[i] > 0.0f && block[i] + 1 < grid_->getDimensions()[i]) {
+                const float hi = static_cast<float>(block[i] + 1) * blockSize;
+                tExit = std::min(tExit, (hi - start[i]) / speed[i]);
+            } else if (speed[i] < 0.0f && block[i] > 0) {
+                const float lo = static_cast<float>(block[i]) * blockSize;
+                tExit = std::min(tExit, (lo - start[i]) / speed[i]);
+            }
+        }
+        return tExit;
+    }
+
+    ChannelSampler<T> sampler_;
+    Normalization normalize_;
+    const TFTable& tf_;
+    const LightingState& lighting_;
+    vec3 dims_;
+    ivec3 maxIndex_;
+    mat4 textureToWorld_;
+    vec3 gradientSpacing_;
+    std::array<vec3, 3> gradientOffsets_;
+    float samplingRate_;
+    const MinMaxBlockGrid* grid_;
+    std::vector<unsigned char> empty_;
+};
+
+}  // namespace
+
+MinMaxBlockGrid::MinMaxBlockGrid(const Volume& volume, size_t channel, size_t blockSize)
+    : dims_{}, blockSize_{std::max(blockSize, size_t{1})}, channel_{channel}, minMax_{} {
+
+    const auto volumeDims = volume.getDimensions();
+    dims_ = (volumeDims + blockSize_ - size_t{1}) / blockSize_;
+    minMax_.resize(glm::compMul(dims_));
+
+    const Normalization normalize{volume};
+    volume.getRepresentation<VolumeRAM>()->dispatch<void, dispatching::filter::All>(
+        [&](const auto* ram) {
+            using T = util::PrecisionValueType<decltype(ram)>;
+            const ChannelSampler<T> sampler{*ram, channel_};
+
+            forEachChunkParallel(minMax_.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const size3_t block{i % dims_.x, (i / dims_.x) % dims_.y,
+                                        i / (dims_.x * dims_.y)};
+                    const size3_t first = block * blockSize_;
+                    const size3_t last =
+                        glm::min(first + blockSize_, volumeDims - size_t{1});
+
+                    float min = std::numeric_limits<float>::max();
+                    float max = std::numeric_limits<float>::lowest();
+                    for (size_t z = first.z; z <= last.z; ++z) {
+                        for (size_t y = first.y; y <= last.y; ++y) {
+                            const size_t row = volumeDims.x * (y + volumeDims.y * z);
+                            for (size_t x = first.x; x <= last.x; ++x) {
+                                const float v = sampler.value(row + x);
+                                min = std::min(min, v);
+                                max = std::max(max, v);
+                            }
+                        }
+                    }
+                    // a negative scale flips the order
+                    const float a = normalize(min);
+                    const float b = normalize(max);
+                    minMax_[i] = vec2{std::min(a, b), std::max(a, b)};
+                }
+            });
+        });
+}
+
+std::shared_ptr<Image> volumeRaycast(const Volume& volume, const TransferFunction& tf,
+                                     const Camera& camera, const LightingState& lighting,
+                                     size2_t dimensions, const VolumeRaycastingSettings& settings,
+                                     const MinMaxBlockGrid* grid) {
+    auto layerRAM = std::make_shared<LayerRAMPrecision<glm::u8vec4>>(dimensions);
+    auto* data = layerRAM->getDataTyped();
+
+    const TFTable table{tf, settings.tfResolution};
+    const mat4 clipToTexture = volume.getCoordinateTransformer().getWorldToTextureMatrix() *
+                               camera.getInverseViewMatrix() *
+                               camera.getInverseProjectionMatrix();
+
+    if (grid && (grid->getChannel() != settings.channel ||
+                 grid->getDimensions() !=
+                     (volume.getDimensions() + grid->getBlockSize() - size_t{1}) /
+                         grid->getBlockSize())) {
+        grid = nullptr;
+    }
+
+    volume.getRepresentation<VolumeRAM>()->dispatch<void, dispatching::filter::All>(
+        [&](const auto* ram) {
+            using T = util::PrecisionValueType<decltype(ram)>;
+            const Raycaster<T> raycaster{volume, *ram, table, lighting, settings, grid};
+
+            // Rays start at the near plane and end at the far plane, clipped to the unit cube
+            // of texture space.
+            const auto trace = [&](size_t x, size_t y) {
+                const vec2 ndc = (vec2{x, y} + 0.5f) / vec2{dimensions} * 2.0f - 1.0f;
+                const vec4 near = clipToTexture * vec4{ndc, -1.0f, 1.0f};
+                const vec4 far = clipToTexture * vec4{ndc, 1.0f, 1.0f};
+                const vec3 a = vec3{near} / near.w;
+                const vec3 d = vec3{far} / far.w - a;
+
+                float t0 = 0.0f;
+                float t1 = 1.0f;
+                for (int i = 0; i < 3; ++i) {
+                    if (d[i] != 0.0f) {
+                        const float ta = -a[i] / d[i];
+                        const float tb = (1.0f - a[i]) / d[i];
+                        t0 = std::max(t0, std::min(ta, tb));
+                        t1 = std::min(t1, std::max(ta, tb));
+                    } else if (a[i] < 0.0f || a[i] > 1.0f) {
+                        return vec4{0.0f};
+                    }
+                }
+                if (t0 >= t1) return vec4{0.0f};
+                return raycaster(a + t0 * d, a + t1 * d);
+            };
+
+            const auto tileSize = std::max(settings.tileSize, size_t{1});
+            const size2_t tiles = (dimensions + tileSize - size_t{1}) / tileSize;
+            const auto nTiles = tiles.x * tiles.y;
+
+            forEachChunkParallel(
+                nTiles,
+                [&](size_t begin, size_t end) {
+                    for (size_t tile = begin; tile < end; ++tile) {
+                        const size2_t first{(tile % tiles.x) * tileSize,
+                                            (tile / tiles.x) * tileSize};
+                        const size2_t last = glm::min(first + tileSize, dimensions);
+                        for (size_t y = first.y; y < last.y; ++y) {
+                            for (size_t x = first.x; x < last.x; ++x) {
+                                const vec4 color = glm::clamp(trace(x, y), 0.0f, 1.0f);
+                                data[x + y * dimensions.x] =
+                                    glm::u8vec4{glm::round(color * 255.0f)};
+                            }
+                        }
+                    }
+                },
+                nTiles);
+        });
+
+    return std::make_shared<Image>(std::make_shared<Layer>(layerRAM));
+}
+
+}  // namespace util
+
+}  // namespace inviwo
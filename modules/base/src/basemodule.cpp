@@ -109,9 +109,11 @@
 #include <modules/base/processors/meshcolorfromnormals.h>                  // for MeshColorFro...
 #include <modules/base/processors/meshconverterprocessor.h>                // for MeshConverte...
 #include <modules/base/processors/meshcreator.h>                           // for MeshCreator
+#include <modules/base/processors/meshdecimationprocessor.h>               // for MeshDecimati...
 #include <modules/base/processors/meshexport.h>                            // for MeshExport
 #include <modules/base/processors/meshinformation.h>                       // for MeshInformation
 #include <modules/base/processors/meshmapping.h>                           // for MeshMapping
+#include <modules/base/processors/meshoptimizationprocessor.h>             // for MeshOptimiza...
 #include <modules/base/processors/meshplaneclipping.h>                     // for MeshPlaneCli...
 #include <modules/base/processors/meshsequenceelementselectorprocessor.h>  // for MeshSequence...
 #include <modules/base/processors/meshsource.h>                            // for MeshSource
@@ -146,6 +148,7 @@
 #include <modules/base/processors/volumehistogram2d.h>                       // for VolumeHistog...
 #include <modules/base/processors/volumeinformation.h>                       // for VolumeInform...
 #include <modules/base/processors/volumelaplacianprocessor.h>                // for VolumeLaplac...
+#include <modules/base/processors/volumeraycastercpu.h>                      // for VolumeRaycas...
 #include <modules/base/processors/volumesequenceelementselectorprocessor.h>  // for VolumeSequen...
 #include <modules/base/processors/volumesequenceexport.h>
 #include <modules/base/processors/volumesequencesingletimestepsampler.h>  // for VolumeSequen...
@@ -246,9 +249,11 @@ BaseModule::BaseModule(InviwoApplication* app) : InviwoModule(app, "Base") {
     registerProcessor<MeshColorFromNormals>();
     registerProcessor<MeshConverterProcessor>();
     registerProcessor<MeshCreator>();
+    registerProcessor<MeshDecimationProcessor>();
     registerProcessor<MeshExport>();
     registerProcessor<MeshInformation>();
     registerProcessor<MeshMapping>();
+    registerProcessor<MeshOptimizationProcessor>();
     registerProcessor<MeshPlaneClipping>();
     registerProcessor<MeshSequenceElementSelectorProcessor>();
     registerProcessor<MeshSource>();
@@ -288,6 +293,7 @@ BaseModule::BaseModule(InviwoApplication* app) : InviwoModule(app, "Base") {
     registerProcessor<VolumeGradientCPUProcessor>();
     registerProcessor<VolumeInformation>();
     registerProcessor<VolumeLaplacianProcessor>();
+    registerProcessor<VolumeRaycasterCPU>();
     registerProcessor<VolumeSequenceElementSelectorProcessor>();
     registerProcessor<VolumeSequenceExport>();
     registerProcessor<VolumeSequenceSingleTimestepSamplerProcessor>();
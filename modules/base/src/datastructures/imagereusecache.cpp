@@ -29,23 +29,36 @@
 
 #include <modules/base/datastructures/imagereusecache.h>
 
-#include <algorithm>  // for find_if
+#include <glm/gtx/component_wise.hpp>
 
 namespace inviwo {
-class Image;
-
-std::shared_ptr<Image> ImageReuseCache::getUnused() {
-    auto it = std::find_if(imageCache_.begin(), imageCache_.end(),
-                           [](const auto& elem) { return elem.use_count() == 1; });
-    if (it != imageCache_.end()) {
-        auto res = *it;
-        imageCache_.erase(it);
-        return res;
-    } else {
-        return nullptr;
+
+namespace {
+
+size_t sizeInBytes(const Image& image) {
+    size_t bytes = 0;
+    for (size_t i = 0; i < image.getNumberOfColorLayers(); ++i) {
+        const auto* layer = image.getColorLayer(i);
+        bytes += glm::compMul(layer->getDimensions()) * layer->getDataFormat()->getSizeInBytes();
     }
+    return bytes;
+}
+
+}  // namespace
+
+ImageReuseCache::ImageReuseCache(size_t budget)
+    : pool_{"ImageReuseCache", [](const Image& image) { return sizeInBytes(image); }, budget} {}
+
+std::shared_ptr<Image> ImageReuseCache::getUnused() { return pool_.acquire(); }
+
+std::shared_ptr<Image> ImageReuseCache::getUnused(const size2_t& dim,
+                                                  const DataFormatBase* format) {
+    return pool_.acquire([&](const Image& image) {
+        return image.getNumberOfColorLayers() == 1 && image.getDataFormat() == format &&
+               image.getDimensions() == dim;
+    });
 }
 
-void ImageReuseCache::add(std::shared_ptr<Image> image) { imageCache_.push_back(image); }
+void ImageReuseCache::add(std::shared_ptr<Image> image) { pool_.add(std::move(image)); }
 
 }  // namespace inviwo
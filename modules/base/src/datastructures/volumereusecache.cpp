@@ -29,43 +29,45 @@
 
 #include <modules/base/datastructures/volumereusecache.h>
 
-#include <algorithm>
+#include <glm/gtx/component_wise.hpp>
 
 namespace inviwo {
 
-VolumeReuseCache::VolumeReuseCache(VolumeConfig config) : config_(std::move(config)) {}
+VolumeReuseCache::VolumeReuseCache(VolumeConfig config, size_t budget)
+    : config_(std::move(config))
+    , pool_{"VolumeReuseCache",
+            [](const Volume& volume) {
+                return glm::compMul(volume.getDimensions()) *
+                       volume.getDataFormat()->getSizeInBytes();
+            },
+            budget} {}
 
 const VolumeConfig& VolumeReuseCache::getConfig() const { return config_; }
 auto VolumeReuseCache::setConfig(const VolumeConfig& config) -> Status {
     if (config != config_) {
-        cache_.clear();
         config_ = config;
+        pool_.trim();
         return Status::ClearedCache;
     } else {
         return Status::NoChange;
     }
 }
 std::shared_ptr<Volume> VolumeReuseCache::get() {
-    auto it = std::ranges::find_if(cache_, [](const auto& elem) { return elem.use_count() == 1; });
-    if (it != cache_.end()) {
-        auto volume = *it;
+    const auto reprConfig = config_.reprConfig();
+    if (auto volume = pool_.acquire([&](const Volume& vol) { return reprConfig == vol; })) {
         volume->getMetaDataMap()->removeAll();
 
-        volume->axes[0] = config_.xAxis.value_or(VolumeConfig::defaultYAxis);
+        volume->axes[0] = config_.xAxis.value_or(VolumeConfig::defaultXAxis);
         volume->axes[1] = config_.yAxis.value_or(VolumeConfig::defaultYAxis);
         volume->axes[2] = config_.zAxis.value_or(VolumeConfig::defaultZAxis);
         volume->dataMap = config_.dataMap();
         volume->setModelMatrix(config_.model.value_or(VolumeConfig::defaultModel));
         volume->setWorldMatrix(config_.world.value_or(VolumeConfig::defaultWorld));
 
-        if (*volume != config_.reprConfig()) {
-            throw Exception("Unexpected changes found in cache");
-        }
-
         return volume;
     } else {
         auto vol = std::make_shared<Volume>(config_);
-        cache_.push_back(vol);
+        pool_.add(vol);
         return vol;
     }
 }
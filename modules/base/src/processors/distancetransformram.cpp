@@ -82,8 +82,8 @@ const ProcessorInfo DistanceTransformRAM::processorInfo_{
     Tags::CPU,                          // Tags
     R"(Computes the distance transform of a volume dataset using a threshold value
     The result is the distance from each voxel to the closest feature. It will only work correctly
-    for volumes with an orthogonal basis. It uses the Saito's algorithm to compute the Euclidean
-    distance.
+    for volumes with an orthogonal basis. It uses the linear time algorithm of Felzenszwalb and
+    Huttenlocher to compute the exact Euclidean distance.
     
     Example Network:
     [basegl/distance_transform.inv](file:~modulePath~/tests/regression/distance_transform.inv)
@@ -66,7 +66,8 @@ const ProcessorInfo ImageDistanceTransform::processorInfo_{
     CodeState::Stable,                    // Code state
     Tags::CPU,                            // Tags
     R"(Computes the closest distance to a threshold value for each texel in the first color layer
-    of the input Image. It uses Saito's algorithm to compute the Euclidean distance.
+    of the input Image. It uses the linear time algorithm of Felzenszwalb and Huttenlocher to
+    compute the exact Euclidean distance.
     Note: Only works correctly for Layers with an orthogonal basis.)"_unindentHelp,
 };
 const ProcessorInfo& ImageDistanceTransform::getProcessorInfo() const { return processorInfo_; }
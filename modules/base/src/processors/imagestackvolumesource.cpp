@@ -30,42 +30,48 @@
 #include <modules/base/processors/imagestackvolumesource.h>
 
 #include <inviwo/core/common/factoryutil.h>                             // for getDataReaderFactory
+#include <inviwo/core/datastructures/diskrepresentation.h>              // for DiskRepresentatio...
 #include <inviwo/core/datastructures/image/layer.h>                     // for DataReaderType
 #include <inviwo/core/datastructures/image/layerram.h>                  // for LayerRAM
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
-#include <inviwo/core/datastructures/volume/volumeram.h>
-#include <inviwo/core/io/datareader.h>                          // for DataReaderType
-#include <inviwo/core/io/datareaderexception.h>                 // for DataReaderException
-#include <inviwo/core/io/datareaderfactory.h>                   // for DataReaderFactory
-#include <inviwo/core/ports/volumeport.h>                       // for VolumeOutport
-#include <inviwo/core/processors/processor.h>                   // for Processor
-#include <inviwo/core/processors/processorinfo.h>               // for ProcessorInfo
-#include <inviwo/core/processors/processorstate.h>              // for CodeState, CodeSt...
-#include <inviwo/core/processors/processortags.h>               // for Tags
-#include <inviwo/core/properties/boolproperty.h>                // for BoolProperty
-#include <inviwo/core/properties/buttonproperty.h>              // for ButtonProperty
-#include <inviwo/core/properties/filepatternproperty.h>         // for FilePatternProperty
-#include <inviwo/core/properties/property.h>                    // for OverwriteState
-#include <inviwo/core/util/exception.h>                         // for Exception
-#include <inviwo/core/util/fileextension.h>                     // for FileExtension
-#include <inviwo/core/util/formatdispatching.h>                 // for PrecisionValueType
-#include <inviwo/core/util/formats.h>                           // for DataFormat, DataF...
-#include <inviwo/core/util/glmconvert.h>                        // for glm_convert_norma...
-#include <inviwo/core/util/glmvec.h>                            // for vec3, dvec2, size2_t
-#include <inviwo/core/util/logcentral.h>                        // for LogCentral, LogPr...
-#include <inviwo/core/util/raiiutils.h>                         // for OnScopeExit, OnSc...
-#include <inviwo/core/util/statecoordinator.h>                  // for StateCoordinator
-#include <inviwo/core/util/zip.h>                               // for zipper, enumerate
-#include <modules/base/properties/basisproperty.h>              // for BasisProperty
-#include <modules/base/properties/volumeinformationproperty.h>  // for VolumeInformation...
+#include <inviwo/core/datastructures/volume/volumedisk.h>               // for VolumeDisk, Volum...
+#include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM, create...
+#include <inviwo/core/io/datareader.h>                                  // for DataReaderType
+#include <inviwo/core/io/datareaderexception.h>                         // for DataReaderException
+#include <inviwo/core/io/datareaderfactory.h>                           // for DataReaderFactory
+#include <inviwo/core/ports/volumeport.h>                               // for VolumeOutport
+#include <inviwo/core/processors/processor.h>                           // for Processor
+#include <inviwo/core/processors/processorinfo.h>                       // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>                      // for CodeState, CodeSt...
+#include <inviwo/core/processors/processortags.h>                       // for Tags
+#include <inviwo/core/properties/boolproperty.h>                        // for BoolProperty
+#include <inviwo/core/properties/buttonproperty.h>                      // for ButtonProperty
+#include <inviwo/core/properties/filepatternproperty.h>                 // for FilePatternProperty
+#include <inviwo/core/properties/property.h>                            // for OverwriteState
+#include <inviwo/core/util/cloneableptr.h>                              // for cloneable_ptr
+#include <inviwo/core/util/exception.h>                                 // for Exception
+#include <inviwo/core/util/fileextension.h>                             // for FileExtension
+#include <inviwo/core/util/foreach.h>                                   // for forEachChunkParallel
+#include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
+#include <inviwo/core/util/formats.h>                                   // for DataFormat, DataF...
+#include <inviwo/core/util/glmconvert.h>                                // for glm_convert_norma...
+#include <inviwo/core/util/glmvec.h>                                    // for vec3, dvec2, size2_t
+#include <inviwo/core/util/logcentral.h>                                // for LogCentral, LogPr...
+#include <inviwo/core/util/raiiutils.h>                                 // for OnScopeExit, OnSc...
+#include <inviwo/core/util/statecoordinator.h>                          // for StateCoordinator
+#include <modules/base/properties/basisproperty.h>                      // for BasisProperty
+#include <modules/base/properties/volumeinformationproperty.h>          // for VolumeInformation...
 
 #include <algorithm>      // for fill, transform
 #include <cstddef>        // for size_t
+#include <exception>      // for exception_ptr, rethrow_exception
+#include <filesystem>     // for path
 #include <functional>     // for __base
 #include <iterator>       // for back_insert_iterator
 #include <map>            // for map, operator!=
+#include <mutex>          // for mutex, scoped_lock
 #include <string_view>    // for string_view
 #include <type_traits>    // for integral_constant
 #include <unordered_set>  // for unordered_set
@@ -95,6 +101,115 @@ struct FloatOrIntMax32
     : std::integral_constant<bool, Format::numtype == NumericType::Float || Format::compsize <= 4> {
 };
 
+using Slices =
+    std::vector<std::pair<std::filesystem::path, util::cloneable_ptr<DataReaderType<Layer>>>>;
+
+/*
+ * Reads the images of a stack into the slices of a VolumeRAM, converting them to the format of
+ * the volume. Slices are decoded in parallel on the thread pool and copied directly into their
+ * z offset. Files that can not be read result in empty slices.
+ */
+class ImageStackVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation>,
+                                  public VolumeSliceLoader {
+public:
+    explicit ImageStackVolumeRAMLoader(Slices slices) : slices_{std::move(slices)} {}
+    virtual ImageStackVolumeRAMLoader* clone() const override {
+        return new ImageStackVolumeRAMLoader(*this);
+    }
+    virtual ~ImageStackVolumeRAMLoader() = default;
+
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        return loadSlices(src, 0, src.getDimensions().z);
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                      const VolumeRepresentation& src) const override {
+        auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
+        if (volumeDst->getDimensions() != src.getDimensions()) {
+            throw DataReaderException("Volume size missmatch");
+        }
+        read(*volumeDst, 0);
+    }
+    virtual std::shared_ptr<VolumeRAM> loadSlices(const VolumeRepresentation& src, size_t begin,
+                                                  size_t end) const override {
+        const auto dims = src.getDimensions();
+        auto volumeRAM =
+            createVolumeRAM(size3_t{dims.x, dims.y, end - begin}, src.getDataFormat(), nullptr,
+                            src.getSwizzleMask(), src.getInterpolation(), src.getWrapping());
+        read(*volumeRAM, begin);
+        return volumeRAM;
+    }
+
+private:
+    void read(VolumeRAM& volumeRAM, size_t first) const {
+        volumeRAM.dispatch<void, FloatOrIntMax32>([&](auto volumePrecision) {
+            using ValueType = util::PrecisionValueType<decltype(volumePrecision)>;
+
+            const size3_t dims = volumePrecision->getDimensions();
+            const size2_t layerDims{dims};
+            const size_t sliceOffset = glm::compMul(layerDims);
+            auto volData = volumePrecision->getDataTyped();
+
+            const auto readSlice = [&](size_t slice) {
+                auto* dst = volData + (slice - first) * sliceOffset;
+                const auto fill = [&]() { std::fill(dst, dst + sliceOffset, ValueType{0}); };
+
+                const auto& [file, reader] = slices_[slice];
+                if (!reader) return fill();
+
+                std::shared_ptr<Layer> layer;
+                try {
+                    layer = reader->readData(file);
+                } catch (const DataReaderException& e) {
+                    log::warn("Could not load image: {}, {}", file, e.getMessage());
+                    return fill();
+                }
+                const auto* layerRAM = layer->template getRepresentation<LayerRAM>();
+
+                const auto* format = layerRAM->getDataFormat();
+                if ((format->getNumericType() != NumericType::Float) &&
+                    (format->getPrecision() > 32)) {
+                    log::warn("Unsupported integer bit depth: {}, for image: {}",
+                              format->getPrecision(), file);
+                    return fill();
+                }
+
+                if (layerRAM->getDimensions() != layerDims) {
+                    log::warn("Unexpected dimensions: {}, expected: {}, for image: {}",
+                              layer->getDimensions(), layerDims, file);
+                    return fill();
+                }
+                layerRAM->template dispatch<void, FloatOrIntMax32>([&](auto layerpr) {
+                    const auto data = layerpr->getDataTyped();
+                    std::transform(data, data + sliceOffset, dst, [](auto value) {
+                        return util::glm_convert_normalized<ValueType>(value);
+                    });
+                });
+            };
+
+            // One slice per chunk, decoding times can vary a lot between images
+            std::mutex mutex;
+            std::exception_ptr error;
+            util::forEachChunkParallel(
+                dims.z,
+                [&](size_t begin, size_t end) {
+                    try {
+                        for (size_t slice = first + begin; slice < first + end; ++slice) {
+                            readSlice(slice);
+                        }
+                    } catch (...) {
+                        const std::scoped_lock lock{mutex};
+                        if (!error) error = std::current_exception();
+                    }
+                },
+                dims.z);
+            if (error) std::rethrow_exception(error);
+        });
+    }
+
+    Slices slices_;
+};
+
 }  // namespace
 
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
@@ -110,7 +225,8 @@ const ProcessorInfo ImageStackVolumeSource::processorInfo_{
  
     The input images are converted to a volume representation based on the input channel selection.
     Single channels, i.e. red, green, blue, alpha, and grayscale, will result in a scalar volume
-    whereas rgb and rgba will yield a vec3 or vec4 volume, respectively.)"_unindentHelp,
+    whereas rgb and rgba will yield a vec3 or vec4 volume, respectively. The images are decoded in
+    parallel.)"_unindentHelp,
 
 };
 const ProcessorInfo& ImageStackVolumeSource::getProcessorInfo() const { return processorInfo_; }
@@ -126,6 +242,11 @@ ImageStackVolumeSource::ImageStackVolumeSource(InviwoApplication* app)
                             not considered. Otherwise an empty volume slice will be inserted
                             for each file.)"_unindentHelp,
                             false)
+    , loadOnDemand_("loadOnDemand", "Load on Demand",
+                    R"(If true, the images are only decoded once the volume data is used. Slices
+                    and subsets along z can then be extracted by only decoding the required
+                    images. Otherwise all images are decoded when loading.)"_unindentHelp,
+                    false)
     , basis_("Basis", "Basis and offset")
     , information_("Information", "Data information")
     , readerFactory_{util::getDataReaderFactory(app)} {
@@ -134,6 +255,7 @@ ImageStackVolumeSource::ImageStackVolumeSource(InviwoApplication* app)
     addProperty(filePattern_);
     addProperty(reload_);
     addProperty(skipUnsupportedFiles_);
+    addProperty(loadOnDemand_);
     addProperty(basis_);
     addProperty(information_);
 
@@ -153,7 +275,8 @@ void ImageStackVolumeSource::addFileNameFilters() {
 void ImageStackVolumeSource::process() {
     util::OnScopeExit guard{[&]() { outport_.setData(nullptr); }};
 
-    if (filePattern_.isModified() || reload_.isModified() || skipUnsupportedFiles_.isModified()) {
+    if (filePattern_.isModified() || reload_.isModified() || skipUnsupportedFiles_.isModified() ||
+        loadOnDemand_.isModified()) {
         volume_ = load();
         if (volume_) {
             basis_.updateForNewEntity(*volume_, deserialized_);
@@ -178,24 +301,23 @@ std::shared_ptr<Volume> ImageStackVolumeSource::load() {
         return nullptr;
     }
 
-    std::vector<std::pair<std::filesystem::path, std::unique_ptr<DataReaderType<Layer>>>> slices;
+    Slices slices;
     slices.reserve(files.size());
 
     std::transform(files.begin(), files.end(), std::back_inserter(slices),
-                   [&](const auto& file)
-                       -> std::pair<std::filesystem::path, std::unique_ptr<DataReaderType<Layer>>> {
-                       return {file, std::move(readerFactory_->getReaderForTypeAndExtension<Layer>(
-                                         filePattern_.getSelectedExtension(), file))};
+                   [&](const auto& file) -> Slices::value_type {
+                       return {file, readerFactory_->getReaderForTypeAndExtension<Layer>(
+                                         filePattern_.getSelectedExtension(), file)};
                    });
     if (skipUnsupportedFiles_) {
         slices.erase(std::remove_if(slices.begin(), slices.end(),
-                                    [](auto& elem) { return elem.second == nullptr; }),
+                                    [](auto& elem) { return !elem.second; }),
                      slices.end());
     }
 
     // identify first slice with a reader
-    const auto first = std::find_if(slices.begin(), slices.end(),
-                                    [](auto& item) { return item.second != nullptr; });
+    const auto first =
+        std::find_if(slices.begin(), slices.end(), [](auto& item) { return bool(item.second); });
     if (first == slices.end()) {  // could not find any suitable data reader for the images
         throw Exception(SourceContext{}, "No supported images found in '{}'",
                         filePattern_.getFilePatternPath());
@@ -218,83 +340,29 @@ std::shared_ptr<Volume> ImageStackVolumeSource::load() {
                                   refFormat->getPrecision());
     }
 
-    return referenceRAM->dispatch<std::shared_ptr<Volume>, FloatOrIntMax32>(
-        [&](auto refLayerPrecision) {
-            using ValueType = util::PrecisionValueType<decltype(refLayerPrecision)>;
-            using PrimitiveType = typename DataFormat<ValueType>::primitive;
-
-            const size2_t layerDims = refLayerPrecision->getDimensions();
-            const size_t sliceOffset = glm::compMul(layerDims);
-
-            // create matching volume representation
-            auto volumeRAM =
-                std::make_shared<VolumeRAMPrecision<ValueType>>(size3_t{layerDims, slices.size()});
-            auto volData = volumeRAM->getDataTyped();
-
-            const auto fill = [&](size_t s) {
-                std::fill(volData + s * sliceOffset, volData + (s + 1) * sliceOffset, ValueType{0});
-            };
-
-            const auto read = [&](const auto& file, auto* reader) -> std::shared_ptr<Layer> {
-                try {
-                    return reader->readData(file);
-                } catch (const DataReaderException& e) {
-                    log::warn("Could not load image: {}, {}", file, e.getMessage());
-                    return nullptr;
-                }
-            };
-
-            for (auto&& elem : util::enumerate(slices)) {
-                const auto slice = elem.first();
-                const auto file = elem.second().first;
-                auto* reader = elem.second().second.get();
-                if (!reader) {
-                    fill(slice);
-                    continue;
-                }
-
-                const auto layer = read(file, reader);
-                if (!layer) {
-                    fill(slice);
-                    continue;
-                }
-                const auto* layerRAM = layer->template getRepresentation<LayerRAM>();
-
-                const auto* format = layerRAM->getDataFormat();
-                if ((format->getNumericType() != NumericType::Float) &&
-                    (format->getPrecision() > 32)) {
-                    log::warn("Unsupported integer bit depth: {}, for image: {}",
-                              format->getPrecision(), file);
-                    fill(slice);
-                    continue;
-                }
-
-                if (layerRAM->getDimensions() != layerDims) {
-                    log::warn("Unexpected dimensions: {}, expected: {}, for image: {}",
-                              layer->getDimensions(), layerDims, file);
-                    fill(slice);
-                    continue;
-                }
-                layerRAM->template dispatch<void, FloatOrIntMax32>([&](auto layerpr) {
-                    const auto data = layerpr->getDataTyped();
-                    std::transform(
-                        data, data + sliceOffset, volData + slice * sliceOffset,
-                        [](auto value) { return util::glm_convert_normalized<ValueType>(value); });
-                });
-            }
+    const size3_t dims{referenceRAM->getDimensions(), slices.size()};
+    auto volumeDisk =
+        std::make_shared<VolumeDisk>(filePattern_.getFilePatternPath(), dims, refFormat);
+    volumeDisk->setLoader(new ImageStackVolumeRAMLoader(std::move(slices)));
+
+    std::shared_ptr<Volume> volume;
+    if (loadOnDemand_) {
+        volume = std::make_shared<Volume>(volumeDisk);
+    } else {
+        volume = std::make_shared<Volume>(
+            std::static_pointer_cast<VolumeRAM>(volumeDisk->createRepresentation()));
+    }
 
-            auto volume = std::make_shared<Volume>(volumeRAM);
-            volume->dataMap.dataRange =
-                dvec2{DataFormat<PrimitiveType>::lowest(), DataFormat<PrimitiveType>::max()};
-            volume->dataMap.valueRange =
-                dvec2{DataFormat<PrimitiveType>::lowest(), DataFormat<PrimitiveType>::max()};
+    const auto* primitive = DataFormatBase::get(refFormat->getNumericType(), 1,
+                                                refFormat->getPrecision());
+    volume->dataMap.dataRange = dvec2{primitive->getLowest(), primitive->getMax()};
+    volume->dataMap.valueRange = dvec2{primitive->getLowest(), primitive->getMax()};
 
-            const auto size = vec3(0.01f) * static_cast<vec3>(volumeRAM->getDimensions());
-            volume->setBasis(glm::diagonal3x3(size));
-            volume->setOffset(-0.5 * size);
+    const auto size = vec3(0.01f) * static_cast<vec3>(dims);
+    volume->setBasis(glm::diagonal3x3(size));
+    volume->setOffset(-0.5 * size);
 
-            return volume;
-        });
+    return volume;
 }
 
 void ImageStackVolumeSource::deserialize(Deserializer& d) {
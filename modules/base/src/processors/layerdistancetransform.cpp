@@ -48,7 +48,8 @@ const ProcessorInfo LayerDistanceTransform::processorInfo_{
     CodeState::Stable,                    // Code state
     Tags::CPU,                            // Tags
     R"(Computes the closest distance to a threshold value for each texel in a Layer. It uses
-    Saito's algorithm to compute the Euclidean distance.
+    the linear time algorithm of Felzenszwalb and Huttenlocher to compute the exact Euclidean
+    distance.
     Note: Only works correctly for Layers with an orthogonal basis.)"_unindentHelp,
 };
 
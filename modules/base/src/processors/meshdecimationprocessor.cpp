@@ -0,0 +1,131 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <modules/base/processors/meshdecimationprocessor.h>
+
+#include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/properties/constraintbehavior.h>
+#include <modules/base/algorithm/mesh/meshdecimation.h>
+
+#include <memory>
+#include <utility>
+
+namespace inviwo {
+
+const ProcessorInfo MeshDecimationProcessor::processorInfo_{
+    "org.inviwo.MeshDecimation",                     // Class identifier
+    "Mesh Decimation",                               // Display name
+    "Mesh Operation",                                // Category
+    CodeState::Experimental,                         // Code state
+    Tags::CPU | Tag{"Simplification"} | Tag{"LOD"},  // Tags
+    R"(Reduce the number of triangles of a mesh by collapsing edges in order of their quadric
+    error. Normals, colors, and texture coordinates are interpolated and taken into account in
+    the error. Optionally creates a sequence of levels of detail.
+    )"_unindentHelp,
+};
+const ProcessorInfo& MeshDecimationProcessor::getProcessorInfo() const { return processorInfo_; }
+
+MeshDecimationProcessor::MeshDecimationProcessor()
+    : PoolProcessor{}
+    , inport_{"inport", "Triangle mesh to decimate"_help}
+    , outport_{"outport", "The decimated mesh, with a single triangle index buffer"_help}
+    , levelsOutport_{"levels",
+                     "Levels of detail, from the input triangles to the coarsest level. Only "
+                     "computed when connected."_help}
+    , enabled_{"enabled", "Enable Operation", true}
+    , targetRatio_{"targetRatio", "Target Ratio",
+                   "Fraction of the triangles of the input mesh to keep"_help, 0.1f,
+                   {0.0f, ConstraintBehavior::Immutable}, {1.0f, ConstraintBehavior::Immutable}}
+    , maxError_{"maxError", "Max Error",
+                "Largest allowed change of the surface by a collapse, relative to the size of "
+                "the bounding box of the mesh"_help,
+                0.01f, {0.0f, ConstraintBehavior::Immutable}, {0.1f, ConstraintBehavior::Ignore}}
+    , attributeWeight_{"attributeWeight", "Attribute Weight",
+                       "Weight of the change of normals, colors, and texture coordinates "
+                       "relative to the geometric error"_help,
+                       0.01f, {0.0f, ConstraintBehavior::Immutable},
+                       {1.0f, ConstraintBehavior::Ignore}}
+    , boundaryWeight_{"boundaryWeight", "Boundary Weight",
+                      "Weight of keeping the boundary of open meshes in place"_help, 10.0f,
+                      {0.0f, ConstraintBehavior::Immutable}, {100.0f, ConstraintBehavior::Ignore}}
+    , levels_{"levels", "Levels of Detail"}
+    , levelCount_{"levelCount", "Levels", "Number of levels of detail, including the input"_help,
+                  4, {1, ConstraintBehavior::Immutable}, {10, ConstraintBehavior::Ignore}}
+    , levelRatio_{"levelRatio", "Level Ratio",
+                  "Fraction of the triangles of the previous level to keep in each level"_help,
+                  0.25f, {0.0f, ConstraintBehavior::Immutable},
+                  {1.0f, ConstraintBehavior::Immutable}} {
+
+    addPorts(inport_, outport_, levelsOutport_);
+
+    levels_.addProperties(levelCount_, levelRatio_);
+    addProperties(enabled_, targetRatio_, maxError_, attributeWeight_, boundaryWeight_, levels_);
+}
+
+void MeshDecimationProcessor::process() {
+    auto mesh = inport_.getData();
+
+    if (!enabled_) {
+        auto sequence = std::make_shared<DataSequence<Mesh>>();
+        sequence->push_back(mesh);
+        outport_.setData(mesh);
+        levelsOutport_.setData(sequence);
+        return;
+    }
+
+    const meshutil::MeshDecimationSettings settings{
+        .targetTriangles = 0,
+        .targetRatio = targetRatio_.get(),
+        .maxError = maxError_.get(),
+        .attributeWeight = attributeWeight_.get(),
+        .boundaryWeight = boundaryWeight_.get()};
+
+    outport_.clear();
+    levelsOutport_.clear();
+    dispatchOne(
+        [mesh, settings, levels = levelsOutport_.isConnected(), count = levelCount_.get(),
+         ratio = levelRatio_.get()](pool::Progress progress)
+            -> std::pair<std::shared_ptr<Mesh>, std::shared_ptr<DataSequence<Mesh>>> {
+            auto decimated = meshutil::decimate(
+                *mesh, settings, [&](float p) { progress(levels ? 0.5f * p : p); });
+            if (!levels) return {decimated, nullptr};
+
+            auto sequence = meshutil::decimateLevels(*mesh, count, ratio, settings,
+                                                     [&](float p) { progress(0.5f + 0.5f * p); });
+            return {decimated, sequence};
+        },
+        [this](std::pair<std::shared_ptr<Mesh>, std::shared_ptr<DataSequence<Mesh>>> result) {
+            outport_.setData(result.first);
+            if (result.second) levelsOutport_.setData(result.second);
+            newResults();
+        });
+}
+
+}  // namespace inviwo
@@ -0,0 +1,184 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <modules/base/processors/meshoptimizationprocessor.h>
+
+#include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/properties/constraintbehavior.h>
+#include <inviwo/core/properties/invalidationlevel.h>
+#include <inviwo/core/properties/propertysemantics.h>
+#include <modules/base/algorithm/mesh/meshoptimization.h>
+
+#include <memory>
+#include <utility>
+
+namespace inviwo {
+
+const ProcessorInfo MeshOptimizationProcessor::processorInfo_{
+    "org.inviwo.MeshOptimization",  // Class identifier
+    "Mesh Optimization",            // Display name
+    "Mesh Operation",               // Category
+    CodeState::Experimental,        // Code state
+    Tags::CPU | Tag{"Weld"},        // Tags
+    R"(Optimize a mesh for rendering. Welds duplicated vertices, removes degenerate triangles
+    and unused vertices, and reorders triangles and vertices for the vertex cache and for vertex
+    fetch. The number of vertices and triangles, and the average cache miss ratio (ACMR) before
+    and after are shown in the statistics.
+    )"_unindentHelp,
+};
+const ProcessorInfo& MeshOptimizationProcessor::getProcessorInfo() const { return processorInfo_; }
+
+MeshOptimizationProcessor::MeshOptimizationProcessor()
+    : PoolProcessor{}
+    , inport_{"inport", "Mesh to optimize"_help}
+    , outport_{"outport",
+               "The optimized mesh, triangles are converted to triangle lists"_help}
+    , enabled_{"enabled", "Enable Operation", true}
+    , weld_{"weld", "Weld Vertices", "Merge vertices with the same position"_help, true}
+    , weldTolerance_{"weldTolerance", "Weld Tolerance",
+                     "Largest distance between welded vertices, relative to the size of the "
+                     "bounding box of the mesh"_help,
+                     0.0f, {0.0f, ConstraintBehavior::Immutable},
+                     {0.01f, ConstraintBehavior::Ignore}}
+    , compareAttributes_{"compareAttributes", "Compare Attributes",
+                         "Only weld vertices with the same normals, colors, texture "
+                         "coordinates, and other attributes"_help,
+                         true}
+    , attributeTolerance_{"attributeTolerance", "Attribute Tolerance",
+                          "Largest difference of the attributes of welded vertices"_help, 0.0f,
+                          {0.0f, ConstraintBehavior::Immutable},
+                          {0.1f, ConstraintBehavior::Ignore}}
+    , removeDegenerate_{"removeDegenerate", "Remove Degenerate",
+                        "Remove triangles and line segments that use a vertex twice"_help, true}
+    , reorderTriangles_{"reorderTriangles", "Reorder Triangles",
+                        "Reorder the triangles to reduce vertex cache misses"_help, true}
+    , reorderVertices_{"reorderVertices", "Reorder Vertices",
+                       "Reorder the vertices in the order they are used"_help, true}
+    , cacheSize_{"cacheSize", "Cache Size", "Number of vertices in the vertex cache"_help, 16,
+                 {3, ConstraintBehavior::Immutable}, {64, ConstraintBehavior::Ignore}}
+    , statistics_{"statistics", "Statistics"}
+    , verticesBefore_{"verticesBefore", "Vertices Before",
+                      util::ordinalCount(size_t{0}, size_t{1000000})
+                          .set("Number of vertices of the input mesh"_help)
+                          .set(InvalidationLevel::Valid)
+                          .set(PropertySemantics::Text)
+                          .set(ReadOnly::Yes)}
+    , verticesAfter_{"verticesAfter", "Vertices After",
+                     util::ordinalCount(size_t{0}, size_t{1000000})
+                         .set("Number of vertices of the optimized mesh"_help)
+                         .set(InvalidationLevel::Valid)
+                         .set(PropertySemantics::Text)
+                         .set(ReadOnly::Yes)}
+    , trianglesBefore_{"trianglesBefore", "Triangles Before",
+                       util::ordinalCount(size_t{0}, size_t{1000000})
+                           .set("Number of triangles of the input mesh"_help)
+                           .set(InvalidationLevel::Valid)
+                           .set(PropertySemantics::Text)
+                           .set(ReadOnly::Yes)}
+    , trianglesAfter_{"trianglesAfter", "Triangles After",
+                      util::ordinalCount(size_t{0}, size_t{1000000})
+                          .set("Number of triangles of the optimized mesh"_help)
+                          .set(InvalidationLevel::Valid)
+                          .set(PropertySemantics::Text)
+                          .set(ReadOnly::Yes)}
+    , acmrBefore_{"acmrBefore", "ACMR Before",
+                  util::ordinalLength(0.0, 3.0)
+                      .set("Transformed vertices per triangle of the input mesh"_help)
+                      .set(InvalidationLevel::Valid)
+                      .set(PropertySemantics::Text)
+                      .set(ReadOnly::Yes)}
+    , acmrAfter_{"acmrAfter", "ACMR After",
+                 util::ordinalLength(0.0, 3.0)
+                     .set("Transformed vertices per triangle of the optimized mesh"_help)
+                     .set(InvalidationLevel::Valid)
+                     .set(PropertySemantics::Text)
+                     .set(ReadOnly::Yes)} {
+
+    addPorts(inport_, outport_);
+
+    weldTolerance_.visibilityDependsOn(weld_, [](const auto& p) { return p.get(); });
+    compareAttributes_.visibilityDependsOn(weld_, [](const auto& p) { return p.get(); });
+    attributeTolerance_.visibilityDependsOn(compareAttributes_,
+                                            [](const auto& p) { return p.get(); });
+
+    statistics_.addProperties(verticesBefore_, verticesAfter_, trianglesBefore_, trianglesAfter_,
+                              acmrBefore_, acmrAfter_);
+    statistics_.setCollapsed(true);
+    addProperties(enabled_, weld_, weldTolerance_, compareAttributes_, attributeTolerance_,
+                  removeDegenerate_, reorderTriangles_, reorderVertices_, cacheSize_,
+                  statistics_);
+}
+
+void MeshOptimizationProcessor::process() {
+    auto mesh = inport_.getData();
+
+    if (!enabled_) {
+        outport_.setData(mesh);
+        return;
+    }
+
+    const meshutil::MeshOptimizationSettings settings{
+        .weld = weld_.get(),
+        .weldTolerance = weldTolerance_.get(),
+        .attributeTolerance = compareAttributes_ ? attributeTolerance_.get() : -1.0,
+        .removeDegenerate = removeDegenerate_.get(),
+        .reorderTriangles = reorderTriangles_.get(),
+        .reorderVertices = reorderVertices_.get(),
+        .cacheSize = cacheSize_.get()};
+
+    struct Result {
+        std::shared_ptr<Mesh> mesh;
+        meshutil::MeshStatistics before;
+        meshutil::MeshStatistics after;
+    };
+
+    outport_.clear();
+    dispatchOne(
+        [mesh, settings](pool::Progress progress) -> Result {
+            auto before = meshutil::computeStatistics(*mesh, settings.cacheSize);
+            progress(0.1f);
+            auto optimized = meshutil::optimize(*mesh, settings);
+            progress(0.9f);
+            auto after = meshutil::computeStatistics(*optimized, settings.cacheSize);
+            return {optimized, before, after};
+        },
+        [this](Result result) {
+            outport_.setData(result.mesh);
+            verticesBefore_.set(result.before.vertices);
+            verticesAfter_.set(result.after.vertices);
+            trianglesBefore_.set(result.before.triangles);
+            trianglesAfter_.set(result.after.triangles);
+            acmrBefore_.set(result.before.acmr);
+            acmrAfter_.set(result.after.acmr);
+            newResults();
+        });
+}
+
+}  // namespace inviwo
@@ -58,7 +58,18 @@ VolumeDownsample::VolumeDownsample()
     , mode_{"mode", "Mode",
             OptionPropertyState<util::DownsamplingMode>{
                 .options = {{"strided", "Strided", util::DownsamplingMode::Strided},
-                            {"averaged", "Averaged", util::DownsamplingMode::Averaged}}}
+                            {"averaged", "Averaged", util::DownsamplingMode::Averaged},
+                            {"maximum", "Maximum", util::DownsamplingMode::Maximum},
+                            {"minimum", "Minimum", util::DownsamplingMode::Minimum},
+                            {"median", "Median", util::DownsamplingMode::Median},
+                            {"mode", "Mode (Labels)", util::DownsamplingMode::Mode}},
+                .help = R"(Reduction applied to each block of voxels:
+                    * __Strided__ take the first voxel of each block
+                    * __Averaged__ the mean of each block
+                    * __Maximum__/__Minimum__ the component-wise maximum/minimum of each block
+                    * __Median__ the component-wise (lower) median of each block
+                    * __Mode__ the most frequent value of each block, use this for label volumes
+                    )"_unindentHelp}
                 .setSelectedValue(util::DownsamplingMode::Averaged)}
     , uniform_{"uniform", "Uniform Subsampling",
                "If enabled, the value of the first stride will be used for all directions"_help,
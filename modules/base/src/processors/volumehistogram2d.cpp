@@ -41,7 +41,10 @@
 #include <inviwo/core/util/indexmapper.h>
 #include <inviwo/core/util/zip.h>
 
+#include <array>
 #include <ranges>
+#include <span>
+#include <vector>
 
 namespace inviwo {
 
@@ -53,7 +56,8 @@ const ProcessorInfo VolumeHistogram2D::processorInfo_{
     CodeState::Stable,               // Code state
     Tags::CPU | Tag{"Histogram"},    // Tags
     R"(Create a 2D Histogram from two volume channels. The resulting histogram is normalized with
-       respect to the maximum bin count or the custom data range, if set.)"_unindentHelp,
+       respect to the maximum bin count or the custom data range, if set. Optionally, only voxels
+       where a mask volume is non-zero are considered.)"_unindentHelp,
 };
 
 const ProcessorInfo& VolumeHistogram2D::getProcessorInfo() const { return processorInfo_; }
@@ -109,12 +113,27 @@ std::shared_ptr<Layer> createLayer(const Histogram2D& hist, dvec2 normalizationR
     return layer;
 }
 
+std::vector<unsigned char> createMask(const Volume& volume) {
+    const auto* vrep = volume.getRepresentation<VolumeRAM>();
+    return vrep->dispatch<std::vector<unsigned char>>([](const auto* vr) {
+        using ValueType = util::PrecisionValueType<decltype(vr)>;
+        const auto data = vr->getView();
+        std::vector<unsigned char> mask(data.size());
+        std::ranges::transform(data, mask.begin(), [](const ValueType& v) {
+            return static_cast<double>(util::glmcomp(v, 0)) != 0.0 ? 1 : 0;
+        });
+        return mask;
+    });
+}
+
 }  // namespace
 
 VolumeHistogram2D::VolumeHistogram2D()
     : Processor{}
     , inport1_{"inport1", "Volume 1"_help}
     , inport2_{"inport2", "Volume 2"_help}
+    , mask_{"mask", R"(Optional mask volume, only voxels where the first channel of the mask is
+                       non-zero are included in the histogram.)"_unindentHelp}
     , outport_{"outport", "Histogram Layer"_help}
     , histogramResolution_{"histogramResolution",
                            "Histogram Resolution. The actual resolution might deviate based on the "
@@ -124,6 +143,17 @@ VolumeHistogram2D::VolumeHistogram2D()
                                .set("Resolution of the resulting 2D histogram."_help)}
     , channel1_{"channel1", "Channel 1", enumeratedOptions(), 0}
     , channel2_{"channel2", "Channel 2", enumeratedOptions(), 1}
+    , binning_{"binning", "Binning",
+               OptionPropertyState<HistogramBinning>{
+                   .options = {{"linear", "Linear", HistogramBinning::Linear},
+                               {"log", "Logarithmic", HistogramBinning::Log}}}
+                   .setSelectedValue(HistogramBinning::Linear)
+                   .set(R"(Placement of the bins along the two data axes. `Linear` uses bins of
+equal size, `Logarithmic` places the bins evenly in `log(1 + 1000 * t)`, where `t` is the
+position of `x` relative to the data range, i.e. `t = (x - min) / (max - min)`. The latter gives
+a higher resolution for small values independent of the scale of the data. The axes of the
+resulting layer are then no longer linear. With `Linear`, the number of bins might be reduced
+for integer types to avoid binning artifacts.)"_unindentHelp)}
     , scaling_{"scaling", "Scaling",
                OptionPropertyState<Scaling>{.options = {{"linear", "Linear", Scaling::Linear},
                                                         {"log", "Logarithmic", Scaling::Log}}}
@@ -137,11 +167,25 @@ follows:
 
 where `max` refers to the maximum bin count or the upper limit of the custom data range, if set.
         )"_unindentHelp)}
-    , dataRange_{"dataRange", "Data Range"} {
+    , dataRange_{"dataRange", "Data Range"}
+    , covariance_{"covariance", "Covariance",
+                  util::ordinalSymmetricVector(0.0, 1.0)
+                      .set("Sample covariance of the two channels"_help)
+                      .set(InvalidationLevel::Valid)
+                      .set(PropertySemantics::Text)
+                      .set(ReadOnly::Yes)}
+    , correlation_{"correlation", "Correlation",
+                   util::ordinalSymmetricVector(0.0, 1.0)
+                       .set("Pearson correlation coefficient of the two channels"_help)
+                       .set(InvalidationLevel::Valid)
+                       .set(PropertySemantics::Text)
+                       .set(ReadOnly::Yes)} {
 
     inport2_.setOptional(true);
-    addPorts(inport1_, inport2_, outport_);
-    addProperties(histogramResolution_, channel1_, channel2_, scaling_, dataRange_);
+    mask_.setOptional(true);
+    addPorts(inport1_, inport2_, mask_, outport_);
+    addProperties(histogramResolution_, channel1_, channel2_, binning_, scaling_, dataRange_,
+                  covariance_, correlation_);
 }
 
 void VolumeHistogram2D::process() {
@@ -186,22 +230,18 @@ void VolumeHistogram2D::process() {
                         volume2->getDataFormat()->getComponents());
     }
 
+    std::vector<unsigned char> mask;
+    if (auto maskVolume = mask_.getData()) {
+        if (maskVolume->getDimensions() != volume1->getDimensions()) {
+            throw Exception(SourceContext{}, "Mask dimensions must match, got {} and {}",
+                            maskVolume->getDimensions(), volume1->getDimensions());
+        }
+        mask = createMask(*maskVolume);
+    }
+
     const auto* vrep1 = volume1->getRepresentation<VolumeRAM>();
     const auto* vrep2 = volume2->getRepresentation<VolumeRAM>();
-
-    auto [numbins1, effectiveRange1] =
-        dispatching::singleDispatch<std::pair<size_t, double>, dispatching::filter::All>(
-            vrep1->getDataFormatId(), [volume1, histSize]<typename T>() {
-                return util::detail::optimalBinCount<T>(volume1->dataMap, histSize.x);
-            });
-    auto [numbins2, effectiveRange2] =
-        dispatching::singleDispatch<std::pair<size_t, double>, dispatching::filter::All>(
-            vrep2->getDataFormatId(), [volume2, histSize]<typename U>() {
-                return util::detail::optimalBinCount<U>(volume2->dataMap, histSize.y);
-            });
-
-    const dvec2 effectiveRange{effectiveRange1, effectiveRange2};
-    const size2_t numbins{numbins1, numbins2};
+    const std::array<HistogramBinning, 2> binning{binning_.get(), binning_.get()};
 
     const auto hist = dispatching::doubleDispatch<Histogram2D, dispatching::filter::All,
                                                   dispatching::filter::All>(
@@ -209,10 +249,14 @@ void VolumeHistogram2D::process() {
             auto src1 = static_cast<const VolumeRAMPrecision<T1>*>(vrep1)->getView();
             auto src2 = static_cast<const VolumeRAMPrecision<T2>*>(vrep2)->getView();
 
-            return util::calculateHistogram2D<T1, T2>(src1, c1, volume1->dataMap, src2, c2,
-                                                      volume2->dataMap, numbins);
+            return util::calculateHistogram2D<T1, T2>(
+                src1, c1, volume1->dataMap, src2, c2, volume2->dataMap, histSize, binning,
+                std::span<const unsigned char>{mask});
         });
 
+    covariance_.set(hist.statistics.covariance);
+    correlation_.set(hist.statistics.correlation);
+
     const dvec2 range{0.0, hist.maxCount};
     dataRange_.setDataRange(range);
     dataRange_.setValueRange(dataRange_.getDataRange());
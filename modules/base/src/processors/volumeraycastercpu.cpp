@@ -0,0 +1,135 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/base/processors/volumeraycastercpu.h>
+
+#include <inviwo/core/algorithm/boundingbox.h>          // for boundingBox
+#include <inviwo/core/algorithm/markdown.h>             // for operator""_help, operator""_u...
+#include <inviwo/core/datastructures/volume/volume.h>   // for Volume
+#include <inviwo/core/processors/processorstate.h>      // for CodeState, CodeState::Experimental
+#include <inviwo/core/processors/processortags.h>       // for Tags, Tags::CPU
+#include <inviwo/core/properties/constraintbehavior.h>  // for ConstraintBehavior
+#include <inviwo/core/properties/invalidationlevel.h>   // for InvalidationLevel
+#include <inviwo/core/properties/propertysemantics.h>   // for PropertySemantics
+#include <inviwo/core/util/stringconversion.h>          // for toString
+
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace inviwo {
+
+const ProcessorInfo VolumeRaycasterCPU::processorInfo_{
+    "org.inviwo.VolumeRaycasterCPU",  // Class identifier
+    "Volume Raycaster CPU",           // Display name
+    "Volume Rendering",               // Category
+    CodeState::Experimental,          // Code state
+    Tags::CPU | Tag{"DVR"} | Tag{"Raycasting"},  // Tags
+    R"(Direct volume rendering on the CPU, for rendering without an OpenGL context, for example
+    when generating frames on machines without a GPU. The rays are cast directly from the camera,
+    no entry and exit points are needed. Sampling, classification, shading and compositing follow
+    the GL Volume Raycaster. The image is rendered in tiles in parallel on the thread pool, and
+    blocks of the volume that are transparent for the transfer function are skipped.)"_unindentHelp,
+};
+const ProcessorInfo& VolumeRaycasterCPU::getProcessorInfo() const { return processorInfo_; }
+
+VolumeRaycasterCPU::VolumeRaycasterCPU()
+    : Processor()
+    , volumePort_("volume", "input volume"_help)
+    , outport_("outport", "output image containing volume rendering of the input"_help)
+    , channel_("channel", "Render Channel",
+               "selects which channel of the input volume is rendered"_help,
+               std::vector<OptionPropertyIntOption>{{"Channel 1", "Channel 1", 0}}, size_t{0})
+    , tf_("transferFunction", "Transfer Function", &volumePort_)
+    , samplingRate_("samplingRate", "Sampling Rate", "Number of samples per voxel"_help, 2.0f,
+                    {1.0f, ConstraintBehavior::Immutable}, {20.0f, ConstraintBehavior::Editable})
+    , emptySpaceSkipping_("emptySpaceSkipping", "Empty Space Skipping",
+                          "Skip blocks of the volume where the transfer function is fully "
+                          "transparent. Does not change the result"_help,
+                          true)
+    , blockSize_("blockSize", "Block Size",
+                 "Size in voxels of the blocks used for empty space skipping"_help, 8,
+                 {2, ConstraintBehavior::Immutable}, {64, ConstraintBehavior::Editable})
+    , tileSize_("tileSize", "Tile Size",
+                "Size in pixels of the image tiles that are rendered in parallel"_help, 16,
+                {1, ConstraintBehavior::Immutable}, {256, ConstraintBehavior::Editable})
+    , camera_("camera", "Camera", util::boundingBox(volumePort_))
+    , trackball_(&camera_)
+    , lighting_("lighting", "Lighting", &camera_) {
+
+    addPort(volumePort_);
+    addPort(outport_);
+
+    channel_.setSerializationMode(PropertySerializationMode::All);
+
+    volumePort_.onChange([this]() {
+        if (volumePort_.hasData()) {
+            size_t channels = volumePort_.getData()->getDataFormat()->getComponents();
+
+            if (channels == channel_.size()) return;
+
+            std::vector<OptionPropertyIntOption> channelOptions;
+            for (size_t i = 0; i < channels; i++) {
+                channelOptions.emplace_back("Channel " + toString(i + 1),
+                                            "Channel " + toString(i + 1), static_cast<int>(i));
+            }
+            channel_.replaceOptions(channelOptions);
+            channel_.setCurrentStateAsDefault();
+        }
+    });
+
+    blockSize_.visibilityDependsOn(emptySpaceSkipping_,
+                                   [](const BoolProperty& p) { return p.get(); });
+
+    addProperties(channel_, tf_, samplingRate_, emptySpaceSkipping_, blockSize_, tileSize_,
+                  camera_, trackball_, lighting_);
+}
+
+void VolumeRaycasterCPU::process() {
+    const auto volume = volumePort_.getData();
+
+    if (volumePort_.isChanged() || channel_.isModified() || blockSize_.isModified()) {
+        grid_.reset();
+    }
+    if (emptySpaceSkipping_ && !grid_) {
+        grid_.emplace(*volume, static_cast<size_t>(channel_.get()), blockSize_.get());
+    }
+
+    const util::VolumeRaycastingSettings settings{
+        .channel = static_cast<size_t>(channel_.get()),
+        .samplingRate = samplingRate_.get(),
+        .tileSize = tileSize_.get(),
+    };
+
+    outport_.setData(util::volumeRaycast(*volume, tf_.get(), camera_.get(), lighting_.getState(),
+                                         outport_.getDimensions(), settings,
+                                         emptySpaceSkipping_ ? &*grid_ : nullptr));
+}
+
+}  // namespace inviwo
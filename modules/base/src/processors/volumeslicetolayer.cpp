@@ -34,6 +34,7 @@
 #include <inviwo/core/datastructures/image/layer.h>
 #include <inviwo/core/util/indexmapper.h>
 #include <inviwo/core/util/glm.h>
+#include <modules/base/algorithm/volume/volumeramsubset.h>
 
 #include <algorithm>
 
@@ -82,8 +83,8 @@ size2_t sliceDimensions(const size3_t volumeDims, CartesianCoordinateAxis axis)
     }
 }
 
-Wrapping2D getWrapping(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
-    const auto wrapping = v->getOwner()->getWrapping();
+Wrapping2D getWrapping(const Volume& v, CartesianCoordinateAxis axis) {
+    const auto wrapping = v.getWrapping();
     switch (axis) {
         default:
         case CartesianCoordinateAxis::X:
@@ -95,8 +96,8 @@ Wrapping2D getWrapping(const VolumeRepresentation* v, CartesianCoordinateAxis ax
     }
 }
 
-std::array<Axis, 2> getAxes(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
-    const auto axes = v->getOwner()->axes;
+std::array<Axis, 2> getAxes(const Volume& v, CartesianCoordinateAxis axis) {
+    const auto axes = v.axes;
     switch (axis) {
         default:
         case CartesianCoordinateAxis::X:
@@ -108,8 +109,8 @@ std::array<Axis, 2> getAxes(const VolumeRepresentation* v, CartesianCoordinateAx
     }
 }
 
-mat3 getBasis(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
-    const mat3 basis = v->getOwner()->getBasis();
+mat3 getBasis(const Volume& v, CartesianCoordinateAxis axis) {
+    const mat3 basis = v.getBasis();
     switch (axis) {
         default:
         case CartesianCoordinateAxis::X:
@@ -121,10 +122,10 @@ mat3 getBasis(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
     }
 }
 
-vec3 getOffset(const VolumeRepresentation* v, CartesianCoordinateAxis axis, size_t slice) {
-    const size3_t dims = v->getDimensions();
-    const vec3 offset = v->getOwner()->getOffset();
-    const mat3 basis = v->getOwner()->getBasis();
+vec3 getOffset(const Volume& v, CartesianCoordinateAxis axis, size_t slice) {
+    const size3_t dims = v.getDimensions();
+    const vec3 offset = v.getOffset();
+    const mat3 basis = v.getBasis();
     const vec3 t = vec3{static_cast<float>(slice)} / vec3{dims};
 
     switch (axis) {
@@ -138,9 +139,14 @@ vec3 getOffset(const VolumeRepresentation* v, CartesianCoordinateAxis axis, size
     }
 }
 
+/*
+ * Extract @p slice of @p volume from @p vrprecision, which holds the slices starting at
+ * @p firstSlice along z. This is either the full volume or only the requested z slice.
+ */
 template <typename T>
-std::shared_ptr<Layer> extractSlice(const VolumeRAMPrecision<T>* vrprecision,
-                                    CartesianCoordinateAxis axis, size_t slice) {
+std::shared_ptr<Layer> extractSlice(const VolumeRAMPrecision<T>* vrprecision, const Volume& volume,
+                                    CartesianCoordinateAxis axis, size_t slice,
+                                    size_t firstSlice = 0) {
     const T* voldata = vrprecision->getDataTyped();
     const auto& voldim = vrprecision->getDimensions();
 
@@ -151,14 +157,14 @@ std::shared_ptr<Layer> extractSlice(const VolumeRAMPrecision<T>* vrprecision,
                         .format = vrprecision->getDataFormat(),
                         .swizzleMask = vrprecision->getSwizzleMask(),
                         .interpolation = vrprecision->getInterpolation(),
-                        .wrapping = getWrapping(vrprecision, axis)});
+                        .wrapping = getWrapping(volume, axis)});
     auto layerdata = layerram->getDataTyped();
 
     auto layer = std::make_shared<Layer>(layerram);
-    layer->setBasis(getBasis(vrprecision, axis));
-    layer->setOffset(getOffset(vrprecision, axis, slice));
-    layer->dataMap = vrprecision->getOwner()->dataMap;
-    layer->axes = getAxes(vrprecision, axis);
+    layer->setBasis(getBasis(volume, axis));
+    layer->setOffset(getOffset(volume, axis, slice));
+    layer->dataMap = volume.dataMap;
+    layer->axes = getAxes(volume, axis);
 
     switch (axis) {
         case CartesianCoordinateAxis::X: {
@@ -187,7 +193,7 @@ std::shared_ptr<Layer> extractSlice(const VolumeRAMPrecision<T>* vrprecision,
             break;
         }
         case CartesianCoordinateAxis::Z: {
-            auto z = glm::clamp(slice, size_t{0}, voldim.z - 1);
+            auto z = glm::clamp(slice - firstSlice, size_t{0}, voldim.z - 1);
             const size_t dataSize = voldim.x * voldim.y;
             const size_t initialStartPos = z * voldim.x * voldim.y;
             std::copy(voldata + initialStartPos, voldata + initialStartPos + dataSize, layerdata);
@@ -227,12 +233,20 @@ void VolumeSliceToLayer::process() {
             break;
     }
 
-    auto layer =
-        vol->getRepresentation<VolumeRAM>()
-            ->dispatch<std::shared_ptr<Layer>, dispatching::filter::All>(
-                [&]<typename T>(const VolumeRAMPrecision<T>* vrprecision) {
-                    return extractSlice(vrprecision, sliceAlongAxis_, sliceNumber_.get() - 1);
-                });
+    const auto slice = sliceNumber_.get() - 1;
+
+    // Only read the requested slice of volumes that are still on disk
+    std::shared_ptr<VolumeRAM> sliceRAM;
+    if (sliceAlongAxis_.get() == CartesianCoordinateAxis::Z) {
+        sliceRAM = util::loadSlicesFromDisk(*vol, slice, slice + 1);
+    }
+    const VolumeRAM* vr = sliceRAM ? sliceRAM.get() : vol->getRepresentation<VolumeRAM>();
+    const size_t firstSlice = sliceRAM ? slice : 0;
+
+    auto layer = vr->dispatch<std::shared_ptr<Layer>, dispatching::filter::All>(
+        [&]<typename T>(const VolumeRAMPrecision<T>* vrprecision) {
+            return extractSlice(vrprecision, *vol, sliceAlongAxis_, slice, firstSlice);
+        });
     outport_.setData(layer);
 }
 
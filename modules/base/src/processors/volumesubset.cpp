@@ -46,7 +46,7 @@
 #include <inviwo/core/util/glmmat.h>                                    // for mat3
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t
 #include <inviwo/core/algorithm/markdown.h>                             // for operator""_help...
-#include <modules/base/algorithm/volume/volumeramsubset.h>              // for VolumeRAMSubSet
+#include <modules/base/algorithm/volume/volumeramsubset.h>              // for VolumeRAMSubSet, lo...
 
 #include <functional>     // for __base
 #include <memory>         // for shared_ptr, share...
@@ -117,17 +117,24 @@ VolumeSubset::~VolumeSubset() = default;
 
 void VolumeSubset::process() {
     if (enabled_.get()) {
-        const auto vol = inport_.getData()->getRepresentation<VolumeRAM>();
-        const size3_t inputDims = vol->getDimensions();
+        const auto input = inport_.getData();
+        const size3_t inputDims = input->getDimensions();
         const size3_t offset{
             glm::min(size3_t{rangeX_.get().x, rangeY_.get().x, rangeZ_.get().x}, inputDims)};
         const size3_t dim = size3_t{rangeX_.get().y, rangeY_.get().y, rangeZ_.get().y} - offset;
 
         if (dim == dims_) {
-            outport_.setData(inport_.getData());
+            outport_.setData(input);
         } else {
-            auto volume = std::make_shared<Volume>(*inport_.getData(), NoData{});
-            volume->addRepresentation(VolumeRAMSubSet::apply(vol, dim, offset));
+            auto volume = std::make_shared<Volume>(*input, NoData{});
+            // Only read the required slices of volumes that are still on disk
+            if (auto slices = util::loadSlicesFromDisk(*input, offset.z, offset.z + dim.z)) {
+                volume->addRepresentation(
+                    VolumeRAMSubSet::apply(slices.get(), dim, size3_t{offset.x, offset.y, 0}));
+            } else {
+                volume->addRepresentation(VolumeRAMSubSet::apply(
+                    input->getRepresentation<VolumeRAM>(), dim, offset));
+            }
 
             if (adjustBasisAndOffset_.get()) {
                 vec3 volOffset = inport_.getData()->getOffset();
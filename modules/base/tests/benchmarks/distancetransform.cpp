@@ -0,0 +1,238 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <modules/base/algorithm/volume/volumeramdistancetransform.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <warn/push>
+#include <warn/ignore/unused-function>
+
+using namespace inviwo;
+
+namespace {
+
+/*
+ * The previous implementation, Saito's algorithm with a windowed brute force search in the y and
+ * z passes, kept here as reference.
+ */
+void saitoDistanceTransform(const VolumeRAMPrecision<unsigned char>* inVolume,
+                            VolumeRAMPrecision<float>* outDistanceField) {
+    using int64 = glm::int64;
+    auto square = [](auto a) { return a * a; };
+
+    const auto* src = inVolume->getDataTyped();
+    auto* dst = outDistanceField->getDataTyped();
+
+    const i64vec3 dim{inVolume->getDimensions()};
+    const vec3 squareVoxelSize{1.0f};
+    const vec3 invSquareVoxelSize{1.0f};
+    const util::IndexMapper<3, int64> ind(dim);
+
+#ifdef IVW_USE_OPENMP
+#pragma omp parallel for
+#endif
+    for (int64 z = 0; z < dim.z; ++z) {
+        for (int64 y = 0; y < dim.y; ++y) {
+            float dist = static_cast<float>(dim.x);
+            for (int64 x = 0; x < dim.x; ++x) {
+                dist = src[ind(x, y, z)] > 127 ? 0.0f : dist + 1.0f;
+                dst[ind(x, y, z)] = squareVoxelSize.x * square(dist);
+            }
+            dist = static_cast<float>(dim.x);
+            for (int64 x = dim.x - 1; x >= 0; --x) {
+                dist = src[ind(x, y, z)] > 127 ? 0.0f : dist + 1.0f;
+                dst[ind(x, y, z)] = std::min(dst[ind(x, y, z)], squareVoxelSize.x * square(dist));
+            }
+        }
+    }
+
+    const auto scan = [&](int axis, int64 outer, int64 inner) {
+        const auto n = dim[axis];
+        const auto other = axis == 1 ? 2 : 1;
+#ifdef IVW_USE_OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<float> buff(n);
+#ifdef IVW_USE_OPENMP
+#pragma omp for
+#endif
+            for (int64 o = 0; o < outer; ++o) {
+                for (int64 x = 0; x < inner; ++x) {
+                    i64vec3 pos{x, 0, 0};
+                    pos[other] = o;
+                    for (int64 i = 0; i < n; ++i) {
+                        pos[axis] = i;
+                        buff[i] = dst[ind(pos)];
+                    }
+                    for (int64 i = 0; i < n; ++i) {
+                        auto d = buff[i];
+                        if (d != 0.0f) {
+                            const auto rMax =
+                                static_cast<int64>(std::sqrt(d * invSquareVoxelSize[axis])) + 1;
+                            const auto rStart = std::min(rMax, i - 1);
+                            const auto rEnd = std::min(rMax, n - i);
+                            for (int64 k = -rStart; k < rEnd; ++k) {
+                                const auto w = buff[i + k] + squareVoxelSize[axis] * square(k);
+                                if (w < d) d = w;
+                            }
+                        }
+                        pos[axis] = i;
+                        dst[ind(pos)] = d;
+                    }
+                }
+            }
+        }
+    };
+    scan(1, dim.z, dim.x);
+    scan(2, dim.y, dim.x);
+
+    const int64 size = dim.x * dim.y * dim.z;
+    for (int64 i = 0; i < size; ++i) {
+        dst[i] = std::sqrt(dst[i]);
+    }
+}
+
+std::unique_ptr<VolumeRAMPrecision<unsigned char>> makeFeatures(size_t size, double density) {
+    auto volume = std::make_unique<VolumeRAMPrecision<unsigned char>>(size3_t{size});
+    std::mt19937 rand(0);
+    std::bernoulli_distribution dist(density);
+    std::generate_n(volume->getDataTyped(), size * size * size,
+                    [&]() -> unsigned char { return dist(rand) ? 255 : 0; });
+    return volume;
+}
+
+mat3 basis(const VolumeRAM& volume) {
+    const vec3 dim{volume.getDimensions()};
+    return mat3{vec3{dim.x, 0.0f, 0.0f}, vec3{0.0f, dim.y, 0.0f}, vec3{0.0f, 0.0f, dim.z}};
+}
+
+}  // namespace
+
+static void SparseOld(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    auto src = makeFeatures(size, 1.0e-5);
+    VolumeRAMPrecision<float> dst(size3_t{size});
+
+    for (auto _ : state) {
+        saitoDistanceTransform(src.get(), &dst);
+        benchmark::ClobberMemory();
+    }
+    state.counters["Voxels"] = static_cast<double>(size * size * size);
+}
+
+static void SparseNew(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    auto src = makeFeatures(size, 1.0e-5);
+    VolumeRAMPrecision<float> dst(size3_t{size});
+
+    for (auto _ : state) {
+        util::volumeRAMDistanceTransform(src.get(), &dst, basis(*src), size3_t{1});
+        benchmark::ClobberMemory();
+    }
+    state.counters["Voxels"] = static_cast<double>(size * size * size);
+}
+
+static void DenseOld(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    auto src = makeFeatures(size, 0.05);
+    VolumeRAMPrecision<float> dst(size3_t{size});
+
+    for (auto _ : state) {
+        saitoDistanceTransform(src.get(), &dst);
+        benchmark::ClobberMemory();
+    }
+    state.counters["Voxels"] = static_cast<double>(size * size * size);
+}
+
+static void DenseNew(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    auto src = makeFeatures(size, 0.05);
+    VolumeRAMPrecision<float> dst(size3_t{size});
+
+    for (auto _ : state) {
+        util::volumeRAMDistanceTransform(src.get(), &dst, basis(*src), size3_t{1});
+        benchmark::ClobberMemory();
+    }
+    state.counters["Voxels"] = static_cast<double>(size * size * size);
+}
+
+static void FeatureTransform(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    auto src = makeFeatures(size, 1.0e-5);
+    VolumeRAMPrecision<float> dst(size3_t{size});
+    VolumeRAMPrecision<glm::i64> features(size3_t{size});
+
+    for (auto _ : state) {
+        util::volumeRAMDistanceTransform(
+            src.get(), &dst, &features, basis(*src), size3_t{1},
+            [](unsigned char v) { return v > 127; }, [](float d) { return std::sqrt(d); },
+            [](double) {}, util::DistanceType::Unsigned);
+        benchmark::ClobberMemory();
+    }
+    state.counters["Voxels"] = static_cast<double>(size * size * size);
+}
+
+BENCHMARK(SparseOld)->RangeMultiplier(2)->Range(32, 32 << 2)->Unit(benchmark::kMillisecond);
+BENCHMARK(SparseNew)->RangeMultiplier(2)->Range(32, 32 << 4)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(DenseOld)->RangeMultiplier(2)->Range(32, 32 << 3)->Unit(benchmark::kMillisecond);
+BENCHMARK(DenseNew)->RangeMultiplier(2)->Range(32, 32 << 4)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(FeatureTransform)->RangeMultiplier(2)->Range(32, 32 << 3)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // The new implementation runs on the Inviwo thread pool
+    InviwoApplication app("bm-distancetransform");
+    app.resizePool(std::thread::hardware_concurrency());
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
+
+#include <warn/pop>
@@ -0,0 +1,158 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <modules/base/algorithm/mesh/meshbvh.h>
+#include <modules/base/algorithm/meshutils.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <glm/geometric.hpp>
+
+using namespace inviwo;
+
+namespace {
+
+/*
+ * A torus with subdivisions^2 / 2 triangles
+ */
+std::shared_ptr<BasicMesh> makeTorus(int64_t subdivisions) {
+    return meshutil::torus(vec3{0.0f}, vec3{0.0f, 1.0f, 0.0f}, 1.0f, 0.3f,
+                           ivec2{static_cast<int>(subdivisions),
+                                 static_cast<int>(subdivisions / 4)});
+}
+
+/*
+ * Primary rays of a pinhole camera looking at the torus, row by row.
+ */
+std::vector<meshutil::MeshBVH::Ray> cameraRays(size_t size) {
+    const vec3 eye{0.0f, 2.0f, 3.0f};
+    const auto forward = glm::normalize(vec3{0.0f} - eye);
+    const auto right = glm::normalize(glm::cross(forward, vec3{0.0f, 1.0f, 0.0f}));
+    const auto up = glm::cross(right, forward);
+
+    std::vector<meshutil::MeshBVH::Ray> rays;
+    rays.reserve(size * size);
+    for (size_t y = 0; y < size; ++y) {
+        for (size_t x = 0; x < size; ++x) {
+            const auto u = 2.0f * (static_cast<float>(x) + 0.5f) / static_cast<float>(size) - 1.0f;
+            const auto v = 2.0f * (static_cast<float>(y) + 0.5f) / static_cast<float>(size) - 1.0f;
+            rays.push_back({.origin = eye, .direction = forward + 0.6f * (u * right + v * up)});
+        }
+    }
+    return rays;
+}
+
+std::vector<vec3> randomPoints(size_t count) {
+    std::mt19937 rng{0};
+    std::uniform_real_distribution<float> dist{-2.0f, 2.0f};
+    std::vector<vec3> points(count);
+    for (auto& point : points) point = vec3{dist(rng), dist(rng), dist(rng)};
+    return points;
+}
+
+}  // namespace
+
+static void Build(benchmark::State& state) {
+    const auto mesh = makeTorus(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meshutil::MeshBVH{*mesh});
+    }
+    state.counters["triangles"] = static_cast<double>(state.range(0) * state.range(0) / 2);
+}
+
+static void ClosestHit(benchmark::State& state) {
+    const meshutil::MeshBVH bvh{*makeTorus(state.range(0))};
+    const auto rays = cameraRays(256);
+    for (auto _ : state) {
+        for (const auto& ray : rays) {
+            benchmark::DoNotOptimize(bvh.closestHit(ray));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+static void ClosestHitPacket(benchmark::State& state) {
+    const meshutil::MeshBVH bvh{*makeTorus(state.range(0))};
+    const auto rays = cameraRays(256);
+    std::vector<std::optional<meshutil::MeshBVH::Hit>> hits(rays.size());
+    for (auto _ : state) {
+        bvh.closestHit(rays, hits);
+        benchmark::DoNotOptimize(hits.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+static void AnyHit(benchmark::State& state) {
+    const meshutil::MeshBVH bvh{*makeTorus(state.range(0))};
+    const auto rays = cameraRays(256);
+    for (auto _ : state) {
+        for (const auto& ray : rays) {
+            benchmark::DoNotOptimize(bvh.anyHit(ray));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+static void ClosestPoint(benchmark::State& state) {
+    const meshutil::MeshBVH bvh{*makeTorus(state.range(0))};
+    const auto points = randomPoints(10000);
+    for (auto _ : state) {
+        for (const auto& point : points) {
+            benchmark::DoNotOptimize(bvh.closestPoint(point));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+}
+
+BENCHMARK(Build)->RangeMultiplier(4)->Range(64, 2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(ClosestHit)->RangeMultiplier(4)->Range(64, 2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(ClosestHitPacket)->RangeMultiplier(4)->Range(64, 2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(AnyHit)->RangeMultiplier(4)->Range(64, 2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(ClosestPoint)->RangeMultiplier(4)->Range(64, 2048)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // The subtrees of the BVH are built on the Inviwo thread pool
+    InviwoApplication app("bm-meshbvh");
+    app.resizePool(std::thread::hardware_concurrency());
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
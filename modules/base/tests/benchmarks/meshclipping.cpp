@@ -0,0 +1,109 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/datastructures/geometry/plane.h>
+#include <modules/base/algorithm/mesh/meshclipping.h>
+#include <modules/base/algorithm/volume/marchingcubesopt.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+#include <glm/geometric.hpp>
+
+using namespace inviwo;
+
+namespace {
+
+/*
+ * An iso surface of a spherical volume with about 4 * size^2 triangles
+ */
+std::shared_ptr<Mesh> sphere(int64_t size) {
+    auto volume = std::shared_ptr<Volume>(
+        util::makeSphericalVolume(size3_t{static_cast<size_t>(size)}));
+    return util::marchingCubesOpt(volume, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+}
+
+size_t triangles(const Mesh& mesh) { return mesh.getIndices(0)->getSize() / 3; }
+
+/*
+ * A plane through the center of the sphere, in world space
+ */
+Plane centerPlane(const Mesh& mesh) {
+    const auto center = vec3{mesh.getCoordinateTransformer().getDataToWorldMatrix() *
+                             vec4{0.5f, 0.5f, 0.5f, 1.0f}};
+    return Plane{center, glm::normalize(vec3{1.0f, 0.5f, 0.25f})};
+}
+
+}  // namespace
+
+static void Clip(benchmark::State& state) {
+    const auto mesh = sphere(state.range(0));
+    const auto plane = centerPlane(*mesh);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meshutil::clipMeshAgainstPlane(*mesh, plane, false));
+    }
+    state.counters["Triangles"] = static_cast<double>(triangles(*mesh));
+    state.counters["TrianglesPerSecond"] = benchmark::Counter(
+        static_cast<double>(triangles(*mesh)), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+static void ClipAndCap(benchmark::State& state) {
+    const auto mesh = sphere(state.range(0));
+    const auto plane = centerPlane(*mesh);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(meshutil::clipMeshAgainstPlane(*mesh, plane, true));
+    }
+    state.counters["Triangles"] = static_cast<double>(triangles(*mesh));
+    state.counters["TrianglesPerSecond"] = benchmark::Counter(
+        static_cast<double>(triangles(*mesh)), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(Clip)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(ClipAndCap)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // The triangles are clipped on the Inviwo thread pool
+    InviwoApplication app("bm-meshclipping");
+    app.resizePool(std::thread::hardware_concurrency());
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
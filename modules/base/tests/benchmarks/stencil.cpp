@@ -0,0 +1,239 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/coordinatetransformer.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/templatesampler.h>
+#include <inviwo/core/util/volumeramutils.h>
+#include <inviwo/core/util/volumesampler.h>
+#include <modules/base/algorithm/stencil.h>
+#include <modules/base/algorithm/volume/volumecurl.h>
+#include <modules/base/algorithm/volume/volumedivergence.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+#include <modules/base/algorithm/volume/volumegradient.h>
+#include <modules/base/algorithm/volume/volumelaplacian.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <thread>
+
+#include <warn/push>
+#include <warn/ignore/unused-function>
+
+using namespace inviwo;
+
+namespace {
+
+/*
+ * The previous implementation of the gradient, central differences of world space samples taken
+ * with trilinear interpolation for every voxel, kept here as reference.
+ */
+std::shared_ptr<VolumeRAM> gradientOld(std::shared_ptr<const Volume> volume, int channel) {
+    auto res = std::make_shared<VolumeRAMPrecision<vec3>>(volume->getDimensions());
+    const auto m = volume->getCoordinateTransformer().getDataToWorldMatrix();
+
+    const auto a = m * vec4(0, 0, 0, 1);
+    const auto b = m * vec4(1.0f / vec3(volume->getDimensions() - size3_t(1)), 1);
+    const auto spacing = b - a;
+
+    const vec3 ox(spacing.x, 0, 0);
+    const vec3 oy(0, spacing.y, 0);
+    const vec3 oz(0, 0, spacing.z);
+
+    VolumeSampler sampler{volume, CoordinateSpace::World};
+
+    util::IndexMapper3D index(volume->getDimensions());
+    auto data = res->getDataTyped();
+
+    const dvec3 spacing2 = spacing * 2.0;
+    util::forEachVoxelParallel(volume->getDimensions(), [&](const size3_t& pos) {
+        const vec3 world{m * vec4(vec3(pos) / vec3(volume->getDimensions() - size3_t(1)), 1)};
+
+        data[index(pos)] = static_cast<vec3>(
+            dvec3{(sampler.sample(world + ox) - sampler.sample(world - ox))[channel],
+                  (sampler.sample(world + oy) - sampler.sample(world - oy))[channel],
+                  (sampler.sample(world + oz) - sampler.sample(world - oz))[channel]} /
+            spacing2);
+    });
+    return res;
+}
+
+/*
+ * The previous implementation of the divergence, serial, kept here as reference.
+ */
+std::shared_ptr<VolumeRAM> divergenceOld(const Volume& volume) {
+    auto res = std::make_shared<VolumeRAMPrecision<float>>(volume.getDimensions());
+    const auto m = volume.getCoordinateTransformer().getDataToWorldMatrix();
+
+    const auto a = m * vec4(0, 0, 0, 1);
+    const auto b = m * vec4(1.0f / vec3(volume.getDimensions() - size3_t(1)), 1);
+    const auto spacing = b - a;
+
+    const vec3 ox(spacing.x, 0, 0);
+    const vec3 oy(0, spacing.y, 0);
+    const vec3 oz(0, 0, spacing.z);
+
+    const TemplateVolumeSampler<vec3, vec3> sampler{volume, CoordinateSpace::World};
+
+    util::IndexMapper3D index(volume.getDimensions());
+    auto data = res->getDataTyped();
+
+    util::forEachVoxel(volume.getDimensions(), [&](const size3_t& pos) {
+        const vec3 world{m * vec4(vec3(pos) / vec3(volume.getDimensions() - size3_t(1)), 1)};
+
+        const vec3 Fx = (sampler.sample(world + ox) - sampler.sample(world - ox)) / spacing.x;
+        const vec3 Fy = (sampler.sample(world + oy) - sampler.sample(world - oy)) / spacing.y;
+        const vec3 Fz = (sampler.sample(world + oz) - sampler.sample(world - oz)) / spacing.z;
+
+        data[index(pos)] = 0.5f * (Fx.x + Fy.y + Fz.z);
+    });
+    return res;
+}
+
+std::shared_ptr<Volume> scalarField(size_t size) {
+    return util::makeRippleVolume<float>(size3_t{size});
+}
+
+std::shared_ptr<Volume> vectorField(size_t size) {
+    const auto center = vec3{static_cast<float>(size)} * 0.5f;
+    return util::generateVolume(size3_t{size}, mat3{1.0f}, [&](const size3_t& ind) {
+        const auto p = vec3{ind} - center;
+        return vec3{-p.y, p.x, std::sin(p.z)};
+    });
+}
+
+double voxels(size_t size) { return static_cast<double>(size * size * size); }
+
+}  // namespace
+
+static void GradientOld(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto volume = scalarField(size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gradientOld(volume, 0));
+    }
+    state.counters["Voxels"] = voxels(size);
+}
+
+static void GradientNew(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto volume = scalarField(size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(util::gradientVolume(volume, 0));
+    }
+    state.counters["Voxels"] = voxels(size);
+}
+
+static void DivergenceOld(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto volume = vectorField(size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(divergenceOld(*volume));
+    }
+    state.counters["Voxels"] = voxels(size);
+}
+
+static void DivergenceNew(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto volume = vectorField(size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(util::divergenceVolume(*volume));
+    }
+    state.counters["Voxels"] = voxels(size);
+}
+
+static void Curl(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto volume = vectorField(size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(util::curlVolume(*volume));
+    }
+    state.counters["Voxels"] = voxels(size);
+}
+
+static void Laplacian(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto volume = scalarField(size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            util::volumeLaplacian(volume, util::VolumeLaplacianPostProcessing::None, 1.0));
+    }
+    state.counters["Voxels"] = voxels(size);
+}
+
+/*
+ * The bare stencil, a 7-point box filter, without any of the transforms of the algorithms above
+ */
+static void Stencil(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const VolumeRAMPrecision<float> src(size3_t{size});
+    VolumeRAMPrecision<float> dst(size3_t{size});
+    for (auto _ : state) {
+        util::forEachStencil<1>(src, dst, [](const auto& n) {
+            return (n(0, 0, 0) + n(-1, 0, 0) + n(1, 0, 0) + n(0, -1, 0) + n(0, 1, 0) +
+                    n(0, 0, -1) + n(0, 0, 1)) /
+                   7.0f;
+        });
+        benchmark::ClobberMemory();
+    }
+    state.counters["Voxels"] = voxels(size);
+}
+
+BENCHMARK(GradientOld)->RangeMultiplier(2)->Range(64, 256)->Unit(benchmark::kMillisecond);
+BENCHMARK(GradientNew)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(DivergenceOld)->RangeMultiplier(2)->Range(64, 256)->Unit(benchmark::kMillisecond);
+BENCHMARK(DivergenceNew)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(Curl)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(Laplacian)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(Stencil)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // The stencils run on the Inviwo thread pool
+    InviwoApplication app("bm-stencil");
+    app.resizePool(std::thread::hardware_concurrency());
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
+
+#include <warn/pop>
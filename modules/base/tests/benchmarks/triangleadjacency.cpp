@@ -0,0 +1,121 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <modules/base/algorithm/mesh/triangleadjacency.h>
+#include <modules/base/algorithm/volume/marchingcubesopt.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace inviwo;
+
+namespace {
+
+/*
+ * An iso surface of a spherical volume with about 4 * size^2 triangles
+ */
+std::shared_ptr<Mesh> sphere(int64_t size) {
+    auto volume = std::shared_ptr<Volume>(
+        util::makeSphericalVolume(size3_t{static_cast<size_t>(size)}));
+    return util::marchingCubesOpt(volume, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+}
+
+}  // namespace
+
+/*
+ * The previous way of finding twins, by inserting all half edges into a map
+ */
+static void EdgeMap(benchmark::State& state) {
+    const auto mesh = sphere(state.range(0));
+    const meshutil::TriangleAdjacency adjacency{*mesh};
+    const auto count = static_cast<std::uint32_t>(adjacency.getNumberOfHalfEdges());
+
+    for (auto _ : state) {
+        std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> edgeMap;
+        for (std::uint32_t e = 0; e < count; ++e) {
+            edgeMap.try_emplace({adjacency.from(e), adjacency.to(e)}, e);
+        }
+        std::vector<std::uint32_t> twins(count, meshutil::TriangleAdjacency::noTwin);
+        for (std::uint32_t e = 0; e < count; ++e) {
+            if (auto it = edgeMap.find({adjacency.to(e), adjacency.from(e)});
+                it != edgeMap.end()) {
+                twins[e] = it->second;
+            }
+        }
+        benchmark::DoNotOptimize(twins.data());
+    }
+    state.counters["Triangles"] = static_cast<double>(adjacency.getNumberOfTriangles());
+}
+
+static void Adjacency(benchmark::State& state) {
+    const auto mesh = sphere(state.range(0));
+    size_t triangles = 0;
+    for (auto _ : state) {
+        const meshutil::TriangleAdjacency adjacency{*mesh};
+        triangles = adjacency.getNumberOfTriangles();
+        benchmark::DoNotOptimize(adjacency.getTwins().data());
+    }
+    state.counters["Triangles"] = static_cast<double>(triangles);
+}
+
+static void BoundaryLoops(benchmark::State& state) {
+    const auto mesh = sphere(state.range(0));
+    const meshutil::TriangleAdjacency adjacency{*mesh};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(adjacency.getBoundaryLoops());
+    }
+    state.counters["Triangles"] = static_cast<double>(adjacency.getNumberOfTriangles());
+}
+
+BENCHMARK(EdgeMap)->RangeMultiplier(2)->Range(32, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(Adjacency)->RangeMultiplier(2)->Range(32, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BoundaryLoops)->RangeMultiplier(2)->Range(32, 512)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // The half edges are matched on the Inviwo thread pool
+    InviwoApplication app("bm-triangleadjacency");
+    app.resizePool(std::thread::hardware_concurrency());
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <modules/base/algorithm/volume/volumeramdownsample.h>
+#include <modules/base/algorithm/volume/volumeramsubset.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <thread>
+
+#include <warn/push>
+#include <warn/ignore/unused-function>
+
+using namespace inviwo;
+
+namespace {
+
+/*
+ * The previous single threaded implementation of the averaged downsampling, kept as reference.
+ */
+std::shared_ptr<VolumeRAM> averagedDownsampleOld(const VolumeRAMPrecision<unsigned char>* srcVol,
+                                                 size3_t strides) {
+    const size3_t srcDims{srcVol->getDimensions()};
+    const size3_t destDims{srcDims / strides};
+
+    auto destVol = std::make_shared<VolumeRAMPrecision<unsigned char>>(destDims);
+
+    const auto src = srcVol->getDataTyped();
+    auto dst = destVol->getDataTyped();
+
+    const util::IndexMapper3D sourceMapper(srcDims);
+    const util::IndexMapper3D destMapper(destDims);
+    const double samplesInv = 1.0 / static_cast<double>(glm::compMul(strides));
+
+    for (size_t z = 0; z < destDims.z; ++z) {
+        for (size_t y = 0; y < destDims.y; ++y) {
+            for (size_t x = 0; x < destDims.x; ++x) {
+                double val{0.0};
+                for (size_t oz = 0; oz < strides.z; ++oz) {
+                    for (size_t oy = 0; oy < strides.y; ++oy) {
+                        for (size_t ox = 0; ox < strides.x; ++ox) {
+                            val += static_cast<double>(src[sourceMapper(
+                                x * strides.x + ox, y * strides.y + oy, z * strides.z + oz)]);
+                        }
+                    }
+                }
+                dst[destMapper(x, y, z)] = static_cast<unsigned char>(val * samplesInv);
+            }
+        }
+    }
+    return destVol;
+}
+
+std::unique_ptr<VolumeRAMPrecision<unsigned char>> makeLabels(size_t size) {
+    auto volume = std::make_unique<VolumeRAMPrecision<unsigned char>>(size3_t{size});
+    std::mt19937 rand(0);
+    std::uniform_int_distribution<int> dist(0, 15);
+    auto* data = volume->getDataTyped();
+    for (size_t i = 0; i < size * size * size; ++i) {
+        data[i] = static_cast<unsigned char>(dist(rand));
+    }
+    return volume;
+}
+
+}  // namespace
+
+static void AveragedOld(benchmark::State& state) {
+    auto volume = makeLabels(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(averagedDownsampleOld(volume.get(), size3_t{2}));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(0) *
+                            state.range(0));
+}
+
+static void Downsample(benchmark::State& state) {
+    auto volume = makeLabels(static_cast<size_t>(state.range(0)));
+    const auto mode = static_cast<util::DownsamplingMode>(state.range(1));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(util::volumeDownsample(volume.get(), size3_t{2}, mode));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(0) *
+                            state.range(0));
+}
+
+static void SubSet(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    auto volume = makeLabels(size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            VolumeRAMSubSet::apply(volume.get(), size3_t{size / 2}, size3_t{size / 4}));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(0) *
+                            state.range(0) / 8);
+}
+
+BENCHMARK(AveragedOld)->RangeMultiplier(2)->Range(512, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(Downsample)
+    ->ArgsProduct({benchmark::CreateRange(512, 2048, 2),
+                   {static_cast<int>(util::DownsamplingMode::Strided),
+                    static_cast<int>(util::DownsamplingMode::Averaged),
+                    static_cast<int>(util::DownsamplingMode::Maximum),
+                    static_cast<int>(util::DownsamplingMode::Median),
+                    static_cast<int>(util::DownsamplingMode::Mode)}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(SubSet)->RangeMultiplier(2)->Range(512, 2048)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // The downsampling runs on the Inviwo thread pool
+    InviwoApplication app("bm-volumedownsample");
+    app.resizePool(std::thread::hardware_concurrency());
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
+
+#include <warn/pop>
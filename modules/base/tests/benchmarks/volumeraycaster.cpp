@@ -0,0 +1,125 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/camera/perspectivecamera.h>
+#include <inviwo/core/datastructures/transferfunction.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <modules/base/algorithm/volume/volumeraycasting.h>
+
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <thread>
+
+using namespace inviwo;
+
+namespace {
+
+/*
+ * A sphere distance field, with a transfer function that only maps the inner half of the
+ * sphere, leaving most of the volume as empty space.
+ */
+std::shared_ptr<Volume> makeSphere(size_t size) {
+    const size3_t dim{size};
+    auto ram = std::make_shared<VolumeRAMPrecision<unsigned char>>(dim);
+    const util::IndexMapper3D index(dim);
+    auto* data = ram->getDataTyped();
+    const vec3 center = vec3{dim - size_t{1}} * 0.5f;
+    for (size_t i = 0; i < glm::compMul(dim); ++i) {
+        const auto d = glm::length((vec3{index(i)} - center) / center);
+        data[i] = static_cast<unsigned char>(255.0f * std::max(0.0f, 1.0f - d));
+    }
+    auto volume = std::make_shared<Volume>(ram);
+    volume->setBasis(mat3{1.0f});
+    volume->setOffset(vec3{-0.5f});
+    volume->dataMap.dataRange = dvec2{0.0, 255.0};
+    volume->dataMap.valueRange = dvec2{0.0, 255.0};
+    return volume;
+}
+
+const TransferFunction tf{{{0.0, vec4{0.0f}},
+                           {0.5, vec4{0.0f}},
+                           {0.6, vec4{1.0f, 0.0f, 0.0f, 0.1f}},
+                           {1.0, vec4{1.0f, 1.0f, 0.0f, 0.5f}}}};
+
+const LightingState lighting{ShadingMode::BlinnPhong, vec3{0.0f, 0.0f, 5.0f}, vec3{0.2f},
+                             vec3{0.7f}, vec3{0.3f}, 60.0f};
+
+}  // namespace
+
+static void Raycast(benchmark::State& state) {
+    const auto volume = makeSphere(static_cast<size_t>(state.range(0)));
+    const size2_t dimensions{static_cast<size_t>(state.range(1))};
+    const bool skipping = state.range(2) != 0;
+    const PerspectiveCamera camera{vec3{1.2f, 0.8f, 1.6f}};
+
+    std::optional<util::MinMaxBlockGrid> grid;
+    if (skipping) grid.emplace(*volume, 0);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(util::volumeRaycast(*volume, tf, camera, lighting, dimensions,
+                                                     {}, grid ? &*grid : nullptr));
+    }
+    state.counters["fps"] =
+        benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+static void MinMaxGrid(benchmark::State& state) {
+    const auto volume = makeSphere(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(util::MinMaxBlockGrid{*volume, 0});
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(0) *
+                            state.range(0));
+}
+
+BENCHMARK(Raycast)
+    ->ArgsProduct({{128, 256}, {512, 1024}, {0, 1}})
+    ->ArgNames({"volume", "image", "skipping"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(MinMaxGrid)->RangeMultiplier(2)->Range(128, 512)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // The raycaster renders tiles on the Inviwo thread pool
+    InviwoApplication app("bm-volumeraycaster");
+    app.resizePool(std::thread::hardware_concurrency());
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
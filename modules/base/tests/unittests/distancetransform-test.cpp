@@ -0,0 +1,189 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/algorithm/image/layerramdistancetransform.h>
+#include <modules/base/algorithm/volume/volumeramdistancetransform.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace inviwo {
+
+namespace {
+
+template <typename T>
+std::vector<double> bruteForce(const std::vector<T>& features, const size3_t& dim,
+                               const dvec3& voxelSize, bool feature) {
+    const util::IndexMapper3D index(dim);
+    std::vector<double> result(features.size());
+    for (size_t i = 0; i < features.size(); ++i) {
+        const auto p = dvec3{index(i)};
+        double minDist = std::numeric_limits<double>::max();
+        for (size_t j = 0; j < features.size(); ++j) {
+            if ((features[j] != 0) != feature) continue;
+            minDist = std::min(minDist, glm::length((p - dvec3{index(j)}) * voxelSize));
+        }
+        result[i] = minDist;
+    }
+    return result;
+}
+
+std::vector<unsigned char> randomFeatures(size_t size, double density, unsigned int seed) {
+    std::mt19937 rand(seed);
+    std::bernoulli_distribution dist(density);
+    std::vector<unsigned char> features(size);
+    for (auto& f : features) f = dist(rand) ? 255 : 0;
+    return features;
+}
+
+}  // namespace
+
+TEST(DistanceTransform, VolumeMatchesBruteForce) {
+    const size3_t dim{13, 7, 9};
+    const mat3 basis{vec3{13.0f, 0.0f, 0.0f}, vec3{0.0f, 14.0f, 0.0f}, vec3{0.0f, 0.0f, 4.5f}};
+    const dvec3 voxelSize{1.0, 2.0, 0.5};
+
+    VolumeRAMPrecision<unsigned char> volume(dim);
+    const auto features = randomFeatures(glm::compMul(dim), 0.02, 1);
+    std::copy(features.begin(), features.end(), volume.getDataTyped());
+
+    VolumeRAMPrecision<float> distance(dim);
+    util::volumeRAMDistanceTransform(&volume, &distance, basis, size3_t{1});
+
+    const auto expected = bruteForce(features, dim, voxelSize, true);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(expected[i], distance.getDataTyped()[i], 1.0e-4) << "at index " << i;
+    }
+}
+
+TEST(DistanceTransform, VolumeFeatureTransform) {
+    const size3_t dim{10, 12, 8};
+    const mat3 basis{vec3{10.0f, 0.0f, 0.0f}, vec3{0.0f, 12.0f, 0.0f}, vec3{0.0f, 0.0f, 8.0f}};
+
+    VolumeRAMPrecision<unsigned char> volume(dim);
+    const auto features = randomFeatures(glm::compMul(dim), 0.01, 2);
+    std::copy(features.begin(), features.end(), volume.getDataTyped());
+
+    VolumeRAMPrecision<float> distance(dim);
+    VolumeRAMPrecision<glm::i64> closest(dim);
+    util::volumeRAMDistanceTransform(
+        &volume, &distance, &closest, basis, size3_t{1},
+        [](unsigned char v) { return v != 0; }, [](float d) { return std::sqrt(d); },
+        [](double) {}, util::DistanceType::Unsigned);
+
+    const util::IndexMapper3D index(dim);
+    for (size_t i = 0; i < features.size(); ++i) {
+        const auto feature = closest.getDataTyped()[i];
+        ASSERT_GE(feature, 0);
+        EXPECT_NE(features[feature], 0);
+        EXPECT_NEAR(glm::length(vec3{index(i)} - vec3{index(static_cast<size_t>(feature))}),
+                    distance.getDataTyped()[i], 1.0e-4);
+    }
+}
+
+TEST(DistanceTransform, VolumeNoFeatures) {
+    const size3_t dim{4, 5, 6};
+    const mat3 basis{vec3{4.0f, 0.0f, 0.0f}, vec3{0.0f, 5.0f, 0.0f}, vec3{0.0f, 0.0f, 6.0f}};
+
+    VolumeRAMPrecision<unsigned char> volume(dim);
+    std::fill_n(volume.getDataTyped(), glm::compMul(dim), 0);
+
+    VolumeRAMPrecision<float> distance(dim);
+    VolumeRAMPrecision<glm::i64> closest(dim);
+    util::volumeRAMDistanceTransform(
+        &volume, &distance, &closest, basis, size3_t{1},
+        [](unsigned char v) { return v != 0; }, [](float d) { return d; }, [](double) {},
+        util::DistanceType::Unsigned);
+
+    for (size_t i = 0; i < glm::compMul(dim); ++i) {
+        EXPECT_EQ(closest.getDataTyped()[i], -1);
+        EXPECT_FLOAT_EQ(distance.getDataTyped()[i], 16.0f + 25.0f + 36.0f);
+    }
+}
+
+TEST(DistanceTransform, LayerSignedMatchesBruteForce) {
+    const size2_t dim{17, 11};
+    const mat3 basis{vec3{17.0f, 0.0f, 0.0f}, vec3{0.0f, 11.0f, 0.0f}, vec3{0.0f, 0.0f, 1.0f}};
+
+    LayerRAMPrecision<unsigned char> layer(dim);
+    const auto features = randomFeatures(glm::compMul(dim), 0.3, 3);
+    std::copy(features.begin(), features.end(), layer.getDataTyped());
+
+    LayerRAMPrecision<float> distance(dim);
+    util::layerRAMDistanceTransform(
+        &layer, &distance, nullptr, basis, size2_t{1}, [](unsigned char v) { return v != 0; },
+        [](float d) { return std::sqrt(d); }, [](double) {}, util::DistanceType::Signed);
+
+    const size3_t dim3{dim, 1};
+    const auto outside = bruteForce(features, dim3, dvec3{1.0}, true);
+    const auto inside = bruteForce(features, dim3, dvec3{1.0}, false);
+    for (size_t i = 0; i < features.size(); ++i) {
+        const auto expected = features[i] != 0 ? -inside[i] : outside[i];
+        EXPECT_NEAR(expected, distance.getDataTyped()[i], 1.0e-4) << "at index " << i;
+    }
+}
+
+TEST(DistanceTransform, LayerUpsampled) {
+    const size2_t dim{5, 4};
+    const size2_t upsample{3, 2};
+    const mat3 basis{vec3{5.0f, 0.0f, 0.0f}, vec3{0.0f, 4.0f, 0.0f}, vec3{0.0f, 0.0f, 1.0f}};
+
+    LayerRAMPrecision<unsigned char> layer(dim);
+    const auto features = randomFeatures(glm::compMul(dim), 0.2, 4);
+    std::copy(features.begin(), features.end(), layer.getDataTyped());
+
+    const auto dstDim = dim * upsample;
+    LayerRAMPrecision<float> distance(dstDim);
+    util::layerRAMDistanceTransform(&layer, &distance, basis, upsample);
+
+    std::vector<unsigned char> upsampled(glm::compMul(dstDim));
+    const util::IndexMapper2D srcIndex(dim);
+    const util::IndexMapper2D dstIndex(dstDim);
+    for (size_t i = 0; i < upsampled.size(); ++i) {
+        upsampled[i] = features[srcIndex(dstIndex(i) / upsample)];
+    }
+    const auto expected = bruteForce(upsampled, size3_t{dstDim, 1},
+                                     dvec3{dvec2{1.0} / dvec2{upsample}, 1.0}, true);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(expected[i], distance.getDataTyped()[i], 1.0e-4) << "at index " << i;
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,189 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/mesh/meshbvh.h>
+
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/util/exception.h>
+#include <modules/base/algorithm/meshutils.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+/*
+ * A BVH with all triangles in a single leaf, i.e. brute force intersection of all triangles.
+ */
+meshutil::MeshBVH bruteForce(const meshutil::MeshBVH& bvh) {
+    return meshutil::MeshBVH{
+        bvh.getPositions(), bvh.getTriangles(),
+        meshutil::MeshBVHSettings{.maxLeafSize = bvh.getTriangles().size(),
+                                  .traversalCost = std::numeric_limits<float>::infinity()}};
+}
+
+}  // namespace
+
+TEST(MeshBVH, SingleTriangle) {
+    const meshutil::MeshBVH bvh{std::vector<vec3>{vec3{0, 0, 0}, vec3{1, 0, 0}, vec3{0, 1, 0}},
+                                std::vector<uvec3>{uvec3{0, 1, 2}}};
+
+    const auto hit =
+        bvh.closestHit({.origin = vec3{0.25f, 0.5f, 1.0f}, .direction = vec3{0, 0, -1}});
+    ASSERT_TRUE(hit);
+    EXPECT_FLOAT_EQ(hit->t, 1.0f);
+    EXPECT_FLOAT_EQ(hit->barycentric.x, 0.25f);
+    EXPECT_FLOAT_EQ(hit->barycentric.y, 0.5f);
+    EXPECT_EQ(hit->triangle, 0);
+
+    EXPECT_FALSE(bvh.closestHit({.origin = vec3{0.75f, 0.75f, 1.0f}, .direction = vec3{0, 0, -1}}));
+    EXPECT_FALSE(bvh.closestHit(
+        {.origin = vec3{0.25f, 0.25f, 1.0f}, .direction = vec3{0, 0, -1}, .tMax = 0.5f}));
+    EXPECT_TRUE(bvh.anyHit({.origin = vec3{0.25f, 0.25f, -1.0f}, .direction = vec3{0, 0, 1}}));
+    EXPECT_FALSE(bvh.anyHit({.origin = vec3{0.25f, 0.25f, -1.0f}, .direction = vec3{0, 0, -1}}));
+
+    const auto closest = bvh.closestPoint(vec3{2.0f, 0.0f, 1.0f});
+    ASSERT_TRUE(closest);
+    EXPECT_FLOAT_EQ(closest->point.x, 1.0f);
+    EXPECT_FLOAT_EQ(closest->point.z, 0.0f);
+    EXPECT_FLOAT_EQ(closest->distance, std::sqrt(2.0f));
+    EXPECT_FALSE(bvh.closestPoint(vec3{2.0f, 0.0f, 1.0f}, 1.0f));
+}
+
+TEST(MeshBVH, Empty) {
+    const meshutil::MeshBVH bvh{std::vector<vec3>{}, std::vector<uvec3>{}};
+    EXPECT_TRUE(bvh.getNodes().empty());
+    EXPECT_FALSE(bvh.closestHit({.origin = vec3{0}, .direction = vec3{1, 0, 0}}));
+    EXPECT_FALSE(bvh.anyHit({.origin = vec3{0}, .direction = vec3{1, 0, 0}}));
+    EXPECT_FALSE(bvh.closestPoint(vec3{0}));
+}
+
+TEST(MeshBVH, InvalidIndex) {
+    EXPECT_THROW(
+        (meshutil::MeshBVH{std::vector<vec3>{vec3{0}}, std::vector<uvec3>{uvec3{0, 1, 2}}}),
+        Exception);
+}
+
+TEST(MeshBVH, MatchesBruteForce) {
+    const auto mesh = meshutil::torus(vec3{0}, vec3{0, 1, 0}, 1.0f, 0.3f, ivec2{64, 16});
+    const meshutil::MeshBVH bvh{*mesh};
+    ASSERT_EQ(bvh.getTriangles().size(), 64 * 16 * 2);
+    const auto reference = bruteForce(bvh);
+
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<float> dist{-1.5f, 1.5f};
+    std::vector<meshutil::MeshBVH::Ray> rays;
+    for (int i = 0; i < 500; ++i) {
+        const vec3 origin{dist(rng), dist(rng), 3.0f};
+        const vec3 target{dist(rng), dist(rng), dist(rng)};
+        rays.push_back({.origin = origin, .direction = target - origin});
+    }
+
+    std::vector<std::optional<meshutil::MeshBVH::Hit>> packetHits(rays.size());
+    bvh.closestHit(rays, packetHits);
+
+    for (size_t i = 0; i < rays.size(); ++i) {
+        const auto hit = bvh.closestHit(rays[i]);
+        const auto expected = reference.closestHit(rays[i]);
+        ASSERT_EQ(hit.has_value(), expected.has_value()) << "ray " << i;
+        ASSERT_EQ(packetHits[i].has_value(), expected.has_value()) << "ray " << i;
+        EXPECT_EQ(bvh.anyHit(rays[i]), expected.has_value()) << "ray " << i;
+        if (expected) {
+            EXPECT_FLOAT_EQ(hit->t, expected->t) << "ray " << i;
+            EXPECT_FLOAT_EQ(packetHits[i]->t, expected->t) << "ray " << i;
+        }
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        const vec3 point{dist(rng), dist(rng), dist(rng)};
+        const auto closest = bvh.closestPoint(point);
+        const auto expected = reference.closestPoint(point);
+        ASSERT_TRUE(closest && expected);
+        EXPECT_FLOAT_EQ(closest->distance, expected->distance);
+    }
+}
+
+TEST(MeshBVH, Cache) {
+    std::shared_ptr<const Mesh> mesh =
+        meshutil::torus(vec3{0}, vec3{0, 1, 0}, 1.0f, 0.3f, ivec2{16, 8});
+    const auto bvh = meshutil::getBVH(mesh);
+    ASSERT_TRUE(bvh);
+    EXPECT_EQ(bvh, meshutil::getBVH(mesh));
+
+    std::shared_ptr<const Mesh> other =
+        meshutil::torus(vec3{0}, vec3{0, 1, 0}, 1.0f, 0.3f, ivec2{16, 8});
+    EXPECT_NE(bvh, meshutil::getBVH(other));
+}
+
+TEST(MeshBVH, CacheAliasing) {
+    struct Pair {
+        Mesh first;
+        Mesh second;
+    };
+    auto pair = std::make_shared<Pair>(
+        Pair{*meshutil::torus(vec3{0}, vec3{0, 1, 0}, 1.0f, 0.3f, ivec2{16, 8}),
+             *meshutil::torus(vec3{0}, vec3{0, 1, 0}, 2.0f, 0.3f, ivec2{16, 8})});
+    const std::shared_ptr<const Mesh> first{pair, &pair->first};
+    const std::shared_ptr<const Mesh> second{pair, &pair->second};
+
+    const auto firstBVH = meshutil::getBVH(first);
+    const auto secondBVH = meshutil::getBVH(second);
+    ASSERT_TRUE(firstBVH && secondBVH);
+    EXPECT_NE(firstBVH, secondBVH);
+    EXPECT_NE(firstBVH->getBounds(), secondBVH->getBounds());
+}
+
+TEST(MeshBVH, CacheModifiedMesh) {
+    auto mesh = meshutil::torus(vec3{0}, vec3{0, 1, 0}, 1.0f, 0.3f, ivec2{16, 8});
+    const auto bvh = meshutil::getBVH(mesh);
+    ASSERT_TRUE(bvh);
+
+    auto* positions = mesh->findBuffer(BufferType::PositionAttrib).first;
+    ASSERT_TRUE(positions);
+    positions->getEditableRepresentation<BufferRAM>()->setFromDVec3(0, dvec3{10.0, 0.0, 0.0});
+
+    const auto rebuilt = meshutil::getBVH(mesh);
+    ASSERT_TRUE(rebuilt);
+    EXPECT_NE(bvh, rebuilt);
+    EXPECT_FLOAT_EQ(rebuilt->getBounds().second.x, 10.0f);
+    EXPECT_EQ(rebuilt, meshutil::getBVH(mesh));
+}
+
+}  // namespace inviwo
@@ -40,10 +40,53 @@
 #include <inviwo/core/datastructures/geometry/plane.h>
 #include <modules/base/algorithm/meshutils.h>
 
+#include <array>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <glm/geometric.hpp>
 #include <glm/gtx/perpendicular.hpp>
 
 namespace inviwo {
 
+namespace {
+
+template <typename T>
+const std::vector<T>& getData(const Mesh& mesh, BufferType type) {
+    const auto* buffer = static_cast<const Buffer<T>*>(mesh.findBuffer(type).first);
+    return buffer->getRAMRepresentation()->getDataContainer();
+}
+
+/*
+ * Check that every edge, with vertices identified by position, is used once in each direction
+ */
+void expectClosed(const Mesh& mesh) {
+    const auto& positions = getData<vec3>(mesh, BufferType::PositionAttrib);
+    std::map<std::tuple<float, float, float>, size_t> ids;
+    const auto id = [&](std::uint32_t v) {
+        const auto& p = positions[v];
+        return ids.try_emplace({p.x, p.y, p.z}, ids.size()).first->second;
+    };
+
+    std::map<std::pair<size_t, size_t>, size_t> edges;
+    for (const auto& [info, buffer] : mesh.getIndexBuffers()) {
+        const auto& indices = buffer->getRAMRepresentation()->getDataContainer();
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const std::array<size_t, 3> t{id(indices[i]), id(indices[i + 1]), id(indices[i + 2])};
+            if (t[0] == t[1] || t[1] == t[2] || t[2] == t[0]) continue;
+            for (size_t j = 0; j < 3; ++j) ++edges[{t[j], t[(j + 1) % 3]}];
+        }
+    }
+    for (const auto& [edge, count] : edges) {
+        EXPECT_EQ(count, 1);
+        EXPECT_TRUE(edges.contains({edge.second, edge.first}));
+    }
+}
+
+}  // namespace
+
 TEST(MeshCutting, BarycentricInsidePolygon) {
 
     auto testCorners = [](const std::vector<vec2>& poly) {
@@ -154,6 +197,31 @@ TEST(MeshCutting, PolygonCentroid) {
     }
 }
 
+TEST(MeshCutting, ClipCube) {
+    // The faces of the cube do not share vertices
+    const auto mesh = meshutil::cube(mat4{1.0f});
+    const Plane plane{vec3{0.5f, 0.5f, 0.3f}, glm::normalize(vec3{0.2f, 0.1f, 1.0f})};
+
+    const auto clipped = meshutil::clipMeshAgainstPlane(*mesh, plane, false);
+    const auto capped = meshutil::clipMeshAgainstPlane(*mesh, plane, true);
+    ASSERT_EQ(clipped->getNumberOfIndices(), 1);
+    ASSERT_EQ(capped->getNumberOfIndices(), 2);
+    EXPECT_EQ(capped->getIndices(0)->getSize(), clipped->getIndices(0)->getSize());
+    expectClosed(*capped);
+
+    const auto& positions = getData<vec3>(*capped, BufferType::PositionAttrib);
+    const auto& normals = getData<vec3>(*capped, BufferType::NormalAttrib);
+    const auto& texCoords = getData<vec3>(*capped, BufferType::TexCoordAttrib);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_GE(plane.distance(positions[i]), -1e-6f);
+        // The texture coordinates of the cube are its positions
+        EXPECT_NEAR(glm::distance(texCoords[i], positions[i]), 0.0f, 1e-5f);
+    }
+    for (auto i : capped->getIndices(1)->getRAMRepresentation()->getDataContainer()) {
+        EXPECT_NEAR(glm::distance(normals[i], -plane.getNormal()), 0.0f, 1e-6f);
+    }
+}
+
 TEST(MeshCutting, PlaneBasis) {
     const Plane p{vec3{1, 1, 1}, vec3{0, 0, 1}};
     const auto trans = glm::inverse(p.inPlaneBasis());
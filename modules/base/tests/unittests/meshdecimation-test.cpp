@@ -0,0 +1,152 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/mesh/meshdecimation.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/util/exception.h>
+#include <modules/base/algorithm/mesh/triangleadjacency.h>
+#include <modules/base/algorithm/meshutils.h>
+#include <modules/base/algorithm/volume/marchingcubesopt.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+
+#include <cmath>
+#include <vector>
+
+#include <glm/geometric.hpp>
+
+namespace inviwo {
+
+namespace {
+
+template <typename T>
+const std::vector<T>& getData(const Mesh& mesh, BufferType type) {
+    const auto* buffer = static_cast<const Buffer<T>*>(mesh.findBuffer(type).first);
+    return buffer->getRAMRepresentation()->getDataContainer();
+}
+
+size_t triangles(const Mesh& mesh) { return mesh.getIndices(0)->getSize() / 3; }
+
+/*
+ * An iso surface of a spherical volume, a closed mesh with about 4 * size^2 triangles
+ */
+std::shared_ptr<Mesh> sphere(size_t size) {
+    auto volume = std::shared_ptr<Volume>(util::makeSphericalVolume(size3_t{size}));
+    return util::marchingCubesOpt(volume, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+}
+
+}  // namespace
+
+TEST(MeshDecimation, Sphere) {
+    const auto mesh = sphere(32);
+    const auto& positions = getData<vec3>(*mesh, BufferType::PositionAttrib);
+    ASSERT_TRUE(meshutil::TriangleAdjacency{*mesh}.getBoundaryEdges().empty());
+
+    vec3 center{0.0f};
+    for (const auto& p : positions) center += p;
+    center /= static_cast<float>(positions.size());
+    float radius = 0.0f;
+    for (const auto& p : positions) radius += glm::distance(p, center);
+    radius /= static_cast<float>(positions.size());
+
+    const auto target = triangles(*mesh) / 10;
+    const auto result = meshutil::decimate(*mesh, {.targetTriangles = target});
+
+    EXPECT_LE(triangles(*result), target);
+    EXPECT_GT(triangles(*result), target / 2);
+    EXPECT_EQ(result->getNumberOfBuffers(), mesh->getNumberOfBuffers());
+    EXPECT_TRUE(meshutil::TriangleAdjacency{*result}.getBoundaryEdges().empty());
+
+    for (const auto& p : getData<vec3>(*result, BufferType::PositionAttrib)) {
+        EXPECT_NEAR(glm::distance(p, center), radius, 0.02f * radius);
+    }
+}
+
+TEST(MeshDecimation, Plane) {
+    const auto mesh =
+        meshutil::square(vec3{0.0f}, vec3{0.0f, 0.0f, 1.0f}, vec2{2.0f}, vec4{1.0f}, ivec2{16});
+    const auto result = meshutil::decimate(*mesh, {.targetRatio = 0.05});
+
+    EXPECT_LE(triangles(*result), 25);
+    const auto& positions = getData<vec3>(*result, BufferType::PositionAttrib);
+    const auto& normals = getData<vec3>(*result, BufferType::NormalAttrib);
+    const auto& texCoords = getData<vec3>(*result, BufferType::TexCoordAttrib);
+    ASSERT_EQ(positions.size(), normals.size());
+    ASSERT_EQ(positions.size(), texCoords.size());
+
+    vec3 min{positions.front()};
+    vec3 max{positions.front()};
+    for (size_t i = 0; i < positions.size(); ++i) {
+        min = glm::min(min, positions[i]);
+        max = glm::max(max, positions[i]);
+        EXPECT_FLOAT_EQ(positions[i].z, 0.0f);
+        EXPECT_NEAR(glm::distance(normals[i], vec3{0.0f, 0.0f, 1.0f}), 0.0f, 1e-5f);
+        // The texture coordinates are linear over the plane and are interpolated exactly
+        EXPECT_NEAR(texCoords[i].x, 0.5f * (positions[i].x + 1.0f), 1e-5f);
+        EXPECT_NEAR(texCoords[i].y, 0.5f * (1.0f - positions[i].y), 1e-5f);
+    }
+    // The boundary is kept
+    EXPECT_FLOAT_EQ(min.x, -1.0f);
+    EXPECT_FLOAT_EQ(min.y, -1.0f);
+    EXPECT_FLOAT_EQ(max.x, 1.0f);
+    EXPECT_FLOAT_EQ(max.y, 1.0f);
+}
+
+TEST(MeshDecimation, MaxError) {
+    const auto mesh = sphere(32);
+    const auto loose = meshutil::decimate(*mesh, {.maxError = 1.0});
+    const auto tight = meshutil::decimate(*mesh, {.maxError = 1e-4});
+    EXPECT_LT(triangles(*tight), triangles(*mesh));
+    EXPECT_LT(triangles(*loose), triangles(*tight));
+}
+
+TEST(MeshDecimation, Levels) {
+    const auto mesh = sphere(32);
+    const auto levels = meshutil::decimateLevels(*mesh, 4, 0.5);
+    ASSERT_EQ(levels->size(), 4);
+    EXPECT_EQ(triangles(*(*levels)[0]), triangles(*mesh));
+    for (size_t i = 1; i < levels->size(); ++i) {
+        EXPECT_LE(triangles(*(*levels)[i]), triangles(*(*levels)[i - 1]) / 2);
+    }
+}
+
+TEST(MeshDecimation, NoPositions) {
+    const Mesh mesh{DrawType::Triangles, ConnectivityType::None};
+    EXPECT_THROW(meshutil::decimate(mesh, {}), Exception);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,158 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/mesh/meshoptimization.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/util/exception.h>
+#include <modules/base/algorithm/mesh/triangleadjacency.h>
+#include <modules/base/algorithm/meshutils.h>
+#include <modules/base/algorithm/volume/marchingcubesopt.h>
+#include <modules/base/algorithm/volume/volumegeneration.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace inviwo {
+
+TEST(MeshOptimization, WeldCube) {
+    const auto mesh = meshutil::cube(mat4{1.0f});
+    ASSERT_EQ(mesh->getBuffer(0)->getSize(), 24);
+
+    // The faces of the cube do not share vertices, and differ in their normals
+    const auto sharp = meshutil::optimize(*mesh);
+    EXPECT_EQ(sharp->getBuffer(0)->getSize(), 24);
+    EXPECT_EQ(meshutil::computeStatistics(*sharp).triangles, 12);
+
+    const auto welded = meshutil::optimize(*mesh, {.attributeTolerance = -1.0});
+    EXPECT_EQ(welded->getNumberOfBuffers(), mesh->getNumberOfBuffers());
+    for (const auto& buffer : welded->getBuffers()) {
+        EXPECT_EQ(buffer.second->getSize(), 8);
+    }
+    EXPECT_EQ(meshutil::computeStatistics(*welded).triangles, 12);
+    EXPECT_TRUE(meshutil::TriangleAdjacency{*welded}.getBoundaryEdges().empty());
+}
+
+TEST(MeshOptimization, WeldVertices) {
+    const auto mesh = meshutil::cube(mat4{1.0f});
+    const auto remap = meshutil::weldVertices(*mesh, 0.0, -1.0);
+    ASSERT_EQ(remap.size(), 24);
+    for (std::uint32_t v = 0; v < remap.size(); ++v) {
+        EXPECT_LE(remap[v], v);
+        EXPECT_EQ(remap[remap[v]], remap[v]);
+    }
+    std::vector<std::uint32_t> unique(remap);
+    std::sort(unique.begin(), unique.end());
+    unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+    EXPECT_EQ(unique.size(), 8);
+}
+
+TEST(MeshOptimization, WeldTolerance) {
+    Mesh mesh{DrawType::Triangles, ConnectivityType::None};
+    mesh.addBuffer(BufferType::PositionAttrib,
+                   util::makeBuffer(std::vector<vec3>{{0.0f, 0.0f, 0.0f},
+                                                      {1.0f, 0.0f, 0.0f},
+                                                      {0.0f, 1.0f, 0.0f},
+                                                      {1.0f, 0.0f, 1e-5f},
+                                                      {1.0f, 1.0f, 0.0f},
+                                                      {5.0f, 5.0f, 5.0f}}));
+    mesh.addIndices({DrawType::Triangles, ConnectivityType::None},
+                    util::makeIndexBuffer({0, 1, 2, 2, 3, 4, 1, 3, 4}));
+
+    const auto exact = meshutil::optimize(mesh);
+    EXPECT_EQ(exact->getBuffer(0)->getSize(), 5);
+    EXPECT_EQ(exact->getIndices(0)->getSize(), 9);
+
+    // Vertex 3 is welded to vertex 1, which makes the last triangle degenerate
+    const auto welded = meshutil::optimize(mesh, {.weldTolerance = 1e-4});
+    EXPECT_EQ(welded->getBuffer(0)->getSize(), 4);
+    EXPECT_EQ(welded->getIndices(0)->getSize(), 6);
+
+    const auto kept = meshutil::optimize(mesh, {.weldTolerance = 1e-4, .removeDegenerate = false});
+    EXPECT_EQ(kept->getIndices(0)->getSize(), 9);
+}
+
+TEST(MeshOptimization, VertexCache) {
+    constexpr std::uint32_t size = 64;
+    std::vector<std::uint32_t> grid;
+    for (std::uint32_t y = 0; y < size; ++y) {
+        for (std::uint32_t x = 0; x < size; ++x) {
+            const auto v = y * (size + 1) + x;
+            grid.insert(grid.end(), {v, v + 1, v + size + 2, v, v + size + 2, v + size + 1});
+        }
+    }
+    std::vector<std::uint32_t> triangles(grid.size() / 3);
+    std::iota(triangles.begin(), triangles.end(), std::uint32_t{0});
+    std::shuffle(triangles.begin(), triangles.end(), std::mt19937{42});
+    std::vector<std::uint32_t> shuffled;
+    for (const auto t : triangles) {
+        shuffled.insert(shuffled.end(), {grid[3 * t], grid[3 * t + 1], grid[3 * t + 2]});
+    }
+
+    const auto optimized =
+        meshutil::optimizeVertexCache(shuffled, (size + 1) * (size + 1), 16);
+    ASSERT_EQ(optimized.size(), shuffled.size());
+    EXPECT_GT(meshutil::averageCacheMissRatio(shuffled, 16), 2.5);
+    EXPECT_LT(meshutil::averageCacheMissRatio(optimized, 16),
+              meshutil::averageCacheMissRatio(grid, 16));
+    EXPECT_LT(meshutil::averageCacheMissRatio(optimized, 16), 0.8);
+}
+
+TEST(MeshOptimization, Sphere) {
+    auto volume = std::shared_ptr<Volume>(util::makeSphericalVolume(size3_t{32}));
+    const auto mesh =
+        util::marchingCubesOpt(volume, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+
+    const auto before = meshutil::computeStatistics(*mesh);
+    const auto result = meshutil::optimize(*mesh);
+    const auto after = meshutil::computeStatistics(*result);
+    EXPECT_LE(after.vertices, before.vertices);
+    EXPECT_EQ(after.triangles, before.triangles);
+    EXPECT_LT(after.acmr, before.acmr);
+    EXPECT_LT(after.atvr, before.atvr);
+    EXPECT_TRUE(meshutil::TriangleAdjacency{*result}.getBoundaryEdges().empty());
+}
+
+TEST(MeshOptimization, NoPositions) {
+    const Mesh mesh{DrawType::Triangles, ConnectivityType::None};
+    EXPECT_THROW(meshutil::optimize(mesh), Exception);
+}
+
+}  // namespace inviwo
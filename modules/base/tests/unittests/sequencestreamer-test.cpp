@@ -0,0 +1,172 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/datastructures/sequencestreamer.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+
+#include <memory>
+
+namespace inviwo {
+
+namespace {
+
+class CountingLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    explicit CountingLoader(std::shared_ptr<size_t> count) : count_{std::move(count)} {}
+    virtual CountingLoader* clone() const override { return new CountingLoader(*this); }
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        ++*count_;
+        return std::make_shared<VolumeRAMPrecision<float>>(src.getDimensions());
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation>,
+                                      const VolumeRepresentation&) const override {}
+
+private:
+    std::shared_ptr<size_t> count_;
+};
+
+std::shared_ptr<const DataSequence<Volume>> makeSequence(size_t size,
+                                                         std::shared_ptr<size_t> count) {
+    auto sequence = std::make_shared<DataSequence<Volume>>();
+    for (size_t i = 0; i < size; ++i) {
+        auto disk = std::make_shared<VolumeDisk>(size3_t{4}, DataFloat32::get());
+        disk->setLoader(new CountingLoader(count));
+        sequence->push_back(std::make_shared<Volume>(disk));
+    }
+    return sequence;
+}
+
+size_t residentCount(const DataSequence<Volume>& sequence) {
+    size_t resident = 0;
+    for (size_t i = 0; i < sequence.size(); ++i) {
+        if (sequence[i]->hasRepresentation<VolumeRAM>()) ++resident;
+    }
+    return resident;
+}
+
+}  // namespace
+
+TEST(SequenceStreamer, ReadAheadAndEvict) {
+    auto count = std::make_shared<size_t>(0);
+    auto sequence = makeSequence(10, count);
+
+    SequenceStreamer<Volume> streamer(3);
+
+    auto first = streamer.select(sequence, 0);
+    EXPECT_EQ(first, (*sequence)[0]);
+    EXPECT_EQ(streamer.getStats().misses, 1u);
+    EXPECT_EQ(streamer.getStats().prefetched, 3u);
+    EXPECT_EQ(residentCount(*sequence), 4u);
+    first.reset();
+
+    for (size_t i = 1; i < 10; ++i) {
+        streamer.select(sequence, i);
+        // read-ahead window, the selected and the previously selected element
+        EXPECT_LE(residentCount(*sequence), 5u);
+    }
+    EXPECT_EQ(streamer.getStats().misses, 1u);
+    EXPECT_EQ(streamer.getStats().hits, 9u);
+    EXPECT_DOUBLE_EQ(streamer.getStats().hitRate(), 0.9);
+    EXPECT_GT(streamer.getStats().evicted, 0u);
+
+    // playback wraps around at the end
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_TRUE((*sequence)[i]->hasRepresentation<VolumeRAM>());
+    }
+    EXPECT_FALSE((*sequence)[5]->hasRepresentation<VolumeRAM>());
+
+    streamer.clear();
+    EXPECT_EQ(residentCount(*sequence), 0u);
+}
+
+TEST(SequenceStreamer, Backwards) {
+    auto count = std::make_shared<size_t>(0);
+    auto sequence = makeSequence(8, count);
+
+    SequenceStreamer<Volume> streamer(2);
+    streamer.select(sequence, 5);
+    streamer.select(sequence, 4);
+    EXPECT_TRUE((*sequence)[3]->hasRepresentation<VolumeRAM>());
+    EXPECT_TRUE((*sequence)[2]->hasRepresentation<VolumeRAM>());
+    EXPECT_FALSE((*sequence)[6]->hasRepresentation<VolumeRAM>());
+    // the previously selected element is kept
+    EXPECT_TRUE((*sequence)[5]->hasRepresentation<VolumeRAM>());
+
+    streamer.select(sequence, 3);
+    EXPECT_EQ(streamer.getStats().misses, 2u);
+    EXPECT_EQ(streamer.getStats().hits, 1u);
+    EXPECT_FALSE((*sequence)[5]->hasRepresentation<VolumeRAM>());
+}
+
+TEST(SequenceStreamer, KeepsElementsInUse) {
+    auto count = std::make_shared<size_t>(0);
+    auto sequence = makeSequence(8, count);
+
+    SequenceStreamer<Volume> streamer(1);
+    auto held = streamer.select(sequence, 0);
+    for (size_t i = 1; i < 4; ++i) {
+        streamer.select(sequence, i);
+    }
+    EXPECT_TRUE(held->hasRepresentation<VolumeRAM>());
+    EXPECT_FALSE((*sequence)[1]->hasRepresentation<VolumeRAM>());
+
+    // evicted once it is no longer in use
+    held.reset();
+    streamer.select(sequence, 4);
+    EXPECT_FALSE((*sequence)[0]->hasRepresentation<VolumeRAM>());
+
+    streamer.clear();
+    EXPECT_EQ(residentCount(*sequence), 0u);
+}
+
+TEST(SequenceStreamer, KeepsExistingRepresentations) {
+    auto count = std::make_shared<size_t>(0);
+    auto sequence = makeSequence(4, count);
+    (*sequence)[2]->getRepresentation<VolumeRAM>();
+
+    SequenceStreamer<Volume> streamer(1);
+    for (size_t i = 0; i < 4; ++i) {
+        streamer.select(sequence, i);
+    }
+    streamer.clear();
+    EXPECT_TRUE((*sequence)[2]->hasRepresentation<VolumeRAM>());
+    EXPECT_EQ(residentCount(*sequence), 1u);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,204 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/algorithm/stencil.h>
+#include <modules/base/algorithm/volume/volumecurl.h>
+#include <modules/base/algorithm/volume/volumedivergence.h>
+#include <modules/base/algorithm/volume/volumegradient.h>
+#include <modules/base/algorithm/volume/volumelaplacian.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/volumeramutils.h>
+
+#include <algorithm>
+#include <random>
+
+namespace inviwo {
+
+namespace {
+
+/*
+ * Straightforward evaluation of a weighted 5x5x5 stencil, wrapping every neighbor
+ */
+double reference(const VolumeRAMPrecision<float>& volume, const size3_t& pos, int radiusZ) {
+    const i64vec3 dims{volume.getDimensions()};
+    const auto wrapping = volume.getWrapping();
+    const util::IndexMapper<3, glm::int64> index{dims};
+    double sum = 0.0;
+    int weight = 1;
+    for (int z = -radiusZ; z <= radiusZ; ++z) {
+        for (int y = -2; y <= 2; ++y) {
+            for (int x = -2; x <= 2; ++x) {
+                const i64vec3 p{i64vec3{pos} + i64vec3{x, y, z}};
+                const i64vec3 wrapped{util::detail::wrapIndex(p.x, dims.x, wrapping[0]),
+                                      util::detail::wrapIndex(p.y, dims.y, wrapping[1]),
+                                      util::detail::wrapIndex(p.z, dims.z, wrapping[2])};
+                sum += weight++ * static_cast<double>(volume.getDataTyped()[index(wrapped)]);
+            }
+        }
+    }
+    return sum;
+}
+
+const auto weightedSum = [](int radiusZ) {
+    return [radiusZ](const auto& n) {
+        double sum = 0.0;
+        int weight = 1;
+        for (int z = -radiusZ; z <= radiusZ; ++z) {
+            for (int y = -2; y <= 2; ++y) {
+                for (int x = -2; x <= 2; ++x) {
+                    sum += weight++ * static_cast<double>(n(x, y, z));
+                }
+            }
+        }
+        return sum;
+    };
+};
+
+template <typename F>
+std::shared_ptr<Volume> makeVolume(size3_t dims, F&& func) {
+    using T = decltype(func(size3_t{}));
+    auto ram = std::make_shared<VolumeRAMPrecision<T>>(dims);
+    const util::IndexMapper3D index(dims);
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        ram->getDataTyped()[i] = func(index(i));
+    }
+    auto volume = std::make_shared<Volume>(ram);
+    // One world space unit per voxel
+    volume->setBasis(mat3{vec3{dims.x, 0, 0}, vec3{0, dims.y, 0}, vec3{0, 0, dims.z}});
+    volume->setOffset(vec3{0.0f});
+    return volume;
+}
+
+template <typename T>
+const T& voxel(const Volume& volume, const size3_t& pos) {
+    const auto* ram =
+        static_cast<const VolumeRAMPrecision<T>*>(volume.getRepresentation<VolumeRAM>());
+    return ram->getDataTyped()[util::IndexMapper3D(volume.getDimensions())(pos)];
+}
+
+}  // namespace
+
+TEST(Stencil, Wrapping) {
+    std::mt19937 rand(0);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    for (const auto& dims : {size3_t{7, 6, 5}, size3_t{3, 9, 1}, size3_t{1, 2, 4}}) {
+        for (auto wrapping : {Wrapping::Clamp, Wrapping::Repeat, Wrapping::Mirror}) {
+            VolumeRAMPrecision<float> src(dims, swizzlemasks::luminance,
+                                          InterpolationType::Linear,
+                                          Wrapping3D{wrapping, Wrapping::Clamp, wrapping});
+            std::generate_n(src.getDataTyped(), glm::compMul(dims), [&]() { return dist(rand); });
+            VolumeRAMPrecision<double> dst(dims);
+
+            util::forEachStencil<2>(src, dst, weightedSum(2));
+
+            util::forEachVoxel(dims, [&](const size3_t& pos) {
+                EXPECT_NEAR(dst.getDataTyped()[util::IndexMapper3D(dims)(pos)],
+                            reference(src, pos, 2), 1e-9)
+                    << "at " << pos.x << ", " << pos.y << ", " << pos.z;
+            });
+        }
+    }
+}
+
+TEST(Stencil, Layer) {
+    const size2_t dims{9, 4};
+    LayerRAMPrecision<float> src(dims, LayerType::Color, swizzlemasks::luminance,
+                                 InterpolationType::Linear,
+                                 Wrapping2D{Wrapping::Repeat, Wrapping::Mirror});
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        src.getDataTyped()[i] = static_cast<float>(i % 7);
+    }
+    LayerRAMPrecision<double> dst(dims);
+
+    util::forEachStencil<2>(src, dst, weightedSum(0));
+
+    VolumeRAMPrecision<float> volume(
+        size3_t{dims, 1}, swizzlemasks::luminance, InterpolationType::Linear,
+        Wrapping3D{Wrapping::Repeat, Wrapping::Mirror, Wrapping::Clamp});
+    std::copy_n(src.getDataTyped(), glm::compMul(dims), volume.getDataTyped());
+    for (size_t y = 0; y < dims.y; ++y) {
+        for (size_t x = 0; x < dims.x; ++x) {
+            EXPECT_DOUBLE_EQ(dst.getDataTyped()[x + y * dims.x],
+                             reference(volume, size3_t{x, y, 0}, 0));
+        }
+    }
+}
+
+TEST(Stencil, Gradient) {
+    const auto volume = makeVolume(size3_t{8, 6, 7}, [](const size3_t& p) {
+        return 2.0f * static_cast<float>(p.x) + 3.0f * static_cast<float>(p.y) -
+               static_cast<float>(p.z);
+    });
+    const auto gradient = util::gradientVolume(volume, 0);
+    util::forEachVoxel(size3_t{6, 4, 5}, [&](const size3_t& pos) {
+        const auto g = voxel<vec3>(*gradient, pos + size3_t{1});
+        EXPECT_NEAR(g.x, 2.0f, 1e-5f);
+        EXPECT_NEAR(g.y, 3.0f, 1e-5f);
+        EXPECT_NEAR(g.z, -1.0f, 1e-5f);
+    });
+}
+
+TEST(Stencil, DivergenceAndCurl) {
+    // F = (x - y, x + 2y, 3z) has divergence 6 and curl (0, 0, 2)
+    const auto volume = makeVolume(size3_t{6, 7, 8}, [](const size3_t& p) {
+        const vec3 x{p};
+        return vec3{x.x - x.y, x.x + 2.0f * x.y, 3.0f * x.z};
+    });
+    const auto divergence = util::divergenceVolume(*volume);
+    const auto curl = util::curlVolume(*volume);
+    util::forEachVoxel(size3_t{4, 5, 6}, [&](const size3_t& pos) {
+        EXPECT_NEAR(voxel<float>(*divergence, pos + size3_t{1}), 6.0f, 1e-4f);
+        const auto c = voxel<vec3>(*curl, pos + size3_t{1});
+        EXPECT_NEAR(c.x, 0.0f, 1e-4f);
+        EXPECT_NEAR(c.y, 0.0f, 1e-4f);
+        EXPECT_NEAR(c.z, 2.0f, 1e-4f);
+    });
+}
+
+TEST(Stencil, Laplacian) {
+    // f = x^2 + y^2 - z^2 has a laplacian of 2
+    const auto volume = makeVolume(size3_t{7, 7, 7}, [](const size3_t& p) {
+        const vec3 x{p};
+        return x.x * x.x + x.y * x.y - x.z * x.z;
+    });
+    const auto laplacian =
+        util::volumeLaplacian(volume, util::VolumeLaplacianPostProcessing::None, 1.0);
+    util::forEachVoxel(size3_t{5, 5, 5}, [&](const size3_t& pos) {
+        EXPECT_NEAR(voxel<float>(*laplacian, pos + size3_t{1}), 2.0f, 1e-3f);
+    });
+}
+
+}  // namespace inviwo
@@ -0,0 +1,197 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/algorithm/tfmapping.h>
+#include <inviwo/core/datastructures/datamapper.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/isovaluecollection.h>
+#include <inviwo/core/datastructures/transferfunction.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/exception.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace inviwo {
+
+namespace {
+
+TransferFunction ramp() {
+    return TransferFunction{
+        {{0.0, vec4{0.0f, 0.0f, 1.0f, 0.0f}}, {1.0, vec4{1.0f, 0.0f, 0.0f, 1.0f}}}};
+}
+
+template <typename T>
+std::shared_ptr<Volume> makeVolume(size3_t dim, dvec2 dataRange) {
+    auto ram = std::make_shared<VolumeRAMPrecision<T>>(dim);
+    auto* data = ram->getDataTyped();
+    for (size_t i = 0; i < glm::compMul(dim); ++i) {
+        data[i] = static_cast<T>(dataRange.x + (dataRange.y - dataRange.x) *
+                                                   static_cast<double>(i % 101) / 100.0);
+    }
+    auto volume = std::make_shared<Volume>(ram);
+    volume->dataMap.dataRange = dataRange;
+    volume->dataMap.valueRange = dataRange;
+    return volume;
+}
+
+template <typename T>
+const T* data(const Volume& volume) {
+    return static_cast<const VolumeRAMPrecision<T>*>(volume.getRepresentation<VolumeRAM>())
+        ->getDataTyped();
+}
+
+}  // namespace
+
+TEST(TFMapping, Volume) {
+    const size3_t dim{11, 7, 5};
+    const auto volume = makeVolume<float>(dim, dvec2{-2.0, 3.0});
+    const auto res = util::applyTF(*volume, ramp());
+
+    EXPECT_EQ(res->getDimensions(), dim);
+    EXPECT_EQ(res->getDataFormat(), DataVec4Float32::get());
+    EXPECT_EQ(res->getSwizzleMask(), swizzlemasks::rgba);
+    EXPECT_EQ(res->dataMap.valueRange, dvec2(0.0, 1.0));
+
+    const auto* src = data<float>(*volume);
+    const auto* dst = data<vec4>(*res);
+    for (size_t i = 0; i < glm::compMul(dim); ++i) {
+        const auto x = static_cast<float>((src[i] + 2.0) / 5.0);
+        EXPECT_NEAR(dst[i].r, x, 1e-3f);
+        EXPECT_NEAR(dst[i].b, 1.0f - x, 1e-3f);
+        EXPECT_NEAR(dst[i].a, x, 1e-3f);
+    }
+}
+
+TEST(TFMapping, Clamping) {
+    auto ram = std::make_shared<LayerRAMPrecision<double>>(size2_t{3, 1});
+    ram->getDataTyped()[0] = -10.0;
+    ram->getDataTyped()[1] = 10.0;
+    ram->getDataTyped()[2] = std::numeric_limits<double>::quiet_NaN();
+    DataMapper dataMap;
+    dataMap.dataRange = dvec2{0.0, 1.0};
+
+    const auto res = util::applyTF(*ram, dataMap, ramp());
+    const auto* dst = static_cast<const LayerRAMPrecision<vec4>*>(res.get())->getDataTyped();
+    EXPECT_EQ(dst[0], vec4(0.0f, 0.0f, 1.0f, 0.0f));
+    EXPECT_EQ(dst[1], vec4(1.0f, 0.0f, 0.0f, 1.0f));
+    EXPECT_EQ(dst[2], vec4(0.0f, 0.0f, 1.0f, 0.0f));
+}
+
+TEST(TFMapping, DegenerateDataRange) {
+    auto ram = std::make_shared<LayerRAMPrecision<double>>(size2_t{3, 1});
+    ram->getDataTyped()[0] = 0.0;
+    ram->getDataTyped()[1] = 1.0;
+    ram->getDataTyped()[2] = 2.0;
+    DataMapper dataMap;
+    dataMap.dataRange = dvec2{1.0, 1.0};
+
+    const auto res = util::applyTF(*ram, dataMap, ramp());
+    const auto* dst = static_cast<const LayerRAMPrecision<vec4>*>(res.get())->getDataTyped();
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(dst[i], vec4(0.0f, 0.0f, 1.0f, 0.0f));
+    }
+
+    auto bytes = std::make_shared<LayerRAMPrecision<std::uint8_t>>(size2_t{2, 1});
+    bytes->getDataTyped()[0] = 0;
+    bytes->getDataTyped()[1] = 255;
+    dataMap.dataRange = dvec2{7.0, 7.0};
+    const auto table = util::applyTF(*bytes, dataMap, ramp());
+    const auto* mapped =
+        static_cast<const LayerRAMPrecision<vec4>*>(table.get())->getDataTyped();
+    EXPECT_EQ(mapped[0], vec4(0.0f, 0.0f, 1.0f, 0.0f));
+    EXPECT_EQ(mapped[1], vec4(0.0f, 0.0f, 1.0f, 0.0f));
+}
+
+namespace {
+
+template <typename T>
+void compareWithFloats(size3_t dim, dvec2 dataRange) {
+    const auto volume = makeVolume<T>(dim, dataRange);
+    const auto floats = makeVolume<float>(dim, dataRange);
+    auto* f =
+        static_cast<VolumeRAMPrecision<float>*>(floats->getEditableRepresentation<VolumeRAM>())
+            ->getDataTyped();
+    std::copy_n(data<T>(*volume), glm::compMul(dim), f);
+
+    const auto res = util::applyTF(*volume, ramp());
+    const auto expected = util::applyTF(*floats, ramp());
+    const auto* a = data<vec4>(*res);
+    const auto* b = data<vec4>(*expected);
+    for (size_t i = 0; i < glm::compMul(dim); ++i) {
+        EXPECT_NEAR(a[i].r, b[i].r, 1e-5f);
+        EXPECT_NEAR(a[i].a, b[i].a, 1e-5f);
+    }
+}
+
+}  // namespace
+
+TEST(TFMapping, IntegerTables) {
+    // 8 and 16-bit formats are mapped using a table of all values
+    compareWithFloats<std::uint16_t>(size3_t{64, 64, 20}, dvec2{100.0, 4000.0});
+    compareWithFloats<std::int8_t>(size3_t{64, 64, 20}, dvec2{-100.0, 100.0});
+}
+
+TEST(TFMapping, UInt8Output) {
+    const auto volume = makeVolume<std::uint8_t>(size3_t{101, 1, 1}, dvec2{0.0, 255.0});
+    const auto res =
+        util::applyTF(*volume, ramp(), {.format = DataVec4UInt8::get(), .lutSize = 256});
+    EXPECT_EQ(res->getDataFormat(), DataVec4UInt8::get());
+    EXPECT_EQ(res->dataMap.dataRange, dvec2(0.0, 255.0));
+
+    const auto* src = data<std::uint8_t>(*volume);
+    const auto* dst = data<glm::u8vec4>(*res);
+    for (size_t i = 0; i < 101; ++i) {
+        EXPECT_EQ(dst[i].r, src[i]);
+        EXPECT_EQ(dst[i].b, 255 - src[i]);
+    }
+}
+
+TEST(TFMapping, IsoValues) {
+    const IsoValueCollection isovalues{{{0.5, vec4{1.0f}}}};
+    const auto volume = makeVolume<float>(size3_t{4, 4, 4}, dvec2{0.0, 1.0});
+    const auto res = util::applyTF(*volume, isovalues);
+    const auto* dst = data<vec4>(*res);
+    for (size_t i = 0; i < 64; ++i) {
+        EXPECT_EQ(dst[i], vec4{1.0f});
+    }
+}
+
+TEST(TFMapping, Errors) {
+    const auto volume = makeVolume<float>(size3_t{4, 4, 4}, dvec2{0.0, 1.0});
+    EXPECT_THROW(util::applyTF(*volume, ramp(), {.channel = 1}), Exception);
+    EXPECT_THROW(util::applyTF(*volume, ramp(), {.format = DataFloat32::get()}), Exception);
+}
+
+}  // namespace inviwo
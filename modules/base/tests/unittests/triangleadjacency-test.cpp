@@ -0,0 +1,160 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/mesh/triangleadjacency.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+/*
+ * A width x height grid of quads, two triangles each, optionally leaving out the quad at hole.
+ */
+std::vector<std::uint32_t> grid(
+    std::uint32_t width, std::uint32_t height,
+    std::optional<std::pair<std::uint32_t, std::uint32_t>> hole = std::nullopt) {
+    const auto index = [&](std::uint32_t x, std::uint32_t y) { return x + y * (width + 1); };
+    std::vector<std::uint32_t> indices;
+    for (std::uint32_t y = 0; y < height; ++y) {
+        for (std::uint32_t x = 0; x < width; ++x) {
+            if (std::pair{x, y} == hole) continue;
+            indices.insert(indices.end(), {index(x, y), index(x + 1, y), index(x, y + 1),
+                                           index(x + 1, y), index(x + 1, y + 1), index(x, y + 1)});
+        }
+    }
+    return indices;
+}
+
+/*
+ * The twins as found by matching the half edges through a map
+ */
+std::vector<std::uint32_t> mapTwins(const meshutil::TriangleAdjacency& adjacency) {
+    const auto count = static_cast<std::uint32_t>(adjacency.getNumberOfHalfEdges());
+    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> edgeMap;
+    for (std::uint32_t e = 0; e < count; ++e) {
+        edgeMap.try_emplace({adjacency.from(e), adjacency.to(e)}, e);
+    }
+    std::vector<std::uint32_t> twins(count, meshutil::TriangleAdjacency::noTwin);
+    for (std::uint32_t e = 0; e < count; ++e) {
+        if (auto it = edgeMap.find({adjacency.to(e), adjacency.from(e)}); it != edgeMap.end()) {
+            twins[e] = it->second;
+        }
+    }
+    return twins;
+}
+
+}  // namespace
+
+TEST(TriangleAdjacency, Grid) {
+    const std::uint32_t width = 5;
+    const std::uint32_t height = 4;
+    const meshutil::TriangleAdjacency adjacency{grid(width, height)};
+
+    ASSERT_EQ(adjacency.getNumberOfTriangles(), 2 * width * height);
+    for (std::uint32_t e = 0; e < adjacency.getNumberOfHalfEdges(); ++e) {
+        if (adjacency.isBoundary(e)) continue;
+        const auto twin = adjacency.twin(e);
+        EXPECT_EQ(adjacency.twin(twin), e);
+        EXPECT_EQ(adjacency.from(twin), adjacency.to(e));
+        EXPECT_EQ(adjacency.to(twin), adjacency.from(e));
+        EXPECT_NE(meshutil::TriangleAdjacency::triangle(twin),
+                  meshutil::TriangleAdjacency::triangle(e));
+    }
+    EXPECT_EQ(adjacency.getBoundaryEdges().size(), 2 * (width + height));
+
+    // The diagonal of the first quad
+    EXPECT_EQ(adjacency.twin(1), 5);
+    EXPECT_EQ(adjacency.twin(5), 1);
+    EXPECT_TRUE(adjacency.isBoundary(0));
+    EXPECT_TRUE(adjacency.isBoundary(2));
+}
+
+TEST(TriangleAdjacency, BoundaryLoops) {
+    const std::uint32_t width = 6;
+    const std::uint32_t height = 5;
+    const meshutil::TriangleAdjacency adjacency{grid(width, height, std::pair{2u, 2u})};
+
+    const auto loops = adjacency.getBoundaryLoops();
+    ASSERT_EQ(loops.size(), 2);
+
+    const auto boundary = adjacency.getBoundaryEdges();
+    const auto isBoundaryEdge = [&](std::uint32_t from, std::uint32_t to) {
+        return std::ranges::any_of(boundary, [&](std::uint32_t e) {
+            return adjacency.from(e) == from && adjacency.to(e) == to;
+        });
+    };
+
+    size_t edges = 0;
+    for (const auto& loop : loops) {
+        for (size_t i = 0; i < loop.size(); ++i) {
+            EXPECT_TRUE(isBoundaryEdge(loop[i], loop[(i + 1) % loop.size()]));
+        }
+        edges += loop.size();
+    }
+    EXPECT_EQ(edges, boundary.size());
+
+    const auto [hole, outer] = std::ranges::minmax(
+        loops, [](const auto& a, const auto& b) { return a.size() < b.size(); });
+    EXPECT_EQ(hole.size(), 4);
+    EXPECT_EQ(outer.size(), 2 * (width + height));
+}
+
+TEST(TriangleAdjacency, NonManifold) {
+    std::mt19937 rng{0};
+    for (int i = 0; i < 20; ++i) {
+        const auto vertices = 3 + rng() % 30;
+        std::vector<std::uint32_t> indices(3 * (rng() % 200));
+        for (auto& index : indices) index = static_cast<std::uint32_t>(rng() % vertices);
+
+        const meshutil::TriangleAdjacency adjacency{indices};
+        EXPECT_EQ(adjacency.getTwins(), mapTwins(adjacency));
+    }
+}
+
+TEST(TriangleAdjacency, Empty) {
+    const meshutil::TriangleAdjacency adjacency{std::vector<std::uint32_t>{}};
+    EXPECT_EQ(adjacency.getNumberOfTriangles(), 0);
+    EXPECT_TRUE(adjacency.getBoundaryEdges().empty());
+    EXPECT_TRUE(adjacency.getBoundaryLoops().empty());
+}
+
+}  // namespace inviwo
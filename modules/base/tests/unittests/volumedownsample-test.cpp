@@ -0,0 +1,160 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/algorithm/volume/volumeramdownsample.h>
+#include <modules/base/algorithm/volume/volumeramsubset.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+template <typename T>
+std::shared_ptr<VolumeRAMPrecision<T>> makeVolume(size3_t dim) {
+    auto volume = std::make_shared<VolumeRAMPrecision<T>>(dim);
+    const util::IndexMapper3D index(dim);
+    auto* data = volume->getDataTyped();
+    for (size_t i = 0; i < glm::compMul(dim); ++i) {
+        const auto pos = index(i);
+        data[i] = static_cast<T>((pos.x * 7 + pos.y * 3 + pos.z * 5) % 11);
+    }
+    return volume;
+}
+
+template <typename T>
+const T* data(const std::shared_ptr<VolumeRAM>& volume) {
+    return static_cast<const VolumeRAMPrecision<T>*>(volume.get())->getDataTyped();
+}
+
+}  // namespace
+
+TEST(VolumeDownsample, Dimensions) {
+    auto volume = makeVolume<float>(size3_t{9, 8, 7});
+    for (auto mode : {util::DownsamplingMode::Strided, util::DownsamplingMode::Averaged,
+                      util::DownsamplingMode::Maximum, util::DownsamplingMode::Minimum,
+                      util::DownsamplingMode::Median, util::DownsamplingMode::Mode}) {
+        auto res = util::volumeDownsample(volume.get(), size3_t{2, 3, 2}, mode);
+        EXPECT_EQ(res->getDimensions(), size3_t(4, 2, 3));
+    }
+}
+
+TEST(VolumeDownsample, Reductions) {
+    const size3_t dim{6, 4, 6};
+    const size3_t strides{3, 2, 3};
+    auto volume = makeVolume<int>(dim);
+    const util::IndexMapper3D srcIndex(dim);
+    const util::IndexMapper3D dstIndex(dim / strides);
+
+    auto strided = util::volumeStridedDownsample(volume.get(), strides);
+    auto averaged = util::volumeAveragedDownsample(volume.get(), strides);
+    auto maximum = util::volumeMaximumDownsample(volume.get(), strides);
+    auto minimum = util::volumeMinimumDownsample(volume.get(), strides);
+    auto median = util::volumeMedianDownsample(volume.get(), strides);
+    auto mode = util::volumeModeDownsample(volume.get(), strides);
+
+    for (size_t i = 0; i < glm::compMul(dim / strides); ++i) {
+        const auto pos = dstIndex(i) * strides;
+        std::vector<int> block;
+        for (size_t z = 0; z < strides.z; ++z) {
+            for (size_t y = 0; y < strides.y; ++y) {
+                for (size_t x = 0; x < strides.x; ++x) {
+                    block.push_back(volume->getDataTyped()[srcIndex(pos + size3_t{x, y, z})]);
+                }
+            }
+        }
+        std::sort(block.begin(), block.end());
+        const auto sum = std::accumulate(block.begin(), block.end(), 0.0);
+        size_t bestCount = 0;
+        int expectedMode = 0;
+        for (auto v : block) {
+            const auto count = static_cast<size_t>(std::count(block.begin(), block.end(), v));
+            if (count > bestCount) {
+                bestCount = count;
+                expectedMode = v;
+            }
+        }
+
+        EXPECT_EQ(data<int>(strided)[i], volume->getDataTyped()[srcIndex(pos)]);
+        EXPECT_EQ(data<int>(averaged)[i],
+                  static_cast<int>(sum * (1.0 / static_cast<double>(block.size()))));
+        EXPECT_EQ(data<int>(maximum)[i], block.back());
+        EXPECT_EQ(data<int>(minimum)[i], block.front());
+        EXPECT_EQ(data<int>(median)[i], block[(block.size() - 1) / 2]);
+        EXPECT_EQ(data<int>(mode)[i], expectedMode);
+    }
+}
+
+TEST(VolumeDownsample, VectorFormats) {
+    const size3_t dim{4, 4, 4};
+    auto volume = std::make_shared<VolumeRAMPrecision<vec2>>(dim);
+    auto* src = volume->getDataTyped();
+    for (size_t i = 0; i < glm::compMul(dim); ++i) {
+        src[i] = vec2{static_cast<float>(i), -static_cast<float>(i)};
+    }
+    const util::IndexMapper3D srcIndex(dim);
+
+    auto maximum = util::volumeMaximumDownsample(volume.get(), size3_t{2});
+    auto median = util::volumeMedianDownsample(volume.get(), size3_t{2});
+    const auto first = static_cast<float>(srcIndex(0, 0, 0));
+    const auto last = static_cast<float>(srcIndex(1, 1, 1));
+    EXPECT_EQ(data<vec2>(maximum)[0], vec2(last, -first));
+    EXPECT_EQ(data<vec2>(median)[0],
+              vec2(static_cast<float>(srcIndex(1, 1, 0)), -static_cast<float>(srcIndex(0, 0, 1))));
+}
+
+TEST(VolumeSubSet, Copy) {
+    const size3_t dim{7, 6, 5};
+    auto volume = makeVolume<unsigned short>(dim);
+    const util::IndexMapper3D srcIndex(dim);
+
+    for (auto [subDim, offset] : {std::pair{size3_t{3, 2, 4}, size3_t{2, 1, 1}},
+                                  std::pair{size3_t{7, 6, 2}, size3_t{0, 0, 3}},
+                                  std::pair{size3_t{7, 3, 3}, size3_t{0, 2, 1}}}) {
+        auto res = VolumeRAMSubSet::apply(volume.get(), subDim, offset);
+        ASSERT_EQ(res->getDimensions(), subDim);
+        const util::IndexMapper3D dstIndex(subDim);
+        for (size_t i = 0; i < glm::compMul(subDim); ++i) {
+            EXPECT_EQ(data<unsigned short>(res)[i],
+                      volume->getDataTyped()[srcIndex(dstIndex(i) + offset)]);
+        }
+    }
+}
+
+}  // namespace inviwo
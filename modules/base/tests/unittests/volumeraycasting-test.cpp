@@ -0,0 +1,124 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+#include <modules/base/algorithm/volume/volumeraycasting.h>
+#include <inviwo/core/datastructures/camera/perspectivecamera.h>
+#include <inviwo/core/datastructures/image/image.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/transferfunction.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+/*
+ * A distance field that is 1 at the center of the volume and 0 at the sides.
+ */
+std::shared_ptr<Volume> makeSphere(size3_t dim) {
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(dim);
+    const util::IndexMapper3D index(dim);
+    auto* data = ram->getDataTyped();
+    const vec3 center = vec3{dim - size_t{1}} * 0.5f;
+    for (size_t i = 0; i < glm::compMul(dim); ++i) {
+        const auto d = glm::length((vec3{index(i)} - center) / center);
+        data[i] = std::max(0.0f, 1.0f - d);
+    }
+    auto volume = std::make_shared<Volume>(ram);
+    volume->setBasis(mat3{1.0f});
+    volume->setOffset(vec3{-0.5f});
+    volume->dataMap.dataRange = dvec2{0.0, 1.0};
+    volume->dataMap.valueRange = dvec2{0.0, 1.0};
+    return volume;
+}
+
+std::vector<glm::u8vec4> pixels(const Image& image) {
+    const auto* layer = static_cast<const LayerRAMPrecision<glm::u8vec4>*>(
+        image.getColorLayer()->getRepresentation<LayerRAM>());
+    const auto* data = layer->getDataTyped();
+    return {data, data + glm::compMul(layer->getDimensions())};
+}
+
+const LightingState lighting{ShadingMode::BlinnPhong, vec3{0.0f, 0.0f, 5.0f}, vec3{0.2f},
+                             vec3{0.7f}, vec3{0.3f}, 60.0f};
+
+}  // namespace
+
+TEST(VolumeRaycasting, TransparentTF) {
+    const auto volume = makeSphere(size3_t{32});
+    const TransferFunction tf{{{0.0, vec4{0.0f}}, {1.0, vec4{0.0f}}}};
+    const PerspectiveCamera camera;
+
+    const auto image = util::volumeRaycast(*volume, tf, camera, lighting, size2_t{32});
+    for (const auto& p : pixels(*image)) {
+        EXPECT_EQ(p, glm::u8vec4{0});
+    }
+}
+
+TEST(VolumeRaycasting, OpaqueCenter) {
+    const auto volume = makeSphere(size3_t{32});
+    const TransferFunction tf{{{0.0, vec4{1.0f, 1.0f, 1.0f, 0.0f}}, {0.2, vec4{1.0f}}}};
+    const PerspectiveCamera camera;
+
+    const auto image = util::volumeRaycast(*volume, tf, camera, lighting, size2_t{32});
+    const auto result = pixels(*image);
+    // The central ray passes the full sphere, the corner rays miss the volume.
+    EXPECT_GE(result[16 + 16 * 32].a, 250);
+    EXPECT_EQ(result[0], glm::u8vec4{0});
+}
+
+TEST(VolumeRaycasting, EmptySpaceSkipping) {
+    const auto volume = makeSphere(size3_t{48, 40, 32});
+    const TransferFunction tf{{{0.0, vec4{0.0f}},
+                               {0.5, vec4{0.0f}},
+                               {0.6, vec4{1.0f, 0.0f, 0.0f, 0.3f}},
+                               {1.0, vec4{1.0f, 1.0f, 0.0f, 0.8f}}}};
+    const PerspectiveCamera camera{vec3{1.2f, 0.8f, 1.6f}};
+
+    for (size_t blockSize : {4, 8}) {
+        const util::MinMaxBlockGrid grid{*volume, 0, blockSize};
+        EXPECT_EQ(grid.getDimensions(), (size3_t{48, 40, 32} + blockSize - size_t{1}) / blockSize);
+
+        const auto reference = util::volumeRaycast(*volume, tf, camera, lighting, size2_t{40});
+        const auto skipped =
+            util::volumeRaycast(*volume, tf, camera, lighting, size2_t{40}, {}, &grid);
+        EXPECT_EQ(pixels(*reference), pixels(*skipped));
+    }
+}
+
+}  // namespace inviwo
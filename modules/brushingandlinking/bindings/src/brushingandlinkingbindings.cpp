@@ -91,14 +91,25 @@ void exposeBnL(py::module& m) {
         .def_property_readonly_static("Row", [](py::object) { return BrushingTarget::Row; })
         .def_property_readonly_static("Column", [](py::object) { return BrushingTarget::Column; });
 
+    py::classh<BrushingDelta>(m, "BrushingDelta")
+        .def(py::init<>())
+        .def_readwrite("added", &BrushingDelta::added)
+        .def_readwrite("removed", &BrushingDelta::removed)
+        .def("empty", &BrushingDelta::empty);
+
     py::classh<IndexList>(m, "IndexList")
         .def(py::init<>())
         .def("empty", &IndexList::empty)
         .def("size", &IndexList::size)
         .def("clear", &IndexList::clear)
         .def("set", &IndexList::set)
+        .def("replace", &IndexList::replace)
+        .def("modify", &IndexList::modify)
         .def("contains", &IndexList::contains)
-        .def("getIndices", &IndexList::getIndices)
+        .def("getIndices",
+             static_cast<const BitSet& (IndexList::*)() const>(&IndexList::getIndices))
+        .def("getIndices", static_cast<const BitSet& (IndexList::*)(std::string_view) const>(
+                               &IndexList::getIndices))
         .def("removeSource", &IndexList::removeSources);
 
     py::classh<BrushingTargetsInvalidationLevel>{m, "BrushingTargetsInvalidationLevel"}
@@ -136,6 +147,9 @@ void exposeBnL(py::module& m) {
         .def("isHighlightModified", &BrushingAndLinkingInport::isHighlightModified)
         .def("brush", &BrushingAndLinkingInport::brush, py::arg("action"), py::arg("target"),
              py::arg("indices"), py::arg("source") = std::string_view{})
+        .def("brushDelta", &BrushingAndLinkingInport::brushDelta, py::arg("action"),
+             py::arg("target"), py::arg("added"), py::arg("removed"),
+             py::arg("source") = std::string_view{})
         .def("filter", &BrushingAndLinkingInport::filter, py::arg("source"), py::arg("indices"),
              py::arg("target") = BrushingTarget::Row)
         .def("select", &BrushingAndLinkingInport::select, py::arg("indices"),
@@ -188,6 +202,9 @@ void exposeBnL(py::module& m) {
              py::arg("outport"), py::arg("invalidationLevels"))
         .def("brush", &BrushingAndLinkingManager::brush, py::arg("action"), py::arg("target"),
              py::arg("indices"), py::arg("source") = std::string_view{})
+        .def("brushDelta", &BrushingAndLinkingManager::brushDelta, py::arg("action"),
+             py::arg("target"), py::arg("added"), py::arg("removed"),
+             py::arg("source") = std::string_view{})
         .def("filter", &BrushingAndLinkingManager::filter, py::arg("source"), py::arg("indices"),
              py::arg("target") = BrushingTarget::Row)
         .def("select", &BrushingAndLinkingManager::select, py::arg("indices"),
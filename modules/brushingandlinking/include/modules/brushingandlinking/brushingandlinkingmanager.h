@@ -42,6 +42,7 @@
 #include <cstddef>        // for size_t
 #include <cstdint>        // for uint32_t
 #include <functional>     // for function
+#include <string>         // for string
 #include <string_view>    // for string_view
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
@@ -186,6 +187,28 @@ public:
     void brush(BrushingAction action, BrushingTarget target, const BitSet& indices,
                std::string_view source = {});
 
+    /**
+     * Add \p added to and remove \p removed from the indices of \p action and \p target.
+     * Indices in both \p added and \p removed are removed. In case of BrushingAction::Filter, the
+     * change applies to the indices of \p source, see brush.
+     *
+     * Only the change is propagated to the parent managers, the full set of indices is neither
+     * compared nor copied. Use this to keep the cost of small changes, like highlighting the
+     * item under the mouse, independent of the number of indices.
+     *
+     * @param action   type of brushing action
+     * @param target   target of the action, determines which brushing and linking state to update
+     * @param added    indices to add
+     * @param removed  indices to remove
+     * @param source   must be provided if action is equal to BrushingAction::Filter
+     *
+     * @throw Exception if action is BrushingAction::Filter and no source is given
+     *
+     * \see brush
+     */
+    void brushDelta(BrushingAction action, BrushingTarget target, const BitSet& added,
+                    const BitSet& removed, std::string_view source = {});
+
     //! convenience function for brush(BrushingAction::Filter, target, idx, source)
     void filter(const BitSet& idx, BrushingTarget target, std::string_view source);
     //! convenience function for brush(BrushingAction::Select, target, idx)
@@ -267,6 +290,13 @@ public:
     const BitSet& getIndices(BrushingAction action,
                              BrushingTarget target = BrushingTarget::Row) const;
 
+    /**
+     * A counter that is incremented every time the indices of \p action change, for any target.
+     * Compare against a previously returned value to find out whether anyone has brushed since,
+     * without comparing the indices themselves.
+     */
+    size_t getModificationCount(BrushingAction action) const;
+
     //! convenience function for getIndices(action, target).size()
     size_t getNumber(BrushingAction action, BrushingTarget target = BrushingTarget::Row) const;
     //! convenience function for getIndices(BrushingAction::Filter, target).size()
@@ -393,7 +423,23 @@ public:
 
 private:
     static int getActionIndex(BrushingAction action);
+    /**
+     * Update the indices of \p action and \p target with the \p indices of \p source. If
+     * \p delta is given, it is the change of the indices of \p source since the last update,
+     * and is applied instead of comparing the full set of indices when possible.
+     *
+     * @return the change of the indices of \p action and \p target
+     */
+    BrushingDelta update(BrushingAction action, BrushingTarget target, const BitSet& indices,
+                         const BrushingDelta* delta, std::string_view source);
+    /**
+     * Called by child managers to propagate a change of their \p indices
+     */
+    void receive(BrushingAction action, BrushingTarget target, const BitSet& indices,
+                 const BrushingDelta& delta, std::string_view source);
+    void setModified(BrushingAction action, BrushingTarget target);
     void propagate(BrushingAction action, BrushingTarget target);
+    void propagate(BrushingAction action, BrushingTarget target, const BrushingDelta& delta);
     void propagate(BrushingAction action, const std::vector<BrushingTarget>& targets);
     void addChild(BrushingAndLinkingManager* child);
     void removeChild(BrushingAndLinkingManager* child);
@@ -411,6 +457,12 @@ private:
         std::array<std::variant<BitSetTargets, IndexListTargets>, BrushingActions.size()>;
 
     SelectionMap selections_{{IndexListTargets(), BitSetTargets(), BitSetTargets()}};
+    /**
+     * The source of the last update of each target of the BitSetTargets. The indices of a target
+     * equal the indices of that source, which allows applying a change from the same source.
+     */
+    std::array<std::unordered_map<BrushingTarget, std::string>, BrushingActions.size()>
+        sources_;
 
     std::variant<BrushingAndLinkingInport*, BrushingAndLinkingOutport*> owner_;
     BrushingAndLinkingManager* parent_ = nullptr;
@@ -418,6 +470,7 @@ private:
     std::vector<BrushingTargetsInvalidationLevel>
         invalidationLevels_;  ///< Invalidation levels for combinations of {target, action}
     std::unordered_map<BrushingTarget, BrushingModifications> modifications_;
+    std::array<size_t, BrushingActions.size()> modificationCounts_{};
 
     std::function<void(BrushingAction, BrushingTarget, const BitSet&, std::string_view)>
         onBrushCallback_;
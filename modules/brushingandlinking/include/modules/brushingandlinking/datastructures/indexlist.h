@@ -46,6 +46,20 @@ namespace inviwo {
 class Deserializer;
 class Serializer;
 
+/**
+ * A change of a set of indices, \p added were not in the set before and \p removed were
+ */
+struct IVW_MODULE_BRUSHINGANDLINKING_API BrushingDelta {
+    BitSet added;
+    BitSet removed;
+
+    bool empty() const { return added.empty() && removed.empty(); }
+};
+
+/**
+ * The union of the indices of a number of sources. The union is kept up to date incrementally,
+ * only the indices that change are compared against the other sources.
+ */
 class IVW_MODULE_BRUSHINGANDLINKING_API IndexList : public Serializable {
 public:
     IndexList() = default;
@@ -61,9 +75,27 @@ public:
      * @return true if the indexlist was modified that is \p this and \p indices were different
      */
     bool set(std::string_view src, const BitSet& indices);
+    /**
+     * Replace the indices of source \p src with \p indices
+     *
+     * @return the change of the union of all sources
+     */
+    BrushingDelta replace(std::string_view src, const BitSet& indices);
+    /**
+     * Add \p added to and remove \p removed from the indices of source \p src. Indices in both
+     * \p added and \p removed are removed. The cost depends on the size of the change and not on
+     * the number of indices.
+     *
+     * @return the change of the union of all sources
+     */
+    BrushingDelta modify(std::string_view src, const BitSet& added, const BitSet& removed);
     bool contains(uint32_t idx) const;
 
     const BitSet& getIndices() const;
+    /**
+     * The indices of source \p src, or an empty set if there is no such source
+     */
+    const BitSet& getIndices(std::string_view src) const;
 
     bool removeSources(const std::vector<std::string>& sources);
 
@@ -71,12 +103,15 @@ public:
     virtual void deserialize(Deserializer& d) override;
 
 private:
-    void update() const;
-
-    mutable UnorderedStringMap<BitSet> indicesBySource_;
-    mutable BitSet indices_;
+    /*
+     * Apply a change to the indices of source, added must not be in the indices of source and
+     * removed must be. Returns the change of the union.
+     */
+    BrushingDelta apply(std::string_view source, const BitSet& added, const BitSet& removed);
+    void update();
 
-    mutable bool indicesDirty_ = false;
+    UnorderedStringMap<BitSet> indicesBySource_;
+    BitSet indices_;
 };
 
 }  // namespace inviwo
@@ -174,6 +174,15 @@ public:
     void brush(BrushingAction action, BrushingTarget target, const BitSet& indices,
                std::string_view source = {});
 
+    /**
+     * Add \p added to and remove \p removed from the indices of \p action and \p target. Only
+     * the change is propagated through the brushing and linking network.
+     *
+     * \see BrushingAndLinkingManager::brushDelta
+     */
+    void brushDelta(BrushingAction action, BrushingTarget target, const BitSet& added,
+                    const BitSet& removed, std::string_view source = {});
+
     void filter(std::string_view source, const BitSet& indices,
                 BrushingTarget target = BrushingTarget::Row);
     void select(const BitSet& indices, BrushingTarget target = BrushingTarget::Row);
@@ -195,6 +204,8 @@ public:
 
     const BitSet& getIndices(BrushingAction action,
                              BrushingTarget target = BrushingTarget::Row) const;
+    //! \see BrushingAndLinkingManager::getModificationCount
+    size_t getModificationCount(BrushingAction action) const;
 
     const BitSet& getFilteredIndices(BrushingTarget target = BrushingTarget::Row) const;
     const BitSet& getSelectedIndices(BrushingTarget target = BrushingTarget::Row) const;
@@ -49,6 +49,7 @@
 #include <string>       // for string
 #include <tuple>        // for tuple_element<>::type
 #include <type_traits>  // for add_const<>::type
+#include <utility>      // for move, pair
 
 #include <flags/flags.h>  // for operator&, flags
 #include <fmt/core.h>     // for basic_string_view
@@ -81,22 +82,91 @@ void BrushingAndLinkingManager::brush(BrushingAction action, BrushingTarget targ
         throw Exception("BrushingAction::Filter requires a source");
     }
 
+    const auto change = update(action, target, indices, nullptr, source);
+
+    if (onBrushCallback_) {
+        std::invoke(onBrushCallback_, action, target, indices, source);
+    }
+
+    if (!change.empty()) {
+        propagate(action, target, change);
+    }
+}
+
+void BrushingAndLinkingManager::brushDelta(BrushingAction action, BrushingTarget target,
+                                           const BitSet& added, const BitSet& removed,
+                                           std::string_view source) {
+    if ((action == BrushingAction::Filter) && source.empty()) {
+        throw Exception("BrushingAction::Filter requires a source");
+    }
+
     const int actionIdx = getActionIndex(action);
 
-    const bool changed =
-        std::visit(util::overloaded{[&](BitSetTargets& map) { return map[target].set(indices); },
-                                    [&](IndexListTargets& map) {
-                                        auto it = map.try_emplace(target, IndexList());
-                                        return it.first->second.set(source, indices);
-                                    }},
-                   selections_[actionIdx]);
+    const auto [change, indices] = std::visit(
+        util::overloaded{[&](BitSetTargets& map) -> std::pair<BrushingDelta, const BitSet*> {
+                             auto& current = map[target];
+                             BrushingDelta delta{added - removed - current, removed & current};
+                             current -= delta.removed;
+                             current |= delta.added;
+                             sources_[actionIdx][target] = source;
+                             return {std::move(delta), &current};
+                         },
+                         [&](IndexListTargets& map) -> std::pair<BrushingDelta, const BitSet*> {
+                             auto& list = map.try_emplace(target).first->second;
+                             auto delta = list.modify(source, added, removed);
+                             return {std::move(delta), &list.getIndices(source)};
+                         }},
+        selections_[actionIdx]);
+
+    if (onBrushCallback_) {
+        std::invoke(onBrushCallback_, action, target, *indices, source);
+    }
+
+    if (!change.empty()) {
+        propagate(action, target, change);
+    }
+}
+
+BrushingDelta BrushingAndLinkingManager::update(BrushingAction action, BrushingTarget target,
+                                                const BitSet& indices, const BrushingDelta* delta,
+                                                std::string_view source) {
+    const int actionIdx = getActionIndex(action);
+
+    return std::visit(
+        util::overloaded{[&](BitSetTargets& map) -> BrushingDelta {
+                             auto& current = map[target];
+                             auto& currentSource = sources_[actionIdx][target];
+                             // The current indices are the previous indices of source, apply
+                             // only the change
+                             if (delta && currentSource == source) {
+                                 current -= delta->removed;
+                                 current |= delta->added;
+                                 return *delta;
+                             }
+                             currentSource = source;
+                             BrushingDelta change{indices - current, current - indices};
+                             if (!change.empty()) current = indices;
+                             return change;
+                         },
+                         [&](IndexListTargets& map) -> BrushingDelta {
+                             auto& list = map.try_emplace(target).first->second;
+                             if (delta) return list.modify(source, delta->added, delta->removed);
+                             return list.replace(source, indices);
+                         }},
+        selections_[actionIdx]);
+}
+
+void BrushingAndLinkingManager::receive(BrushingAction action, BrushingTarget target,
+                                        const BitSet& indices, const BrushingDelta& delta,
+                                        std::string_view source) {
+    const auto change = update(action, target, indices, &delta, source);
 
     if (onBrushCallback_) {
         std::invoke(onBrushCallback_, action, target, indices, source);
     }
 
-    if (changed) {
-        propagate(action, target);
+    if (!change.empty()) {
+        propagate(action, target, change);
     }
 }
 
@@ -174,6 +244,13 @@ const BitSet& BrushingAndLinkingManager::getIndices(BrushingAction action,
     }
 }
 
+size_t BrushingAndLinkingManager::getModificationCount(BrushingAction action) const {
+    if (parent_) {
+        return parent_->getModificationCount(action);
+    }
+    return modificationCounts_[getActionIndex(action)];
+}
+
 void BrushingAndLinkingManager::clearIndices(BrushingAction action, BrushingTarget target) {
     if (action == BrushingAction::Filter) {
         throw Exception(SourceContext{}, "Clearing indices for action '{}' is not supported",
@@ -204,6 +281,7 @@ void BrushingAndLinkingManager::clearIndices(BrushingAction action, BrushingTarg
         stack.pop();
         if (clearMap(node->selections_)) {
             node->modifications_[target] |= fromAction(action);
+            ++node->modificationCounts_[getActionIndex(action)];
             changed = true;
         }
         for (auto c : node->children_) {
@@ -443,6 +521,7 @@ void BrushingAndLinkingManager::serialize(Serializer& s) const {
 }
 
 void BrushingAndLinkingManager::deserialize(Deserializer& d) {
+    for (auto& count : modificationCounts_) ++count;
     for (auto&& [action, targetmap] : util::zip(BrushingActions, selections_)) {
         if (std::holds_alternative<BitSetTargets>(targetmap)) {
             auto& map = std::get<BitSetTargets>(targetmap);
@@ -472,8 +551,9 @@ int BrushingAndLinkingManager::getActionIndex(BrushingAction action) {
     return static_cast<int>(action);
 }
 
-void BrushingAndLinkingManager::propagate(BrushingAction action, BrushingTarget target) {
+void BrushingAndLinkingManager::setModified(BrushingAction action, BrushingTarget target) {
     modifications_[target] |= fromAction(action);
+    ++modificationCounts_[getActionIndex(action)];
 
     // Only invalidate the top level in the connected brushing manager network
     if (!parent_) {
@@ -489,6 +569,10 @@ void BrushingAndLinkingManager::propagate(BrushingAction action, BrushingTarget
             inport->invalidate(getInvalidationLevel(target, modifications_[target]));
         }
     }
+}
+
+void BrushingAndLinkingManager::propagate(BrushingAction action, BrushingTarget target) {
+    setModified(action, target);
 
     if (parent_) {
         const std::string source = std::visit([](auto* p) { return p->getPath(); }, owner_);
@@ -501,11 +585,27 @@ void BrushingAndLinkingManager::propagate(BrushingAction action, BrushingTarget
     }
 }
 
+void BrushingAndLinkingManager::propagate(BrushingAction action, BrushingTarget target,
+                                          const BrushingDelta& delta) {
+    setModified(action, target);
+
+    if (parent_) {
+        const std::string source = std::visit([](auto* p) { return p->getPath(); }, owner_);
+
+        auto localIndices = getBitSet(action, target);
+
+        if (localIndices) {
+            parent_->receive(action, target, *localIndices, delta, source);
+        }
+    }
+}
+
 void BrushingAndLinkingManager::propagate(BrushingAction action,
                                           const std::vector<BrushingTarget>& targets) {
     for (auto t : targets) {
         modifications_[t] |= fromAction(action);
     }
+    ++modificationCounts_[getActionIndex(action)];
 
     // Only invalidate the top level in the connected brushing manager network
     if (!parent_ && std::holds_alternative<BrushingAndLinkingOutport*>(owner_)) {
@@ -47,60 +47,86 @@ size_t IndexList::size() const { return indices_.size(); }
 void IndexList::clear() {
     indices_.clear();
     indicesBySource_.clear();
-    indicesDirty_ = false;
 }
 
-const BitSet& IndexList::getIndices() const {
-    update();
-    return indices_;
-}
+const BitSet& IndexList::getIndices() const { return indices_; }
 
-bool IndexList::set(std::string_view src, const BitSet& indices) {
-    const std::string source(src);
-    auto it = indicesBySource_.find(source);
+const BitSet& IndexList::getIndices(std::string_view src) const {
+    static const BitSet empty;
 
-    if (it == indicesBySource_.end()) {
-        if (indices.empty()) return false;
+    auto it = indicesBySource_.find(src);
+    return it != indicesBySource_.end() ? it->second : empty;
+}
 
-        indicesBySource_.emplace(std::make_pair(source, indices));
-    } else {
-        if (it->second == indices) return false;
+bool IndexList::set(std::string_view src, const BitSet& indices) {
+    const auto& current = getIndices(src);
+    const auto added = indices - current;
+    const auto removed = current - indices;
+    if (added.empty() && removed.empty()) return false;
 
-        if (indices.empty()) {
-            indicesBySource_.erase(it);
-        } else {
-            it->second = indices;
-        }
-    }
-    indicesDirty_ = true;
+    apply(src, added, removed);
     return true;
 }
 
-bool IndexList::contains(uint32_t idx) const {
-    update();
-    return indices_.contains(idx);
+BrushingDelta IndexList::replace(std::string_view src, const BitSet& indices) {
+    const auto& current = getIndices(src);
+    const auto added = indices - current;
+    const auto removed = current - indices;
+    return apply(src, added, removed);
+}
+
+BrushingDelta IndexList::modify(std::string_view src, const BitSet& added,
+                                const BitSet& removed) {
+    const auto& current = getIndices(src);
+    return apply(src, added - removed - current, removed & current);
 }
 
+bool IndexList::contains(uint32_t idx) const { return indices_.contains(idx); }
+
 bool IndexList::removeSources(const std::vector<std::string>& sources) {
-    size_t modified = 0u;
+    bool modified = false;
     for (auto& source : sources) {
-        modified += indicesBySource_.erase(source);
+        auto it = indicesBySource_.find(source);
+        if (it == indicesBySource_.end()) continue;
+
+        const BitSet removed = it->second;
+        apply(source, BitSet{}, removed);
+        modified = true;
     }
-    indicesDirty_ |= (modified != 0);
-    return (modified != 0);
+    return modified;
 }
 
-void IndexList::update() const {
-    if (!indicesDirty_) return;
+BrushingDelta IndexList::apply(std::string_view source, const BitSet& added,
+                               const BitSet& removed) {
+    if (added.empty() && removed.empty()) return {};
 
+    auto it = indicesBySource_.find(source);
+    if (it == indicesBySource_.end()) {
+        it = indicesBySource_.try_emplace(std::string{source}).first;
+    }
+    it->second -= removed;
+    it->second |= added;
+
+    // Removed indices stay in the union if any other source has them
+    BrushingDelta delta{added - indices_, removed};
+    for (const auto& [other, indices] : indicesBySource_) {
+        if (delta.removed.empty()) break;
+        if (other != source) delta.removed -= indices;
+    }
+    indices_ -= delta.removed;
+    indices_ |= delta.added;
+
+    if (it->second.empty()) indicesBySource_.erase(it);
+    return delta;
+}
+
+void IndexList::update() {
     using T = std::unordered_map<std::string, BitSet>::value_type;
     std::erase_if(indicesBySource_, [](const T& p) { return p.second.empty(); });
 
     auto bitsets =
         util::transform(indicesBySource_, [](auto& p) -> const BitSet* { return &p.second; });
     indices_ = BitSet::fastUnion(bitsets);
-
-    indicesDirty_ = false;
 }
 
 void IndexList::serialize(Serializer& s) const {
@@ -110,7 +136,7 @@ void IndexList::serialize(Serializer& s) const {
 void IndexList::deserialize(Deserializer& d) {
     indicesBySource_.clear();
     d.deserialize("source", indicesBySource_, "indices");
-    indicesDirty_ = true;
+    update();
 }
 
 }  // namespace inviwo
@@ -94,6 +94,12 @@ void BrushingAndLinkingInport::brush(BrushingAction action, BrushingTarget targe
     manager_.brush(action, target, indices, source);
 }
 
+void BrushingAndLinkingInport::brushDelta(BrushingAction action, BrushingTarget target,
+                                          const BitSet& added, const BitSet& removed,
+                                          std::string_view source) {
+    manager_.brushDelta(action, target, added, removed, source);
+}
+
 void BrushingAndLinkingInport::filter(std::string_view source, const BitSet& indices,
                                       BrushingTarget target) {
     manager_.brush(BrushingAction::Filter, target, indices, source);
@@ -140,6 +146,10 @@ const BitSet& BrushingAndLinkingInport::getIndices(BrushingAction action,
     return manager_.getIndices(action, target);
 }
 
+size_t BrushingAndLinkingInport::getModificationCount(BrushingAction action) const {
+    return manager_.getModificationCount(action);
+}
+
 const BitSet& BrushingAndLinkingInport::getFilteredIndices(BrushingTarget target) const {
     return manager_.getIndices(BrushingAction::Filter, target);
 }
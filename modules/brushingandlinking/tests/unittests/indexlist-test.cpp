@@ -0,0 +1,155 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/bitset.h>
+#include <modules/brushingandlinking/datastructures/indexlist.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace inviwo {
+
+TEST(IndexList, ModifyAddsAndRemoves) {
+    IndexList list;
+    auto delta = list.modify("a", BitSet{1, 2, 3}, BitSet{});
+    EXPECT_EQ(delta.added, (BitSet{1, 2, 3}));
+    EXPECT_TRUE(delta.removed.empty());
+    EXPECT_EQ(list.getIndices(), (BitSet{1, 2, 3}));
+
+    // 5 is not in the list and is ignored
+    delta = list.modify("a", BitSet{4}, BitSet{1, 5});
+    EXPECT_EQ(delta.added, BitSet{4});
+    EXPECT_EQ(delta.removed, BitSet{1});
+    EXPECT_EQ(list.getIndices("a"), (BitSet{2, 3, 4}));
+    EXPECT_EQ(list.getIndices(), (BitSet{2, 3, 4}));
+}
+
+TEST(IndexList, ModifyAddedAndRemovedIsRemoved) {
+    IndexList list;
+    list.modify("a", BitSet{1, 2}, BitSet{});
+
+    const auto delta = list.modify("a", BitSet{2, 3}, BitSet{2, 3});
+    EXPECT_TRUE(delta.added.empty());
+    EXPECT_EQ(delta.removed, BitSet{2});
+    EXPECT_EQ(list.getIndices(), BitSet{1});
+}
+
+TEST(IndexList, ModifyWithoutChange) {
+    IndexList list;
+    list.modify("a", BitSet{1}, BitSet{});
+
+    EXPECT_TRUE(list.modify("a", BitSet{1}, BitSet{}).empty());
+    EXPECT_TRUE(list.modify("a", BitSet{}, BitSet{7}).empty());
+    EXPECT_TRUE(list.modify("b", BitSet{}, BitSet{1}).empty());
+    EXPECT_EQ(list.getIndices(), BitSet{1});
+}
+
+TEST(IndexList, ModifyKeepsIndicesOfOtherSources) {
+    IndexList list;
+    list.modify("a", BitSet{1, 2}, BitSet{});
+    list.modify("b", BitSet{2, 3}, BitSet{});
+    EXPECT_EQ(list.getIndices(), (BitSet{1, 2, 3}));
+
+    // 2 is still in b
+    auto delta = list.modify("a", BitSet{}, BitSet{1, 2});
+    EXPECT_TRUE(delta.added.empty());
+    EXPECT_EQ(delta.removed, BitSet{1});
+    EXPECT_TRUE(list.getIndices("a").empty());
+    EXPECT_EQ(list.getIndices(), (BitSet{2, 3}));
+
+    // 3 is already in b
+    delta = list.modify("a", BitSet{3, 4}, BitSet{});
+    EXPECT_EQ(delta.added, BitSet{4});
+    EXPECT_TRUE(delta.removed.empty());
+    EXPECT_EQ(list.getIndices("a"), (BitSet{3, 4}));
+    EXPECT_EQ(list.getIndices(), (BitSet{2, 3, 4}));
+}
+
+TEST(IndexList, ReplaceAndSet) {
+    IndexList list;
+    list.replace("a", BitSet{1, 2, 3});
+    list.replace("b", BitSet{3, 4});
+
+    const auto delta = list.replace("a", BitSet{2, 5});
+    EXPECT_EQ(delta.added, BitSet{5});
+    EXPECT_EQ(delta.removed, BitSet{1});
+    EXPECT_EQ(list.getIndices(), (BitSet{2, 3, 4, 5}));
+
+    EXPECT_FALSE(list.set("a", BitSet{2, 5}));
+    EXPECT_TRUE(list.set("b", BitSet{}));
+    EXPECT_EQ(list.getIndices(), (BitSet{2, 5}));
+}
+
+TEST(IndexList, RemoveSources) {
+    IndexList list;
+    list.modify("a", BitSet{1, 2}, BitSet{});
+    list.modify("b", BitSet{2}, BitSet{});
+
+    EXPECT_FALSE(list.removeSources({"c"}));
+    EXPECT_TRUE(list.removeSources({"a"}));
+    EXPECT_TRUE(list.getIndices("a").empty());
+    EXPECT_EQ(list.getIndices(), BitSet{2});
+}
+
+TEST(IndexList, RandomChangesMatchUnion) {
+    const std::array<std::string, 3> sources{"a", "b", "c"};
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::uint32_t> index(0, 63);
+    std::uniform_int_distribution<size_t> count(0, 8);
+    std::uniform_int_distribution<size_t> source(0, sources.size() - 1);
+    const auto randomIndices = [&]() {
+        BitSet b;
+        for (size_t i = 0, n = count(gen); i < n; ++i) b.add(index(gen));
+        return b;
+    };
+
+    IndexList list;
+    for (int i = 0; i < 1000; ++i) {
+        const auto& src = sources[source(gen)];
+        const BitSet before = list.getIndices();
+
+        const auto delta = i % 5 == 0 ? list.replace(src, randomIndices())
+                                      : list.modify(src, randomIndices(), randomIndices());
+
+        BitSet expected;
+        for (const auto& s : sources) expected |= list.getIndices(s);
+        ASSERT_EQ(list.getIndices(), expected) << "iteration " << i;
+        ASSERT_EQ(delta.added, expected - before) << "iteration " << i;
+        ASSERT_EQ(delta.removed, before - expected) << "iteration " << i;
+    }
+}
+
+}  // namespace inviwo
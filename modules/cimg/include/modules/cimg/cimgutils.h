@@ -72,6 +72,16 @@ struct IVW_MODULE_CIMG_API TIFFHeader {
 
 IVW_MODULE_CIMG_API TIFFHeader getTIFFHeader(const std::filesystem::path& filename);
 
+/**
+ * Reads the pages [firstPage, firstPage + volume.getDimensions().z) of a multi-page TIFF file
+ * directly into the slices of @p volume. The pages are decoded in parallel on the thread pool,
+ * with one TIFF handle per thread, and written to their z offset without any intermediate
+ * copies. The data format of @p volume has to match the file, see getTIFFHeader. Like the other
+ * CImg readers the y axis is flipped.
+ */
+IVW_MODULE_CIMG_API void readTIFFSlices(const std::filesystem::path& filePath, VolumeRAM& volume,
+                                        size_t firstPage = 0);
+
 /**
  * Loads layer from a specified filePath.
  **/
@@ -33,6 +33,7 @@
 
 #include <inviwo/core/datastructures/diskrepresentation.h>           // for DiskRepresentationLo...
 #include <inviwo/core/datastructures/volume/volume.h>                // for DataReaderType
+#include <inviwo/core/datastructures/volume/volumedisk.h>            // for VolumeSliceLoader
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>  // for VolumeRepresentation
 #include <inviwo/core/io/datareader.h>                               // for DataReaderType
 
@@ -51,8 +52,13 @@ public:
     virtual std::shared_ptr<Volume> readData(const std::filesystem::path& filePath) override;
 };
 
+/**
+ * Loads the pages of a multi-page TIFF file into a VolumeRAM. The pages are decoded in parallel,
+ * see cimgutil::readTIFFSlices, and ranges of pages can be read without reading the whole file.
+ */
 class IVW_MODULE_CIMG_API TIFFStackVolumeRAMLoader
-    : public DiskRepresentationLoader<VolumeRepresentation> {
+    : public DiskRepresentationLoader<VolumeRepresentation>,
+      public VolumeSliceLoader {
 public:
     TIFFStackVolumeRAMLoader(const std::filesystem::path& sourceFile);
     virtual TIFFStackVolumeRAMLoader* clone() const override;
@@ -62,6 +68,8 @@ public:
         const VolumeRepresentation& src) const override;
     virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
                                       const VolumeRepresentation& src) const override;
+    virtual std::shared_ptr<VolumeRAM> loadSlices(const VolumeRepresentation& src, size_t begin,
+                                                  size_t end) const override;
 
 private:
     std::filesystem::path sourceFile_;
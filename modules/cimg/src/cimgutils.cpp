@@ -33,6 +33,7 @@
 #endif
 
 #include <modules/cimg/cimgutils.h>
+#include <modules/cimg/detail/tiffdirectory.h>
 
 #include <inviwo/core/datastructures/image/imagetypes.h>                // for SwizzleMask, lumi...
 #include <inviwo/core/datastructures/image/layerram.h>                  // for LayerRAM
@@ -43,6 +44,7 @@
 #include <inviwo/core/io/datawriterexception.h>                         // for DataWriterException
 #include <inviwo/core/util/exception.h>                                 // for Exception
 #include <inviwo/core/util/filesystem.h>                                // for getFileExtension
+#include <inviwo/core/util/foreach.h>                                   // for forEachChunkParallel
 #include <inviwo/core/util/formatdispatching.h>                         // for dispatch, All
 #include <inviwo/core/util/formats.h>                                   // for DataFormatId, Dat...
 #include <inviwo/core/util/glmutils.h>                                  // for extent, rank
@@ -56,7 +58,9 @@
 #include <algorithm>      // for min
 #include <cstdint>        // for uint16_t, uint32_t
 #include <cstring>        // for size_t, memcpy
+#include <exception>      // for exception_ptr, rethrow_exception
 #include <functional>     // for __base
+#include <mutex>          // for mutex, scoped_lock
 #include <ostream>        // for operator<<, basic...
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
@@ -582,6 +586,134 @@ TIFFHeader getTIFFHeader(const std::filesystem::path& filename) {
 #endif
 }
 
+#ifdef cimg_use_tiff
+namespace detail {
+
+// Handles stripped and tiled files with contiguous or separate planes
+void readTIFFDirectory(TIFF* tif, unsigned char* dst, size2_t dims, size_t pixelSize,
+                       std::vector<unsigned char>& buffer) {
+    std::uint32_t width = 0, height = 0;
+    std::uint16_t samplesPerPixel = 1, bitsPerSample = 8, planarConfig = PLANARCONFIG_CONTIG;
+    TIFFGetFieldDefaulted(tif, TIFFTAG_IMAGEWIDTH, &width);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_IMAGELENGTH, &height);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLESPERPIXEL, &samplesPerPixel);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_BITSPERSAMPLE, &bitsPerSample);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_PLANARCONFIG, &planarConfig);
+
+    if (size2_t{width, height} != dims) {
+        throw DataReaderException(SourceContext{}, "Unexpected TIFF page size {}x{}, expected {}",
+                                  width, height, dims);
+    }
+    const size_t sampleSize = bitsPerSample / 8;
+    if (sampleSize * samplesPerPixel != pixelSize) {
+        throw DataReaderException(SourceContext{}, "Unexpected TIFF page format");
+    }
+
+    const bool separate = planarConfig == PLANARCONFIG_SEPARATE && samplesPerPixel > 1;
+    const size_t planes = separate ? samplesPerPixel : 1;
+    const size_t srcPixelSize = separate ? sampleSize : pixelSize;
+
+    // Image is up-side-down
+    const auto copy = [&](size_t y, size_t x, const unsigned char* src, size_t count,
+                          size_t plane) {
+        auto* row = dst + ((dims.y - 1 - y) * dims.x + x) * pixelSize;
+        if (!separate) {
+            std::memcpy(row, src, count * pixelSize);
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                std::memcpy(row + i * pixelSize + plane * sampleSize, src + i * sampleSize,
+                            sampleSize);
+            }
+        }
+    };
+
+    if (TIFFIsTiled(tif)) {
+        std::uint32_t tileWidth = 0, tileHeight = 0;
+        TIFFGetField(tif, TIFFTAG_TILEWIDTH, &tileWidth);
+        TIFFGetField(tif, TIFFTAG_TILELENGTH, &tileHeight);
+        buffer.resize(static_cast<size_t>(TIFFTileSize(tif)));
+        for (size_t plane = 0; plane < planes; ++plane) {
+            for (std::uint32_t y0 = 0; y0 < height; y0 += tileHeight) {
+                for (std::uint32_t x0 = 0; x0 < width; x0 += tileWidth) {
+                    const auto tile = TIFFComputeTile(tif, x0, y0, 0,
+                                                      static_cast<std::uint16_t>(plane));
+                    if (TIFFReadEncodedTile(tif, tile, buffer.data(), -1) < 0) {
+                        throw DataReaderException(SourceContext{}, "Could not read TIFF tile");
+                    }
+                    const auto count = std::min(tileWidth, width - x0);
+                    for (std::uint32_t r = 0; r < std::min(tileHeight, height - y0); ++r) {
+                        copy(y0 + r, x0, buffer.data() + r * tileWidth * srcPixelSize, count,
+                             plane);
+                    }
+                }
+            }
+        }
+    } else {
+        std::uint32_t rowsPerStrip = height;
+        TIFFGetFieldDefaulted(tif, TIFFTAG_ROWSPERSTRIP, &rowsPerStrip);
+        rowsPerStrip = std::min(rowsPerStrip, height);
+        buffer.resize(static_cast<size_t>(TIFFStripSize(tif)));
+        for (size_t plane = 0; plane < planes; ++plane) {
+            for (std::uint32_t y0 = 0; y0 < height; y0 += rowsPerStrip) {
+                const auto strip = TIFFComputeStrip(tif, y0, static_cast<std::uint16_t>(plane));
+                if (TIFFReadEncodedStrip(tif, strip, buffer.data(), -1) < 0) {
+                    throw DataReaderException(SourceContext{}, "Could not read TIFF strip");
+                }
+                for (std::uint32_t r = 0; r < std::min(rowsPerStrip, height - y0); ++r) {
+                    copy(y0 + r, 0, buffer.data() + r * width * srcPixelSize, width, plane);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace detail
+#endif
+
+void readTIFFSlices(const std::filesystem::path& filePath, VolumeRAM& volume, size_t firstPage) {
+#ifdef cimg_use_tiff
+    const auto dims = volume.getDimensions();
+    const auto pixelSize = static_cast<size_t>(volume.getDataFormat()->getSizeInBytes());
+    const auto sliceSize = dims.x * dims.y * pixelSize;
+    auto* data = static_cast<unsigned char*>(volume.getData());
+
+    std::mutex mutex;
+    std::exception_ptr error;
+    util::forEachChunkParallel(dims.z, [&](size_t begin, size_t end) {
+        try {
+            // libtiff handles can not be shared between threads, open one per chunk
+            TIFF* tif = TIFFOpen(filePath.string().c_str(), "r");
+            util::OnScopeExit closeFile([tif]() {
+                if (tif) TIFFClose(tif);
+            });
+            if (!tif) {
+                throw DataReaderException(SourceContext{}, "Error could not open input file: {}",
+                                          filePath);
+            }
+            if (!TIFFSetDirectory(tif, static_cast<tdir_t>(firstPage + begin))) {
+                throw DataReaderException(SourceContext{}, "Missing TIFF page {} in {}",
+                                          firstPage + begin, filePath);
+            }
+            std::vector<unsigned char> buffer;
+            for (size_t z = begin; z < end; ++z) {
+                if (z != begin && !TIFFReadDirectory(tif)) {
+                    throw DataReaderException(SourceContext{}, "Missing TIFF page {} in {}",
+                                              firstPage + z, filePath);
+                }
+                detail::readTIFFDirectory(tif, data + z * sliceSize, size2_t{dims}, pixelSize,
+                                          buffer);
+            }
+        } catch (...) {
+            const std::scoped_lock lock{mutex};
+            if (!error) error = std::current_exception();
+        }
+    });
+    if (error) std::rethrow_exception(error);
+#else
+    throw Exception("TIFF not available");
+#endif
+}
+
 }  // namespace cimgutil
 
 }  // namespace inviwo
@@ -96,24 +96,33 @@ TIFFStackVolumeRAMLoader* TIFFStackVolumeRAMLoader::clone() const {
 
 std::shared_ptr<VolumeRepresentation> TIFFStackVolumeRAMLoader::createRepresentation(
     const VolumeRepresentation& src) const {
-    const auto fileName = findFile(sourceFile_);
-
-    auto volumeRAM = cimgutil::loadVolume(fileName, src.getDataFormat(), src.getDimensions());
-    volumeRAM->setWrapping(src.getWrapping());
-    volumeRAM->setInterpolation(src.getInterpolation());
-    volumeRAM->setSwizzleMask(src.getSwizzleMask());
-    return volumeRAM;
+    return loadSlices(src, 0, src.getDimensions().z);
 }
 
 void TIFFStackVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
                                                     const VolumeRepresentation& src) const {
     auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
+    if (volumeDst->getDimensions() != src.getDimensions()) {
+        throw DataReaderException("Volume size missmatch");
+    }
 
     const auto fileName = findFile(sourceFile_);
-    cimgutil::updateVolume(*volumeDst, fileName);
+    cimgutil::readTIFFSlices(fileName, *volumeDst);
     volumeDst->setWrapping(src.getWrapping());
     volumeDst->setInterpolation(src.getInterpolation());
     volumeDst->setSwizzleMask(src.getSwizzleMask());
 }
 
+std::shared_ptr<VolumeRAM> TIFFStackVolumeRAMLoader::loadSlices(const VolumeRepresentation& src,
+                                                                size_t begin, size_t end) const {
+    const auto fileName = findFile(sourceFile_);
+    const auto dims = src.getDimensions();
+
+    auto volumeRAM = createVolumeRAM(size3_t{dims.x, dims.y, end - begin}, src.getDataFormat(),
+                                     nullptr, src.getSwizzleMask(), src.getInterpolation(),
+                                     src.getWrapping());
+    cimgutil::readTIFFSlices(fileName, *volumeRAM, begin);
+    return volumeRAM;
+}
+
 }  // namespace inviwo
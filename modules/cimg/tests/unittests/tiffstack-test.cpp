@@ -0,0 +1,297 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/formats.h>
+#include <inviwo/core/util/raiiutils.h>
+#include <modules/cimg/cimgutils.h>
+#include <modules/cimg/detail/tiffdirectory.h>
+#include <modules/cimg/tiffstackvolumereader.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <tiffio.h>
+#include <warn/pop>
+
+namespace inviwo {
+
+namespace {
+
+struct TIFFLayout {
+    bool tiled = false;
+    bool separate = false;
+    std::uint16_t samples = 1;
+};
+
+// Neither a multiple of the tile size nor of the rows per strip, to get partial edge tiles
+constexpr size3_t dims{37, 29, 6};
+constexpr std::uint32_t tileSize = 16;
+constexpr std::uint32_t rowsPerStrip = 5;
+
+template <typename Scalar>
+Scalar value(size_t x, size_t y, size_t z, size_t c) {
+    // Use both bytes of wider types to catch byte order mistakes
+    const size_t scale = sizeof(Scalar) > 1 ? 257 : 1;
+    return static_cast<Scalar>((x * 7 + y * 13 + z * 29 + c * 53) % 251 * scale);
+}
+
+template <typename Scalar>
+const DataFormatBase* dataFormat(const TIFFLayout& layout) {
+    return DataFormatBase::get(NumericType::UnsignedInteger, layout.samples, 8 * sizeof(Scalar));
+}
+
+template <typename Scalar>
+void writeTIFF(const std::filesystem::path& file, const TIFFLayout& layout) {
+    TIFF* tif = TIFFOpen(file.string().c_str(), "w");
+    ASSERT_NE(tif, nullptr);
+    util::OnScopeExit closeFile([tif]() { TIFFClose(tif); });
+
+    const bool separate = layout.separate && layout.samples > 1;
+    const size_t planes = separate ? layout.samples : 1;
+    const size_t planeSamples = separate ? 1 : layout.samples;
+
+    // Fill count pixels of row y starting at x0, pixels outside of the page are set to zero
+    const auto fill = [&](Scalar* dst, size_t x0, size_t y, size_t z, size_t count,
+                          size_t plane) {
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t s = 0; s < planeSamples; ++s) {
+                const auto x = x0 + i;
+                dst[i * planeSamples + s] =
+                    x < dims.x && y < dims.y ? value<Scalar>(x, y, z, plane + s) : Scalar{0};
+            }
+        }
+    };
+
+    for (size_t z = 0; z < dims.z; ++z) {
+        TIFFSetField(tif, TIFFTAG_SUBFILETYPE, FILETYPE_PAGE);
+        TIFFSetField(tif, TIFFTAG_PAGENUMBER, static_cast<std::uint16_t>(z),
+                     static_cast<std::uint16_t>(dims.z));
+        TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, static_cast<std::uint32_t>(dims.x));
+        TIFFSetField(tif, TIFFTAG_IMAGELENGTH, static_cast<std::uint32_t>(dims.y));
+        TIFFSetField(tif, TIFFTAG_SAMPLESPERPIXEL, layout.samples);
+        TIFFSetField(tif, TIFFTAG_BITSPERSAMPLE, static_cast<std::uint16_t>(8 * sizeof(Scalar)));
+        TIFFSetField(tif, TIFFTAG_SAMPLEFORMAT, SAMPLEFORMAT_UINT);
+        TIFFSetField(tif, TIFFTAG_PHOTOMETRIC,
+                     layout.samples == 3 ? PHOTOMETRIC_RGB : PHOTOMETRIC_MINISBLACK);
+        TIFFSetField(tif, TIFFTAG_PLANARCONFIG,
+                     separate ? PLANARCONFIG_SEPARATE : PLANARCONFIG_CONTIG);
+        TIFFSetField(tif, TIFFTAG_COMPRESSION, COMPRESSION_LZW);
+
+        if (layout.tiled) {
+            TIFFSetField(tif, TIFFTAG_TILEWIDTH, tileSize);
+            TIFFSetField(tif, TIFFTAG_TILELENGTH, tileSize);
+            std::vector<Scalar> tile(tileSize * tileSize * planeSamples);
+            for (size_t plane = 0; plane < planes; ++plane) {
+                for (std::uint32_t y0 = 0; y0 < dims.y; y0 += tileSize) {
+                    for (std::uint32_t x0 = 0; x0 < dims.x; x0 += tileSize) {
+                        for (size_t r = 0; r < tileSize; ++r) {
+                            fill(tile.data() + r * tileSize * planeSamples, x0, y0 + r, z,
+                                 tileSize, plane);
+                        }
+                        const auto index =
+                            TIFFComputeTile(tif, x0, y0, 0, static_cast<std::uint16_t>(plane));
+                        const auto size = static_cast<tmsize_t>(tile.size() * sizeof(Scalar));
+                        ASSERT_GE(TIFFWriteEncodedTile(tif, index, tile.data(), size), 0);
+                    }
+                }
+            }
+        } else {
+            TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, rowsPerStrip);
+            std::vector<Scalar> strip(rowsPerStrip * dims.x * planeSamples);
+            for (size_t plane = 0; plane < planes; ++plane) {
+                for (std::uint32_t y0 = 0; y0 < dims.y; y0 += rowsPerStrip) {
+                    const auto rows = std::min<size_t>(rowsPerStrip, dims.y - y0);
+                    for (size_t r = 0; r < rows; ++r) {
+                        fill(strip.data() + r * dims.x * planeSamples, 0, y0 + r, z, dims.x,
+                             plane);
+                    }
+                    const auto index =
+                        TIFFComputeStrip(tif, y0, static_cast<std::uint16_t>(plane));
+                    const auto size =
+                        static_cast<tmsize_t>(rows * dims.x * planeSamples * sizeof(Scalar));
+                    ASSERT_GE(TIFFWriteEncodedStrip(tif, index, strip.data(), size), 0);
+                }
+            }
+        }
+        ASSERT_TRUE(TIFFWriteDirectory(tif));
+    }
+}
+
+// The pages [firstPage, firstPage + pages) with interleaved channels and y flipped like the
+// CImg readers
+template <typename Scalar>
+std::vector<Scalar> expected(const TIFFLayout& layout, size_t firstPage, size_t pages) {
+    std::vector<Scalar> res(dims.x * dims.y * pages * layout.samples);
+    for (size_t z = 0; z < pages; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const auto i = (z * dims.y + (dims.y - 1 - y)) * dims.x + x;
+                for (size_t c = 0; c < layout.samples; ++c) {
+                    res[i * layout.samples + c] = value<Scalar>(x, y, firstPage + z, c);
+                }
+            }
+        }
+    }
+    return res;
+}
+
+template <typename Scalar>
+std::vector<Scalar> readSlices(const std::filesystem::path& file, const TIFFLayout& layout,
+                               size_t firstPage, size_t pages) {
+    auto ram = createVolumeRAM(size3_t{dims.x, dims.y, pages}, dataFormat<Scalar>(layout));
+    cimgutil::readTIFFSlices(file, *ram, firstPage);
+    const auto* data = static_cast<const Scalar*>(ram->getData());
+    return {data, data + dims.x * dims.y * pages * layout.samples};
+}
+
+// The previous loader, going through CImg, with the channels interleaved
+template <typename Scalar>
+std::vector<Scalar> readCImg(const std::filesystem::path& file, const TIFFLayout& layout) {
+    auto ram = cimgutil::loadVolume(file, dataFormat<Scalar>(layout), dims);
+    const auto* data = static_cast<const Scalar*>(ram->getData());
+    const auto voxels = dims.x * dims.y * dims.z;
+    // CImg keeps each channel in a separate plane
+    std::vector<Scalar> res(voxels * layout.samples);
+    for (size_t i = 0; i < voxels; ++i) {
+        for (size_t c = 0; c < layout.samples; ++c) {
+            res[i * layout.samples + c] = data[c * voxels + i];
+        }
+    }
+    return res;
+}
+
+template <typename Scalar>
+void testLayout(const TIFFLayout& layout) {
+    util::TempFileHandle tmpFile("cimg", ".tif");
+    writeTIFF<Scalar>(tmpFile.getFileName(), layout);
+    if (::testing::Test::HasFatalFailure()) return;
+
+    const auto header = cimgutil::getTIFFHeader(tmpFile.getFileName());
+    EXPECT_EQ(header.format, dataFormat<Scalar>(layout));
+    EXPECT_TRUE(header.dimensions == dims);
+
+    const auto slices = readSlices<Scalar>(tmpFile.getFileName(), layout, 0, dims.z);
+    EXPECT_EQ(slices, (expected<Scalar>(layout, 0, dims.z)));
+    EXPECT_EQ(slices, readCImg<Scalar>(tmpFile.getFileName(), layout));
+}
+
+}  // namespace
+
+TEST(TIFFStack, StrippedGray8) { testLayout<std::uint8_t>({.tiled = false, .samples = 1}); }
+TEST(TIFFStack, StrippedRGB16) { testLayout<std::uint16_t>({.tiled = false, .samples = 3}); }
+TEST(TIFFStack, TiledGray16) { testLayout<std::uint16_t>({.tiled = true, .samples = 1}); }
+TEST(TIFFStack, TiledRGB8) { testLayout<std::uint8_t>({.tiled = true, .samples = 3}); }
+
+TEST(TIFFStack, StrippedSeparateRGB8) {
+    testLayout<std::uint8_t>({.tiled = false, .separate = true, .samples = 3});
+}
+TEST(TIFFStack, TiledSeparateRGB16) {
+    testLayout<std::uint16_t>({.tiled = true, .separate = true, .samples = 3});
+}
+
+TEST(TIFFStack, ReadSlicesFromPage) {
+    const TIFFLayout layout{.tiled = true, .separate = true, .samples = 3};
+    util::TempFileHandle tmpFile("cimg", ".tif");
+    writeTIFF<std::uint8_t>(tmpFile.getFileName(), layout);
+    ASSERT_FALSE(HasFatalFailure());
+
+    EXPECT_EQ(readSlices<std::uint8_t>(tmpFile.getFileName(), layout, 2, 3),
+              (expected<std::uint8_t>(layout, 2, 3)));
+    EXPECT_THROW(readSlices<std::uint8_t>(tmpFile.getFileName(), layout, 4, 3),
+                 DataReaderException);
+}
+
+TEST(TIFFStack, ReadDirectory) {
+    const TIFFLayout layout{.tiled = false, .separate = true, .samples = 3};
+    util::TempFileHandle tmpFile("cimg", ".tif");
+    writeTIFF<std::uint16_t>(tmpFile.getFileName(), layout);
+    ASSERT_FALSE(HasFatalFailure());
+
+    TIFF* tif = TIFFOpen(tmpFile.getFileName().string().c_str(), "r");
+    ASSERT_NE(tif, nullptr);
+    util::OnScopeExit closeFile([tif]() { TIFFClose(tif); });
+    ASSERT_TRUE(TIFFSetDirectory(tif, 4));
+
+    const size_t pixelSize = layout.samples * sizeof(std::uint16_t);
+    std::vector<std::uint16_t> page(dims.x * dims.y * layout.samples);
+    std::vector<unsigned char> buffer;
+    cimgutil::detail::readTIFFDirectory(tif, reinterpret_cast<unsigned char*>(page.data()),
+                                        size2_t{dims}, pixelSize, buffer);
+    EXPECT_EQ(page, (expected<std::uint16_t>(layout, 4, 1)));
+
+    EXPECT_THROW(cimgutil::detail::readTIFFDirectory(
+                     tif, reinterpret_cast<unsigned char*>(page.data()),
+                     size2_t{dims.x, dims.y - 1}, pixelSize, buffer),
+                 DataReaderException);
+    EXPECT_THROW(cimgutil::detail::readTIFFDirectory(
+                     tif, reinterpret_cast<unsigned char*>(page.data()), size2_t{dims},
+                     sizeof(std::uint16_t), buffer),
+                 DataReaderException);
+}
+
+TEST(TIFFStack, LoaderLoadSlices) {
+    const TIFFLayout layout{.tiled = true, .separate = false, .samples = 1};
+    util::TempFileHandle tmpFile("cimg", ".tif");
+    writeTIFF<std::uint16_t>(tmpFile.getFileName(), layout);
+    ASSERT_FALSE(HasFatalFailure());
+
+    TIFFStackVolumeReader reader;
+    auto volume = reader.readData(tmpFile.getFileName());
+    const auto* disk = volume->getRepresentation<VolumeDisk>();
+    ASSERT_TRUE(disk->canLoadSlices());
+
+    auto ram = disk->loadSlices(1, 4);
+    ASSERT_NE(ram, nullptr);
+    EXPECT_TRUE(ram->getDimensions() == (size3_t{dims.x, dims.y, 3}));
+    EXPECT_EQ(ram->getDataFormat(), dataFormat<std::uint16_t>(layout));
+    const auto* data = static_cast<const std::uint16_t*>(ram->getData());
+    EXPECT_EQ((std::vector<std::uint16_t>(data, data + dims.x * dims.y * 3)),
+              (expected<std::uint16_t>(layout, 1, 3)));
+    // Only the requested slices are read, the volume stays on disk
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+
+    EXPECT_THROW(disk->loadSlices(4, dims.z + 1), Exception);
+}
+
+}  // namespace inviwo
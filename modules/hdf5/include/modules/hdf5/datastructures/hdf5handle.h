@@ -66,6 +66,20 @@ public:
         size_t stride;
     };
 
+    /**
+     * Options used when reading volumes.
+     * The chunk cache is used by the HDF5 library when reading hyperslabs of chunked datasets,
+     * it should preferably fit all the chunks of a layer of the selection.
+     * With directChunkRead the chunks touched by the selection are read raw and decompressed in
+     * parallel on the thread pool. This is only done for datasets stored with the same type as
+     * the requested one and compressed using the deflate and shuffle filters, other datasets are
+     * read through the HDF5 library.
+     */
+    struct ReadOptions {
+        size_t chunkCacheSize = 64 * 1024 * 1024;
+        bool directChunkRead = true;
+    };
+
     Handle(const std::filesystem::path& filename);
     Handle(const std::filesystem::path& filename, Path path);
     Handle(const Handle& rhs);
@@ -84,6 +98,25 @@ public:
     std::shared_ptr<Volume> getVolumeAtPathAsType(const Path& path,
                                                   std::vector<Selection> selection,
                                                   const DataFormatBase* type) const;
+    std::shared_ptr<Volume> getVolumeAtPathAsType(const Path& path,
+                                                  std::vector<Selection> selection,
+                                                  const DataFormatBase* type,
+                                                  const ReadOptions& options) const;
+
+    /**
+     * Chunk dimensions of the dataset at path in column major order, empty if the dataset is not
+     * chunked.
+     */
+    std::vector<size_t> getChunkDimensions(const Path& path) const;
+
+    /**
+     * Returns a strided version of selection with at most maxSize samples along each dimension.
+     * For chunked datasets strides larger than a chunk are rounded up to a whole number of
+     * chunks, each chunk read then contributes a single sample along that dimension and only the
+     * chunks containing samples are touched. The selection is in column major order.
+     */
+    std::vector<Selection> getPreviewSelection(const Path& path, std::vector<Selection> selection,
+                                               size_t maxSize) const;
 
     template <typename T>
     std::vector<T> getVectorAtPath(const Path& path) const;
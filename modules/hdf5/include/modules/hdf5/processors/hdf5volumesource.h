@@ -96,6 +96,7 @@ private:
     };
 
     void makeVolume();
+    Handle::ReadOptions getReadOptions();
     void onDataChange();
 
     void onSelectionChange();
@@ -123,6 +124,7 @@ private:
     CompositeProperty information_;
     DoubleMinMaxProperty dataRange_;
     StringProperty dataDimensions_;
+    StringProperty chunkDimensions_;
 
     CompositeProperty outputGroup_;
     OptionPropertyInt overrideRange_;
@@ -131,6 +133,8 @@ private:
     StringProperty valueUnit_;
 
     OptionPropertyInt datatype_;
+    BoolProperty preview_;
+    IntSizeTProperty previewSize_;
 
     DimSelections selection_;
 
@@ -33,11 +33,20 @@
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/formatdispatching.h>
 #include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/foreach.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 
 #include <modules/base/algorithm/dataminmax.h>
 
+#include <zlib.h>
+
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <numeric>
 
 namespace inviwo {
 
@@ -48,6 +57,231 @@ H5::Group load(const std::filesystem::path& filename, const std::string& path) {
     H5::H5File hdfFile(filename.generic_string(), H5F_ACC_RDONLY);
     return hdfFile.openGroup(path);
 }
+
+/*
+ * Chunk dimensions and filter pipeline of a dataset, the dimensions are in row major order and
+ * empty for contiguous datasets.
+ */
+struct ChunkLayout {
+    std::vector<hsize_t> dims;
+    std::vector<H5Z_filter_t> filters;
+    bool supportedFilters = true;
+
+    bool isChunked() const { return !dims.empty(); }
+    size_t elements() const {
+        return std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<>{});
+    }
+};
+
+ChunkLayout getChunkLayout(const H5::DataSet& dataset) {
+    ChunkLayout layout;
+    const auto plist = dataset.getCreatePlist();
+    if (plist.getLayout() != H5D_CHUNKED) return layout;
+
+    layout.dims.resize(dataset.getSpace().getSimpleExtentNdims());
+    plist.getChunk(static_cast<int>(layout.dims.size()), layout.dims.data());
+
+    for (int i = 0; i < plist.getNfilters(); ++i) {
+        unsigned int flags = 0;
+        unsigned int config = 0;
+        size_t nValues = 0;
+        std::array<char, 64> name{};
+        const auto filter =
+            plist.getFilter(i, flags, nValues, nullptr, name.size(), name.data(), config);
+        layout.filters.push_back(filter);
+        layout.supportedFilters &= filter == H5Z_FILTER_DEFLATE || filter == H5Z_FILTER_SHUFFLE;
+    }
+    return layout;
+}
+
+size_t nextPrime(size_t n) {
+    const auto isPrime = [](size_t v) {
+        if (v < 2) return false;
+        for (size_t i = 2; i * i <= v; ++i) {
+            if (v % i == 0) return false;
+        }
+        return true;
+    };
+    while (!isPrime(n)) ++n;
+    return n;
+}
+
+H5::DSetAccPropList chunkCache(size_t cacheSize, size_t chunkSize) {
+    // HDF5 recommends a prime number of hash slots, about 100 times the number of cached chunks
+    const auto chunks = std::max(size_t{1}, cacheSize / std::max(size_t{1}, chunkSize));
+    H5::DSetAccPropList access;
+    access.setChunkCache(nextPrime(100 * chunks), cacheSize, 0.75);
+    return access;
+}
+
+#if H5_VERSION_GE(1, 10, 3)
+
+constexpr bool hasDirectChunkRead = true;
+
+/*
+ * Undo the filter pipeline of a raw chunk. The filters are undone in reverse order, filters
+ * flagged in the mask were skipped when the chunk was written.
+ */
+void decodeChunk(const ChunkLayout& layout, std::uint32_t mask, size_t elementSize,
+                 std::vector<unsigned char>& raw, std::vector<unsigned char>& tmp) {
+    for (size_t i = layout.filters.size(); i-- > 0;) {
+        if (mask & (1u << i)) continue;
+
+        if (layout.filters[i] == H5Z_FILTER_DEFLATE) {
+            tmp.resize(layout.elements() * elementSize);
+            auto size = static_cast<uLongf>(tmp.size());
+            if (uncompress(tmp.data(), &size, raw.data(), static_cast<uLong>(raw.size())) !=
+                Z_OK) {
+                throw Exception(SourceContext{}, "HDF: unable to inflate chunk");
+            }
+            tmp.resize(size);
+        } else if (layout.filters[i] == H5Z_FILTER_SHUFFLE) {
+            tmp.resize(raw.size());
+            const auto count = raw.size() / elementSize;
+            for (size_t byte = 0; byte < elementSize; ++byte) {
+                for (size_t j = 0; j < count; ++j) {
+                    tmp[j * elementSize + byte] = raw[byte * count + j];
+                }
+            }
+            std::copy(raw.begin() + count * elementSize, raw.end(),
+                      tmp.begin() + count * elementSize);
+        }
+        std::swap(raw, tmp);
+    }
+}
+
+/*
+ * Read the selection by visiting only the chunks that contain selected samples. The raw chunks
+ * are read one at a time since the HDF5 library is not reentrant, while the decompression and
+ * the copying of the selected samples is done in parallel on the thread pool.
+ */
+template <typename T>
+void readChunks(const H5::DataSet& dataset, const ChunkLayout& layout,
+                const std::vector<hsize_t>& dataDims, const std::vector<hsize_t>& start,
+                const std::vector<hsize_t>& count, const std::vector<hsize_t>& stride, T* dst) {
+    const auto rank = layout.dims.size();
+
+    std::vector<std::vector<hsize_t>> touched(rank);
+    for (size_t d = 0; d < rank; ++d) {
+        for (hsize_t k = 0; k < count[d]; ++k) {
+            const auto chunk = (start[d] + k * stride[d]) / layout.dims[d];
+            if (touched[d].empty() || touched[d].back() != chunk) touched[d].push_back(chunk);
+        }
+    }
+    const auto nChunks =
+        std::accumulate(touched.begin(), touched.end(), size_t{1},
+                        [](size_t n, const std::vector<hsize_t>& t) { return n * t.size(); });
+
+    std::vector<size_t> dstStrides(rank, 1);
+    std::vector<size_t> chunkStrides(rank, 1);
+    for (size_t d = rank - 1; d > 0; --d) {
+        dstStrides[d - 1] = dstStrides[d] * count[d];
+        chunkStrides[d - 1] = chunkStrides[d] * layout.dims[d];
+    }
+
+    T fill{};
+    dataset.getCreatePlist().getFillValue(TypeMap<T>::getType(), &fill);
+
+    std::mutex mutex;
+    std::exception_ptr error;
+    ::inviwo::util::forEachChunkParallel(nChunks, [&](size_t begin, size_t end) {
+        std::vector<unsigned char> raw;
+        std::vector<unsigned char> tmp;
+        std::vector<hsize_t> offset(rank);
+        std::vector<hsize_t> first(rank);
+        std::vector<hsize_t> last(rank);
+        std::vector<hsize_t> k(rank);
+
+        try {
+            for (size_t i = begin; i < end; ++i) {
+                for (size_t d = rank, rest = i; d-- > 0;) {
+                    offset[d] = touched[d][rest % touched[d].size()] * layout.dims[d];
+                    rest /= touched[d].size();
+                }
+
+                bool allocated = false;
+                std::uint32_t mask = 0;
+                {
+                    const std::scoped_lock lock{mutex};
+                    if (error) return;
+                    // Unallocated chunks report an error, keep it off the HDF5 error stack
+                    hsize_t size = 0;
+                    herr_t status = -1;
+                    H5E_BEGIN_TRY {
+                        status = H5Dget_chunk_storage_size(dataset.getId(), offset.data(), &size);
+                    }
+                    H5E_END_TRY;
+                    if (status >= 0 && size > 0) {
+                        raw.resize(size);
+                        if (H5Dread_chunk(dataset.getId(), H5P_DEFAULT, offset.data(), &mask,
+                                          raw.data()) < 0) {
+                            throw Exception(SourceContext{}, "HDF: unable to read chunk");
+                        }
+                        allocated = true;
+                    }
+                }
+
+                const T* chunk = nullptr;
+                if (allocated) {
+                    decodeChunk(layout, mask, sizeof(T), raw, tmp);
+                    if (raw.size() != layout.elements() * sizeof(T)) {
+                        throw Exception(SourceContext{}, "HDF: unexpected chunk size");
+                    }
+                    chunk = reinterpret_cast<const T*>(raw.data());
+                }
+
+                for (size_t d = 0; d < rank; ++d) {
+                    const auto lo = std::max(offset[d], start[d]);
+                    const auto hi = std::min(offset[d] + layout.dims[d], dataDims[d]);
+                    first[d] = (lo - start[d] + stride[d] - 1) / stride[d];
+                    last[d] = std::min(count[d], (hi - start[d] + stride[d] - 1) / stride[d]);
+                }
+
+                const auto inner = rank - 1;
+                k = first;
+                while (true) {
+                    size_t src = 0;
+                    size_t dstIndex = 0;
+                    for (size_t d = 0; d < inner; ++d) {
+                        src += (start[d] + k[d] * stride[d] - offset[d]) * chunkStrides[d];
+                        dstIndex += k[d] * dstStrides[d];
+                    }
+                    for (auto j = first[inner]; j < last[inner]; ++j) {
+                        dst[dstIndex + j] =
+                            chunk ? chunk[src + start[inner] + j * stride[inner] - offset[inner]]
+                                  : fill;
+                    }
+
+                    size_t d = inner;
+                    for (; d > 0; --d) {
+                        if (++k[d - 1] < last[d - 1]) break;
+                        k[d - 1] = first[d - 1];
+                    }
+                    if (d == 0) break;
+                }
+            }
+        } catch (...) {
+            const std::scoped_lock lock{mutex};
+            if (!error) error = std::current_exception();
+        }
+    });
+
+    if (error) std::rethrow_exception(error);
+}
+
+#else
+
+constexpr bool hasDirectChunkRead = false;
+
+template <typename T>
+void readChunks(const H5::DataSet&, const ChunkLayout&, const std::vector<hsize_t>&,
+                const std::vector<hsize_t>&, const std::vector<hsize_t>&,
+                const std::vector<hsize_t>&, T*) {
+    throw Exception(SourceContext{}, "HDF: reading raw chunks requires HDF5 1.10.3 or later");
+}
+
+#endif
+
 }  // namespace
 
 Handle::Handle(const std::filesystem::path& filename)
@@ -123,13 +357,49 @@ double Handle::getMax(const DataFormatBase* type) const {
     }
 }
 
+std::vector<size_t> Handle::getChunkDimensions(const Path& path) const {
+    auto dataset = data_.openDataSet(path);
+    ::inviwo::util::OnScopeExit closedataset{[&]() { dataset.close(); }};
+
+    const auto layout = getChunkLayout(dataset);
+    return std::vector<size_t>(layout.dims.rbegin(), layout.dims.rend());
+}
+
+std::vector<Handle::Selection> Handle::getPreviewSelection(const Path& path,
+                                                           std::vector<Selection> selection,
+                                                           size_t maxSize) const {
+    const auto chunks = getChunkDimensions(path);
+    maxSize = std::max(maxSize, size_t{1});
+
+    for (size_t i = 0; i < selection.size(); ++i) {
+        auto& sel = selection[i];
+        const auto extent = sel.end - sel.start;
+        sel.stride = std::max(sel.stride, (extent + maxSize - 1) / maxSize);
+
+        if (i < chunks.size() && sel.stride > chunks[i]) {
+            const auto aligned = (sel.stride + chunks[i] - 1) / chunks[i] * chunks[i];
+            if (aligned <= extent) sel.stride = aligned;
+        }
+    }
+    return selection;
+}
+
 std::shared_ptr<Volume> Handle::getVolumeAtPathAsType(const Path& path,
                                                       std::vector<Selection> selection,
                                                       const DataFormatBase* type) const {
+    return getVolumeAtPathAsType(path, std::move(selection), type, ReadOptions{});
+}
+
+std::shared_ptr<Volume> Handle::getVolumeAtPathAsType(const Path& path,
+                                                      std::vector<Selection> selection,
+                                                      const DataFormatBase* type,
+                                                      const ReadOptions& options) const {
 
     auto dataset = data_.openDataSet(path);
     ::inviwo::util::OnScopeExit closedataset{[&]() { dataset.close(); }};
 
+    const auto layout = getChunkLayout(dataset);
+
     const H5::DataSpace dataSpace = dataset.getSpace();
     const size_t rank = dataSpace.getSimpleExtentNdims();
     if (selection.size() != rank) {
@@ -181,9 +451,10 @@ std::shared_ptr<Volume> Handle::getVolumeAtPathAsType(const Path& path,
 
     hsize_t selectionSize = memorySpace.getSelectNpoints();
 
-    log::info("Data rank: {} dims {} size {} selection {} memory size {} memory dim {}", rank,
-              joinString(dataDimensions, " x "), dataSize, dataSpace.getSelectNpoints(),
-              memorySpace.getSelectNpoints(), volumeDimensions);
+    log::info("Data rank: {} dims {} chunks {} size {} selection {} memory size {} memory dim {}",
+              rank, joinString(dataDimensions, " x "),
+              layout.isChunked() ? joinString(layout.dims, " x ") : "contiguous", dataSize,
+              dataSpace.getSelectNpoints(), memorySpace.getSelectNpoints(), volumeDimensions);
 
     const DataFormatBase* format = type ? type : util::getDataFormatFromDataSet(dataset);
 
@@ -198,7 +469,19 @@ std::shared_ptr<Volume> Handle::getVolumeAtPathAsType(const Path& path,
             ValueType* data = vrprecision->getDataTyped();
 
             try {
-                dataset.read(data, TypeMap<ValueType>::getType(), memorySpace, dataSpace);
+                if (hasDirectChunkRead && options.directChunkRead && layout.isChunked() &&
+                    layout.supportedFilters &&
+                    dataset.getDataType() == TypeMap<ValueType>::getType()) {
+                    readChunks(dataset, layout, dataDimensions, start, count, stride, data);
+                } else if (layout.isChunked()) {
+                    auto cached = data_.openDataSet(
+                        path, chunkCache(options.chunkCacheSize,
+                                         layout.elements() * dataset.getDataType().getSize()));
+                    ::inviwo::util::OnScopeExit closecached{[&]() { cached.close(); }};
+                    cached.read(data, TypeMap<ValueType>::getType(), memorySpace, dataSpace);
+                } else {
+                    dataset.read(data, TypeMap<ValueType>::getType(), memorySpace, dataSpace);
+                }
             } catch (H5::DataSetIException& e) {
                 throw Exception(SourceContext{}, "HDF: unable to read data: {}", e.getDetailMsg());
             }
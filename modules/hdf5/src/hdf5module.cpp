@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <modules/hdf5/hdf5module.h>
+#include <modules/hdf5/hdf5settings.h>
 
 #include <modules/hdf5/ports/hdf5port.h>
 #include <modules/hdf5/processors/hdf5source.h>
@@ -43,6 +44,8 @@ HDF5Module::HDF5Module(InviwoApplication* app) : InviwoModule(app, "HDF5") {
     registerProcessor<hdf5::Source>();
     registerProcessor<hdf5::HDF5ToVolume>();
     registerProcessor<hdf5::PathSelection>();
+
+    registerSettings(std::make_unique<hdf5::HDF5Settings>());
 }
 
 }  // namespace inviwo
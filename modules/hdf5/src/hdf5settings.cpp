@@ -0,0 +1,62 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/hdf5/hdf5settings.h>
+
+#include <inviwo/core/algorithm/markdown.h>             // for operator""_help
+#include <inviwo/core/properties/constraintbehavior.h>  // for ConstraintBehavior, ConstraintBeh...
+#include <inviwo/core/properties/invalidationlevel.h>   // for InvalidationLevel, InvalidationLe...
+#include <inviwo/core/properties/propertysemantics.h>   // for PropertySemantics, PropertySemant...
+
+namespace inviwo {
+
+namespace hdf5 {
+
+HDF5Settings::HDF5Settings()
+    : Settings("HDF5")
+    , chunkCacheSize_("chunkCacheSize", "Chunk Cache (MB)",
+                      "Size of the HDF5 chunk cache used per dataset when reading hyperslabs. "
+                      "Should be large enough to fit a full layer of chunks of the selection"_help,
+                      64, {1, ConstraintBehavior::Immutable}, {4096, ConstraintBehavior::Editable},
+                      1, InvalidationLevel::InvalidOutput, PropertySemantics::Text)
+    , directChunkRead_("directChunkRead", "Parallel Chunk Decompression",
+                       "Read the raw chunks touched by a selection and decompress them in "
+                       "parallel on the thread pool. Only used for datasets compressed with the "
+                       "deflate and shuffle filters, other datasets are read through the HDF5 "
+                       "library"_help,
+                       true) {
+
+    addProperties(chunkCacheSize_, directChunkRead_);
+
+    load();
+}
+
+}  // namespace hdf5
+
+}  // namespace inviwo
@@ -30,6 +30,8 @@
 #include <modules/hdf5/processors/hdf5volumesource.h>
 #include <modules/hdf5/datastructures/hdf5handle.h>
 #include <modules/hdf5/datastructures/hdf5path.h>
+#include <modules/hdf5/hdf5settings.h>
+#include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/io/datareader.h>
 #include <inviwo/core/io/datareaderexception.h>
 #include <inviwo/core/network/networklock.h>
@@ -75,6 +77,7 @@ HDF5ToVolume::HDF5ToVolume()
     , dataRange_("dataRange", "Range", 0., 255.0, -DataFloat64::max(), DataFloat64::max(), 0.0, 0.0,
                  InvalidationLevel::InvalidOutput, PropertySemantics("Text"))
     , dataDimensions_("dataDimensions", "Dimensions")
+    , chunkDimensions_("chunkDimensions", "Chunks")
 
     , outputGroup_("outputGroup", "Operations", InvalidationLevel::Valid)
     , overrideRange_("overrideRange", "Use Range", {{"data", "Data", 0}, {"custom", "Custom", 1}},
@@ -93,6 +96,12 @@ HDF5ToVolume::HDF5ToVolume()
                  {"uchar", "Unsigned Char", 2},
                  {"ushort", "Unsigned Short", 3}},
                 0)
+    , preview_("preview", "Preview",
+               "Load a low resolution preview of the selection, the strides are increased to "
+               "give at most __Preview Size__ voxels along each dimension and aligned to the "
+               "chunks of the dataset to read as few chunks as possible"_help,
+               false)
+    , previewSize_("previewSize", "Preview Size", 128, 8, 1024)
     , selection_("selection", "Selection", 6)
     , dirty_(false) {
 
@@ -113,11 +122,14 @@ HDF5ToVolume::HDF5ToVolume()
     basisSelection_.setSerializationMode(PropertySerializationMode::All);
 
     dataDimensions_.setReadOnly(true);
+    chunkDimensions_.setReadOnly(true);
     dataRange_.setReadOnly(true);
-    information_.addProperties(dataDimensions_, dataRange_);
+    information_.addProperties(dataDimensions_, chunkDimensions_, dataRange_);
 
-    outputGroup_.addProperties(datatype_, overrideRange_, outDataRange_, valueRange_, valueUnit_,
-                               selection_);
+    previewSize_.visibilityDependsOn(preview_, [](const BoolProperty& p) { return p.get(); });
+
+    outputGroup_.addProperties(datatype_, preview_, previewSize_, overrideRange_, outDataRange_,
+                               valueRange_, valueUnit_, selection_);
     outputGroup_.onChange([this]() {
         if (automaticEvaluation_) {
             dirty_ = true;
@@ -312,6 +324,13 @@ void HDF5ToVolume::onSelectionChange() {
     if (!volumeMatches_.empty()) {
         MetaData volumeMeta = volumeMatches_[volumeSelection_.getSelectedIndex()];
         dataDimensions_.set("[" + joinString(volumeMeta.getColumnMajorDimensions(), ", ") + "]");
+        if (inport_.hasData()) {
+            const auto data = inport_.getData();
+            const auto chunks = data->getChunkDimensions(Path(data->getGroup().getObjName()) +
+                                                         volumeMeta.path_);
+            chunkDimensions_.set(chunks.empty() ? "Contiguous"
+                                                : "[" + joinString(chunks, ", ") + "]");
+        }
         selection_.update(volumeMeta);
     }
 }
@@ -337,9 +356,13 @@ void HDF5ToVolume::makeVolume() {
                 }
             }();
 
-            volume_ = std::shared_ptr<Volume>(
-                data->getVolumeAtPathAsType(Path(data->getGroup().getObjName()) + volumeMeta.path_,
-                                            selection_.getSelection(), format));
+            const auto path = Path(data->getGroup().getObjName()) + volumeMeta.path_;
+            auto selection = selection_.getSelection();
+            if (preview_) {
+                selection = data->getPreviewSelection(path, std::move(selection), previewSize_);
+            }
+
+            volume_ = data->getVolumeAtPathAsType(path, selection, format, getReadOptions());
 
             dataRange_.set(volume_->dataMap.dataRange);
             outport_.setData(volume_);
@@ -350,6 +373,15 @@ void HDF5ToVolume::makeVolume() {
     }
 }
 
+Handle::ReadOptions HDF5ToVolume::getReadOptions() {
+    Handle::ReadOptions options;
+    if (auto settings = getInviwoApplication()->getSettingsByType<HDF5Settings>()) {
+        options.chunkCacheSize = settings->chunkCacheSize_.get() * 1024 * 1024;
+        options.directChunkRead = settings->directChunkRead_.get();
+    }
+    return options;
+}
+
 HDF5ToVolume::DimSelection::DimSelection(const std::string& identifier,
                                          const std::string& displayName, InvalidationLevel level)
     : CompositeProperty(identifier, displayName, level, PropertySemantics::Default)
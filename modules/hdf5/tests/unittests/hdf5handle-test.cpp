@@ -0,0 +1,173 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/hdf5/datastructures/hdf5handle.h>
+#include <modules/hdf5/datastructures/hdf5path.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/formats.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+// Row major dimensions, the chunks do not divide the dimensions to get partial edge chunks
+constexpr std::array<hsize_t, 3> dims{13, 11, 10};
+constexpr std::array<hsize_t, 3> chunks{4, 5, 3};
+
+template <typename T>
+void writeDataset(H5::H5File& file, const std::string& name, const H5::PredType& type,
+                  bool sparse) {
+    H5::DSetCreatPropList plist;
+    plist.setChunk(static_cast<int>(chunks.size()), chunks.data());
+    plist.setShuffle();
+    plist.setDeflate(6);
+    const T fillValue = std::numeric_limits<T>::max();
+    plist.setFillValue(type, &fillValue);
+
+    const H5::DataSpace space(static_cast<int>(dims.size()), dims.data());
+    auto dataset = file.createDataSet(name, type, space, plist);
+
+    std::vector<T> values(std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<>{}));
+    std::iota(values.begin(), values.end(), T{0});
+
+    if (!sparse) {
+        dataset.write(values.data(), type);
+        return;
+    }
+
+    // Only write a block in the middle, the chunks outside of it are never allocated
+    const std::array<hsize_t, 3> start{5, 3, 4};
+    const std::array<hsize_t, 3> count{4, 5, 3};
+    auto fileSpace = dataset.getSpace();
+    fileSpace.selectHyperslab(H5S_SELECT_SET, count.data(), start.data());
+    const H5::DataSpace memSpace(static_cast<int>(count.size()), count.data());
+    dataset.write(values.data(), type, memSpace, fileSpace);
+}
+
+/*
+ * Read a selection (in column major order like Handle::Selection) with H5::DataSet::read
+ */
+template <typename T>
+std::vector<T> readReference(const std::filesystem::path& filename, const std::string& name,
+                             const H5::PredType& type, std::vector<hdf5::Handle::Selection> sel) {
+    std::reverse(sel.begin(), sel.end());
+    std::vector<hsize_t> start;
+    std::vector<hsize_t> count;
+    std::vector<hsize_t> stride;
+    for (const auto& s : sel) {
+        start.push_back(s.start);
+        count.push_back((s.end - s.start) / s.stride);
+        stride.push_back(s.stride);
+    }
+
+    const H5::H5File file(filename.string(), H5F_ACC_RDONLY);
+    const auto dataset = file.openDataSet(name);
+    auto fileSpace = dataset.getSpace();
+    fileSpace.selectHyperslab(H5S_SELECT_SET, count.data(), start.data(), stride.data());
+    const H5::DataSpace memSpace(static_cast<int>(count.size()), count.data());
+
+    std::vector<T> result(
+        std::accumulate(count.begin(), count.end(), size_t{1}, std::multiplies<>{}));
+    dataset.read(result.data(), type, memSpace, fileSpace);
+    return result;
+}
+
+template <typename T>
+std::vector<T> readHandle(const std::filesystem::path& filename, const std::string& name,
+                          const std::vector<hdf5::Handle::Selection>& sel, bool direct) {
+    const hdf5::Handle handle{filename};
+    const auto volume = handle.getVolumeAtPathAsType(
+        hdf5::Path{name}, sel, DataFormat<T>::get(),
+        hdf5::Handle::ReadOptions{.directChunkRead = direct});
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+    const auto* data = static_cast<const T*>(ram->getData());
+    return std::vector<T>(data, data + glm::compMul(ram->getDimensions()));
+}
+
+const std::vector<std::vector<hdf5::Handle::Selection>> selections{
+    // everything
+    {{0, 10, 1}, {0, 11, 1}, {0, 13, 1}},
+    // strided, with starts that are not chunk aligned
+    {{1, 10, 3}, {2, 11, 2}, {0, 13, 5}},
+    // a single slice through the partial edge chunks
+    {{0, 10, 1}, {0, 11, 1}, {12, 13, 1}},
+    // a sub block crossing chunk borders
+    {{2, 9, 1}, {4, 11, 1}, {3, 10, 2}}};
+
+template <typename T>
+void compareReads(const H5::PredType& type, bool sparse) {
+    const util::TempFileHandle tmpFile("hdf5", ".h5");
+    {
+        H5::H5File file(tmpFile.getFileName().string(), H5F_ACC_TRUNC);
+        writeDataset<T>(file, "data", type, sparse);
+    }
+
+    for (const auto& sel : selections) {
+        const auto expected = readReference<T>(tmpFile.getFileName(), "data", type, sel);
+        const auto direct = readHandle<T>(tmpFile.getFileName(), "data", sel, true);
+        const auto library = readHandle<T>(tmpFile.getFileName(), "data", sel, false);
+        EXPECT_EQ(expected, direct) << "selection start " << sel[0].start << ", "
+                                    << sel[1].start << ", " << sel[2].start;
+        EXPECT_EQ(expected, library);
+    }
+}
+
+}  // namespace
+
+TEST(HDF5Handle, DirectChunkReadFloat) { compareReads<float>(H5::PredType::NATIVE_FLOAT, false); }
+
+TEST(HDF5Handle, DirectChunkReadUInt16) {
+    compareReads<std::uint16_t>(H5::PredType::NATIVE_UINT16, false);
+}
+
+TEST(HDF5Handle, DirectChunkReadUnallocatedChunks) {
+    compareReads<float>(H5::PredType::NATIVE_FLOAT, true);
+}
+
+}  // namespace inviwo
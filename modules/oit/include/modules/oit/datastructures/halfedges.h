@@ -31,16 +31,18 @@
 
 #include <modules/oit/oitmoduledefine.h>  // for IVW_MODULE_MESHRENDERIN...
 
-#include <inviwo/core/datastructures/buffer/buffer.h>  // for IndexBuffer
-#include <inviwo/core/datastructures/geometry/mesh.h>  // for Mesh
-#include <inviwo/core/util/iterrange.h>                // for as_range
-#include <inviwo/core/util/transformiterator.h>        // for TransformIterator, make...
-
-#include <cstdint>        // for uint32_t
-#include <iterator>       // for bidirectional_iterator_tag
-#include <optional>       // for optional, nullopt
-#include <unordered_map>  // for unordered_map<>::const_...
-#include <vector>         // for vector
+#include <inviwo/core/datastructures/buffer/buffer.h>       // for IndexBuffer
+#include <inviwo/core/datastructures/geometry/mesh.h>       // for Mesh
+#include <inviwo/core/util/iterrange.h>                     // for as_range
+#include <inviwo/core/util/transformiterator.h>             // for TransformIterator, make...
+#include <modules/base/algorithm/mesh/triangleadjacency.h>  // for TriangleAdjacency
+
+#include <cstdint>    // for uint32_t
+#include <iterator>   // for bidirectional_iterator_tag
+#include <limits>     // for numeric_limits
+#include <optional>   // for optional, nullopt
+#include <stdexcept>  // for out_of_range
+#include <vector>     // for vector
 
 namespace inviwo {
 
@@ -77,6 +79,12 @@ public:
      */
     HalfEdges(const Mesh& mesh);
 
+    /**
+     * \brief Construct from the twin edges of a TriangleAdjacency
+     * Face f and half edge e of the half edges are triangle f and half edge e of the adjacency.
+     */
+    explicit HalfEdges(const meshutil::TriangleAdjacency& adjacency);
+
     /**
      * \brief Creates a index buffer for triangles with connectivity 'None'
      */
@@ -164,9 +172,18 @@ private:
         std::optional<std::uint32_t> twin = std::nullopt;
     };
 
+    static constexpr std::uint32_t noEdge = std::numeric_limits<std::uint32_t>::max();
+
     std::vector<HalfEdge> edges_;
-    std::unordered_map<std::uint32_t, std::uint32_t> vertexToEdge_;
-    std::unordered_map<std::uint32_t, std::uint32_t> faceToEdge_;
+    /**
+     * \brief First half edge of each vertex index, noEdge for vertices without triangles
+     */
+    std::vector<std::uint32_t> vertexToEdge_;
+    /**
+     * \brief First half edge of each vertex that is part of a triangle
+     */
+    std::vector<std::uint32_t> vertexEdges_;
+    std::vector<std::uint32_t> faceToEdge_;
 };
 
 inline auto HalfEdges::faceToEdge(std::uint32_t faceIndex) const -> EdgeIter {
@@ -174,29 +191,23 @@ inline auto HalfEdges::faceToEdge(std::uint32_t faceIndex) const -> EdgeIter {
 }
 
 inline auto HalfEdges::vertexToEdge(std::uint32_t vertexIndex) const -> EdgeIter {
-    return {this, vertexToEdge_.at(vertexIndex)};
+    const auto edge = vertexToEdge_.at(vertexIndex);
+    if (edge == noEdge) throw std::out_of_range("Vertex is not part of any face");
+    return {this, edge};
 }
 
 inline auto HalfEdges::faces() const {
-    const auto transform =
-        [this](
-            const std::unordered_map<std::uint32_t, std::uint32_t>::value_type& item) -> EdgeIter {
-        return {this, item.second};
-    };
+    const auto transform = [this](std::uint32_t edge) -> EdgeIter { return {this, edge}; };
 
     return util::as_range(util::makeTransformIterator(transform, faceToEdge_.begin()),
                           util::makeTransformIterator(transform, faceToEdge_.end()));
 }
 
 inline auto HalfEdges::vertices() const {
-    const auto transform =
-        [this](
-            const std::unordered_map<std::uint32_t, std::uint32_t>::value_type& item) -> EdgeIter {
-        return {this, item.second};
-    };
+    const auto transform = [this](std::uint32_t edge) -> EdgeIter { return {this, edge}; };
 
-    return util::as_range(util::makeTransformIterator(transform, vertexToEdge_.begin()),
-                          util::makeTransformIterator(transform, vertexToEdge_.end()));
+    return util::as_range(util::makeTransformIterator(transform, vertexEdges_.begin()),
+                          util::makeTransformIterator(transform, vertexEdges_.end()));
 }
 
 inline std::uint32_t HalfEdges::EdgeIter::vertex() const {
@@ -34,92 +34,48 @@
 #include <inviwo/core/datastructures/geometry/geometrytype.h>      // for DrawType, DrawType::Tr...
 #include <inviwo/core/datastructures/geometry/mesh.h>              // for Mesh, Mesh::IndexVector
 #include <inviwo/core/util/assertion.h>                            // for IVW_ASSERT
+#include <inviwo/core/util/foreach.h>                              // for forEachChunkParallel
 #include <inviwo/core/util/iterrange.h>                            // for iter_range
 #include <inviwo/core/util/transformiterator.h>                    // for TransformIterator
-#include <modules/base/algorithm/meshutils.h>                      // for forEachTriangle
+#include <modules/base/algorithm/mesh/triangleadjacency.h>         // for TriangleAdjacency
 
-#include <map>          // for map, operator!=, __map...
+#include <algorithm>    // for max
 #include <memory>       // for make_shared, shared_ptr
 #include <type_traits>  // for remove_reference<>::type
-#include <utility>      // for pair, move
+#include <utility>      // for move
 
 namespace inviwo {
 
-HalfEdges::HalfEdges(Mesh::MeshInfo info, const IndexBuffer& indexBuffer) {
-    // map to fill in the opposite direction
-    // (start_vertex, end_vertex) -> edge_index
-    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> edgeMap;
+HalfEdges::HalfEdges(Mesh::MeshInfo info, const IndexBuffer& indexBuffer)
+    : HalfEdges(meshutil::TriangleAdjacency{info, indexBuffer}) {}
 
-    std::uint32_t face = 0;
-    meshutil::forEachTriangle(info, indexBuffer,
-                              [&](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
-                                  // a-b, b-c, c-a
-                                  const auto count = static_cast<std::uint32_t>(edges_.size());
-                                  edges_.push_back(HalfEdge{a, face, count + 1, count + 2});
-                                  edgeMap.try_emplace({a, b}, count + 0);
-                                  vertexToEdge_.try_emplace(a, count + 0);
+HalfEdges::HalfEdges(const Mesh& mesh) : HalfEdges(meshutil::TriangleAdjacency{mesh}) {}
 
-                                  edges_.push_back(HalfEdge{b, face, count + 2, count + 0});
-                                  edgeMap.try_emplace({b, c}, count + 1);
-                                  vertexToEdge_.try_emplace(b, count + 1);
+HalfEdges::HalfEdges(const meshutil::TriangleAdjacency& adjacency)
+    : edges_(adjacency.getNumberOfHalfEdges())
+    , faceToEdge_(adjacency.getNumberOfTriangles()) {
 
-                                  edges_.push_back(HalfEdge{c, face, count + 0, count + 1});
-                                  edgeMap.try_emplace({c, a}, count + 2);
-                                  vertexToEdge_.try_emplace(c, count + 2);
-
-                                  faceToEdge_.try_emplace(face, count);
-
-                                  ++face;
-                              });
-
-    for (auto& edge : edges_) {
-        const auto a = edge.vertex;
-        const auto b = edges_[edge.next].vertex;
-
-        auto it = edgeMap.find(std::pair{b, a});
-        if (it != edgeMap.end()) {
-            edge.twin = it->second;
+    using Adj = meshutil::TriangleAdjacency;
+    util::forEachChunkParallel(edges_.size(), [&](size_t begin, size_t end) {
+        for (auto e = static_cast<std::uint32_t>(begin); e < end; ++e) {
+            const auto twin = adjacency.twin(e);
+            edges_[e] = HalfEdge{adjacency.from(e), Adj::triangle(e), Adj::next(e), Adj::prev(e),
+                                 twin == Adj::noTwin ? std::nullopt : std::optional{twin}};
         }
+    });
+    for (std::uint32_t face = 0; face < faceToEdge_.size(); ++face) {
+        faceToEdge_[face] = 3 * face;
     }
-}
-
-HalfEdges::HalfEdges(const Mesh& mesh) {
-
-    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> edgeMap;
-    std::uint32_t face = 0;
 
-    for (auto [info, indexBuffer] : mesh.getIndexBuffers()) {
-        if (info.dt != DrawType::Triangles) continue;
-        meshutil::forEachTriangle(info, *indexBuffer,
-                                  [&](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
-                                      // a-b, b-c, c-a
-                                      const auto count = static_cast<std::uint32_t>(edges_.size());
-                                      edges_.push_back(HalfEdge{a, face, count + 1, count + 2});
-                                      edgeMap.try_emplace({a, b}, count + 0);
-                                      vertexToEdge_.try_emplace(a, count + 0);
-
-                                      edges_.push_back(HalfEdge{b, face, count + 2, count + 0});
-                                      edgeMap.try_emplace({b, c}, count + 1);
-                                      vertexToEdge_.try_emplace(b, count + 1);
-
-                                      edges_.push_back(HalfEdge{c, face, count + 0, count + 1});
-                                      edgeMap.try_emplace({c, a}, count + 2);
-                                      vertexToEdge_.try_emplace(c, count + 2);
-
-                                      faceToEdge_.try_emplace(face, count);
-
-                                      ++face;
-                                  });
+    // The first half edge starting in each vertex, vertices without faces are left as noEdge
+    std::uint32_t maxVertex = 0;
+    for (const auto& edge : edges_) maxVertex = std::max(maxVertex, edge.vertex);
+    vertexToEdge_.assign(edges_.empty() ? 0 : size_t{maxVertex} + 1, noEdge);
+    for (auto e = static_cast<std::uint32_t>(edges_.size()); e-- > 0;) {
+        vertexToEdge_[edges_[e].vertex] = e;
     }
-
-    for (auto& edge : edges_) {
-        const auto a = edge.vertex;
-        const auto b = edges_[edge.next].vertex;
-
-        auto it = edgeMap.find(std::pair{b, a});
-        if (it != edgeMap.end()) {
-            edge.twin = it->second;
-        }
+    for (const auto edge : vertexToEdge_) {
+        if (edge != noEdge) vertexEdges_.push_back(edge);
     }
 }
 
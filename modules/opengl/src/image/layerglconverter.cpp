@@ -32,6 +32,7 @@
 #include <inviwo/core/datastructures/image/layerram.h>  // for LayerRAM (ptr only), createLayerRAM
 #include <inviwo/core/util/formats.h>                   // for DataFormatBase
 #include <inviwo/core/util/logcentral.h>                // for LogCentral
+#include <inviwo/core/resourcemanager/resource.h>       // for evictable, makeEvictable
 #include <modules/opengl/image/layergl.h>               // for LayerGL
 #include <modules/opengl/texture/texture2d.h>           // IWYU pragma: keep
 
@@ -52,6 +53,9 @@ std::shared_ptr<LayerGL> LayerRAM2GLConverter::createFrom(
     }
 
     dst->getTexture()->initialize(src->getData());
+    // The GL representation can be recreated from RAM, hence it can be evicted.
+    resource::evictable(resource::GL{dst->getTexture()->getID()},
+                        resource::makeEvictable<LayerRepresentation>(dst, src));
     return dst;
 }
 
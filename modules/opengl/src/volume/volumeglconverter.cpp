@@ -32,6 +32,7 @@
 #include <inviwo/core/datastructures/volume/volumeram.h>  // for VolumeRAM (ptr only), createVol...
 #include <inviwo/core/util/formats.h>                     // for DataFormatBase
 #include <inviwo/core/util/logcentral.h>                  // for LogCentral
+#include <inviwo/core/resourcemanager/resource.h>         // for evictable, makeEvictable
 #include <modules/opengl/volume/volumegl.h>               // for VolumeGL
 #include <modules/opengl/texture/texture3d.h>             // IWYU pragma: keep
 
@@ -52,6 +53,9 @@ std::shared_ptr<VolumeGL> VolumeRAM2GLConverter::createFrom(
     }
 
     dst->getTexture()->initialize(src->getData());
+    // The GL representation can be recreated from RAM, hence it can be evicted.
+    resource::evictable(resource::GL{dst->getTexture()->getID()},
+                        resource::makeEvictable<VolumeRepresentation>(dst, src));
     return dst;
 }
 
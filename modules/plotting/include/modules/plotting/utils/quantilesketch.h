@@ -0,0 +1,121 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#pragma once
+
+#include <modules/plotting/plottingmoduledefine.h>  // for IVW_MODULE_PLOTTING_API
+
+#include <cstddef>  // for size_t
+#include <random>   // for minstd_rand
+#include <span>     // for span
+#include <vector>   // for vector
+
+namespace inviwo {
+
+namespace statsutil {
+
+/**
+ * \brief Approximate quantiles of a stream of values in bounded memory
+ * Implements the KLL sketch (Karnin, Lang, and Liberty, "Optimal Quantile Approximation in
+ * Streams", 2016). The values are kept in a hierarchy of compactors where the values in level h
+ * represent 2^h values each. When the sketch is full, a level is sorted and every other value is
+ * promoted to the next level. The rank error of a quantile is about 1.7 / k of the number of
+ * values, independent of the number of values, while at most about 3k values are retained.
+ *
+ * Values can be added in chunks as they become available, for example to show progressively
+ * refined box plots of large data frame columns. Sketches of separate parts of the data, for
+ * example computed in parallel, can be combined with merge(). NaNs are ignored. Use percentiles()
+ * for exact results when all of the data is available.
+ *
+ * Quantiles use the nearest rank method, as percentiles(). The minimum and maximum are exact.
+ */
+class IVW_MODULE_PLOTTING_API QuantileSketch {
+public:
+    /**
+     * @param k  controls the accuracy and size of the sketch, larger is more accurate
+     */
+    explicit QuantileSketch(size_t k = 200);
+
+    void add(double value);
+
+    template <typename T>
+    void add(std::span<const T> values) {
+        for (const auto& value : values) {
+            add(static_cast<double>(value));
+        }
+    }
+
+    /**
+     * Combine with a sketch of other values, @p other must use the same k
+     */
+    void merge(const QuantileSketch& other);
+
+    /**
+     * Number of values added, excluding NaNs
+     */
+    size_t count() const;
+    /**
+     * Number of values retained by the sketch
+     */
+    size_t size() const;
+    double min() const;
+    double max() const;
+
+    /**
+     * Approximation of the value below a percentage @p q of the values
+     * @throw Exception if @p q is less than 0 or larger than 1, or if the sketch is empty
+     */
+    double quantile(double q) const;
+    /**
+     * Approximations of the values below the percentages @p qs of the values
+     * @throw Exception if any of @p qs is less than 0 or larger than 1, or if the sketch is empty
+     */
+    std::vector<double> quantiles(const std::vector<double>& qs) const;
+    /**
+     * Approximation of the fraction of values less than or equal to @p value
+     */
+    double rank(double value) const;
+
+private:
+    void updateCapacities();
+    void compress();
+
+    size_t k_;
+    size_t count_;
+    double min_;
+    double max_;
+    std::vector<std::vector<double>> levels_;
+    std::vector<size_t> capacities_;  // Capacity of each level, updated when a level is added
+    std::minstd_rand random_;
+};
+
+}  // namespace statsutil
+
+}  // namespace inviwo
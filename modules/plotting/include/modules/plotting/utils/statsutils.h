@@ -27,24 +27,26 @@
  *
  *********************************************************************************/
 
+
 #pragma once
 
 #include <modules/plotting/plottingmoduledefine.h>  // for IVW_MODULE_PLOTTING_API
 
 #include <inviwo/core/util/exception.h>      // for Exception
+#include <inviwo/core/util/foreach.h>        // for forEachChunkParallel
 #include <inviwo/core/util/glm.h>            // for isnan
 #include <inviwo/core/util/glmutils.h>       // for is_floating_point
 #include <inviwo/core/util/sourcecontext.h>  // for SourceContext
 
-#include <algorithm>    // for max, sort, partition
+#include <algorithm>    // for max, min, nth_element, sort
 #include <cmath>        // for ceil
 #include <cstddef>      // for size_t
 #include <iosfwd>       // for ostream
-#include <iterator>     // for distance
-#include <stdexcept>    // for invalid_argument
+#include <iterator>     // for back_inserter, distance
+#include <numeric>      // for accumulate, iota
+#include <span>         // for span
 #include <string>       // for string
 #include <string_view>  // for string_view
-#include <type_traits>  // for enable_if
 #include <vector>       // for vector
 
 #include <glm/common.hpp>
@@ -60,8 +62,302 @@ struct RegresionResult {
     double corr;
 };
 
+namespace detail {
+
+/**
+ * Sums of a pair of data channels needed for a linear regression. Partial sums of separate
+ * blocks of data are combined with merge().
+ */
+struct IVW_MODULE_PLOTTING_API RegressionMoments {
+    size_t count{0};
+    double meanX{0.0};
+    double meanY{0.0};
+    double m2x{0.0};
+    double m2y{0.0};
+    double cxy{0.0};
+
+    void merge(const RegressionMoments& other);
+    RegresionResult result() const;
+};
+
+template <typename T>
+bool isValid(const T& value) {
+    if constexpr (util::is_floating_point<T>::value) {
+        return !glm::isnan(value);
+    } else {
+        return true;
+    }
+}
+
+template <typename Tx, typename Ty>
+RegressionMoments regressionMoments(std::span<const Tx> x, std::span<const Ty> y) {
+    constexpr size_t blockSize = 4096;
+    RegressionMoments moments;
+    for (size_t begin = 0; begin < x.size(); begin += blockSize) {
+        const auto end = std::min(begin + blockSize, x.size());
+
+        // Two passes over each block, first for the means and then for the deviations
+        RegressionMoments block;
+        double sumX = 0.0;
+        double sumY = 0.0;
+        for (size_t i = begin; i < end; ++i) {
+            if (isValid(x[i]) && isValid(y[i])) {
+                sumX += static_cast<double>(x[i]);
+                sumY += static_cast<double>(y[i]);
+                ++block.count;
+            }
+        }
+        if (block.count == 0) continue;
+        block.meanX = sumX / static_cast<double>(block.count);
+        block.meanY = sumY / static_cast<double>(block.count);
+        for (size_t i = begin; i < end; ++i) {
+            if (isValid(x[i]) && isValid(y[i])) {
+                const auto dx = static_cast<double>(x[i]) - block.meanX;
+                const auto dy = static_cast<double>(y[i]) - block.meanY;
+                block.m2x += dx * dx;
+                block.m2y += dy * dy;
+                block.cxy += dx * dy;
+            }
+        }
+        moments.merge(block);
+    }
+    return moments;
+}
+
+/**
+ * Nearest rank of @p percentile among @p size elements, i.e. ceil(percentile * size) - 1
+ * @throw Exception if @p percentile is less than 0 or larger than 1
+ */
+inline size_t percentileRank(double percentile, size_t size) {
+    if (percentile < 0.0 || percentile > 1.0) {
+        throw Exception(SourceContext{}, "Percentile must be between 0 and 1, got {}",
+                        percentile);
+    }
+    // Take care of percentile == 0 using std::max
+    return static_cast<size_t>(
+        std::max(std::ceil(static_cast<double>(size) * percentile) - 1.0, 0.0));
+}
+
+/**
+ * Reorders [first, last) such that the element at each of the given @p ranks is the element
+ * that would be there if the range was sorted. Every element before a rank is less than or equal
+ * to it and every element after it greater than or equal. The ranks have to be sorted and
+ * unique, and are relative to @p offset. Recursing on the median rank gives O(n log(k)) for k
+ * ranks, compared to O(n log(n)) for sorting.
+ */
+template <typename Iter>
+void multiSelect(Iter first, Iter last, std::span<const size_t> ranks, size_t offset = 0) {
+    if (ranks.empty() || first == last) return;
+    const auto mid = ranks.size() / 2;
+    const auto nth = first + static_cast<std::ptrdiff_t>(ranks[mid] - offset);
+    std::nth_element(first, nth, last);
+    multiSelect(first, nth, ranks.first(mid), offset);
+    multiSelect(nth + 1, last, ranks.subspan(mid + 1), ranks[mid] + 1);
+}
+
+/**
+ * The nearest ranks of @p percentiles among @p size elements, sorted and without duplicates
+ * @throw Exception if any percentile is less than 0 or larger than 1
+ */
+IVW_MODULE_PLOTTING_API std::vector<size_t> percentileRanks(const std::vector<double>& percentiles,
+                                                            size_t size);
+
+/**
+ * Finds the elements at the sorted and unique @p ranks among the @p size valid values of
+ * @p data without sorting or copying all of it. A sorted sample of the data gives a narrow
+ * bracket of values around each rank, a parallel pass over the data counts the values below each
+ * bracket and collects the values within it, and the rank is finally selected among the
+ * collected values. A bracket that turns out to miss its rank is widened and the pass repeated.
+ */
+template <typename T>
+std::vector<T> selectRanks(std::span<const T> data, size_t size, std::span<const size_t> ranks) {
+    constexpr size_t sampleSize = size_t{1} << 16;
+    // Half width of the brackets in sample positions, about four standard deviations of the
+    // sample position of a rank
+    constexpr size_t bracketWidth = 512;
+    constexpr size_t minTaskSize = size_t{1} << 16;
+
+    std::vector<T> result(ranks.size());
+
+    if (size <= 4 * sampleSize) {
+        std::vector<T> values;
+        values.reserve(size);
+        std::ranges::copy_if(data, std::back_inserter(values),
+                             [](const T& value) { return isValid(value); });
+        multiSelect(values.begin(), values.end(), ranks);
+        std::ranges::transform(ranks, result.begin(), [&](size_t rank) { return values[rank]; });
+        return result;
+    }
+
+    std::vector<T> sample;
+    sample.reserve(sampleSize);
+    for (size_t i = 0; i < sampleSize; ++i) {
+        const auto& value = data[i * data.size() / sampleSize];
+        if (isValid(value)) sample.push_back(value);
+    }
+    std::ranges::sort(sample);
+
+    struct Bracket {
+        size_t rank;
+        bool openLow;
+        T low;
+        bool openHigh;
+        T high;
+    };
+    std::vector<Bracket> brackets;
+    for (auto rank : ranks) {
+        Bracket bracket{rank, true, T{}, true, T{}};
+        if (!sample.empty()) {
+            const auto pos = static_cast<size_t>(static_cast<double>(rank) /
+                                                 static_cast<double>(size) *
+                                                 static_cast<double>(sample.size()));
+            if (pos >= bracketWidth) {
+                bracket.openLow = false;
+                bracket.low = sample[pos - bracketWidth];
+            }
+            if (pos + bracketWidth < sample.size()) {
+                bracket.openHigh = false;
+                bracket.high = sample[pos + bracketWidth];
+            }
+        }
+        brackets.push_back(bracket);
+    }
+
+    // The indices of the ranks that are not yet found
+    std::vector<size_t> pending(ranks.size());
+    std::iota(pending.begin(), pending.end(), size_t{0});
+    while (!pending.empty()) {
+        struct Partial {
+            std::vector<size_t> below;
+            std::vector<std::vector<T>> within;
+        };
+        const auto tasks = std::max<size_t>(
+            std::min(util::getPoolSize(), data.size() / minTaskSize), 1);
+        std::vector<Partial> partials(tasks);
+
+        util::forEachChunkParallel(
+            tasks,
+            [&](size_t firstTask, size_t lastTask) {
+                for (auto task = firstTask; task < lastTask; ++task) {
+                    auto& partial = partials[task];
+                    partial.below.assign(pending.size(), 0);
+                    partial.within.resize(pending.size());
+                    const auto chunk = data.subspan(task * data.size() / tasks,
+                                                    (task + 1) * data.size() / tasks -
+                                                        task * data.size() / tasks);
+                    for (const auto& value : chunk) {
+                        if (!isValid(value)) continue;
+                        for (size_t j = 0; j < pending.size(); ++j) {
+                            const auto& bracket = brackets[pending[j]];
+                            const bool below = !bracket.openLow && value < bracket.low;
+                            const bool above = !bracket.openHigh && bracket.high < value;
+                            partial.below[j] += below ? 1 : 0;
+                            if (!below && !above) partial.within[j].push_back(value);
+                        }
+                    }
+                }
+            },
+            tasks);
+
+        std::vector<size_t> missed;
+        for (size_t j = 0; j < pending.size(); ++j) {
+            auto& bracket = brackets[pending[j]];
+            size_t below = 0;
+            size_t within = 0;
+            for (const auto& partial : partials) {
+                below += partial.below[j];
+                within += partial.within[j].size();
+            }
+            if (bracket.rank < below) {
+                bracket.openLow = true;
+                missed.push_back(pending[j]);
+            } else if (bracket.rank >= below + within) {
+                bracket.openHigh = true;
+                missed.push_back(pending[j]);
+            } else {
+                std::vector<T> values;
+                values.reserve(within);
+                for (const auto& partial : partials) {
+                    values.insert(values.end(), partial.within[j].begin(),
+                                  partial.within[j].end());
+                }
+                const auto nth = values.begin() + static_cast<std::ptrdiff_t>(bracket.rank - below);
+                std::nth_element(values.begin(), nth, values.end());
+                result[pending[j]] = *nth;
+            }
+        }
+        pending = std::move(missed);
+    }
+
+    return result;
+}
+
+template <typename T>
+size_t countValid(std::span<const T> data) {
+    if constexpr (util::is_floating_point<T>::value) {
+        constexpr size_t minTaskSize = size_t{1} << 16;
+        const auto tasks = std::max<size_t>(
+            std::min(util::getPoolSize(), data.size() / minTaskSize), 1);
+        std::vector<size_t> counts(tasks, 0);
+        util::forEachChunkParallel(
+            tasks,
+            [&](size_t firstTask, size_t lastTask) {
+                for (auto task = firstTask; task < lastTask; ++task) {
+                    const auto begin = task * data.size() / tasks;
+                    const auto end = (task + 1) * data.size() / tasks;
+                    size_t count = 0;
+                    for (size_t i = begin; i < end; ++i) {
+                        count += isValid(data[i]) ? 1 : 0;
+                    }
+                    counts[task] = count;
+                }
+            },
+            tasks);
+        return std::accumulate(counts.begin(), counts.end(), size_t{0});
+    } else {
+        return data.size();
+    }
+}
+
+}  // namespace detail
+
 IVW_MODULE_PLOTTING_API RegresionResult linearRegresion(const BufferBase& X, const BufferBase& Y);
 
+/**
+ * \brief Least squares fit of y = kx + m to the pairs of values in @p x and @p y
+ * The sums are computed in parallel directly on the typed data. Pairs containing a NaN are
+ * excluded from the computation.
+ * @throw Exception if @p x and @p y are not of equal length
+ */
+template <typename Tx, typename Ty>
+RegresionResult linearRegresion(std::span<const Tx> x, std::span<const Ty> y) {
+    if (x.size() != y.size()) {
+        throw Exception(SourceContext{}, "Buffers are not of equal length ({} and {})", x.size(),
+                        y.size());
+    }
+    constexpr size_t minTaskSize = size_t{1} << 16;
+    const auto tasks =
+        std::max<size_t>(std::min(util::getPoolSize(), x.size() / minTaskSize), 1);
+    std::vector<detail::RegressionMoments> partials(tasks);
+    util::forEachChunkParallel(
+        tasks,
+        [&](size_t firstTask, size_t lastTask) {
+            for (auto task = firstTask; task < lastTask; ++task) {
+                const auto begin = task * x.size() / tasks;
+                const auto count = (task + 1) * x.size() / tasks - begin;
+                partials[task] =
+                    detail::regressionMoments(x.subspan(begin, count), y.subspan(begin, count));
+            }
+        },
+        tasks);
+
+    detail::RegressionMoments moments;
+    for (const auto& partial : partials) {
+        moments.merge(partial);
+    }
+    return moments.result();
+}
+
 IVW_MODULE_PLOTTING_API std::ostream& operator<<(std::ostream& os, RegresionResult res);
 
 /**
@@ -75,48 +371,73 @@ IVW_MODULE_PLOTTING_API std::ostream& operator<<(std::ostream& os, RegresionResu
  * \endcode
  * See also https://en.wikipedia.org/wiki/Percentile
  *
+ * The data is only partially sorted, as much as needed to find the requested percentiles. Use
+ * the overload taking a std::span to avoid the copy of the data.
+ *
  * @param data to compute percentiles on
  * @param percentiles in the range [0 1]
  * @return values below the percentage given by the percentiles.
- * @throw Exception if any percentile is less than 0 or larger than 1
+ * @throw Exception if any percentile is less than 0 or larger than 1, or if the data only
+ *                  contains NaNs and percentiles are requested
  */
-template <typename T, typename std::enable_if<!util::is_floating_point<T>::value, int>::type = 0>
+template <typename T>
 std::vector<T> percentiles(std::vector<T> data, const std::vector<double>& percentiles) {
-    std::sort(data.begin(), data.end());
+    data.erase(std::remove_if(data.begin(), data.end(),
+                              [](const T& value) { return !detail::isValid(value); }),
+               data.end());
+    const auto ranks = detail::percentileRanks(percentiles, data.size());
+    detail::multiSelect(data.begin(), data.end(), ranks);
+
     std::vector<T> result;
     result.reserve(percentiles.size());
-    auto nElements = data.size();
     for (auto percentile : percentiles) {
-        if (percentile < 0.f || percentile > 1.f) {
-            throw Exception("Percentile must be between 0 and 1");
-        }
-        // Take care of percentile == 1 using std::min
-        result.push_back(
-            data[static_cast<size_t>(std::max(std::ceil(nElements * percentile) - 1., 0.))]);
+        result.push_back(data[detail::percentileRank(percentile, data.size())]);
     }
     return result;
 }
 
-// Float/double types have special values
-template <typename T, typename std::enable_if<util::is_floating_point<T>::value, int>::type = 0>
-std::vector<T> percentiles(std::vector<T> data, const std::vector<double>& percentiles) {
-    auto noNaN =
-        std::partition(data.begin(), data.end(), [](const auto& a) { return glm::isnan(a); });
-    std::sort(noNaN, data.end());
+/**
+ * \brief Compute value below a percentage of observations in the data without copying or
+ * sorting it.
+ * Uses the nearest rank method, i.e. ceil(percentile * N), where N = number of elements in data.
+ * NaNs (Not a Numbers) are excluded from the computation.
+ *
+ * Small data is copied and partially sorted. For large data, a sorted sample of the data
+ * narrows down each percentile to a small range of values which are collected in a parallel pass
+ * over the data. Only those are partially sorted, see detail::selectRanks. Use QuantileSketch for
+ * approximate percentiles of data that is not available all at once.
+ *
+ * @param data to compute percentiles on
+ * @param percentiles in the range [0 1]
+ * @return values below the percentage given by the percentiles.
+ * @throw Exception if any percentile is less than 0 or larger than 1, or if the data only
+ *                  contains NaNs and percentiles are requested
+ */
+template <typename T>
+std::vector<T> percentiles(std::span<const T> data, const std::vector<double>& percentiles) {
+    const auto size = detail::countValid(data);
+    const auto ranks = detail::percentileRanks(percentiles, size);
+    const auto values = detail::selectRanks(data, size, ranks);
+
     std::vector<T> result;
     result.reserve(percentiles.size());
-    size_t nElements = std::distance(noNaN, data.end());
     for (auto percentile : percentiles) {
-        if (percentile < 0.f || percentile > 1.f) {
-            throw std::invalid_argument("Percentile must be between 0 and 1");
-        }
-        // Take care of percentile == 1 using std::min
-        result.push_back(
-            data[static_cast<size_t>(std::max(std::ceil(nElements * percentile) - 1., 0.))]);
+        const auto rank = detail::percentileRank(percentile, size);
+        const auto index = std::distance(ranks.begin(), std::ranges::lower_bound(ranks, rank));
+        result.push_back(values[static_cast<size_t>(index)]);
     }
     return result;
 }
 
+/**
+ * \brief Compute percentiles of a scalar buffer, see percentiles(std::span<const T>, const
+ * std::vector<double>&)
+ * @throw Exception if the buffer is not scalar, any percentile is less than 0 or larger than 1,
+ *                  or if the buffer only contains NaNs and percentiles are requested
+ */
+IVW_MODULE_PLOTTING_API std::vector<double> percentiles(const BufferBase& buffer,
+                                                        const std::vector<double>& percentiles);
+
 }  // namespace statsutil
 
 }  // namespace inviwo
@@ -0,0 +1,179 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <modules/plotting/utils/quantilesketch.h>
+
+#include <modules/plotting/utils/statsutils.h>  // for percentileRank
+
+#include <inviwo/core/util/exception.h>      // for Exception
+#include <inviwo/core/util/sourcecontext.h>  // for SourceContext
+
+#include <algorithm>  // for max, min, sort
+#include <cmath>      // for isnan, pow, ceil
+#include <limits>     // for numeric_limits
+#include <numeric>    // for accumulate
+#include <utility>    // for pair
+
+namespace inviwo {
+
+namespace statsutil {
+
+QuantileSketch::QuantileSketch(size_t k)
+    : k_{std::max(k, size_t{8})}
+    , count_{0}
+    , min_{std::numeric_limits<double>::max()}
+    , max_{std::numeric_limits<double>::lowest()}
+    , levels_(1)
+    , capacities_{}
+    , random_{} {
+    updateCapacities();
+}
+
+void QuantileSketch::add(double value) {
+    if (std::isnan(value)) return;
+    ++count_;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    levels_[0].push_back(value);
+    if (levels_[0].size() >= capacities_[0]) compress();
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.count_ == 0) return;
+    if (levels_.size() < other.levels_.size()) {
+        levels_.resize(other.levels_.size());
+        updateCapacities();
+    }
+    for (size_t level = 0; level < other.levels_.size(); ++level) {
+        levels_[level].insert(levels_[level].end(), other.levels_[level].begin(),
+                              other.levels_[level].end());
+    }
+    count_ += other.count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    compress();
+}
+
+size_t QuantileSketch::count() const { return count_; }
+
+size_t QuantileSketch::size() const {
+    return std::accumulate(levels_.begin(), levels_.end(), size_t{0},
+                           [](size_t sum, const auto& level) { return sum + level.size(); });
+}
+
+double QuantileSketch::min() const { return min_; }
+
+double QuantileSketch::max() const { return max_; }
+
+double QuantileSketch::quantile(double q) const { return quantiles({q}).front(); }
+
+std::vector<double> QuantileSketch::quantiles(const std::vector<double>& qs) const {
+    if (count_ == 0 && !qs.empty()) {
+        throw Exception(SourceContext{}, "Quantiles of an empty sketch");
+    }
+
+    std::vector<std::pair<double, size_t>> weighted;
+    weighted.reserve(size());
+    for (size_t level = 0; level < levels_.size(); ++level) {
+        for (auto value : levels_[level]) {
+            weighted.emplace_back(value, size_t{1} << level);
+        }
+    }
+    std::ranges::sort(weighted);
+
+    // The total weight of the retained values equals the number of added values
+    std::vector<double> result;
+    result.reserve(qs.size());
+    for (auto q : qs) {
+        const auto rank = detail::percentileRank(q, count_);
+        if (rank == 0) {
+            result.push_back(min_);
+        } else if (rank + 1 == count_) {
+            result.push_back(max_);
+        } else {
+            size_t cumulative = 0;
+            auto it = weighted.begin();
+            for (; it != weighted.end(); ++it) {
+                cumulative += it->second;
+                if (cumulative > rank) break;
+            }
+            result.push_back(it != weighted.end() ? it->first : max_);
+        }
+    }
+    return result;
+}
+
+double QuantileSketch::rank(double value) const {
+    if (count_ == 0) return 0.0;
+    size_t weight = 0;
+    for (size_t level = 0; level < levels_.size(); ++level) {
+        for (auto v : levels_[level]) {
+            if (v <= value) weight += size_t{1} << level;
+        }
+    }
+    return static_cast<double>(weight) / static_cast<double>(count_);
+}
+
+void QuantileSketch::updateCapacities() {
+    // The top level has capacity k, each level below 2/3 of the one above
+    capacities_.resize(levels_.size());
+    for (size_t level = 0; level < levels_.size(); ++level) {
+        const auto depth = static_cast<double>(levels_.size() - level - 1);
+        capacities_[level] = std::max(
+            static_cast<size_t>(std::ceil(static_cast<double>(k_) * std::pow(2.0 / 3.0, depth))),
+            size_t{2});
+    }
+}
+
+void QuantileSketch::compress() {
+    for (size_t level = 0; level < levels_.size(); ++level) {
+        if (levels_[level].size() < capacities_[level]) continue;
+        if (level + 1 == levels_.size()) {
+            levels_.emplace_back();
+            updateCapacities();
+        }
+
+        auto& values = levels_[level];
+        std::ranges::sort(values);
+        // Keep the first value if there is an odd number of values, and promote either the even
+        // or the odd values of the rest with equal probability
+        const size_t begin = values.size() % 2;
+        const size_t offset = random_() % 2;
+        auto& next = levels_[level + 1];
+        for (size_t i = begin + offset; i < values.size(); i += 2) {
+            next.push_back(values[i]);
+        }
+        values.resize(begin);
+    }
+}
+
+}  // namespace statsutil
+
+}  // namespace inviwo
@@ -27,101 +27,68 @@
  *
  *********************************************************************************/
 
-#include <modules/plotting/utils/statsutils.h>
 
-#include <inviwo/core/datastructures/buffer/buffer.h>                   // for BufferBase
-#include <inviwo/core/datastructures/buffer/bufferram.h>                // for BufferRAM
-#include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
-#include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
-#include <inviwo/core/util/exception.h>                                 // for Exception
-#include <inviwo/core/util/formatdispatching.h>                         // for Scalars
-#include <inviwo/core/util/glmmat.h>                                    // for dmat2
-#include <inviwo/core/util/glmvec.h>                                    // for dvec2
-#include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
-#include <inviwo/core/util/zip.h>                                       // for zipper, get, zip
+#include <modules/plotting/utils/statsutils.h>
 
-#include <stdlib.h>       // for abs
-#include <memory>         // for unique_ptr
-#include <ostream>        // for operator<<, basic...
-#include <unordered_set>  // for unordered_set
+#include <inviwo/core/datastructures/buffer/buffer.h>     // for BufferBase
+#include <inviwo/core/datastructures/buffer/bufferram.h>  // for BufferRAM
+#include <inviwo/core/util/exception.h>                   // for Exception
+#include <inviwo/core/util/formatdispatching.h>           // for Scalars
+#include <inviwo/core/util/sourcecontext.h>               // for SourceContext
 
-#include <glm/mat2x2.hpp>  // for mat<>::col_type
-#include <glm/matrix.hpp>  // for inverse
-#include <glm/vec2.hpp>    // for vec<>::(anonymous)
+#include <algorithm>  // for sort, unique
+#include <cmath>      // for sqrt
+#include <ostream>    // for operator<<, basic...
+#include <span>       // for span
+#include <utility>    // for as_const
 
 namespace inviwo {
 namespace statsutil {
 namespace detail {
-template <typename Tx, typename Ty>
-RegresionResult linearRegresion(const Tx& X, const Ty& Y) {
-    RegresionResult res;
-    if (X.getSize() != Y.getSize()) {
-        throw Exception("Buffers are not of equal length");
+
+void RegressionMoments::merge(const RegressionMoments& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
     }
-    auto& xvec = X.getDataContainer();
-    auto& yvec = Y.getDataContainer();
+    // Chan et al. pairwise update of the means and the sums of squared deviations
+    const auto n1 = static_cast<double>(count);
+    const auto n2 = static_cast<double>(other.count);
+    const auto n = n1 + n2;
+    const auto dx = other.meanX - meanX;
+    const auto dy = other.meanY - meanY;
+    meanX += dx * (n2 / n);
+    meanY += dy * (n2 / n);
+    m2x += other.m2x + dx * dx * (n1 * n2 / n);
+    m2y += other.m2y + dy * dy * (n1 * n2 / n);
+    cxy += other.cxy + dx * dy * (n1 * n2 / n);
+    count += other.count;
+}
 
-    // Ax = b;
+RegresionResult RegressionMoments::result() const {
     // Minimize the sum of squares of individual errors
     // http://users.metu.edu.tr/csert/me310/me310_5_regression.pdf
-    dmat2 A = dmat2(xvec.size(), 0, 0, 0);
-    dvec2 b(0);
-    double sumX = 0;
-    double sumY = 0;
+    RegresionResult res;
+    res.k = cxy / m2x;
+    res.m = meanY - res.k * meanX;
+    res.corr = cxy / std::sqrt(m2x * m2y);
+    res.r2 = res.corr * res.corr;
+    return res;
+}
 
-    // Iterate over containers in sync
-    for (auto&& i : util::zip(xvec, yvec)) {
-        auto x = get<0>(i);
-        auto y = get<1>(i);
-        if (std::isnan(static_cast<double>(x)) || std::isnan(static_cast<double>(y))) {
-            --A[0][0];
-            continue;
-        }
-        sumX += x;
-        sumY += y;
-        A[1][1] += x * x;
-        b.y += y * x;
+std::vector<size_t> percentileRanks(const std::vector<double>& percentiles, size_t size) {
+    if (size == 0 && !percentiles.empty()) {
+        throw Exception(SourceContext{}, "Percentiles of empty data or data with only NaNs");
     }
-
-    b.x = sumY;
-    A[1][0] = A[0][1] = sumX;
-    dvec2 km = glm::inverse(A) * b;
-    res.k = km.y;
-    res.m = km.x;
-    res.r2 = 0;
-    double meanX = sumX / A[0][0];
-    double meanY = sumY / A[0][0];
-    double stdX = 0;
-    double stdY = 0;
-
-    for (auto&& i : util::zip(xvec, yvec)) {
-        if (std::isnan(static_cast<double>(get<0>(i))) ||
-            std::isnan(static_cast<double>(get<1>(i)))) {
-            continue;
-        }
-        auto x = get<0>(i) - meanX;
-        auto y = get<1>(i) - meanY;
-
-        stdX += x * x;
-        stdY += y * y;
-
-        res.r2 += x * y;
+    std::vector<size_t> ranks;
+    ranks.reserve(percentiles.size());
+    for (auto percentile : percentiles) {
+        ranks.push_back(percentileRank(percentile, size));
     }
-
-    stdX /= A[0][0];
-    stdY /= A[0][0];
-
-    stdX = std::sqrt(stdX);
-    stdY = std::sqrt(stdY);
-
-    res.r2 /= A[0][0];
-    res.r2 /= stdX * stdY;
-
-    res.corr = std::abs(res.r2);
-    if (res.k < 0) res.corr = -res.corr;
-    res.r2 *= res.r2;
-
-    return res;
+    std::ranges::sort(ranks);
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    return ranks;
 }
 
 }  // namespace detail
@@ -130,8 +97,20 @@ RegresionResult linearRegresion(const BufferBase& X, const BufferBase& Y) {
     return X.getRepresentation<BufferRAM>()
         ->dispatch<RegresionResult, dispatching::filter::Scalars>([&](auto Xbuf) {
             return Y.getRepresentation<BufferRAM>()
-                ->dispatch<RegresionResult, dispatching::filter::Scalars>(
-                    [&](auto Ybuf) { return detail::linearRegresion(*Xbuf, *Ybuf); });
+                ->dispatch<RegresionResult, dispatching::filter::Scalars>([&](auto Ybuf) {
+                    return linearRegresion(std::span{std::as_const(Xbuf->getDataContainer())},
+                                           std::span{std::as_const(Ybuf->getDataContainer())});
+                });
+        });
+}
+
+std::vector<double> percentiles(const BufferBase& buffer, const std::vector<double>& percentiles) {
+    return buffer.getRepresentation<BufferRAM>()
+        ->dispatch<std::vector<double>, dispatching::filter::Scalars>([&](auto buf) {
+            const auto values =
+                statsutil::percentiles(std::span{std::as_const(buf->getDataContainer())},
+                                       percentiles);
+            return std::vector<double>(values.begin(), values.end());
         });
 }
 
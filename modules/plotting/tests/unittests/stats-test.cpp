@@ -29,12 +29,22 @@
 
 #include <inviwo/core/datastructures/buffer/buffer.h>
 #include <modules/plotting/utils/statsutils.h>
+#include <modules/plotting/utils/quantilesketch.h>
 
 #include <warn/push>
 #include <warn/ignore/all>
 #include <gtest/gtest.h>
 #include <warn/pop>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
 namespace inviwo {
 
 TEST(StatsUtilsTest, init) {
@@ -69,4 +79,150 @@ TEST(StatsUtilsTest, init) {
     EXPECT_DOUBLE_EQ(50., percentiles[4]) << " 100 percentile";
 }
 
+namespace {
+
+template <typename T>
+std::vector<T> sortedPercentiles(std::vector<T> data, const std::vector<double>& percentiles) {
+    std::erase_if(data, [](const T& v) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return std::isnan(v);
+        } else {
+            return false;
+        }
+    });
+    std::ranges::sort(data);
+    std::vector<T> result;
+    for (auto percentile : percentiles) {
+        result.push_back(data[static_cast<size_t>(
+            std::max(std::ceil(static_cast<double>(data.size()) * percentile) - 1.0, 0.0))]);
+    }
+    return result;
+}
+
+const std::vector<double> testPercentiles{0.0, 0.01, 0.25, 0.5, 0.5, 0.75, 0.99, 0.999, 1.0};
+
+}  // namespace
+
+TEST(StatsUtilsTest, percentilesNaN) {
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> data{nan, 20., 15., nan, 50., 40., 35., nan};
+
+    const auto percentiles = statsutil::percentiles(data, {0.05, .30, 0.40, 0.5, 1.0});
+    EXPECT_EQ(std::vector<double>({15., 20., 20., 35., 50.}), percentiles);
+
+    const auto spanPercentiles =
+        statsutil::percentiles(std::span<const double>{data}, {0.05, .30, 0.40, 0.5, 1.0});
+    EXPECT_EQ(percentiles, spanPercentiles);
+
+    EXPECT_THROW(statsutil::percentiles(data, {1.5}), Exception);
+    EXPECT_THROW(statsutil::percentiles(std::vector<double>{nan, nan}, {0.5}), Exception);
+    EXPECT_TRUE(statsutil::percentiles(std::vector<double>{}, {}).empty());
+}
+
+TEST(StatsUtilsTest, percentilesLarge) {
+    std::mt19937 rand{0};
+    std::lognormal_distribution<double> dis{0.0, 1.0};
+    std::vector<double> data(1000000);
+    std::ranges::generate(data, [&]() { return dis(rand); });
+    for (size_t i = 0; i < data.size(); i += 97) {
+        data[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const auto expected = sortedPercentiles(data, testPercentiles);
+    EXPECT_EQ(expected, statsutil::percentiles(std::span<const double>{data}, testPercentiles));
+    EXPECT_EQ(expected, statsutil::percentiles(data, testPercentiles));
+}
+
+TEST(StatsUtilsTest, percentilesDuplicates) {
+    // Few distinct values give many equal values in the brackets
+    std::mt19937 rand{0};
+    std::uniform_int_distribution<int> dis{0, 10};
+    std::vector<std::uint8_t> data(1000000);
+    std::ranges::generate(data, [&]() { return static_cast<std::uint8_t>(dis(rand)); });
+
+    EXPECT_EQ(sortedPercentiles(data, testPercentiles),
+              statsutil::percentiles(std::span<const std::uint8_t>{data}, testPercentiles));
+
+    // Make the sample of the data unrepresentative, the brackets will miss the percentiles
+    const size_t sampleSize = size_t{1} << 16;
+    for (size_t i = 0; i < sampleSize; ++i) {
+        data[i * data.size() / sampleSize] = 255;
+    }
+    EXPECT_EQ(sortedPercentiles(data, testPercentiles),
+              statsutil::percentiles(std::span<const std::uint8_t>{data}, testPercentiles));
+}
+
+TEST(StatsUtilsTest, percentilesBuffer) {
+    Buffer<int> buffer(1000);
+    auto& vec = buffer.getEditableRAMRepresentation()->getDataContainer();
+    for (int i = 0; i < 1000; ++i) {
+        vec[i] = 999 - i;
+    }
+    const auto percentiles = statsutil::percentiles(buffer, {0.0, 0.25, 0.5, 1.0});
+    EXPECT_EQ(std::vector<double>({0.0, 249.0, 499.0, 999.0}), percentiles);
+}
+
+TEST(StatsUtilsTest, linearRegresionTyped) {
+    std::mt19937 rand{0};
+    std::normal_distribution<float> dis{0.0f, 1.0f};
+    Buffer<float> X(100000);
+    Buffer<int> Y(100000);
+    auto& vecX = X.getEditableRAMRepresentation()->getDataContainer();
+    auto& vecY = Y.getEditableRAMRepresentation()->getDataContainer();
+    for (size_t i = 0; i < vecX.size(); ++i) {
+        vecX[i] = dis(rand);
+        vecY[i] = static_cast<int>(std::round(100.0f * vecX[i] + 10.0f * dis(rand) + 5.0f));
+    }
+    vecX[42] = std::numeric_limits<float>::quiet_NaN();
+
+    const auto res = statsutil::linearRegresion(X, Y);
+    const auto typed = statsutil::linearRegresion(std::span<const float>{vecX},
+                                                  std::span<const int>{vecY});
+    EXPECT_DOUBLE_EQ(typed.k, res.k);
+    EXPECT_DOUBLE_EQ(typed.m, res.m);
+    EXPECT_NEAR(100.0, res.k, 0.5);
+    EXPECT_NEAR(5.0, res.m, 0.5);
+    EXPECT_NEAR(0.995, res.corr, 0.001);
+    EXPECT_DOUBLE_EQ(res.corr * res.corr, res.r2);
+
+    EXPECT_THROW(statsutil::linearRegresion(std::span<const float>{vecX}.first(10),
+                                            std::span<const int>{vecY}),
+                 Exception);
+}
+
+TEST(StatsUtilsTest, quantileSketch) {
+    std::mt19937 rand{0};
+    std::uniform_real_distribution<double> dis{0.0, 1.0};
+    std::vector<double> data(200000);
+    std::ranges::generate(data, [&]() { return dis(rand); });
+
+    statsutil::QuantileSketch sketch;
+    statsutil::QuantileSketch first;
+    statsutil::QuantileSketch second;
+    sketch.add(std::span<const double>{data});
+    first.add(std::span<const double>{data}.first(data.size() / 3));
+    second.add(std::span<const double>{data}.subspan(data.size() / 3));
+    first.merge(second);
+
+    for (auto* s : {&sketch, &first}) {
+        EXPECT_EQ(data.size(), s->count());
+        EXPECT_LT(s->size(), 1000);
+        EXPECT_EQ(*std::ranges::min_element(data), s->quantile(0.0));
+        EXPECT_EQ(*std::ranges::max_element(data), s->quantile(1.0));
+        // The data is uniform in [0 1], so the quantile is also the rank
+        for (auto q : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99}) {
+            EXPECT_NEAR(q, s->quantile(q), 0.02) << "quantile " << q;
+            EXPECT_NEAR(q, s->rank(q), 0.02) << "rank " << q;
+        }
+    }
+
+    statsutil::QuantileSketch small;
+    small.add(std::span<const double>{std::vector<double>{20., 15., 50., 40., 35.}});
+    small.add(std::numeric_limits<double>::quiet_NaN());
+    EXPECT_EQ(std::vector<double>({15., 20., 20., 35., 50.}),
+              small.quantiles({0.05, .30, 0.40, 0.5, 1.0}));
+
+    EXPECT_THROW(statsutil::QuantileSketch{}.quantile(0.5), Exception);
+}
+
 }  // namespace inviwo
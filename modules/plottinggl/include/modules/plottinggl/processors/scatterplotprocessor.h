@@ -31,6 +31,7 @@
 
 #include <modules/plottinggl/plottingglmoduledefine.h>  // for IVW_MODULE_PLOTTIN...
 
+#include <inviwo/core/datastructures/bitset.h>                         // for BitSet
 #include <inviwo/core/ports/imageport.h>                               // for BaseImageInport
 #include <inviwo/core/processors/processor.h>                          // for Processor
 #include <inviwo/core/processors/processorinfo.h>                      // for ProcessorInfo
@@ -38,6 +39,7 @@
 #include <inviwo/core/util/staticstring.h>                             // for operator+
 #include <inviwo/dataframe/datastructures/dataframe.h>                 // for DataFrameInport
 #include <inviwo/dataframe/properties/columnoptionproperty.h>          // for ColumnOptionProperty
+#include <modules/brushingandlinking/datastructures/brushingaction.h>  // for BrushingAction
 #include <modules/brushingandlinking/ports/brushingandlinkingports.h>  // for BrushingAndLinking...
 #include <modules/opengl/texture/textureutils.h>                       // for ImageInport
 #include <modules/plottinggl/plotters/scatterplotgl.h>                 // for ScatterPlotGL::Sor...
@@ -67,6 +69,20 @@ public:
     static const ProcessorInfo processorInfo_;
 
 private:
+    /**
+     * The rows last brushed by this processor and the corresponding indices of the data frame
+     */
+    struct BrushedRows {
+        std::weak_ptr<const DataFrame> data;
+        BitSet rows;
+        size_t modificationCount = 0;  ///< of the brushing action after the last brush
+    };
+    /**
+     * Brush the indices of @p rows with @p action. If nothing else has brushed @p action since
+     * @p previous, only the change is sent using BrushingAndLinkingInport::brushDelta.
+     */
+    void brushRows(BrushingAction action, const BitSet& rows, BrushedRows& previous);
+
     DataFrameInport dataFramePort_;
     BrushingAndLinkingInport brushingPort_;
     ImageInport backgroundPort_;
@@ -89,6 +105,8 @@ private:
     ScatterPlotGL::SelectionCallbackHandle filteringChangedCallBack_;
 
     std::unordered_map<uint32_t, uint32_t> indexToRowMap_;
+    BrushedRows highlighted_;
+    BrushedRows selected_;
 };
 
 }  // namespace plot
@@ -104,27 +104,11 @@ ScatterPlotProcessor::ScatterPlotProcessor()
     });
     highlightChangedCallBack_ =
         scatterPlot_.addHighlightChangedCallback([this](const BitSet& highlighted) {
-            if (auto data = dataFramePort_.getData()) {
-                BitSet indices;
-                auto iCol = data->getIndexColumn();
-                auto& indexCol = iCol->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
-                for (auto idx : highlighted) {
-                    indices.add(indexCol[idx]);
-                }
-                brushingPort_.highlight(indices);
-            }
+            brushRows(BrushingAction::Highlight, highlighted, highlighted_);
         });
     selectionChangedCallBack_ =
         scatterPlot_.addSelectionChangedCallback([this](const BitSet& selected) {
-            if (auto data = dataFramePort_.getData()) {
-                BitSet indices;
-                auto iCol = data->getIndexColumn();
-                auto& indexCol = iCol->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
-                for (auto idx : selected) {
-                    indices.add(indexCol[idx]);
-                }
-                brushingPort_.select(indices);
-            }
+            brushRows(BrushingAction::Select, selected, selected_);
         });
     filteringChangedCallBack_ =
         scatterPlot_.addFilteringChangedCallback([this](const BitSet& filtered) {
@@ -177,6 +161,35 @@ ScatterPlotProcessor::ScatterPlotProcessor()
     });
 }
 
+void ScatterPlotProcessor::brushRows(BrushingAction action, const BitSet& rows,
+                                     BrushedRows& previous) {
+    auto data = dataFramePort_.getData();
+    if (!data) return;
+
+    auto iCol = data->getIndexColumn();
+    auto& indexCol = iCol->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+    auto rowsToIds = [&](const BitSet& b) {
+        BitSet indices;
+        for (auto idx : b) {
+            indices.add(indexCol[idx]);
+        }
+        return indices;
+    };
+
+    if (previous.data.lock() == data &&
+        brushingPort_.getModificationCount(action) == previous.modificationCount) {
+        // Nothing else has brushed since the last call, send only the change. Hovering from one
+        // point to the next then costs the same regardless of the number of brushed indices.
+        brushingPort_.brushDelta(action, BrushingTarget::Row, rowsToIds(rows - previous.rows),
+                                 rowsToIds(previous.rows - rows));
+    } else {
+        brushingPort_.brush(action, BrushingTarget::Row, rowsToIds(rows));
+    }
+    previous.rows = rows;
+    previous.data = data;
+    previous.modificationCount = brushingPort_.getModificationCount(action);
+}
+
 void ScatterPlotProcessor::process() {
     utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 
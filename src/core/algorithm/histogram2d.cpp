@@ -29,7 +29,17 @@
 
 #include <inviwo/core/algorithm/histogram2d.h>
 
-namespace inviwo::util::detail {
+#include <inviwo/core/util/foreach.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <glm/common.hpp>
+
+namespace inviwo::util {
+
+namespace detail {
 
 DataMapper histogramDataMap(const DataMapper& datamap, double effectiveRange) {
     const dvec2 effectiveDataRange{datamap.dataRange.x, datamap.dataRange.x + effectiveRange};
@@ -38,4 +48,201 @@ DataMapper histogramDataMap(const DataMapper& datamap, double effectiveRange) {
     return DataMapper{effectiveDataRange, effectiveValueRange, datamap.valueAxis};
 }
 
-}  // namespace inviwo::util::detail
+}  // namespace detail
+
+namespace {
+
+constexpr size_t blockSize = 4096;
+// Partial histograms use 32-bit counters, no task may see more values than that
+constexpr size_t maxTaskSize = std::numeric_limits<std::uint32_t>::max();
+// Avoid allocating partial histograms for tasks with very little data
+constexpr size_t minTaskSize = 1 << 16;
+
+}  // namespace
+
+void Histogram2DAccumulator::Moments::merge(const Moments& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    // Chan et al. pairwise update of the mean and the sums of squared deviations
+    const auto n1 = static_cast<double>(count);
+    const auto n2 = static_cast<double>(other.count);
+    const auto n = n1 + n2;
+    const auto delta = other.mean - mean;
+    mean += delta * (n2 / n);
+    m2 += other.m2 + delta * delta * (n1 * n2 / n);
+    cxy += other.cxy + delta.x * delta.y * (n1 * n2 / n);
+    min = glm::min(min, other.min);
+    max = glm::max(max, other.max);
+    count += other.count;
+}
+
+Histogram2DAccumulator::Histogram2DAccumulator(const std::array<DataMapper, 2>& dataMaps,
+                                               size2_t numbins, dvec2 effectiveRange,
+                                               std::array<HistogramBinning, 2> binning)
+    : dataMaps_{dataMaps}
+    , numbins_{glm::max(numbins, size2_t{1})}
+    , effectiveRange_{effectiveRange}
+    , binning_{binning}
+    , axes_{}
+    , counts_(glm::compMul(numbins_), 0)
+    , totalCounts_{0}
+    , underflow_{0}
+    , overflow_{0}
+    , moments_{} {
+
+    for (size_t i = 0; i < 2; ++i) {
+        const auto bins = static_cast<double>(numbins_[i] - 1);
+        const auto range = effectiveRange_[i];
+        if (binning_[i] == HistogramBinning::Log) {
+            // log1p(s * (v - min) / range) / log1p(s) * bins, see histogramBinPosition
+            axes_[i] = Axis{.min = dataMaps_[i].dataRange.x,
+                            .scale = range > 0.0 ? bins / std::log1p(histogramLogBinningScale)
+                                                 : 0.0,
+                            .logScale = range > 0.0 ? histogramLogBinningScale / range : 0.0,
+                            .binning = binning_[i]};
+        } else {
+            axes_[i] = Axis{.min = dataMaps_[i].dataRange.x,
+                            .scale = range > 0.0 ? bins / range : 0.0,
+                            .logScale = 0.0,
+                            .binning = binning_[i]};
+        }
+    }
+}
+
+void Histogram2DAccumulator::add(size_t size, const BlockLoader& loader) {
+    if (size == 0) return;
+
+    const auto tasks = std::max({std::min(util::getPoolSize(), size / minTaskSize),
+                                 size / maxTaskSize + 1, size_t{1}});
+
+    struct Partial {
+        std::vector<std::uint32_t> counts;
+        size_t included = 0;
+        size_t underflow = 0;
+        size_t overflow = 0;
+        Moments moments;
+    };
+    std::vector<Partial> partials(tasks);
+
+    const auto position = [](const Axis& axis, double v) {
+        const auto x = v - axis.min;
+        return (axis.binning == HistogramBinning::Log ? std::log1p(x * axis.logScale) : x) *
+               axis.scale;
+    };
+    const dvec2 end{static_cast<double>(numbins_.x), static_cast<double>(numbins_.y)};
+
+    const auto process = [&](size_t task) {
+        const auto begin = (size * task) / tasks;
+        const auto stop = (size * (task + 1)) / tasks;
+        auto& partial = partials[task];
+        partial.counts.assign(counts_.size(), 0);
+
+        std::vector<double> first(blockSize);
+        std::vector<double> second(blockSize);
+        std::vector<unsigned char> include(blockSize);
+
+        for (auto offset = begin; offset < stop; offset += blockSize) {
+            const auto n = std::min(blockSize, stop - offset);
+            loader(offset, std::span{first}.first(n), std::span{second}.first(n),
+                   std::span{include}.first(n));
+
+            const auto valid = [&](size_t i) {
+                return include[i] && std::isfinite(first[i]) && std::isfinite(second[i]);
+            };
+
+            // Statistics of the block, two passes over the block for numerical stability
+            Moments block;
+            dvec2 sum{0.0};
+            for (size_t i = 0; i < n; ++i) {
+                if (valid(i)) {
+                    sum += dvec2{first[i], second[i]};
+                    ++block.count;
+                }
+            }
+            if (block.count > 0) {
+                block.mean = sum / static_cast<double>(block.count);
+                block.min = dvec2{std::numeric_limits<double>::max()};
+                block.max = dvec2{std::numeric_limits<double>::lowest()};
+                for (size_t i = 0; i < n; ++i) {
+                    if (valid(i)) {
+                        const dvec2 v{first[i], second[i]};
+                        const auto d = v - block.mean;
+                        block.m2 += d * d;
+                        block.cxy += d.x * d.y;
+                        block.min = glm::min(block.min, v);
+                        block.max = glm::max(block.max, v);
+                    }
+                }
+                partial.moments.merge(block);
+            }
+
+            for (size_t i = 0; i < n; ++i) {
+                if (!include[i]) continue;
+                ++partial.included;
+                const auto x = position(axes_[0], first[i]);
+                const auto y = position(axes_[1], second[i]);
+                // Negated comparisons to also catch NaN. Values within one bin width below the
+                // range end up in the first bin, the same as when truncating the bin index.
+                if (!(x > -1.0) || !(y > -1.0)) {
+                    ++partial.underflow;
+                } else if (x >= end.x || y >= end.y) {
+                    ++partial.overflow;
+                } else {
+                    ++partial.counts[static_cast<size_t>(x) + static_cast<size_t>(y) * numbins_.x];
+                }
+            }
+        }
+    };
+
+    util::forEachChunkParallel(
+        tasks,
+        [&](size_t first, size_t last) {
+            for (auto task = first; task < last; ++task) process(task);
+        },
+        tasks);
+
+    for (auto& partial : partials) {
+        util::forEachChunkParallel(counts_.size(), [&](size_t begin, size_t stop) {
+            for (size_t i = begin; i < stop; ++i) {
+                counts_[i] += partial.counts[i];
+            }
+        });
+        totalCounts_ += partial.included;
+        underflow_ += partial.underflow;
+        overflow_ += partial.overflow;
+        moments_.merge(partial.moments);
+    }
+}
+
+Histogram2D Histogram2DAccumulator::histogram() const {
+    JointStatistics statistics{.count = moments_.count};
+    if (moments_.count > 0) {
+        const auto n = static_cast<double>(moments_.count);
+        const auto dof = std::max(n - 1.0, 1.0);
+        const auto denominator = std::sqrt(moments_.m2.x * moments_.m2.y);
+        statistics.min = moments_.min;
+        statistics.max = moments_.max;
+        statistics.mean = moments_.mean;
+        statistics.standardDeviation = glm::sqrt(moments_.m2 / dof);
+        statistics.covariance = moments_.cxy / dof;
+        statistics.correlation = denominator > 0.0 ? moments_.cxy / denominator : 0.0;
+    }
+
+    return Histogram2D{
+        .counts = counts_,
+        .dimensions = numbins_,
+        .totalCounts = totalCounts_,
+        .maxCount = *std::ranges::max_element(counts_),
+        .dataMap = {detail::histogramDataMap(dataMaps_[0], effectiveRange_.x),
+                    detail::histogramDataMap(dataMaps_[1], effectiveRange_.y)},
+        .underflow = underflow_,
+        .overflow = overflow_,
+        .binning = binning_,
+        .statistics = statistics,
+    };
+}
+
+}  // namespace inviwo::util
@@ -45,6 +45,7 @@
 #include <inviwo/core/ports/portinspectorfactory.h>
 #include <inviwo/core/ports/portinspectormanager.h>
 #include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/poolprocessor.h>
 #include <inviwo/core/processors/processorfactory.h>
 #include <inviwo/core/processors/processorwidgetfactory.h>
 #include <inviwo/core/properties/property.h>
@@ -62,6 +63,7 @@
 #include <inviwo/core/util/fileobserver.h>
 #include <inviwo/core/util/filesystemobserver.h>
 #include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/evaluationprofiler.h>
 #include <inviwo/core/util/rendercontext.h>
 #include <inviwo/core/util/settings/settings.h>
 #include <inviwo/core/util/buildinfo.h>
@@ -142,6 +144,7 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
     , clearAllSingeltons_{[]() {
         PickingManager::deleteInstance();
         RenderContext::deleteInstance();
+        EvaluationProfiler::deleteInstance();
     }}
     , resourceManager_{std::make_unique<ResourceManager>()}
     , cameraFactory_{std::make_unique<CameraFactory>()}
@@ -180,10 +183,32 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
     init(this);
     RenderContext::init();
     PickingManager::init();
+    EvaluationProfiler::init();
+    EvaluationProfiler::getPtr()->setEnabled(systemSettings_->enableProfiling_);
 
     resizePool(systemSettings_->poolSize_);
     systemSettings_->poolSize_.onChange([this]() { resizePool(systemSettings_->poolSize_); });
 
+    // Evicting representations is only safe when nobody can hold raw pointers to them
+    resourceManager_->setBusyCallback([this]() {
+        if (processorNetwork_->islocked() || pool_.getQueueSize() > 0 ||
+            pool_.getActiveCount() > 0) {
+            return true;
+        }
+        bool busy = false;
+        processorNetwork_->forEachProcessor([&](Processor* processor) {
+            if (auto* poolProcessor = dynamic_cast<PoolProcessor*>(processor)) {
+                busy = busy || poolProcessor->hasPendingJobs();
+            }
+        });
+        return busy;
+    });
+
+    processorNetwork_->getLinkEvaluator().setBatched(systemSettings_->batchedLinking_);
+    systemSettings_->batchedLinking_.onChange([this]() {
+        processorNetwork_->getLinkEvaluator().setBatched(systemSettings_->batchedLinking_);
+    });
+
     workspaceManager_->registerFactory(getProcessorFactory());
     workspaceManager_->registerFactory(getMetaDataFactory());
     workspaceManager_->registerFactory(getPropertyFactory());
@@ -29,4 +29,39 @@
 
 #include <inviwo/core/datastructures/histogram.h>
 
-namespace inviwo {}  // namespace inviwo
+#include <cmath>
+
+namespace inviwo {
+
+double histogramBinPosition(HistogramBinning binning, double t) {
+    if (binning == HistogramBinning::Log) {
+        return std::log1p(histogramLogBinningScale * t) / std::log1p(histogramLogBinningScale);
+    }
+    return t;
+}
+
+double histogramBinValue(HistogramBinning binning, double p) {
+    if (binning == HistogramBinning::Log) {
+        return std::expm1(p * std::log1p(histogramLogBinningScale)) / histogramLogBinningScale;
+    }
+    return p;
+}
+
+double Histogram2D::binEdge(size_t dim, size_t bin) const {
+    const auto& range = dataMap[dim].dataRange;
+    if (dimensions[dim] < 2) {
+        return bin == 0 ? range.x : range.y;
+    }
+    const auto p = static_cast<double>(bin) / static_cast<double>(dimensions[dim] - 1);
+    return range.x + (range.y - range.x) * histogramBinValue(binning[dim], p);
+}
+
+std::vector<double> Histogram2D::binEdges(size_t dim) const {
+    std::vector<double> edges(dimensions[dim] + 1);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        edges[i] = binEdge(dim, i);
+    }
+    return edges;
+}
+
+}  // namespace inviwo
@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <inviwo/core/datastructures/image/layerramconverter.h>
+#include <inviwo/core/resourcemanager/resource.h>
 
 namespace inviwo {
 /**
@@ -42,12 +43,18 @@ namespace inviwo {
 
 std::shared_ptr<LayerRAM> LayerDisk2RAMConverter::createFrom(
     std::shared_ptr<const LayerDisk> source) const {
-    return std::static_pointer_cast<LayerRAM>(source->createRepresentation());
+    auto ram = std::static_pointer_cast<LayerRAM>(source->createRepresentation());
+    // The RAM representation can always be reloaded from disk, hence it can be evicted.
+    resource::evictable(resource::toRAM(ram->getData()),
+                        resource::makeEvictable<LayerRepresentation>(ram, source));
+    return ram;
 }
 
 void LayerDisk2RAMConverter::update(std::shared_ptr<const LayerDisk> source,
                                     std::shared_ptr<LayerRAM> destination) const {
     source->updateRepresentation(destination);
+    resource::evictable(resource::toRAM(destination->getData()),
+                        resource::makeEvictable<LayerRepresentation>(destination, source));
 }
 
 }  // namespace inviwo
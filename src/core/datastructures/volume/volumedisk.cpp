@@ -29,6 +29,8 @@
 
 #include <inviwo/core/datastructures/volume/volumedisk.h>
 
+#include <inviwo/core/datastructures/volume/volumeram.h>
+
 namespace inviwo {
 
 VolumeDisk::VolumeDisk(size3_t dimensions, const DataFormatBase* format,
@@ -87,4 +89,20 @@ void VolumeDisk::setWrapping(const Wrapping3D& wrapping) { wrapping_ = wrapping;
 
 Wrapping3D VolumeDisk::getWrapping() const { return wrapping_; }
 
+bool VolumeDisk::canLoadSlices() const {
+    return dynamic_cast<const VolumeSliceLoader*>(getLoader()) != nullptr;
+}
+
+std::shared_ptr<VolumeRAM> VolumeDisk::loadSlices(size_t begin, size_t end) const {
+    if (const auto* loader = dynamic_cast<const VolumeSliceLoader*>(getLoader())) {
+        if (begin >= end || end > dimensions_.z) {
+            throw Exception(SourceContext{},
+                            "Invalid slice range [{}, {}) for a volume with {} slices", begin, end,
+                            dimensions_.z);
+        }
+        return loader->loadSlices(*this, begin, end);
+    }
+    return nullptr;
+}
+
 }  // namespace inviwo
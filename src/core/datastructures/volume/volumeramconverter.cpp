@@ -29,17 +29,24 @@
 
 #include <inviwo/core/datastructures/volume/volumeramconverter.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/resourcemanager/resource.h>
 
 namespace inviwo {
 
 std::shared_ptr<VolumeRAM> VolumeDisk2RAMConverter::createFrom(
     std::shared_ptr<const VolumeDisk> source) const {
-    return std::static_pointer_cast<VolumeRAM>(source->createRepresentation());
+    auto ram = std::static_pointer_cast<VolumeRAM>(source->createRepresentation());
+    // The RAM representation can always be reloaded from disk, hence it can be evicted.
+    resource::evictable(resource::toRAM(ram->getData()),
+                        resource::makeEvictable<VolumeRepresentation>(ram, source));
+    return ram;
 }
 
 void VolumeDisk2RAMConverter::update(std::shared_ptr<const VolumeDisk> source,
                                      std::shared_ptr<VolumeRAM> destination) const {
     source->updateRepresentation(destination);
+    resource::evictable(resource::toRAM(destination->getData()),
+                        resource::makeEvictable<VolumeRepresentation>(destination, source));
 }
 
 }  // namespace inviwo
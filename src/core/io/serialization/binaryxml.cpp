@@ -0,0 +1,546 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/serialization/binaryxml.h>
+
+#include <inviwo/core/io/serialization/ticpp.h>
+#include <inviwo/core/util/charconv.h>
+#include <inviwo/core/util/exception.h>
+
+#include <ticpp/printer.h>
+#include <ticpp/stylesheet.h>
+#include <ticpp/text.h>
+#include <ticpp/unknown.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::array<std::byte, 4> magic{std::byte{'I'}, std::byte{'V'}, std::byte{'W'},
+                                         std::byte{'B'}};
+constexpr std::byte formatVersion{1};
+
+// Shorter runs of numeric elements are not worth the array header
+constexpr size_t minArrayLength = 4;
+
+enum class Tag : std::uint8_t {
+    End,
+    Element,
+    Text,
+    CData,
+    Comment,
+    Declaration,
+    Unknown,
+    Stylesheet,
+    Array
+};
+
+enum class Kind : std::uint8_t { String, Int, Float, Double };
+
+/*
+ * The binary representations of a text that give back the exact same text when formatted.
+ */
+struct Numeric {
+    static constexpr std::uint8_t intBit = 1;
+    static constexpr std::uint8_t floatBit = 2;
+    static constexpr std::uint8_t doubleBit = 4;
+
+    explicit Numeric(std::string_view text) {
+        if (text.empty() || text.size() > 24) return;
+        const auto c = text.front();
+        if (!(c == '-' || (c >= '0' && c <= '9') || c == 'i' || c == 'n')) return;
+
+        if (auto v = util::fromStr<std::int64_t>(text); v && formatsAs(*v, text)) {
+            i = *v;
+            mask |= intBit;
+        }
+        if (auto v = util::fromStr<float>(text); v && formatsAs(*v, text)) {
+            f = *v;
+            mask |= floatBit;
+        }
+        if (auto v = util::fromStr<double>(text); v && formatsAs(*v, text)) {
+            d = *v;
+            mask |= doubleBit;
+        }
+    }
+
+    static bool supports(std::uint8_t mask, Kind kind) {
+        switch (kind) {
+            case Kind::Int:
+                return (mask & intBit) != 0;
+            case Kind::Float:
+                return (mask & floatBit) != 0;
+            case Kind::Double:
+                return (mask & doubleBit) != 0;
+            case Kind::String:
+                return true;
+        }
+        return false;
+    }
+
+    /*
+     * The most compact kind that is supported by all values in mask.
+     */
+    static Kind kind(std::uint8_t mask) {
+        for (auto k : {Kind::Int, Kind::Float, Kind::Double}) {
+            if (supports(mask, k)) return k;
+        }
+        return Kind::String;
+    }
+
+    template <typename T>
+    static bool formatsAs(T value, std::string_view text) {
+        std::array<char, 32> buffer{};
+        const auto res = fmt::format_to_n(buffer.data(), buffer.size(), "{}", value);
+        return std::string_view{buffer.data(), res.size} == text;
+    }
+
+    std::uint8_t mask = 0;
+    std::int64_t i = 0;
+    float f = 0.0f;
+    double d = 0.0;
+};
+
+class Encoder {
+public:
+    explicit Encoder(std::pmr::vector<std::byte>& data) : data_{data} {}
+
+    void document(const TiXmlDocument& doc) {
+        data_.insert(data_.end(), magic.begin(), magic.end());
+        data_.push_back(formatVersion);
+        children(doc);
+    }
+
+private:
+    void tag(Tag t) { data_.push_back(static_cast<std::byte>(t)); }
+    void kind(Kind k) { data_.push_back(static_cast<std::byte>(k)); }
+
+    void varint(std::uint64_t value) {
+        while (value >= 0x80) {
+            data_.push_back(static_cast<std::byte>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        data_.push_back(static_cast<std::byte>(value));
+    }
+
+    void zigzag(std::int64_t value) {
+        varint((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+
+    template <typename T>
+    void fixed(T value) {
+        using U = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        auto bits = std::bit_cast<U>(value);
+        for (size_t i = 0; i < sizeof(U); ++i) {
+            data_.push_back(static_cast<std::byte>(bits & 0xff));
+            bits >>= 8;
+        }
+    }
+
+    // Strings are interned, 0 is followed by a new string, otherwise the index + 1 of a
+    // previous string
+    void string(std::string_view str) {
+        if (auto it = strings_.find(str); it != strings_.end()) {
+            varint(it->second + 1);
+        } else {
+            varint(0);
+            varint(str.size());
+            const auto* begin = reinterpret_cast<const std::byte*>(str.data());
+            data_.insert(data_.end(), begin, begin + str.size());
+            strings_.emplace(str, strings_.size());
+        }
+    }
+
+    void number(Kind k, const Numeric& n) {
+        switch (k) {
+            case Kind::Int:
+                zigzag(n.i);
+                break;
+            case Kind::Float:
+                fixed(n.f);
+                break;
+            case Kind::Double:
+                fixed(n.d);
+                break;
+            case Kind::String:
+                break;
+        }
+    }
+
+    void value(std::string_view text) {
+        const Numeric n{text};
+        const auto k = Numeric::kind(n.mask);
+        kind(k);
+        if (k == Kind::String) {
+            string(text);
+        } else {
+            number(k, n);
+        }
+    }
+
+    void children(const TiXmlNode& parent) {
+        const auto start = data_.size();
+        fixed(std::uint32_t{0});
+
+        const TiXmlNode* node = parent.FirstChild();
+        while (node) {
+            if (const auto* elem = node->ToElement()) {
+                node = element(*elem);
+            } else {
+                other(*node);
+                node = node->NextSibling();
+            }
+        }
+        tag(Tag::End);
+
+        const auto length = static_cast<std::uint32_t>(data_.size() - start - 4);
+        for (size_t i = 0; i < 4; ++i) {
+            data_[start + i] = static_cast<std::byte>((length >> (8 * i)) & 0xff);
+        }
+    }
+
+    static const TiXmlAttribute* arrayItem(const TiXmlNode* node, std::string_view name,
+                                           std::string_view attribute) {
+        const auto* elem = node ? node->ToElement() : nullptr;
+        if (!elem || elem->Value() != name || elem->FirstChild()) return nullptr;
+        const auto* attr = elem->FirstAttribute();
+        if (!attr || attr->Next() || attr->Name() != attribute) return nullptr;
+        return attr;
+    }
+
+    /*
+     * Encode the run of elements that starts at first, either as a packed array, or one by one.
+     * Returns the node after the run.
+     */
+    const TiXmlNode* element(const TiXmlElement& first) {
+        const auto* firstAttr = first.FirstAttribute();
+        if (first.FirstChild() || !firstAttr || firstAttr->Next()) {
+            single(first);
+            return first.NextSibling();
+        }
+
+        const auto name = first.Value();
+        const auto attribute = firstAttr->Name();
+
+        size_t count = 0;
+        const TiXmlNode* end = &first;
+        while (arrayItem(end, name, attribute)) {
+            ++count;
+            end = end->NextSibling();
+        }
+
+        if (count >= minArrayLength) {
+            values_.clear();
+            std::uint8_t mask = Numeric::intBit | Numeric::floatBit | Numeric::doubleBit;
+            for (const TiXmlNode* node = &first; node != end && mask; node = node->NextSibling()) {
+                values_.emplace_back(node->ToElement()->FirstAttribute()->Value());
+                mask &= values_.back().mask;
+            }
+
+            if (const auto k = Numeric::kind(mask); k != Kind::String) {
+                tag(Tag::Array);
+                string(name);
+                string(attribute);
+                kind(k);
+                varint(count);
+                for (const auto& n : values_) number(k, n);
+                return end;
+            }
+        }
+
+        for (const TiXmlNode* node = &first; node != end; node = node->NextSibling()) {
+            single(*node->ToElement());
+        }
+        return end;
+    }
+
+    void single(const TiXmlElement& elem) {
+        tag(Tag::Element);
+        string(elem.Value());
+
+        size_t count = 0;
+        for (const auto* attr = elem.FirstAttribute(); attr; attr = attr->Next()) ++count;
+        varint(count);
+        for (const auto* attr = elem.FirstAttribute(); attr; attr = attr->Next()) {
+            string(attr->Name());
+            value(attr->Value());
+        }
+        children(elem);
+    }
+
+    void other(const TiXmlNode& node) {
+        if (const auto* text = node.ToText()) {
+            tag(text->CDATA() ? Tag::CData : Tag::Text);
+            string(text->Value());
+        } else if (const auto* comment = node.ToComment()) {
+            tag(Tag::Comment);
+            string(comment->Value());
+        } else if (const auto* decl = node.ToDeclaration()) {
+            tag(Tag::Declaration);
+            string(decl->Version());
+            string(decl->Encoding());
+            string(decl->Standalone());
+        } else if (const auto* stylesheet = node.ToStylesheetReference()) {
+            tag(Tag::Stylesheet);
+            string(stylesheet->Type());
+            string(stylesheet->Href());
+        } else {
+            tag(Tag::Unknown);
+            string(node.Value());
+        }
+    }
+
+    std::pmr::vector<std::byte>& data_;
+    std::unordered_map<std::string_view, size_t> strings_;
+    std::vector<Numeric> values_;
+};
+
+class Decoder {
+public:
+    explicit Decoder(std::span<const std::byte> data) : data_{data} {}
+
+    void document(TiXmlDocument& doc) {
+        if (!binaryxml::isBinary(data_)) {
+            throw Exception(SourceContext{}, "Invalid binary xml, header not found");
+        }
+        pos_ = magic.size();
+        if (const auto version = byte(); version != formatVersion) {
+            throw Exception(SourceContext{}, "Unsupported binary xml format version: {}",
+                            static_cast<int>(version));
+        }
+        children(doc, doc.getAllocator());
+        if (pos_ != data_.size()) {
+            throw Exception(SourceContext{}, "Invalid binary xml, unexpected trailing data");
+        }
+    }
+
+private:
+    void require(size_t size) const {
+        if (data_.size() - pos_ < size) {
+            throw Exception(SourceContext{}, "Invalid binary xml, unexpected end of data");
+        }
+    }
+
+    std::byte byte() {
+        require(1);
+        return data_[pos_++];
+    }
+
+    std::uint64_t varint() {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const auto b = std::to_integer<std::uint64_t>(byte());
+            value |= (b & 0x7f) << shift;
+            if ((b & 0x80) == 0) return value;
+        }
+        throw Exception(SourceContext{}, "Invalid binary xml, malformed integer");
+    }
+
+    std::int64_t zigzag() {
+        const auto value = varint();
+        return static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    template <typename T>
+    T fixed() {
+        using U = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        require(sizeof(U));
+        U bits = 0;
+        for (size_t i = 0; i < sizeof(U); ++i) {
+            bits |= std::to_integer<U>(data_[pos_ + i]) << (8 * i);
+        }
+        pos_ += sizeof(U);
+        return std::bit_cast<T>(bits);
+    }
+
+    std::string_view string() {
+        if (const auto ref = varint(); ref != 0) {
+            if (ref > strings_.size()) {
+                throw Exception(SourceContext{}, "Invalid binary xml, unknown string reference");
+            }
+            return strings_[ref - 1];
+        }
+        const auto size = varint();
+        require(size);
+        const std::string_view str{reinterpret_cast<const char*>(data_.data() + pos_), size};
+        pos_ += size;
+        strings_.push_back(str);
+        return str;
+    }
+
+    Kind kind() {
+        const auto k = std::to_integer<std::uint8_t>(byte());
+        if (k > static_cast<std::uint8_t>(Kind::Double)) {
+            throw Exception(SourceContext{}, "Invalid binary xml, unknown value kind: {}", k);
+        }
+        return static_cast<Kind>(k);
+    }
+
+    void value(Kind k, std::pmr::string& out) {
+        switch (k) {
+            case Kind::String:
+                out.append(string());
+                break;
+            case Kind::Int:
+                fmt::format_to(std::back_inserter(out), "{}", zigzag());
+                break;
+            case Kind::Float:
+                fmt::format_to(std::back_inserter(out), "{}", fixed<float>());
+                break;
+            case Kind::Double:
+                fmt::format_to(std::back_inserter(out), "{}", fixed<double>());
+                break;
+        }
+    }
+
+    void children(TiXmlNode& parent, TiXmlNode::allocator_type alloc) {
+        const auto length = fixed<std::uint32_t>();
+        const auto end = pos_ + length;
+        if (end > data_.size()) {
+            throw Exception(SourceContext{}, "Invalid binary xml, unexpected end of data");
+        }
+
+        while (true) {
+            const auto t = static_cast<Tag>(byte());
+            if (t == Tag::End) break;
+            node(t, parent, alloc);
+        }
+
+        if (pos_ != end) {
+            throw Exception(SourceContext{}, "Invalid binary xml, node length mismatch");
+        }
+    }
+
+    void node(Tag t, TiXmlNode& parent, TiXmlNode::allocator_type alloc) {
+        switch (t) {
+            case Tag::Element: {
+                auto* elem = parent.LinkEndChild(alloc.new_object<TiXmlElement>(string()));
+                const auto count = varint();
+                for (std::uint64_t i = 0; i < count; ++i) {
+                    auto& attr = elem->ToElement()->AddAttribute(string());
+                    value(kind(), attr);
+                }
+                children(*elem, alloc);
+                break;
+            }
+            case Tag::Array: {
+                const auto name = string();
+                const auto attribute = string();
+                const auto k = kind();
+                const auto count = varint();
+                for (std::uint64_t i = 0; i < count; ++i) {
+                    auto* elem = parent.LinkEndChild(alloc.new_object<TiXmlElement>(name));
+                    value(k, elem->ToElement()->AddAttribute(attribute));
+                }
+                break;
+            }
+            case Tag::Text:
+            case Tag::CData:
+                parent.LinkEndChild(alloc.new_object<TiXmlText>(string(), t == Tag::CData));
+                break;
+            case Tag::Comment:
+                parent.LinkEndChild(alloc.new_object<TiXmlComment>(string()));
+                break;
+            case Tag::Declaration: {
+                const auto version = string();
+                const auto encoding = string();
+                const auto standalone = string();
+                parent.LinkEndChild(
+                    alloc.new_object<TiXmlDeclaration>(version, encoding, standalone));
+                break;
+            }
+            case Tag::Stylesheet: {
+                const auto type = string();
+                const auto href = string();
+                parent.LinkEndChild(alloc.new_object<TiXmlStylesheetReference>(type, href));
+                break;
+            }
+            case Tag::Unknown: {
+                auto* unknown = alloc.new_object<TiXmlUnknown>();
+                unknown->SetValue(string());
+                parent.LinkEndChild(unknown);
+                break;
+            }
+            default:
+                throw Exception(SourceContext{}, "Invalid binary xml, unknown node type: {}",
+                                static_cast<int>(t));
+        }
+    }
+
+    std::span<const std::byte> data_;
+    size_t pos_ = 0;
+    std::vector<std::string_view> strings_;
+};
+
+}  // namespace
+
+bool binaryxml::isBinary(std::span<const std::byte> data) {
+    return data.size() > magic.size() && std::equal(magic.begin(), magic.end(), data.begin());
+}
+
+void binaryxml::encode(const TiXmlDocument& doc, std::pmr::vector<std::byte>& data) {
+    Encoder{data}.document(doc);
+}
+
+void binaryxml::decode(std::span<const std::byte> data, TiXmlDocument& doc) {
+    Decoder{data}.document(doc);
+}
+
+void binaryxml::toXML(std::span<const std::byte> data, std::pmr::string& xml, bool format) {
+    TiXmlDocument doc{xml.get_allocator()};
+    decode(data, doc);
+    try {
+        TiXmlPrinter printer{xml, format ? TiXmlStreamPrint::No : TiXmlStreamPrint::Yes};
+        doc.Accept(&printer);
+    } catch (const TiXmlError& e) {
+        throw Exception(SourceContext{}, "{}", e.what());
+    }
+}
+
+void binaryxml::fromXML(const std::pmr::string& xml, std::pmr::vector<std::byte>& data) {
+    TiXmlDocument doc{data.get_allocator()};
+    try {
+        doc.Parse(xml.c_str(), nullptr, data.get_allocator());
+    } catch (const TiXmlError& e) {
+        throw Exception(SourceContext{}, "{}", e.what());
+    }
+    encode(doc, data);
+}
+
+}  // namespace inviwo
@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <inviwo/core/io/serialization/deserializer.h>
+#include <inviwo/core/io/serialization/binaryxml.h>
 #include <inviwo/core/io/serialization/serializable.h>
 #include <inviwo/core/io/serialization/versionconverter.h>
 #include <inviwo/core/util/factory.h>
@@ -118,6 +119,22 @@ Deserializer::Deserializer(const std::pmr::string& content, std::string_view roo
                            allocator_type alloc)
     : Deserializer{content, std::filesystem::path{}, rootElement, alloc} {}
 
+Deserializer::Deserializer(std::span<const std::byte> data, const std::filesystem::path& refPath,
+                           std::string_view rootElement, allocator_type alloc)
+    : SerializeBase(refPath, alloc), registeredFactories_{alloc} {
+    try {
+        binaryxml::decode(data, *doc_);
+        rootElement_ = getRootElement(*doc_, rootElement);
+        version_ = getVersionAttribute(rootElement_);
+    } catch (const TiXmlError& e) {
+        throw AbortException(e.what());
+    } catch (const AbortException&) {
+        throw;
+    } catch (const Exception& e) {
+        throw AbortException(e.getContext(), "{}", e.getMessage());
+    }
+}
+
 void Deserializer::deserialize(std::string_view key, std::filesystem::path& path,
                                const SerializationTarget& target) {
 
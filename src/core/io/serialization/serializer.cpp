@@ -32,6 +32,7 @@
 #include <inviwo/core/util/exception.h>
 #include <inviwo/core/io/serialization/ticpp.h>
 #include <inviwo/core/io/serialization/serializationexception.h>
+#include <inviwo/core/io/serialization/binaryxml.h>
 #include <inviwo/core/util/safecstr.h>
 
 #include <filesystem>
@@ -155,4 +156,12 @@ void Serializer::write(std::pmr::string& xml, bool format) {
     }
 }
 
+void Serializer::write(std::pmr::vector<std::byte>& data) {
+    try {
+        binaryxml::encode(*doc_, data);
+    } catch (const TiXmlError& e) {
+        throw SerializationException(e.what());
+    }
+}
+
 }  // namespace inviwo
@@ -38,6 +38,11 @@
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/network/networklock.h>
 #include <inviwo/core/properties/compositeproperty.h>
+#include <inviwo/core/util/evaluationprofiler.h>
+
+#include <chrono>
+#include <unordered_set>
+#include <utility>
 
 namespace inviwo {
 
@@ -125,6 +130,10 @@ void LinkEvaluator::removeLink(const PropertyLink& propertyLink) {
         directLinkCache_.erase(src);
     }
 
+    // The properties might be about to be removed, don't keep them for a later batch
+    std::erase(pending_, src);
+    std::erase(pending_, dst);
+
     transientLinkCache_.clear();
 }
 
@@ -210,14 +219,82 @@ bool LinkEvaluator::isLinking() const { return !visited_.empty(); }
 void LinkEvaluator::evaluateLinksFromProperty(Property* modifiedProperty) {
     if (util::contains(visited_, modifiedProperty)) return;
 
-    const NetworkLock lock(network_);
+    if (batched_ && network_->islocked()) {
+        if (!getTriggeredLinksForProperty(modifiedProperty).empty()) {
+            std::erase(pending_, modifiedProperty);
+            pending_.push_back(modifiedProperty);
+        }
+        return;
+    }
 
-    auto& links = getTriggeredLinksForProperty(modifiedProperty);
-    const VisitedHelper helper(visited_, links);
+    const auto start = std::chrono::steady_clock::now();
+    const EvaluationProfiler::Scope scope{EvaluationProfiler::Category::Linking, "Links"};
+    {
+        const NetworkLock lock(network_);
 
-    for (auto& link : links) {
-        link.converter->convert(link.src, link.dst);
+        auto& links = getTriggeredLinksForProperty(modifiedProperty);
+        const VisitedHelper helper(visited_, links);
+
+        for (auto& link : links) {
+            link.converter->convert(link.src, link.dst);
+        }
+        ++stats_.evaluations;
+        stats_.conversions += links.size();
     }
+    stats_.time += std::chrono::steady_clock::now() - start;
+}
+
+void LinkEvaluator::setBatched(bool batched) {
+    batched_ = batched;
+    if (!batched_ && !network_->islocked()) flushBatch();
 }
 
+bool LinkEvaluator::isBatched() const { return batched_; }
+
+bool LinkEvaluator::hasPendingChanges() const { return !pending_.empty(); }
+
+void LinkEvaluator::flushBatch() {
+    if (pending_.empty()) return;
+
+    const auto start = std::chrono::steady_clock::now();
+    const EvaluationProfiler::Scope scope{EvaluationProfiler::Category::Linking, "Batched Links"};
+    {
+        const NetworkLock lock(network_);
+        // Changes made during the propagation end up in a new batch, flushed under the same lock
+        while (!pending_.empty()) {
+            const auto sources = std::exchange(pending_, {});
+
+            std::vector<ConvertibleLink> links;
+            std::unordered_set<Property*> assigned;
+            for (auto it = sources.rbegin(); it != sources.rend(); ++it) {
+                // A later change has already set this property, and followed its outgoing links
+                if (!assigned.insert(*it).second) {
+                    stats_.coalesced += getTriggeredLinksForProperty(*it).size();
+                    continue;
+                }
+                for (const auto& link : getTriggeredLinksForProperty(*it)) {
+                    if (assigned.insert(link.dst).second) {
+                        links.push_back(link);
+                    } else {
+                        ++stats_.coalesced;
+                    }
+                }
+            }
+            // The links of later changes come first, so every link reads a source that already has
+            // its final value. The links of each change are in propagation order.
+            const VisitedHelper helper(visited_, links);
+            for (auto& link : links) {
+                link.converter->convert(link.src, link.dst);
+            }
+            stats_.evaluations += sources.size();
+            stats_.conversions += links.size();
+        }
+    }
+    stats_.time += std::chrono::steady_clock::now() - start;
+}
+
+const LinkEvaluator::Stats& LinkEvaluator::getStats() const { return stats_; }
+
+void LinkEvaluator::resetStats() { stats_ = Stats{}; }
+
 }  // namespace inviwo
@@ -33,6 +33,7 @@
 #include <inviwo/core/util/vectoroperations.h>
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/foreach.h>
 #include <inviwo/core/util/rendercontext.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/utilities.h>
@@ -41,12 +42,14 @@
 #include <inviwo/core/metadata/processormetadata.h>
 #include <inviwo/core/network/networkvisitor.h>
 #include <inviwo/core/network/networkedge.h>
+#include <inviwo/core/processors/processorfactory.h>
 #include <inviwo/core/io/serialization/serializationexception.h>
 
 #include <fmt/format.h>
 #include <fmt/std.h>
 
 #include <algorithm>
+#include <unordered_map>
 
 namespace inviwo {
 
@@ -319,6 +322,10 @@ void ProcessorNetwork::evaluateLinksFromProperty(Property* source) {
     linkEvaluator_.evaluateLinksFromProperty(source);
 }
 
+LinkEvaluator& ProcessorNetwork::getLinkEvaluator() { return linkEvaluator_; }
+
+const LinkEvaluator& ProcessorNetwork::getLinkEvaluator() const { return linkEvaluator_; }
+
 void ProcessorNetwork::clear() {
     const NetworkLock lock(this);
 
@@ -431,6 +438,48 @@ const int ProcessorNetwork::processorNetworkVersion_ = 21;
 
 namespace {
 
+/*
+ * Create the new processors of a workspace whose factory objects are thread safe in parallel on
+ * the thread pool. The remaining processors are created on demand during the deserialization.
+ */
+std::unordered_map<std::string, std::shared_ptr<Processor>> createProcessorsConcurrently(
+    Deserializer& d, const ProcessorNetwork& net, const ProcessorFactory& factory) {
+
+    std::pmr::vector<std::pair<std::string, std::string_view>> toCreate{d.getAllocator()};
+    d.deserializeRange("Processors", "Processor", [&](Deserializer& nested, size_t) {
+        const auto type = nested.attribute(SerializeConstants::TypeAttribute);
+        const auto id = nested.attribute("identifier");
+        if (!type || !id || !factory.isThreadSafe(*type)) return;
+
+        auto key = util::stripIdentifier(*id);
+        if (const auto* p = net.getProcessorByIdentifier(key);
+            p && p->getClassIdentifier() == *type) {
+            return;
+        }
+        toCreate.emplace_back(std::move(key), *type);
+    });
+
+    std::unordered_map<std::string, std::shared_ptr<Processor>> created;
+    if (toCreate.size() < 2) return created;
+
+    std::vector<std::shared_ptr<Processor>> processors(toCreate.size());
+    util::forEachChunkParallel(toCreate.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            try {
+                processors[i] = factory.createShared(toCreate[i].second);
+            } catch (...) {
+                // Leave it to the regular deserialization to create and report the error
+            }
+        }
+    });
+
+    created.reserve(toCreate.size());
+    for (size_t i = 0; i < toCreate.size(); ++i) {
+        if (processors[i]) created.try_emplace(std::move(toCreate[i].first), processors[i]);
+    }
+    return created;
+}
+
 PortConnection retrieveConnection(Deserializer& d, const ProcessorNetwork& net) {
     const auto src = d.attribute("src");
     const auto dst = d.attribute("dst");
@@ -518,13 +567,18 @@ void ProcessorNetwork::deserialize(Deserializer& d) {
     try {
         rendercontext::activateDefault();
 
+        auto created = createProcessorsConcurrently(d, *this, *application_->getProcessorFactory());
+
         d.deserialize(
             "Processors", processors_, "Processor",
             deserializer::MapFunctions{
                 .attributeKey = "identifier",
                 .idTransform = [](std::string_view id) { return util::stripIdentifier(id); },
                 .makeNew =
-                    []() {
+                    [&](const std::string& id) {
+                        if (auto it = created.find(id); it != created.end()) {
+                            return std::move(it->second);
+                        }
                         rendercontext::activateDefault();
                         return std::shared_ptr<Processor>{};
                     },
@@ -30,11 +30,13 @@
 #include <inviwo/core/network/processornetworkevaluator.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/processorresultcache.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/network/networkutils.h>
 #include <inviwo/core/network/networklock.h>
 #include <inviwo/core/util/clock.h>
+#include <inviwo/core/util/evaluationprofiler.h>
 
 namespace inviwo {
 
@@ -106,6 +108,8 @@ void ProcessorNetworkEvaluator::evaluate() {
     }
 
     IVW_CPU_PROFILING_IF(500, "Evaluated Processor Network");
+    const EvaluationProfiler::Scope evaluationScope{EvaluationProfiler::Category::Evaluation,
+                                                    "Network"};
 
     for (auto processor : processorsSorted_) {
         if (!processor->isValid()) {
@@ -113,6 +117,9 @@ void ProcessorNetworkEvaluator::evaluate() {
                 try {
                     // re-initialize resources (e.g., shaders) if necessary
                     if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
+                        const EvaluationProfiler::Scope scope{
+                            EvaluationProfiler::Category::InitializeResources,
+                            processor->getIdentifier()};
                         processor->initializeResources();
                     }
                 } catch (...) {
@@ -122,6 +129,8 @@ void ProcessorNetworkEvaluator::evaluate() {
 
                 try {
                     // call onChange for all invalid inports
+                    const EvaluationProfiler::Scope scope{
+                        EvaluationProfiler::Category::PortOnChange, processor->getIdentifier()};
                     for (auto inport : processor->getInports()) {
                         inport->callOnChangeIfChanged();
                     }
@@ -134,8 +143,14 @@ void ProcessorNetworkEvaluator::evaluate() {
 
                 try {
                     IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
-                    // do the actual processing
-                    processor->process();
+                    const EvaluationProfiler::Scope scope{EvaluationProfiler::Category::Process,
+                                                          processor->getIdentifier()};
+                    // restore memoized results if possible, otherwise do the actual processing
+                    auto* cache = processor->getResultCache();
+                    if (!cache || !cache->restore()) {
+                        processor->process();
+                        if (cache && processor->isReady()) cache->store();
+                    }
 
                     // Set processor as valid only if we still are ready.
                     // Callbacks might have made our inports invalid, if so abort
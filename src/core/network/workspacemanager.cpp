@@ -272,6 +272,29 @@ void WorkspaceManager::load(const std::pmr::string& xml, const std::filesystem::
     }
 }
 
+void WorkspaceManager::save(std::pmr::vector<std::byte>& data, const std::filesystem::path& refPath,
+                            const ExceptionHandler& exceptionHandler, WorkspaceSaveMode mode,
+                            Serializer::PropertyOwnerFilter filter) {
+
+    std::pmr::monotonic_buffer_resource mbr{1024 * 32};
+
+    Serializer serializer(refPath, SerializeConstants::InviwoWorkspace, &mbr);
+    serializer.setWorkspaceSaveMode(mode);
+    serializer.setPropertyOwnerFilter(std::move(filter));
+
+    if (mode != WorkspaceSaveMode::Undo) {
+        const InviwoSetupInfo info(*app_, *app_->getProcessorNetwork(), &mbr);
+        serializer.serialize("InviwoSetup", info);
+    }
+
+    serializers_.invoke(serializer, exceptionHandler, mode);
+    serializer.write(data);
+
+    if (mode != WorkspaceSaveMode::Undo) {
+        setModified(false);
+    }
+}
+
 void WorkspaceManager::save(const std::filesystem::path& path,
                             const ExceptionHandler& exceptionHandler, WorkspaceSaveMode mode) {
     auto ostream = std::ofstream(path);
@@ -282,6 +305,23 @@ void WorkspaceManager::save(const std::filesystem::path& path,
     }
 }
 
+void WorkspaceManager::load(std::span<const std::byte> data, const std::filesystem::path& refPath,
+                            const ExceptionHandler& exceptionHandler, WorkspaceSaveMode mode) {
+    RenderContext::getPtr()->activateDefaultRenderContext();
+
+    std::pmr::monotonic_buffer_resource mbr{1024 * 128};
+
+    auto [deserializer, info] =
+        createWorkspaceDeserializerAndInfo(data, refPath, LogCentral::getPtr(), &mbr);
+    const DeserializationErrorHandle<ErrorHandle> errorHandle(deserializer, info, refPath,
+                                                              SourceContext{});
+    deserializers_.invoke(deserializer, exceptionHandler, mode);
+
+    if (mode != WorkspaceSaveMode::Undo) {
+        setModified(false);
+    }
+}
+
 void WorkspaceManager::load(const std::filesystem::path& path,
                             const ExceptionHandler& exceptionHandler, WorkspaceSaveMode mode) {
 
@@ -345,6 +385,21 @@ std::pair<Deserializer, InviwoSetupInfo> WorkspaceManager::createWorkspaceDeseri
     return result;
 }
 
+std::pair<Deserializer, InviwoSetupInfo> WorkspaceManager::createWorkspaceDeserializerAndInfo(
+    std::span<const std::byte> data, const std::filesystem::path& refPath, Logger* logger,
+    std::pmr::polymorphic_allocator<std::byte> alloc) const {
+
+    std::pair<Deserializer, InviwoSetupInfo> result{
+        std::piecewise_construct,
+        std::forward_as_tuple(data, refPath, SerializeConstants::InviwoWorkspace, alloc),
+        std::forward_as_tuple(alloc)};
+    auto& [deserializer, info] = result;
+
+    configureWorkspaceDeserializerAndInfo(deserializer, info, logger);
+
+    return result;
+}
+
 void WorkspaceManager::configureWorkspaceDeserializerAndInfo(Deserializer& deserializer,
                                                              InviwoSetupInfo& info,
                                                              Logger* logger) const {
@@ -32,6 +32,7 @@
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/util/stdfuture.h>
+#include <inviwo/core/util/evaluationprofiler.h>
 
 #include <fmt/format.h>
 
@@ -101,11 +102,21 @@ void PoolProcessor::stopJobs() {
 
 bool PoolProcessor::hasJobs() { return !states_.empty(); }
 
+bool PoolProcessor::hasPendingJobs() const { return !states_.empty() || !queue_.empty(); }
+
 void PoolProcessor::submit(Submission& job) {
     job.setupProgress();
     states_.push_back(job.state);
     notifyObserversStartBackgroundWork(this, job.tasks.size());
+    const bool profile = EvaluationProfiler::active() != nullptr;
     for (auto& task : job.tasks) {
+        if (profile) {
+            task = [task = std::move(task), identifier = getIdentifier()]() {
+                const EvaluationProfiler::Scope scope{EvaluationProfiler::Category::BackgroundJob,
+                                                      identifier};
+                task();
+            };
+        }
         util::getThreadPool(getInviwoApplication()).enqueueRaw(std::move(task));
     }
 }
@@ -96,4 +96,9 @@ std::shared_ptr<Processor> ProcessorFactory::createShared(std::string_view key,
 
 bool ProcessorFactory::hasKey(std::string_view key) const { return Register::hasKey(key); }
 
+bool ProcessorFactory::isThreadSafe(std::string_view key) const {
+    auto it = this->map_.find(key);
+    return it != end(this->map_) && it->second->isThreadSafe();
+}
+
 }  // namespace inviwo
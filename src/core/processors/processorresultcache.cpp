@@ -0,0 +1,176 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/processors/processorresultcache.h>
+
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/io/serialization/serializer.h>
+#include <inviwo/core/util/hashcombine.h>
+
+#include <algorithm>
+#include <ranges>
+#include <string_view>
+
+namespace inviwo {
+
+ProcessorResultCache::ProcessorResultCache(Processor* processor, size_t capacity)
+    : processor_{processor}, capacity_{capacity} {
+    processor_->resultCache_ = this;
+}
+
+ProcessorResultCache::~ProcessorResultCache() {
+    if (processor_->resultCache_ == this) {
+        processor_->resultCache_ = nullptr;
+    }
+}
+
+size_t ProcessorResultCache::propertyHash() {
+    Serializer s{};
+    s.setWorkspaceSaveMode(WorkspaceSaveMode::Undo);  // skip any metadata
+    processor_->PropertyOwner::serialize(s);
+    xml_.clear();
+    s.write(xml_);
+    return std::hash<std::string_view>{}(xml_);
+}
+
+std::list<ProcessorResultCache::Entry>::iterator ProcessorResultCache::find(
+    size_t key, std::string_view state, const std::vector<std::shared_ptr<const void>>& inputs) {
+
+    const auto sameInputs = [&](const Entry& entry) {
+        return std::ranges::equal(entry.inputs, inputs, [](const std::weak_ptr<const void>& cached,
+                                                           const std::shared_ptr<const void>& in) {
+            // A expired input can never match, its address might have been reused.
+            const auto locked = cached.lock();
+            return locked && locked == in;
+        });
+    };
+
+    auto [begin, end] = entries_.equal_range(key);
+    for (auto it = begin; it != end; ++it) {
+        if (it->second->state == state && sameInputs(*it->second)) return it->second;
+    }
+    return lru_.end();
+}
+
+bool ProcessorResultCache::restore() {
+    pendingKey_.reset();
+    pendingInputs_.clear();
+    if (capacity_ == 0 || outputs_.empty()) return false;
+
+    for (auto& input : inputs_) {
+        input.collect(pendingInputs_);
+    }
+    size_t key = propertyHash();
+    for (const auto& input : pendingInputs_) {
+        util::hash_combine(key, input.get());
+    }
+
+    if (auto it = find(key, xml_, pendingInputs_); it != lru_.end()) {
+        for (auto&& [output, data] : std::views::zip(outputs_, it->outputs)) {
+            output.set(data);
+        }
+        lru_.splice(lru_.begin(), lru_, it);
+        ++stats_.hits;
+        pendingInputs_.clear();
+        return true;
+    }
+
+    ++stats_.misses;
+    pendingKey_ = key;
+    return false;
+}
+
+void ProcessorResultCache::store() {
+    if (!pendingKey_) return;
+
+    // xml_ still holds the state serialized by restore()
+    Entry entry{
+        .key = *pendingKey_, .state = std::string{xml_}, .inputs = {}, .outputs = {}, .bytes = 0};
+    entry.inputs.assign(pendingInputs_.begin(), pendingInputs_.end());
+    pendingKey_.reset();
+    pendingInputs_.clear();
+
+    for (auto& output : outputs_) {
+        auto data = output.get();
+        if (!data) return;
+        // Held by the outport and us only, otherwise the processor might reuse and modify it
+        if (data.use_count() > 2) {
+            ++stats_.skipped;
+            return;
+        }
+        entry.bytes += output.size(data.get());
+        entry.outputs.push_back(std::move(data));
+    }
+    if (entry.bytes > capacity_) return;
+
+    trim(capacity_ - entry.bytes);
+
+    stats_.bytes += entry.bytes;
+    ++stats_.entries;
+    const auto key = entry.key;
+    lru_.push_front(std::move(entry));
+    entries_.emplace(key, lru_.begin());
+}
+
+void ProcessorResultCache::trim(size_t capacity) {
+    while (!lru_.empty() && stats_.bytes > capacity) {
+        auto last = std::prev(lru_.end());
+        auto [begin, end] = entries_.equal_range(last->key);
+        for (auto it = begin; it != end; ++it) {
+            if (it->second == last) {
+                entries_.erase(it);
+                break;
+            }
+        }
+        stats_.bytes -= last->bytes;
+        --stats_.entries;
+        ++stats_.evictions;
+        lru_.erase(last);
+    }
+}
+
+void ProcessorResultCache::clear() {
+    lru_.clear();
+    entries_.clear();
+    pendingKey_.reset();
+    pendingInputs_.clear();
+    stats_.entries = 0;
+    stats_.bytes = 0;
+}
+
+void ProcessorResultCache::setCapacity(size_t bytes) {
+    capacity_ = bytes;
+    trim(capacity_);
+}
+
+size_t ProcessorResultCache::getCapacity() const { return capacity_; }
+
+const ProcessorResultCache::Stats& ProcessorResultCache::getStats() const { return stats_; }
+
+}  // namespace inviwo
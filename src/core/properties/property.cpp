@@ -253,6 +253,8 @@ Property& Property::propertyModified() {
     setModified();
 
     if (auto owner = getOwner()) {
+        owner->markModified();
+
         // Evaluate property links
         if (auto processor = owner->getProcessor()) {
             processor->notifyObserversAboutPropertyChange(this);
@@ -370,6 +372,7 @@ void Property::accept(NetworkVisitor& visitor) { visitor.visit(*this); }
 // network evaluation.
 void Property::notifyAboutChange() {
     if (auto owner = getOwner()) {
+        owner->markModified();
         if (auto processor = owner->getProcessor()) {
             // By putting a nullptr here we will avoid evaluation links.
             processor->notifyObserversAboutPropertyChange(nullptr);
@@ -155,6 +155,7 @@ void PropertyOwner::insertProperty(size_t index, Property* property, bool owner)
 
     notifyObserversWillAddProperty(this, property, index);
     insertPropertyImpl(properties_.begin() + index, property, owner);
+    markModified();
     notifyObserversDidAddProperty(property, index);
 }
 
@@ -211,6 +212,7 @@ Property* PropertyOwner::removePropertyImpl(iterator it) {
 
         prop->setOwner(nullptr);
         properties_.erase(it);
+        markModified();
         notifyObserversDidRemoveProperty(this, prop, index);
 
         // This will delete the property if owned; in that case set prop to nullptr.
@@ -317,6 +319,7 @@ bool PropertyOwner::move(Property* property, size_t newIndex) {
 
         notifyObserversWillAddProperty(this, property, newIndex);
         properties_.insert(properties_.begin() + newIndex, property);
+        markModified();
         notifyObserversDidAddProperty(property, newIndex);
         return true;
     } else {
@@ -357,7 +360,17 @@ const PropertyOwner* PropertyOwner::getOwner() const { return nullptr; }
 
 PropertyOwner* PropertyOwner::getOwner() { return nullptr; }
 
+size_t PropertyOwner::getModificationCount() const { return modificationCount_; }
+
+void PropertyOwner::markModified() {
+    for (auto* owner = this; owner != nullptr; owner = owner->getOwner()) {
+        ++owner->modificationCount_;
+    }
+}
+
 void PropertyOwner::serialize(Serializer& s) const {
+    if (!s.serializeProperties(*this)) return;
+
     s.serialize(
         "OwnedPropertyIdentifiers", ownedProperties_, "PropertyIdentifier", util::alwaysTrue{},
         [](const std::unique_ptr<Property>& p) -> decltype(auto) { return p->getIdentifier(); });
@@ -81,6 +81,10 @@ void meta(const RAM& key, const ResourceMeta& meta) {
     onMain(&ResourceManager::meta<RAM>, key, meta);
 }
 
+void evictable(const RAM& key, Evictable evictable) {
+    onMain(&ResourceManager::evictable<RAM>, key, std::move(evictable));
+}
+
 void add(const GL& key, Resource resource) {
     onMain(&ResourceManager::add<GL>, key, std::move(resource));
 }
@@ -95,6 +99,10 @@ void meta(const GL& key, const ResourceMeta& meta) {
     onMain(&ResourceManager::meta<GL>, key, meta);
 }
 
+void evictable(const GL& key, Evictable evictable) {
+    onMain(&ResourceManager::evictable<GL>, key, std::move(evictable));
+}
+
 void add(const PY& key, Resource resource) {
     onMain(&ResourceManager::add<PY>, key, std::move(resource));
 }
@@ -109,6 +117,16 @@ void meta(const PY& key, const ResourceMeta& meta) {
     onMain(&ResourceManager::meta<PY>, key, meta);
 }
 
+void evictable(const PY& key, Evictable evictable) {
+    onMain(&ResourceManager::evictable<PY>, key, std::move(evictable));
+}
+
+void addPool(std::shared_ptr<const PoolStats> stats) {
+    onMain(&ResourceManager::addPool, std::move(stats));
+}
+
+void removePool(const PoolStats* stats) { onMain(&ResourceManager::removePool, stats); }
+
 RAM toRAM(const void* ptr) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
     return resource::RAM{reinterpret_cast<std::uintptr_t>(ptr)};
@@ -29,4 +29,123 @@
 
 #include <inviwo/core/resourcemanager/resourcemanager.h>
 
-namespace inviwo {}  // namespace inviwo
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/timer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ranges>
+#include <vector>
+
+namespace inviwo {
+
+ResourceManager::ResourceManager() = default;
+
+ResourceManager::~ResourceManager() = default;
+
+void ResourceManager::setBudget(size_t groupIndex, size_t bytes) {
+    stats_.at(groupIndex).budget = bytes;
+    if (overBudget(groupIndex)) scheduleEnforceBudget();
+}
+
+size_t ResourceManager::getBudget(size_t groupIndex) const { return stats_.at(groupIndex).budget; }
+
+size_t ResourceManager::enforceBudget(size_t groupIndex) {
+    if (!overBudget(groupIndex)) return 0;
+
+    size_t evicted = 0;
+    util::for_each_in_tuple(
+        [&, i = size_t{0}](auto& evictables) mutable {
+            if (i++ != groupIndex) return;
+
+            using Key = typename std::decay_t<decltype(evictables)>::key_type;
+            std::vector<std::pair<std::chrono::steady_clock::time_point, Key>> candidates;
+            candidates.reserve(evictables.size());
+            for (auto it = evictables.begin(); it != evictables.end();) {
+                if (auto lastAccess = it->second.lastAccess()) {
+                    candidates.emplace_back(*lastAccess, it->first);
+                    ++it;
+                } else {
+                    it = evictables.erase(it);
+                }
+            }
+            std::ranges::sort(candidates, std::less<>{},
+                              &std::pair<std::chrono::steady_clock::time_point, Key>::first);
+
+            auto& stats = stats_[groupIndex];
+            for (const auto& key : candidates | std::views::values) {
+                if (!overBudget(groupIndex)) break;
+                // Evicting will release the resource, which removes the evictable
+                auto it = evictables.find(key);
+                if (it == evictables.end()) continue;
+                const auto evict = it->second.evict;
+                const auto before = stats.usage;
+                if (evict()) {
+                    evictables.erase(key);
+                    ++stats.evictions;
+                    const auto bytes = before > stats.usage ? before - stats.usage : size_t{0};
+                    stats.evictedBytes += bytes;
+                    evicted += bytes;
+                }
+            }
+        },
+        evictables_);
+
+    return evicted;
+}
+
+size_t ResourceManager::enforceBudgets() {
+    enforcePending_ = false;
+    size_t evicted = 0;
+    for (size_t i = 0; i < groups; ++i) {
+        evicted += enforceBudget(i);
+    }
+    return evicted;
+}
+
+void ResourceManager::setBusyCallback(std::function<bool()> busy) { busy_ = std::move(busy); }
+
+void ResourceManager::addPool(std::shared_ptr<const resource::PoolStats> stats) {
+    if (!stats || std::ranges::contains(pools_, stats)) return;
+    notifyWillAddPool(pools_.size());
+    pools_.push_back(std::move(stats));
+    notifyDidAddPool(pools_.size() - 1);
+}
+
+void ResourceManager::removePool(const resource::PoolStats* stats) {
+    auto it = std::ranges::find(pools_, stats, &std::shared_ptr<const resource::PoolStats>::get);
+    if (it == pools_.end()) return;
+    const auto index = static_cast<size_t>(std::distance(pools_.begin(), it));
+    notifyWillRemovePool(index);
+    pools_.erase(it);
+    notifyDidRemovePool(index);
+}
+
+void ResourceManager::scheduleEnforceBudget() {
+    // Evict later on the main thread, never in the middle of a conversion or an evaluation.
+    if (enforcePending_ || !InviwoApplication::isInitialized() ||
+        InviwoApplication::getPtr()->getResourceManager() != this) {
+        return;
+    }
+    enforcePending_ = true;
+    util::dispatchFrontAndForget([this]() { enforceWhenIdle(); });
+}
+
+void ResourceManager::enforceWhenIdle() {
+    if (busyRetries_ < maxBusyRetries && !overHardLimit() && busy_ && busy_()) {
+        // Somebody might be reading the resources through raw pointers, try again later
+        ++busyRetries_;
+        if (!retry_) {
+            retry_ = std::make_unique<Delay>(std::chrono::milliseconds{100},
+                                             [this]() { enforceWhenIdle(); });
+        }
+        retry_->start();
+        return;
+    }
+    // Past the retries or the hard limit, staying within the budget takes precedence
+    busyRetries_ = 0;
+    enforceBudgets();
+}
+
+}  // namespace inviwo
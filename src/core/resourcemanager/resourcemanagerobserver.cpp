@@ -61,5 +61,17 @@ void ResourceManagerObservable::notifyDidRemoveResource(size_t group, size_t ind
     forEachObserver(
         [&](ResourceManagerObserver* o) { o->onDidRemoveResource(group, index, resource); });
 }
+void ResourceManagerObservable::notifyWillAddPool(size_t index) {
+    forEachObserver([&](ResourceManagerObserver* o) { o->onWillAddPool(index); });
+}
+void ResourceManagerObservable::notifyDidAddPool(size_t index) {
+    forEachObserver([&](ResourceManagerObserver* o) { o->onDidAddPool(index); });
+}
+void ResourceManagerObservable::notifyWillRemovePool(size_t index) {
+    forEachObserver([&](ResourceManagerObserver* o) { o->onWillRemovePool(index); });
+}
+void ResourceManagerObservable::notifyDidRemovePool(size_t index) {
+    forEachObserver([&](ResourceManagerObserver* o) { o->onDidRemovePool(index); });
+}
 
 }  // namespace inviwo
@@ -0,0 +1,203 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/common/coremodulesharedlibrary.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/common/inviwomodulefactoryobject.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/ports/datainport.h>
+#include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/processorfactory.h>
+#include <inviwo/core/processors/processorfactoryobject.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/properties/stringproperty.h>
+#include <inviwo/core/util/consolelogger.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+template <bool ThreadSafe>
+struct LoadProcessor : Processor {
+    static constexpr bool threadSafeConstruction = ThreadSafe;
+
+    LoadProcessor(const std::string& id, const std::string& name)
+        : Processor(id, name)
+        , inport("inport")
+        , outport("outport")
+        , value("value", "Value", 0, 0, 100)
+        , position("position", "Position", vec3(0.0f), vec3(-1.0f), vec3(1.0f))
+        , label("label", "Label", "label") {
+        inport.setOptional(true);
+        addPorts(inport, outport);
+        addProperties(value, position, label);
+    }
+
+    virtual void process() override {}
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    DataInport<int> inport;
+    DataOutport<int> outport;
+    IntProperty value;
+    FloatVec3Property position;
+    StringProperty label;
+};
+
+template <bool ThreadSafe>
+const ProcessorInfo LoadProcessor<ThreadSafe>::processorInfo_{
+    ThreadSafe ? "org.inviwo.ThreadSafeLoadProcessor" : "org.inviwo.LoadProcessor",
+    ThreadSafe ? "Thread Safe Load Processor" : "Load Processor",
+    "Testing",
+    CodeState::Stable,
+    Tags::CPU,
+};
+
+const std::filesystem::path refPath = std::filesystem::temp_directory_path() / "workspaceload.inv";
+
+/*
+ * A synthetic workspace with a chain of processors, each connected and linked to the previous
+ */
+template <bool ThreadSafe>
+std::pmr::string makeWorkspace(InviwoApplication& app, size_t count) {
+    auto* network = app.getProcessorNetwork();
+    auto* manager = app.getWorkspaceManager();
+    manager->clear();
+
+    std::shared_ptr<LoadProcessor<ThreadSafe>> prev;
+    for (size_t i = 0; i < count; ++i) {
+        auto p = std::make_shared<LoadProcessor<ThreadSafe>>(fmt::format("processor{}", i),
+                                                             fmt::format("Processor {}", i));
+        network->addProcessor(p);
+        if (prev) {
+            network->addConnection(&prev->outport, &p->inport);
+            network->addLink(&prev->value, &p->value);
+        }
+        prev = p;
+    }
+
+    std::pmr::string xml;
+    manager->save(xml, refPath);
+    manager->clear();
+    return xml;
+}
+
+}  // namespace
+
+template <bool ThreadSafe>
+void LoadWorkspace(benchmark::State& state) {
+    auto& app = *InviwoApplication::getPtr();
+    auto* manager = app.getWorkspaceManager();
+    const auto xml = makeWorkspace<ThreadSafe>(app, static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        manager->clear();
+        state.ResumeTiming();
+
+        manager->load(xml, refPath);
+    }
+    manager->clear();
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(xml.size()));
+}
+
+template <bool ThreadSafe>
+void ReloadWorkspace(benchmark::State& state) {
+    auto& app = *InviwoApplication::getPtr();
+    auto* manager = app.getWorkspaceManager();
+    const auto xml = makeWorkspace<ThreadSafe>(app, static_cast<size_t>(state.range(0)));
+    manager->load(xml, refPath);
+
+    for (auto _ : state) {
+        manager->load(xml, refPath);
+    }
+    manager->clear();
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(LoadWorkspace, false)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(LoadWorkspace, true)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(ReloadWorkspace, false)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+}  // namespace inviwo
+
+int main(int argc, char** argv) {
+    using namespace inviwo;
+
+    LogCentral::init();
+    auto logger = std::make_shared<ConsoleLogger>();
+    LogCentral::getPtr()->setVerbosity(LogVerbosity::Error);
+    LogCentral::getPtr()->registerLogger(logger);
+
+    InviwoApplication app(argc, argv, "Inviwo-Benchmark-WorkspaceLoad");
+    {
+        std::vector<std::unique_ptr<InviwoModuleFactoryObject>> modules;
+        modules.emplace_back(createInviwoCore());
+        app.registerModules(std::move(modules));
+    }
+    app.processFront();
+
+    ProcessorFactoryObjectTemplate<LoadProcessor<false>> loadProcessor;
+    ProcessorFactoryObjectTemplate<LoadProcessor<true>> threadSafeLoadProcessor;
+    app.getProcessorFactory()->registerObject(&loadProcessor);
+    app.getProcessorFactory()->registerObject(&threadSafeLoadProcessor);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    app.getProcessorFactory()->unRegisterObject(&threadSafeLoadProcessor);
+    app.getProcessorFactory()->unRegisterObject(&loadProcessor);
+    return 0;
+}
@@ -0,0 +1,152 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/io/serialization/binaryxml.h>
+#include <inviwo/core/io/serialization/serialization.h>
+#include <inviwo/core/io/serialization/ticpp.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <ticpp/printer.h>
+
+#include <fmt/format.h>
+
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::pmr::string print(const std::pmr::string& xml) {
+    TiXmlDocument doc;
+    doc.Parse(xml.c_str(), nullptr, {});
+    std::pmr::string out;
+    TiXmlPrinter printer{out, TiXmlStreamPrint::Yes};
+    doc.Accept(&printer);
+    return out;
+}
+
+std::pmr::string roundTrip(const std::pmr::string& xml) {
+    std::pmr::vector<std::byte> data;
+    binaryxml::fromXML(xml, data);
+    EXPECT_TRUE(binaryxml::isBinary(data));
+    std::pmr::string out;
+    binaryxml::toXML(data, out);
+    return out;
+}
+
+}  // namespace
+
+TEST(BinaryXml, Lossless) {
+    const std::pmr::string xml = R"(<?xml version="1.0" ?>
+<!-- comment -->
+<InviwoWorkspace version="3">
+    <Numbers a="1" b="-0" c="0.1" d="1.0" e="nan" f="-inf" g="1e-05" h="01" i="+1"
+             j="123456789012345678901" k="0.30000000000000004" l="" m="text"/>
+    <Text>some text</Text>
+    <CData><![CDATA[a < b]]></CData>
+    <Ints><item content="1"/><item content="2"/><item content="-3"/><item content="4"/></Ints>
+    <Floats><item content="1"/><item content="0.5"/><item content="2"/><item content="3"/></Floats>
+    <Strings><item content="a"/><item content="b"/><item content="c"/><item content="d"/></Strings>
+    <Mixed><item content="1"/><item content="x"/><item content="2"/><item content="3"/></Mixed>
+    <Names><item content="1"/><item content="2"/><other content="3"/><item content="4"/></Names>
+</InviwoWorkspace>)";
+
+    EXPECT_EQ(print(xml), roundTrip(xml));
+}
+
+TEST(BinaryXml, Compact) {
+    std::pmr::string xml = R"(<InviwoWorkspace version="3"><Values>)";
+    for (int i = 0; i < 1000; ++i) {
+        fmt::format_to(std::back_inserter(xml), R"(<item content="{}"/>)", i * 0.001f);
+    }
+    xml += "</Values></InviwoWorkspace>";
+
+    std::pmr::vector<std::byte> data;
+    binaryxml::fromXML(xml, data);
+    EXPECT_LT(data.size() * 4, xml.size());
+
+    std::pmr::string out;
+    binaryxml::toXML(data, out);
+    EXPECT_EQ(print(xml), out);
+}
+
+TEST(BinaryXml, Invalid) {
+    const std::pmr::string xml = R"(<InviwoWorkspace version="3"><a b="1"/></InviwoWorkspace>)";
+    std::pmr::vector<std::byte> data;
+    binaryxml::fromXML(xml, data);
+
+    std::pmr::string out;
+    auto truncated = data;
+    truncated.pop_back();
+    EXPECT_THROW(binaryxml::toXML(truncated, out), Exception);
+
+    auto header = data;
+    header[0] = std::byte{'X'};
+    EXPECT_FALSE(binaryxml::isBinary(header));
+    EXPECT_THROW(binaryxml::toXML(header, out), Exception);
+}
+
+TEST(BinaryXml, Serializer) {
+    const auto refPath = filesystem::findBasePath();
+    const std::vector<float> values{0.0f, 0.25f, std::numeric_limits<float>::max(), -1.5f, 3.0f};
+    const vec3 vector{1.0f, 2.5f, -3.0f};
+    const std::string text = "text";
+
+    std::pmr::vector<std::byte> data;
+    {
+        Serializer serializer(refPath);
+        serializer.serialize("values", values);
+        serializer.serialize("vector", vector);
+        serializer.serialize("text", text);
+        serializer.write(data);
+    }
+
+    Deserializer deserializer(data, refPath);
+    std::vector<float> outValues;
+    vec3 outVector{};
+    std::string outText;
+    deserializer.deserialize("values", outValues);
+    deserializer.deserialize("vector", outVector);
+    deserializer.deserialize("text", outText);
+
+    EXPECT_EQ(values, outValues);
+    EXPECT_EQ(vector, outVector);
+    EXPECT_EQ(text, outText);
+}
+
+}  // namespace inviwo
@@ -144,4 +144,34 @@ TEST(CompositeProperty, ObserveMoveOwned) {
     EXPECT_TRUE(copy.PropertyOwnerObservable::isObservedBy(&obs1));
 }
 
+TEST(CompositeProperty, ModificationCount) {
+    CompositeProperty outer{"outer", "outer"};
+    CompositeProperty inner{"inner", "inner"};
+    FloatProperty f1{"f1", "f1"};
+    FloatProperty f2{"f2", "f2"};
+    outer.addProperty(inner);
+    outer.addProperty(f1);
+    inner.addProperty(f2);
+
+    const auto outerCount = outer.getModificationCount();
+    const auto innerCount = inner.getModificationCount();
+
+    f1.set(0.25f);
+    EXPECT_GT(outer.getModificationCount(), outerCount);
+    EXPECT_EQ(inner.getModificationCount(), innerCount);
+
+    const auto count = outer.getModificationCount();
+    f2.set(0.25f);
+    EXPECT_GT(inner.getModificationCount(), innerCount);
+    EXPECT_GT(outer.getModificationCount(), count);
+
+    // Setting the same value is not a modification
+    const auto unchanged = outer.getModificationCount();
+    f2.set(0.25f);
+    EXPECT_EQ(outer.getModificationCount(), unchanged);
+
+    inner.removeProperty(f2);
+    EXPECT_GT(outer.getModificationCount(), unchanged);
+}
+
 }  // namespace inviwo
@@ -0,0 +1,152 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/deltahistory.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::vector<std::byte> bytes(std::string_view str) {
+    std::vector<std::byte> res;
+    for (auto c : str) res.push_back(static_cast<std::byte>(c));
+    return res;
+}
+
+}  // namespace
+
+TEST(DeltaHistory, PushAndAt) {
+    const std::vector<std::string> states{"hello world", "hello brave world",
+                                          "hello brave new world", "hi world", "", "x"};
+    DeltaHistory history;
+    for (const auto& state : states) {
+        EXPECT_TRUE(history.push(bytes(state)));
+    }
+    ASSERT_EQ(states.size(), history.size());
+
+    for (size_t i = 0; i < states.size(); ++i) {
+        EXPECT_EQ(bytes(states[i]), history.at(i)) << "index " << i;
+    }
+    for (size_t i = states.size(); i-- > 0;) {
+        EXPECT_EQ(bytes(states[i]), history.at(i)) << "index " << i;
+    }
+}
+
+TEST(DeltaHistory, IdenticalPush) {
+    DeltaHistory history;
+    EXPECT_TRUE(history.push(bytes("state")));
+    EXPECT_FALSE(history.push(bytes("state")));
+    EXPECT_EQ(1, history.size());
+}
+
+TEST(DeltaHistory, Truncate) {
+    DeltaHistory history;
+    history.push(bytes("a"));
+    history.push(bytes("ab"));
+    history.push(bytes("abc"));
+    history.push(bytes("abcd"));
+
+    history.truncate(2);
+    ASSERT_EQ(2, history.size());
+    EXPECT_EQ(bytes("ab"), history.at(1));
+
+    EXPECT_TRUE(history.push(bytes("abx")));
+    ASSERT_EQ(3, history.size());
+    EXPECT_EQ(bytes("a"), history.at(0));
+    EXPECT_EQ(bytes("abx"), history.at(2));
+
+    history.truncate(0);
+    EXPECT_TRUE(history.empty());
+    EXPECT_EQ(0, history.memoryUsage());
+}
+
+TEST(DeltaHistory, SmallChangesAreCheap) {
+    std::string state(10000, 'a');
+    DeltaHistory history;
+    history.push(bytes(state));
+    for (size_t i = 0; i < 100; ++i) {
+        state[i * 97] = 'b';
+        history.push(bytes(state));
+    }
+    EXPECT_EQ(101, history.size());
+    EXPECT_LT(history.memoryUsage(), 2 * state.size());
+    EXPECT_EQ(bytes(std::string(10000, 'a')), history.at(0));
+}
+
+TEST(DeltaHistory, ScatteredChangesAreCheap) {
+    // Mimic a binary workspace where an edit also changes a length field at the start
+    std::string state;
+    for (size_t i = 0; i < 2000; ++i) state += "property" + std::to_string(i) + ";";
+    const auto first = bytes(state);
+
+    state[5] = '#';
+    state.insert(state.size() / 3, "a longer value");
+    state.erase(2 * state.size() / 3, 4);
+    state[state.size() - 10] = '#';
+    const auto second = bytes(state);
+
+    DeltaHistory history;
+    history.push(first);
+    history.push(second);
+    EXPECT_LT(history.memoryUsage() - second.size(), 512);
+    EXPECT_EQ(first, history.at(0));
+    EXPECT_EQ(second, history.at(1));
+}
+
+TEST(DeltaHistory, Budget) {
+    const std::string state(1000, 'a');
+    DeltaHistory history{4000};
+    for (size_t i = 0; i < 100; ++i) {
+        history.push(bytes(state + std::string(i + 1, 'b')));
+        EXPECT_LE(history.memoryUsage(), 4000);
+    }
+    ASSERT_GT(history.size(), 1);
+    ASSERT_LT(history.size(), 100);
+
+    // The latest states are kept
+    const auto size = history.size();
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(bytes(state + std::string(100 - size + i + 1, 'b')), history.at(i));
+    }
+
+    history.setBudget(0);
+    EXPECT_EQ(1, history.size());
+    EXPECT_EQ(bytes(state + std::string(100, 'b')), history.at(0));
+}
+
+}  // namespace inviwo
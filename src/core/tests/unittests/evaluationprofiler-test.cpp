@@ -0,0 +1,153 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/evaluationprofiler.h>
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+using Category = EvaluationProfiler::Category;
+using namespace std::chrono_literals;
+
+void record(EvaluationProfiler& profiler, std::string_view name, std::chrono::milliseconds duration,
+            Category category = Category::Process) {
+    const auto start = EvaluationProfiler::clock::now();
+    profiler.record(category, name, start, start + duration);
+}
+
+}  // namespace
+
+TEST(EvaluationProfiler, RingBuffer) {
+    EvaluationProfiler profiler{4};
+    for (int i = 1; i <= 6; ++i) {
+        record(profiler, "p", std::chrono::milliseconds{i});
+    }
+    const auto events = profiler.getEvents();
+    ASSERT_EQ(events.size(), size_t{4});
+    EXPECT_EQ(events.front().duration, 3ms);
+    EXPECT_EQ(events.back().duration, 6ms);
+
+    profiler.clear();
+    EXPECT_TRUE(profiler.getEvents().empty());
+}
+
+TEST(EvaluationProfiler, Stats) {
+    EvaluationProfiler profiler{256};
+    for (int i = 1; i <= 100; ++i) {
+        record(profiler, "slow", std::chrono::milliseconds{i});
+    }
+    record(profiler, "fast", 1ms);
+    record(profiler, "slow", 500ms, Category::InitializeResources);
+
+    const auto stats = profiler.getStats("slow");
+    EXPECT_EQ(stats.count, size_t{100});
+    EXPECT_EQ(stats.max, 100ms);
+    EXPECT_EQ(stats.p95, 96ms);
+    EXPECT_EQ(stats.total, 5050ms);
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::microseconds>(stats.mean), 50500us);
+
+    const auto all = profiler.getStats(Category::Process);
+    ASSERT_EQ(all.size(), size_t{2});
+    EXPECT_EQ(all.front().first, "slow");
+    EXPECT_EQ(all.back().first, "fast");
+
+    EXPECT_EQ(profiler.getStats("missing").count, size_t{0});
+}
+
+TEST(EvaluationProfiler, ChromeTrace) {
+    EvaluationProfiler profiler{16};
+    record(profiler, "Volume \"Source\"", 2ms);
+
+    std::stringstream ss;
+    profiler.exportChromeTrace(ss);
+    const auto trace = ss.str();
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"Volume \"Source\"")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("cat":"Process")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("dur":2000.000)"), std::string::npos);
+}
+
+TEST(EvaluationProfiler, ChromeTraceControlCharacters) {
+    EvaluationProfiler profiler{16};
+    record(profiler, "Line\nBreak\x01", 1ms);
+
+    std::stringstream ss;
+    profiler.exportChromeTrace(ss);
+    EXPECT_NE(ss.str().find(R"("name":"Line\nBreak\u0001")"), std::string::npos);
+}
+
+TEST(EvaluationProfiler, Threads) {
+    EvaluationProfiler profiler{8};
+    std::vector<std::jthread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&profiler]() {
+            for (int j = 0; j < 10; ++j) record(profiler, "job", 1ms);
+        });
+    }
+    threads.clear();
+
+    // Each thread keeps its own ring buffer
+    const auto events = profiler.getEvents();
+    EXPECT_EQ(events.size(), size_t{32});
+    EXPECT_EQ(profiler.getStats("job").count, size_t{32});
+    EXPECT_TRUE(std::ranges::is_sorted(events, std::less<>{}, &EvaluationProfiler::Event::start));
+    EXPECT_TRUE(std::ranges::all_of(events, [](const auto& e) { return e.thread < 4; }));
+}
+
+TEST(EvaluationProfiler, Scope) {
+    ASSERT_TRUE(EvaluationProfiler::isInitialized());
+    auto* profiler = EvaluationProfiler::getPtr();
+    const auto wasEnabled = profiler->isEnabled();
+    profiler->clear();
+
+    profiler->setEnabled(false);
+    { const EvaluationProfiler::Scope scope{Category::Process, "disabled"}; }
+    EXPECT_EQ(profiler->getStats("disabled").count, size_t{0});
+
+    profiler->setEnabled(true);
+    { const EvaluationProfiler::Scope scope{Category::Process, "enabled"}; }
+    EXPECT_EQ(profiler->getStats("enabled").count, size_t{1});
+
+    profiler->setEnabled(wasEnabled);
+    profiler->clear();
+}
+
+}  // namespace inviwo
@@ -0,0 +1,109 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+class PoolSize {
+public:
+    explicit PoolSize(size_t size) : app_{InviwoApplication::getPtr()}, old_{app_->getPoolSize()} {
+        app_->resizePool(size);
+    }
+    PoolSize(const PoolSize&) = delete;
+    PoolSize& operator=(const PoolSize&) = delete;
+    ~PoolSize() { app_->resizePool(old_); }
+
+private:
+    InviwoApplication* app_;
+    size_t old_;
+};
+
+}  // namespace
+
+TEST(ForEachChunkParallel, coversRange) {
+    const PoolSize poolSize{4};
+    std::vector<int> visited(10007, 0);
+    util::forEachChunkParallel(visited.size(), [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) ++visited[i];
+    });
+    EXPECT_EQ(visited.size(), std::accumulate(visited.begin(), visited.end(), size_t{0}));
+}
+
+TEST(ForEachChunkParallel, nestedInPoolJobs) {
+    for (size_t size : {1, 2, 4}) {
+        const PoolSize poolSize{size};
+
+        // Occupy every pool thread with a job that itself uses forEachChunkParallel
+        std::vector<std::future<size_t>> futures;
+        for (size_t job = 0; job < 2 * size; ++job) {
+            futures.push_back(util::dispatchPool([]() {
+                std::atomic<size_t> sum{0};
+                util::forEachChunkParallel(100000, [&](size_t begin, size_t end) {
+                    util::forEachChunkParallel(
+                        end - begin, [&](size_t b, size_t e) { sum += e - b; });
+                });
+                return sum.load();
+            }));
+        }
+        for (auto& future : futures) {
+            EXPECT_EQ(100000, future.get()) << "pool size " << size;
+        }
+    }
+}
+
+TEST(ForEachChunkParallel, rethrows) {
+    const PoolSize poolSize{4};
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_THROW(util::forEachChunkParallel(1000,
+                                                [](size_t begin, size_t) {
+                                                    if (begin > 500) {
+                                                        throw std::runtime_error("chunk failed");
+                                                    }
+                                                }),
+                     std::runtime_error);
+    }
+}
+
+}  // namespace inviwo
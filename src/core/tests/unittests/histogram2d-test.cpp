@@ -0,0 +1,249 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/algorithm/histogram2d.h>
+#include <inviwo/core/datastructures/datamapper.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::pair<std::vector<double>, std::vector<double>> correlatedData(size_t size) {
+    std::mt19937 rand{0};
+    std::normal_distribution<double> dis{0.5, 0.2};
+    std::vector<double> data1(size);
+    std::vector<double> data2(size);
+    for (size_t i = 0; i < size; ++i) {
+        data1[i] = dis(rand);
+        data2[i] = 0.5 * data1[i] + 0.5 * dis(rand);
+    }
+    return {data1, data2};
+}
+
+}  // namespace
+
+TEST(Histogram2DTest, binning) {
+    const std::vector<double> data1{0.0, 0.25, 0.5, 1.0, 1.5, -0.5};
+    const std::vector<double> data2{0.0, 0.75, 0.5, 1.0, 0.0, 0.0};
+    const DataMapper dataMap{dvec2{0.0, 1.0}};
+
+    const auto hist = util::calculateHistogram2D<double, double>(data1, 0, dataMap, data2, 0,
+                                                                 dataMap, size2_t{5, 5});
+
+    ASSERT_EQ(size2_t(5, 5), hist.dimensions);
+    EXPECT_EQ(6, hist.totalCounts);
+    EXPECT_EQ(1, hist.underflow);
+    EXPECT_EQ(1, hist.overflow);
+    EXPECT_EQ(1, hist.counts[0]);
+    EXPECT_EQ(1, hist.counts[1 + 3 * 5]);
+    EXPECT_EQ(1, hist.counts[2 + 2 * 5]);
+    EXPECT_EQ(1, hist.counts[4 + 4 * 5]);
+    EXPECT_EQ(4, std::accumulate(hist.counts.begin(), hist.counts.end(), size_t{0}));
+}
+
+TEST(Histogram2DTest, logBinning) {
+    const std::vector<double> data1{0.0, 0.5, 1.0};
+    const std::vector<double> data2{0.0, 0.5, 1.0};
+    const DataMapper dataMap{dvec2{0.0, 1.0}};
+
+    const auto hist = util::calculateHistogram2D<double, double>(
+        data1, 0, dataMap, data2, 0, dataMap, size2_t{4, 4},
+        {HistogramBinning::Log, HistogramBinning::Linear});
+
+    EXPECT_EQ(HistogramBinning::Log, hist.binning[0]);
+    EXPECT_EQ(HistogramBinning::Linear, hist.binning[1]);
+    // log(1 + 500) / log(1 + 1000) * 3 = 2.70 for the first and 0.5 * 3 = 1.5 for the second
+    // dimension
+    EXPECT_EQ(1, hist.counts[0]);
+    EXPECT_EQ(1, hist.counts[2 + 1 * 4]);
+    EXPECT_EQ(1, hist.counts[3 + 3 * 4]);
+}
+
+TEST(Histogram2DTest, logBinningScaleIndependent) {
+    const std::vector<double> data{0.0, 0.001, 0.01, 0.1, 0.3, 0.5, 1.0};
+    std::vector<double> scaled(data.size());
+    std::ranges::transform(data, scaled.begin(), [](double v) { return 1000.0 * v + 5.0; });
+    const DataMapper dataMap{dvec2{0.0, 1.0}};
+    const DataMapper scaledDataMap{dvec2{5.0, 1005.0}};
+
+    const std::array binning{HistogramBinning::Log, HistogramBinning::Log};
+    const auto hist = util::calculateHistogram2D<double, double>(
+        data, 0, dataMap, data, 0, dataMap, size2_t{16, 16}, binning);
+    const auto scaledHist = util::calculateHistogram2D<double, double>(
+        scaled, 0, scaledDataMap, scaled, 0, scaledDataMap, size2_t{16, 16}, binning);
+
+    EXPECT_EQ(hist.counts, scaledHist.counts);
+}
+
+TEST(Histogram2DTest, binEdges) {
+    const std::vector<double> data{0.0, 1.0};
+    const DataMapper dataMap{dvec2{0.0, 1.0}};
+
+    const auto hist = util::calculateHistogram2D<double, double>(
+        data, 0, dataMap, data, 0, dataMap, size2_t{5, 5},
+        {HistogramBinning::Linear, HistogramBinning::Log});
+
+    const auto linear = hist.binEdges(0);
+    ASSERT_EQ(6, linear.size());
+    for (size_t i = 0; i < linear.size(); ++i) {
+        EXPECT_DOUBLE_EQ(static_cast<double>(i) * 0.25, linear[i]);
+    }
+
+    const auto log = hist.binEdges(1);
+    ASSERT_EQ(6, log.size());
+    EXPECT_DOUBLE_EQ(0.0, log[0]);
+    EXPECT_NEAR(1.0, log[4], 1e-12);
+    for (size_t i = 1; i < log.size(); ++i) {
+        EXPECT_LT(log[i - 1], log[i]);
+        EXPECT_NEAR(static_cast<double>(i) / 4.0,
+                    histogramBinPosition(HistogramBinning::Log, log[i]), 1e-12);
+    }
+}
+
+TEST(Histogram2DTest, statistics) {
+    const auto [data1, data2] = correlatedData(100000);
+    const DataMapper dataMap{dvec2{0.0, 1.0}};
+
+    const auto hist = util::calculateHistogram2D<double, double>(data1, 0, dataMap, data2, 0,
+                                                                 dataMap, size2_t{64, 64});
+
+    const auto n = static_cast<double>(data1.size());
+    const dvec2 mean{std::accumulate(data1.begin(), data1.end(), 0.0) / n,
+                     std::accumulate(data2.begin(), data2.end(), 0.0) / n};
+    dvec2 m2{0.0};
+    double cxy = 0.0;
+    for (size_t i = 0; i < data1.size(); ++i) {
+        m2 += dvec2{data1[i] - mean.x, data2[i] - mean.y} *
+              dvec2{data1[i] - mean.x, data2[i] - mean.y};
+        cxy += (data1[i] - mean.x) * (data2[i] - mean.y);
+    }
+
+    const auto& stats = hist.statistics;
+    EXPECT_EQ(data1.size(), stats.count);
+    EXPECT_NEAR(mean.x, stats.mean.x, 1e-12);
+    EXPECT_NEAR(mean.y, stats.mean.y, 1e-12);
+    EXPECT_NEAR(std::sqrt(m2.x / (n - 1.0)), stats.standardDeviation.x, 1e-12);
+    EXPECT_NEAR(std::sqrt(m2.y / (n - 1.0)), stats.standardDeviation.y, 1e-12);
+    EXPECT_NEAR(cxy / (n - 1.0), stats.covariance, 1e-12);
+    EXPECT_NEAR(cxy / std::sqrt(m2.x * m2.y), stats.correlation, 1e-12);
+    EXPECT_DOUBLE_EQ(*std::ranges::min_element(data1), stats.min.x);
+    EXPECT_DOUBLE_EQ(*std::ranges::max_element(data2), stats.max.y);
+}
+
+TEST(Histogram2DTest, nonFiniteValues) {
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> data1{nan, 0.25, 0.5, 0.75};
+    const std::vector<double> data2{0.0, 0.25, 0.5, 0.75};
+    const DataMapper dataMap{dvec2{0.0, 1.0}};
+
+    const auto hist = util::calculateHistogram2D<double, double>(data1, 0, dataMap, data2, 0,
+                                                                 dataMap, size2_t{4, 4});
+    EXPECT_EQ(1, hist.underflow);
+    EXPECT_EQ(3, hist.statistics.count);
+    EXPECT_DOUBLE_EQ(0.5, hist.statistics.mean.x);
+    EXPECT_DOUBLE_EQ(1.0, hist.statistics.correlation);
+}
+
+TEST(Histogram2DTest, mask) {
+    const auto [data1, data2] = correlatedData(10000);
+    const DataMapper dataMap{dvec2{0.0, 1.0}};
+
+    std::vector<unsigned char> mask(data1.size());
+    std::vector<double> masked1;
+    std::vector<double> masked2;
+    for (size_t i = 0; i < data1.size(); ++i) {
+        mask[i] = i % 3 == 0 ? 0 : 1;
+        if (mask[i]) {
+            masked1.push_back(data1[i]);
+            masked2.push_back(data2[i]);
+        }
+    }
+
+    const std::array<HistogramBinning, 2> binning{HistogramBinning::Linear,
+                                                  HistogramBinning::Linear};
+    const auto hist =
+        util::calculateHistogram2D<double, double>(data1, 0, dataMap, data2, 0, dataMap,
+                                                   size2_t{32, 32}, binning,
+                                                   std::span<const unsigned char>{mask});
+    const auto expected = util::calculateHistogram2D<double, double>(
+        masked1, 0, dataMap, masked2, 0, dataMap, size2_t{32, 32});
+
+    EXPECT_EQ(expected.counts, hist.counts);
+    EXPECT_EQ(masked1.size(), hist.totalCounts);
+    EXPECT_EQ(expected.underflow, hist.underflow);
+    EXPECT_EQ(expected.overflow, hist.overflow);
+    EXPECT_NEAR(expected.statistics.correlation, hist.statistics.correlation, 1e-12);
+
+    const auto partialMask = std::span<const unsigned char>{mask}.first(10);
+    EXPECT_THROW((util::calculateHistogram2D<double, double>(data1, 0, dataMap, data2, 0, dataMap,
+                                                             size2_t{32, 32}, binning,
+                                                             partialMask)),
+                 Exception);
+}
+
+TEST(Histogram2DTest, streaming) {
+    const auto [data1, data2] = correlatedData(10000);
+    const DataMapper dataMap{dvec2{0.0, 1.0}};
+
+    const auto expected = util::calculateHistogram2D<double, double>(data1, 0, dataMap, data2, 0,
+                                                                     dataMap, size2_t{32, 32});
+
+    auto accumulator =
+        util::makeHistogram2DAccumulator<double, double>(dataMap, dataMap, size2_t{32, 32});
+    for (size_t offset = 0; offset < data1.size(); offset += 3000) {
+        const auto count = std::min<size_t>(3000, data1.size() - offset);
+        accumulator.add(std::span<const double>{data1}.subspan(offset, count), 0,
+                        std::span<const double>{data2}.subspan(offset, count), 0);
+    }
+    const auto hist = accumulator.histogram();
+
+    EXPECT_EQ(expected.counts, hist.counts);
+    EXPECT_EQ(expected.totalCounts, hist.totalCounts);
+    EXPECT_EQ(expected.maxCount, hist.maxCount);
+    EXPECT_EQ(expected.statistics.count, hist.statistics.count);
+    EXPECT_NEAR(expected.statistics.mean.x, hist.statistics.mean.x, 1e-12);
+    EXPECT_NEAR(expected.statistics.covariance, hist.statistics.covariance, 1e-12);
+    EXPECT_NEAR(expected.statistics.correlation, hist.statistics.correlation, 1e-12);
+}
+
+}  // namespace inviwo
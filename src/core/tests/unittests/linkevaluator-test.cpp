@@ -0,0 +1,191 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwoapplication.h>
+
+#include <inviwo/core/links/linkevaluator.h>
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkobserver.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+
+#include <memory>
+#include <string>
+
+namespace inviwo {
+
+namespace {
+
+struct LinkProcessor : Processor {
+    LinkProcessor(const std::string& id) : Processor(id, id), value("value", "Value", 0, 0, 100) {
+        addProperty(value);
+        value.onChange([this]() { ++changes; });
+    }
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    IntProperty value;
+    int changes = 0;
+};
+
+const ProcessorInfo LinkProcessor::processorInfo_{
+    "org.inviwo.LinkProcessor",  // Class identifier
+    "LinkProcessor",             // Display name
+    "Testing",                   // Category
+    CodeState::Stable,           // Code state
+    Tags::CPU,                   // Tags
+};
+
+struct LinkNetwork {
+    LinkNetwork() : network{InviwoApplication::getPtr()} {
+        a = network.addProcessor(std::make_shared<LinkProcessor>("a"));
+        b = network.addProcessor(std::make_shared<LinkProcessor>("b"));
+        c = network.addProcessor(std::make_shared<LinkProcessor>("c"));
+        network.addLink(&a->value, &b->value);
+        network.addLink(&b->value, &c->value);
+        network.getLinkEvaluator().resetStats();
+    }
+
+    ProcessorNetwork network;
+    LinkProcessor* a;
+    LinkProcessor* b;
+    LinkProcessor* c;
+};
+
+struct UnlockCounter : ProcessorNetworkObserver {
+    virtual void onProcessorNetworkUnlocked() override { ++unlocks; }
+    int unlocks = 0;
+};
+
+}  // namespace
+
+TEST(LinkEvaluator, Immediate) {
+    LinkNetwork net;
+    auto& evaluator = net.network.getLinkEvaluator();
+
+    {
+        const NetworkLock lock(&net.network);
+        for (int i = 1; i <= 5; ++i) {
+            net.a->value.set(i);
+            EXPECT_EQ(net.c->value.get(), i);
+        }
+    }
+    EXPECT_EQ(net.b->changes, 5);
+    EXPECT_EQ(net.c->changes, 5);
+    EXPECT_EQ(evaluator.getStats().evaluations, size_t{5});
+    EXPECT_EQ(evaluator.getStats().conversions, size_t{10});
+}
+
+TEST(LinkEvaluator, Batched) {
+    LinkNetwork net;
+    auto& evaluator = net.network.getLinkEvaluator();
+    evaluator.setBatched(true);
+
+    {
+        const NetworkLock lock(&net.network);
+        for (int i = 1; i <= 5; ++i) {
+            net.a->value.set(i);
+        }
+        EXPECT_TRUE(evaluator.hasPendingChanges());
+        EXPECT_EQ(net.b->value.get(), 0);
+        EXPECT_EQ(net.c->value.get(), 0);
+    }
+    EXPECT_FALSE(evaluator.hasPendingChanges());
+    EXPECT_EQ(net.b->value.get(), 5);
+    EXPECT_EQ(net.c->value.get(), 5);
+    EXPECT_EQ(net.b->changes, 1);
+    EXPECT_EQ(net.c->changes, 1);
+    EXPECT_EQ(evaluator.getStats().evaluations, size_t{1});
+    EXPECT_EQ(evaluator.getStats().conversions, size_t{2});
+
+    // Without a lock changes are propagated immediately
+    net.a->value.set(7);
+    EXPECT_EQ(net.c->value.get(), 7);
+}
+
+TEST(LinkEvaluator, BatchedLatestChangeWins) {
+    LinkNetwork net;
+    net.network.addLink(&net.c->value, &net.a->value);
+    auto& evaluator = net.network.getLinkEvaluator();
+    evaluator.setBatched(true);
+
+    {
+        const NetworkLock lock(&net.network);
+        net.a->value.set(3);
+        net.c->value.set(9);
+        net.b->value.set(4);
+    }
+    EXPECT_EQ(net.a->value.get(), 4);
+    EXPECT_EQ(net.b->value.get(), 4);
+    EXPECT_EQ(net.c->value.get(), 4);
+    EXPECT_GT(evaluator.getStats().coalesced, size_t{0});
+
+    {
+        const NetworkLock lock(&net.network);
+        net.b->value.set(1);
+        net.a->value.set(2);
+    }
+    EXPECT_EQ(net.a->value.get(), 2);
+    EXPECT_EQ(net.b->value.get(), 2);
+    EXPECT_EQ(net.c->value.get(), 2);
+}
+
+TEST(LinkEvaluator, BatchedNested) {
+    LinkNetwork net;
+    auto* d = net.network.addProcessor(std::make_shared<LinkProcessor>("d"));
+    auto* e = net.network.addProcessor(std::make_shared<LinkProcessor>("e"));
+    net.network.addLink(&d->value, &e->value);
+    // A change made by the propagation is flushed in a second batch
+    net.c->value.onChange([&]() { d->value.set(net.c->value.get() * 2); });
+
+    auto& evaluator = net.network.getLinkEvaluator();
+    evaluator.setBatched(true);
+    UnlockCounter counter;
+    net.network.addObserver(&counter);
+
+    {
+        const NetworkLock lock(&net.network);
+        net.a->value.set(5);
+    }
+    EXPECT_EQ(net.c->value.get(), 5);
+    EXPECT_EQ(e->value.get(), 10);
+    EXPECT_EQ(evaluator.getStats().evaluations, size_t{2});
+    EXPECT_EQ(counter.unlocks, 1);
+
+    net.network.removeObserver(&counter);
+}
+
+}  // namespace inviwo
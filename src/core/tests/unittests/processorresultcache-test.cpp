@@ -0,0 +1,197 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwoapplication.h>
+
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/processorresultcache.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+
+#include <inviwo/core/ports/datainport.h>
+#include <inviwo/core/ports/dataoutport.h>
+
+namespace inviwo {
+
+namespace {
+
+struct CachedProcessor : Processor {
+    CachedProcessor(std::string_view id)
+        : Processor(id, id)
+        , outport_{"outport"}
+        , value_{"value", "Value", 0, 0, 100}
+        , cache_{this, 2 * sizeof(int)} {
+        addPort(outport_);
+        addProperty(value_);
+        cache_.addPorts(outport_);
+    }
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override {
+        ++processed;
+        outport_.setData(std::make_shared<int>(value_.get()));
+    }
+
+    DataOutport<int> outport_;
+    IntProperty value_;
+    ProcessorResultCache cache_;
+    int processed = 0;
+};
+
+const ProcessorInfo CachedProcessor::processorInfo_{
+    "org.inviwo.CachedTestProcessor",  // Class identifier
+    "CachedTestProcessor",             // Display name
+    "Testing",                         // Category
+    CodeState::Stable,                 // Code state
+    Tags::CPU,                         // Tags
+};
+
+struct ReusingProcessor : Processor {
+    ReusingProcessor(std::string_view id)
+        : Processor(id, id)
+        , outport_{"outport"}
+        , value_{"value", "Value", 0, 0, 100}
+        , data_{std::make_shared<int>(0)}
+        , cache_{this} {
+        addPort(outport_);
+        addProperty(value_);
+        cache_.addPorts(outport_);
+    }
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override {
+        ++processed;
+        *data_ = value_.get();
+        outport_.setData(data_);
+    }
+
+    DataOutport<int> outport_;
+    IntProperty value_;
+    std::shared_ptr<int> data_;
+    ProcessorResultCache cache_;
+    int processed = 0;
+};
+
+const ProcessorInfo ReusingProcessor::processorInfo_{
+    "org.inviwo.ReusingTestProcessor",  // Class identifier
+    "ReusingTestProcessor",             // Display name
+    "Testing",                          // Category
+    CodeState::Stable,                  // Code state
+    Tags::CPU,                          // Tags
+};
+
+struct SinkProcessor : Processor {
+    SinkProcessor(std::string_view id) : Processor(id, id), inport_{"inport"} {
+        addPort(inport_);
+    }
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override { value = *inport_.getData(); }
+
+    DataInport<int> inport_;
+    int value = -1;
+};
+
+const ProcessorInfo SinkProcessor::processorInfo_{
+    "org.inviwo.SinkTestProcessor",  // Class identifier
+    "SinkTestProcessor",             // Display name
+    "Testing",                       // Category
+    CodeState::Stable,               // Code state
+    Tags::CPU,                       // Tags
+};
+
+}  // namespace
+
+TEST(ProcessorResultCache, HitAndMiss) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    auto* a = network.addProcessor(std::make_shared<CachedProcessor>("a"));
+    auto* b = network.addProcessor(std::make_shared<SinkProcessor>("b"));
+    network.addConnection(&a->outport_, &b->inport_);
+
+    EXPECT_EQ(1, a->processed);
+    EXPECT_EQ(0, b->value);
+
+    a->value_.set(1);
+    EXPECT_EQ(2, a->processed);
+    EXPECT_EQ(1, b->value);
+
+    // Scrubbing back should restore the first result without processing
+    a->value_.set(0);
+    EXPECT_EQ(2, a->processed);
+    EXPECT_EQ(0, b->value);
+    EXPECT_EQ(size_t{1}, a->cache_.getStats().hits);
+    EXPECT_EQ(size_t{2}, a->cache_.getStats().misses);
+
+    // The capacity only fits two results, the least recently used one (1) is evicted
+    a->value_.set(2);
+    EXPECT_EQ(3, a->processed);
+    EXPECT_EQ(size_t{1}, a->cache_.getStats().evictions);
+
+    a->value_.set(1);
+    EXPECT_EQ(4, a->processed);
+    EXPECT_EQ(1, b->value);
+
+    a->cache_.clear();
+    a->value_.set(2);
+    EXPECT_EQ(5, a->processed);
+    EXPECT_EQ(2, b->value);
+}
+
+TEST(ProcessorResultCache, ReusedDataIsNotCached) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    auto* a = network.addProcessor(std::make_shared<ReusingProcessor>("a"));
+    auto* b = network.addProcessor(std::make_shared<SinkProcessor>("b"));
+    network.addConnection(&a->outport_, &b->inport_);
+
+    a->value_.set(1);
+    a->value_.set(0);
+    EXPECT_EQ(3, a->processed);
+    EXPECT_EQ(0, b->value);
+    EXPECT_EQ(size_t{0}, a->cache_.getStats().hits);
+    EXPECT_EQ(size_t{0}, a->cache_.getStats().entries);
+    EXPECT_EQ(size_t{3}, a->cache_.getStats().skipped);
+}
+
+}  // namespace inviwo
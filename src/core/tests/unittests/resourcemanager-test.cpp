@@ -0,0 +1,132 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/resourcemanager/resourcemanager.h>
+
+#include <chrono>
+#include <optional>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t ramGroup = util::index_of<resource::RAM, ResourceManager::Keys>();
+
+Resource makeResource(size_t bytes) {
+    return Resource{.dims = glm::size4_t{bytes, 0, 0, 0}, .format = DataFormatId::UInt8};
+}
+
+resource::Evictable makeEvictable(ResourceManager& rm, resource::RAM key,
+                                  std::chrono::steady_clock::time_point time) {
+    return resource::Evictable{
+        .lastAccess = [time]() -> std::optional<std::chrono::steady_clock::time_point> {
+            return time;
+        },
+        .evict =
+            [&rm, key]() {
+                rm.remove(key);
+                return true;
+            }};
+}
+
+}  // namespace
+
+TEST(ResourceManager, Usage) {
+    ResourceManager rm;
+    rm.add(resource::RAM{1}, makeResource(100));
+    rm.add(resource::RAM{2}, makeResource(50));
+    EXPECT_EQ(size_t{150}, rm.totalByteSize(ramGroup));
+
+    rm.add(resource::RAM{2}, makeResource(20));
+    EXPECT_EQ(size_t{120}, rm.totalByteSize(ramGroup));
+    EXPECT_EQ(size_t{150}, rm.getStats(ramGroup).peakUsage);
+
+    rm.move(resource::RAM{1}, resource::RAM{3}, makeResource(10));
+    EXPECT_EQ(size_t{30}, rm.totalByteSize(ramGroup));
+
+    rm.remove(resource::RAM{2});
+    rm.remove(resource::RAM{3});
+    EXPECT_EQ(size_t{0}, rm.totalByteSize(ramGroup));
+}
+
+TEST(ResourceManager, EvictLeastRecentlyUsed) {
+    ResourceManager rm;
+    const auto now = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < 4; ++i) {
+        const resource::RAM key{i};
+        rm.add(key, makeResource(100));
+        rm.evictable(key, makeEvictable(rm, key, now + std::chrono::seconds(i)));
+    }
+    // Not evictable
+    rm.add(resource::RAM{10}, makeResource(100));
+
+    rm.setBudget(ramGroup, 250);
+    EXPECT_EQ(size_t{300}, rm.enforceBudget(ramGroup));
+    EXPECT_EQ(size_t{200}, rm.totalByteSize(ramGroup));
+    EXPECT_EQ(size_t{3}, rm.getStats(ramGroup).evictions);
+    EXPECT_EQ(size_t{300}, rm.getStats(ramGroup).evictedBytes);
+
+    // The most recently used and the non evictable resource remains
+    EXPECT_EQ(size_t{2}, rm.size(ramGroup));
+    EXPECT_EQ(size_t{0}, rm.enforceBudget(ramGroup));
+}
+
+TEST(ResourceManager, EvictFailure) {
+    ResourceManager rm;
+    const auto now = std::chrono::steady_clock::now();
+
+    rm.add(resource::RAM{1}, makeResource(100));
+    rm.evictable(resource::RAM{1},
+                 resource::Evictable{
+                     .lastAccess = [now]() -> std::optional<std::chrono::steady_clock::time_point> {
+                         return now;
+                     },
+                     .evict = []() { return false; }});
+
+    rm.add(resource::RAM{2}, makeResource(100));
+    rm.evictable(resource::RAM{2},
+                 resource::Evictable{
+                     .lastAccess = []() -> std::optional<std::chrono::steady_clock::time_point> {
+                         return std::nullopt;
+                     },
+                     .evict = []() { return true; }});
+
+    rm.setBudget(ramGroup, 50);
+    EXPECT_EQ(size_t{0}, rm.enforceBudget(ramGroup));
+    EXPECT_EQ(size_t{0}, rm.getStats(ramGroup).evictions);
+    EXPECT_EQ(size_t{2}, rm.size(ramGroup));
+}
+
+}  // namespace inviwo
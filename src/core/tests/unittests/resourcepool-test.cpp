@@ -0,0 +1,181 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/resourcemanager/resourcepool.h>
+
+#include <memory>
+
+namespace inviwo {
+
+namespace {
+
+ResourcePool<size_t> makePool(size_t budget = ResourcePool<size_t>::unlimited) {
+    return ResourcePool<size_t>{"Test", [](const size_t& bytes) { return bytes; }, budget};
+}
+
+}  // namespace
+
+TEST(ResourcePool, AcquireUnused) {
+    auto pool = makePool();
+    EXPECT_EQ(pool.acquire(), nullptr);
+    EXPECT_EQ(pool.getStats().misses, size_t{1});
+
+    auto item = std::make_shared<size_t>(10);
+    const auto* ptr = item.get();
+    pool.add(item);
+    EXPECT_EQ(pool.size(), size_t{1});
+    EXPECT_EQ(pool.sizeInBytes(), size_t{10});
+
+    // In use by us, should not be handed out
+    EXPECT_EQ(pool.acquire(), nullptr);
+    EXPECT_EQ(pool.getStats().misses, size_t{2});
+
+    item.reset();
+    auto reused = pool.acquire([](const size_t& bytes) { return bytes == 10; });
+    EXPECT_EQ(reused.get(), ptr);
+    EXPECT_EQ(pool.getStats().hits, size_t{1});
+    EXPECT_EQ(pool.size(), size_t{1});
+
+    // Adding an item again should not duplicate it
+    pool.add(reused);
+    EXPECT_EQ(pool.size(), size_t{1});
+}
+
+TEST(ResourcePool, AcquireMatching) {
+    auto pool = makePool();
+    pool.add(std::make_shared<size_t>(10));
+    pool.add(std::make_shared<size_t>(20));
+
+    EXPECT_EQ(pool.acquire([](const size_t& bytes) { return bytes == 30; }), nullptr);
+    auto item = pool.acquire([](const size_t& bytes) { return bytes == 10; });
+    ASSERT_NE(item, nullptr);
+    EXPECT_EQ(*item, size_t{10});
+}
+
+TEST(ResourcePool, AcquireFallback) {
+    auto pool = makePool();
+    pool.add(std::make_shared<size_t>(10));
+    pool.add(std::make_shared<size_t>(20));
+
+    // The first predicate takes precedence over recency
+    auto item = pool.acquire([](const size_t& bytes) { return bytes == 10; },
+                             [](const size_t&) { return true; });
+    ASSERT_NE(item, nullptr);
+    EXPECT_EQ(*item, size_t{10});
+
+    auto fallback = pool.acquire([](const size_t& bytes) { return bytes == 30; },
+                                 [](const size_t& bytes) { return bytes == 20; });
+    ASSERT_NE(fallback, nullptr);
+    EXPECT_EQ(*fallback, size_t{20});
+
+    EXPECT_EQ(pool.acquire([](const size_t& bytes) { return bytes == 30; },
+                           [](const size_t& bytes) { return bytes == 40; }),
+              nullptr);
+    EXPECT_EQ(pool.getStats().hits, size_t{2});
+    EXPECT_EQ(pool.getStats().misses, size_t{1});
+}
+
+TEST(ResourcePool, ResizedItem) {
+    auto pool = makePool(25);
+    auto item = std::make_shared<size_t>(10);
+    pool.add(item);
+    pool.add(std::make_shared<size_t>(10));
+    EXPECT_EQ(pool.sizeInBytes(), size_t{20});
+
+    // The size is updated when the item is added again
+    *item = 20;
+    pool.add(item);
+    EXPECT_EQ(pool.sizeInBytes(), size_t{20});
+    EXPECT_EQ(pool.getStats().bytes, size_t{20});
+    EXPECT_EQ(pool.size(), size_t{1});
+    EXPECT_EQ(pool.getStats().evictions, size_t{1});
+}
+
+TEST(ResourcePool, EvictLeastRecentlyUsed) {
+    auto pool = makePool(25);
+    auto first = std::make_shared<size_t>(10);
+    auto second = std::make_shared<size_t>(10);
+    const auto* firstPtr = first.get();
+    pool.add(first);
+    pool.add(second);
+    first.reset();
+    second.reset();
+
+    // Touch the first item to make the second one the least recently used
+    EXPECT_EQ(pool.acquire([firstPtr](const size_t& item) { return &item == firstPtr; }).get(),
+              firstPtr);
+
+    pool.add(std::make_shared<size_t>(10));
+    EXPECT_EQ(pool.size(), size_t{2});
+    EXPECT_EQ(pool.sizeInBytes(), size_t{20});
+    EXPECT_EQ(pool.getStats().evictions, size_t{1});
+    EXPECT_EQ(pool.getStats().bytes, size_t{20});
+
+    auto remaining = pool.acquire([firstPtr](const size_t& item) { return &item == firstPtr; });
+    EXPECT_EQ(remaining.get(), firstPtr);
+}
+
+TEST(ResourcePool, KeepItemsInUse) {
+    auto pool = makePool(15);
+    auto first = std::make_shared<size_t>(10);
+    auto second = std::make_shared<size_t>(10);
+    pool.add(first);
+    pool.add(second);
+
+    // Both items are in use, nothing can be evicted
+    EXPECT_EQ(pool.size(), size_t{2});
+    EXPECT_EQ(pool.getStats().evictions, size_t{0});
+
+    first.reset();
+    EXPECT_EQ(pool.trim(), size_t{1});
+    EXPECT_EQ(pool.size(), size_t{1});
+
+    pool.setBudget(0);
+    EXPECT_EQ(pool.size(), size_t{1});
+    second.reset();
+    pool.setBudget(0);
+    EXPECT_EQ(pool.size(), size_t{0});
+}
+
+TEST(ResourcePool, Remove) {
+    auto pool = makePool();
+    auto item = std::make_shared<size_t>(10);
+    pool.add(item);
+    EXPECT_EQ(pool.remove(item.get()), item);
+    EXPECT_EQ(pool.size(), size_t{0});
+    EXPECT_EQ(pool.remove(item.get()), nullptr);
+}
+
+}  // namespace inviwo
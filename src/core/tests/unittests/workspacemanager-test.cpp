@@ -0,0 +1,153 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwoapplication.h>
+
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/ports/datainport.h>
+#include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/processorfactory.h>
+#include <inviwo/core/processors/processorfactoryobject.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <string>
+
+namespace inviwo {
+
+namespace {
+
+struct ConcurrentProcessor : Processor {
+    static constexpr bool threadSafeConstruction = true;
+
+    ConcurrentProcessor(const std::string& id, const std::string& name)
+        : Processor(id, name)
+        , inport("inport")
+        , outport("outport")
+        , value("value", "Value", 0, 0, 100) {
+        inport.setOptional(true);
+        addPorts(inport, outport);
+        addProperty(value);
+    }
+
+    virtual void process() override {}
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    DataInport<int> inport;
+    DataOutport<int> outport;
+    IntProperty value;
+};
+
+const ProcessorInfo ConcurrentProcessor::processorInfo_{
+    "org.inviwo.ConcurrentProcessor",  // Class identifier
+    "Concurrent Processor",            // Display name
+    "Testing",                         // Category
+    CodeState::Stable,                 // Code state
+    Tags::CPU,                         // Tags
+};
+
+struct SerialProcessor : Processor {
+    SerialProcessor(const std::string& id, const std::string& name) : Processor(id, name) {}
+
+    virtual void process() override {}
+
+    virtual const ProcessorInfo& getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+};
+
+const ProcessorInfo SerialProcessor::processorInfo_{
+    "org.inviwo.SerialProcessor",  // Class identifier
+    "Serial Processor",            // Display name
+    "Testing",                     // Category
+    CodeState::Stable,             // Code state
+    Tags::CPU,                     // Tags
+};
+
+}  // namespace
+
+TEST(WorkspaceManager, ThreadSafeFactoryObject) {
+    const ProcessorFactoryObjectTemplate<ConcurrentProcessor> concurrent;
+    EXPECT_TRUE(concurrent.isThreadSafe());
+
+    const ProcessorFactoryObjectTemplate<SerialProcessor> serial;
+    EXPECT_FALSE(serial.isThreadSafe());
+}
+
+TEST(WorkspaceManager, LoadThreadSafeProcessors) {
+    auto* app = InviwoApplication::getPtr();
+    auto* network = app->getProcessorNetwork();
+    auto* manager = app->getWorkspaceManager();
+    const auto refPath = std::filesystem::temp_directory_path() / "workspacemanager-test.inv";
+
+    ProcessorFactoryObjectTemplate<ConcurrentProcessor> factoryObject;
+    app->getProcessorFactory()->registerObject(&factoryObject);
+    EXPECT_TRUE(app->getProcessorFactory()->isThreadSafe("org.inviwo.ConcurrentProcessor"));
+
+    manager->clear();
+    constexpr int count = 16;
+    std::shared_ptr<ConcurrentProcessor> prev;
+    for (int i = 0; i < count; ++i) {
+        auto p = std::make_shared<ConcurrentProcessor>("p" + std::to_string(i), "P");
+        p->value.set(i);
+        network->addProcessor(p);
+        if (prev) network->addConnection(&prev->outport, &p->inport);
+        prev = p;
+    }
+
+    std::pmr::string xml;
+    manager->save(xml, refPath);
+    manager->clear();
+    ASSERT_EQ(network->size(), size_t{0});
+
+    manager->load(xml, refPath);
+    EXPECT_EQ(network->size(), size_t{count});
+    EXPECT_EQ(network->getConnections().size(), size_t{count - 1});
+    for (int i = 0; i < count; ++i) {
+        auto* p = dynamic_cast<ConcurrentProcessor*>(
+            network->getProcessorByIdentifier("p" + std::to_string(i)));
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(p->value.get(), i);
+    }
+
+    manager->clear();
+    app->getProcessorFactory()->unRegisterObject(&factoryObject);
+}
+
+}  // namespace inviwo
@@ -53,7 +53,7 @@
 
 namespace inviwo {
 
-ConsoleLogger::ConsoleLogger() : useColor(true) {
+ConsoleLogger::ConsoleLogger() : useColor(true), useStdErr(false) {
     if (const auto* term = std::getenv("TERM")) {
         if (std::string_view{term} == "dumb") {
             useColor = false;
@@ -67,10 +67,11 @@ void ConsoleLogger::log(std::string_view logSource, [[maybe_unused]] LogLevel lo
                         [[maybe_unused]] std::string_view functionName,
                         [[maybe_unused]] int lineNumber, std::string_view logMsg) {
 
-    auto& os = logLevel == LogLevel::Error ? std::cerr : std::cout;
+    const bool toStdErr = useStdErr || logLevel == LogLevel::Error;
+    auto& os = toStdErr ? std::cerr : std::cout;
 
 #ifdef WIN32
-    const auto h = logLevel == LogLevel::Error ? STD_ERROR_HANDLE : STD_OUTPUT_HANDLE;
+    const auto h = toStdErr ? STD_ERROR_HANDLE : STD_OUTPUT_HANDLE;
     HANDLE hConsole = GetStdHandle(h);
     const auto k = [&]() {
         switch (logLevel) {
@@ -0,0 +1,337 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/deltahistory.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace inviwo {
+
+namespace {
+
+// Random values for the gear rolling hash, generated with splitmix64
+constexpr std::array<std::uint64_t, 256> gear = []() {
+    std::array<std::uint64_t, 256> table{};
+    std::uint64_t state = 0x9e3779b97f4a7c15;
+    for (auto& item : table) {
+        state += 0x9e3779b97f4a7c15;
+        auto z = state;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        item = z ^ (z >> 31);
+    }
+    return table;
+}();
+
+// Chunks are on average about 48 bytes, small enough to keep the cost of an edit low
+constexpr size_t minChunkSize = 16;
+constexpr size_t maxChunkSize = 256;
+constexpr int chunkBits = 5;
+
+struct Chunk {
+    size_t begin;
+    size_t size;
+    std::uint64_t hash;
+
+    std::span<const std::byte> bytes(std::span<const std::byte> data) const {
+        return data.subspan(begin, size);
+    }
+};
+
+/*
+ * Split data into chunks where the gear hash of the preceding bytes has its top bits cleared.
+ * The hash only depends on the last 64 bytes, so the boundaries of two snapshots realign shortly
+ * after an edit.
+ */
+std::vector<Chunk> split(std::span<const std::byte> data) {
+    std::vector<Chunk> chunks;
+    size_t begin = 0;
+    std::uint64_t rolling = 0;
+    std::uint64_t hash = 0xcbf29ce484222325;  // FNV-1a of the chunk content
+    for (size_t i = 0; i < data.size(); ++i) {
+        const auto byte = std::to_integer<std::uint8_t>(data[i]);
+        rolling = (rolling << 1) + gear[byte];
+        hash = (hash ^ byte) * 0x100000001b3;
+        const auto size = i + 1 - begin;
+        if ((size >= minChunkSize && (rolling >> (64 - chunkBits)) == 0) ||
+            size >= maxChunkSize || i + 1 == data.size()) {
+            chunks.push_back(Chunk{.begin = begin, .size = size, .hash = hash});
+            begin = i + 1;
+            hash = 0xcbf29ce484222325;
+        }
+    }
+    return chunks;
+}
+
+size_t commonPrefix(std::span<const std::byte> a, std::span<const std::byte> b) {
+    const auto size = std::min(a.size(), b.size());
+    return static_cast<size_t>(std::mismatch(a.begin(), a.begin() + size, b.begin()).first -
+                               a.begin());
+}
+
+size_t commonSuffix(std::span<const std::byte> a, std::span<const std::byte> b) {
+    const auto size = std::min(a.size(), b.size());
+    return static_cast<size_t>(std::mismatch(a.rbegin(), a.rbegin() + size, b.rbegin()).first -
+                               a.rbegin());
+}
+
+}  // namespace
+
+size_t DeltaHistory::Delta::memoryUsage() const {
+    return std::accumulate(hunks.begin(), hunks.end(), sizeof(Delta),
+                           [](size_t sum, const Hunk& hunk) {
+                               return sum + sizeof(Hunk) + hunk.before.size() + hunk.after.size();
+                           });
+}
+
+DeltaHistory::DeltaHistory(size_t budget)
+    : budget_{budget}
+    , cursorIndex_{0}
+    , cursor_{}
+    , deltas_{}
+    , deltaMemory_{0}
+    , hasSnapshot_{false} {}
+
+bool DeltaHistory::push(std::span<const std::byte> snapshot) {
+    if (empty()) {
+        cursor_.assign(snapshot.begin(), snapshot.end());
+        cursorIndex_ = 0;
+        hasSnapshot_ = true;
+        return true;
+    }
+
+    moveTo(size() - 1);
+    if (std::ranges::equal(cursor_, snapshot)) return false;
+
+    auto& delta = deltas_.emplace_back(diff(cursor_, snapshot));
+    deltaMemory_ += delta.memoryUsage();
+    apply(cursor_, delta, true);
+    ++cursorIndex_;
+
+    enforceBudget();
+    return true;
+}
+
+const std::vector<std::byte>& DeltaHistory::at(size_t index) {
+    moveTo(index);
+    return cursor_;
+}
+
+void DeltaHistory::truncate(size_t count) {
+    if (count == 0) {
+        clear();
+        return;
+    }
+    if (count >= size()) return;
+
+    moveTo(std::min(cursorIndex_, count - 1));
+    while (deltas_.size() >= count) {
+        deltaMemory_ -= deltas_.back().memoryUsage();
+        deltas_.pop_back();
+    }
+}
+
+void DeltaHistory::clear() {
+    cursor_.clear();
+    cursor_.shrink_to_fit();
+    cursorIndex_ = 0;
+    deltas_.clear();
+    deltaMemory_ = 0;
+    hasSnapshot_ = false;
+}
+
+size_t DeltaHistory::size() const { return hasSnapshot_ ? deltas_.size() + 1 : 0; }
+
+bool DeltaHistory::empty() const { return !hasSnapshot_; }
+
+size_t DeltaHistory::memoryUsage() const { return cursor_.size() + deltaMemory_; }
+
+void DeltaHistory::setBudget(size_t budget) {
+    budget_ = budget;
+    enforceBudget();
+}
+
+size_t DeltaHistory::getBudget() const { return budget_; }
+
+auto DeltaHistory::diff(std::span<const std::byte> before, std::span<const std::byte> after)
+    -> Delta {
+    const auto maxCommon = std::min(before.size(), after.size());
+    const auto prefix = commonPrefix(before.first(maxCommon), after.first(maxCommon));
+    const auto suffix = commonSuffix(before.subspan(prefix), after.subspan(prefix));
+    const auto beforeMiddle = before.subspan(prefix, before.size() - prefix - suffix);
+    const auto afterMiddle = after.subspan(prefix, after.size() - prefix - suffix);
+
+    const auto beforeChunks = split(beforeMiddle);
+    const auto afterChunks = split(afterMiddle);
+
+    std::unordered_map<std::uint64_t, std::vector<size_t>> beforeIndex;
+    for (size_t i = 0; i < beforeChunks.size(); ++i) {
+        beforeIndex[beforeChunks[i].hash].push_back(i);
+    }
+    std::unordered_map<std::uint64_t, std::vector<size_t>> afterIndex;
+    for (size_t j = 0; j < afterChunks.size(); ++j) {
+        afterIndex[afterChunks[j].hash].push_back(j);
+    }
+
+    // The first chunk in `chunks` from `first` that is equal to `chunk`
+    const auto find = [](const auto& index, const std::vector<Chunk>& chunks,
+                         std::span<const std::byte> data, size_t first, const Chunk& chunk,
+                         std::span<const std::byte> chunkData) -> std::optional<size_t> {
+        const auto it = index.find(chunk.hash);
+        if (it == index.end()) return std::nullopt;
+        for (auto i = std::ranges::lower_bound(it->second, first); i != it->second.end(); ++i) {
+            if (std::ranges::equal(chunks[*i].bytes(data), chunk.bytes(chunkData))) return *i;
+        }
+        return std::nullopt;
+    };
+
+    Delta delta;
+    const auto addHunk = [&](size_t beforeBegin, size_t beforeEnd, size_t afterBegin,
+                             size_t afterEnd) {
+        auto from = beforeMiddle.subspan(beforeBegin, beforeEnd - beforeBegin);
+        auto to = afterMiddle.subspan(afterBegin, afterEnd - afterBegin);
+        // Chunk boundaries do not line up with the edit, trim the unchanged bytes
+        const auto head = commonPrefix(from, to);
+        from = from.subspan(head);
+        to = to.subspan(head);
+        const auto tail = commonSuffix(from, to);
+        from = from.first(from.size() - tail);
+        to = to.first(to.size() - tail);
+        if (from.empty() && to.empty()) return;
+        delta.hunks.push_back(Hunk{.offset = prefix + beforeBegin + head,
+                                   .before = {from.begin(), from.end()},
+                                   .after = {to.begin(), to.end()}});
+    };
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < beforeChunks.size() && j < afterChunks.size()) {
+        if (beforeChunks[i].hash == afterChunks[j].hash &&
+            std::ranges::equal(beforeChunks[i].bytes(beforeMiddle),
+                               afterChunks[j].bytes(afterMiddle))) {
+            ++i;
+            ++j;
+            continue;
+        }
+
+        // Find the nearest pair of equal chunks to resume from, searching from both sides
+        std::optional<std::pair<size_t, size_t>> resume;
+        for (auto jj = j; jj < afterChunks.size(); ++jj) {
+            if (auto ii = find(beforeIndex, beforeChunks, beforeMiddle, i, afterChunks[jj],
+                               afterMiddle)) {
+                resume = std::pair{*ii, jj};
+                break;
+            }
+        }
+        for (auto ii = i; ii < beforeChunks.size(); ++ii) {
+            if (resume && ii - i >= resume->first - i + resume->second - j) break;
+            if (auto jj = find(afterIndex, afterChunks, afterMiddle, j, beforeChunks[ii],
+                               beforeMiddle)) {
+                if (!resume || ii - i + *jj - j < resume->first - i + resume->second - j) {
+                    resume = std::pair{ii, *jj};
+                }
+                break;
+            }
+        }
+        if (!resume) break;
+
+        addHunk(beforeChunks[i].begin, beforeChunks[resume->first].begin, afterChunks[j].begin,
+                afterChunks[resume->second].begin);
+        i = resume->first;
+        j = resume->second;
+    }
+    addHunk(i < beforeChunks.size() ? beforeChunks[i].begin : beforeMiddle.size(),
+            beforeMiddle.size(),
+            j < afterChunks.size() ? afterChunks[j].begin : afterMiddle.size(),
+            afterMiddle.size());
+
+    return delta;
+}
+
+void DeltaHistory::apply(std::vector<std::byte>& snapshot, const Delta& delta, bool forward) {
+    const auto sameSize = std::ranges::all_of(
+        delta.hunks, [](const Hunk& hunk) { return hunk.before.size() == hunk.after.size(); });
+
+    if (sameSize) {
+        for (const auto& hunk : delta.hunks) {
+            std::ranges::copy(forward ? hunk.after : hunk.before,
+                              snapshot.begin() + static_cast<std::ptrdiff_t>(hunk.offset));
+        }
+        return;
+    }
+
+    std::vector<std::byte> result;
+    result.reserve(std::accumulate(delta.hunks.begin(), delta.hunks.end(), snapshot.size(),
+                                   [&](size_t sum, const Hunk& hunk) {
+                                       return sum + (forward ? hunk.after : hunk.before).size();
+                                   }));
+    size_t pos = 0;
+    std::ptrdiff_t shift = 0;  // Offset of the after snapshot relative to the before snapshot
+    for (const auto& hunk : delta.hunks) {
+        const auto& from = forward ? hunk.before : hunk.after;
+        const auto& to = forward ? hunk.after : hunk.before;
+        const auto start = forward ? hunk.offset : static_cast<size_t>(hunk.offset + shift);
+
+        result.insert(result.end(), snapshot.begin() + pos, snapshot.begin() + start);
+        result.insert(result.end(), to.begin(), to.end());
+        pos = start + from.size();
+        shift += static_cast<std::ptrdiff_t>(hunk.after.size()) -
+                 static_cast<std::ptrdiff_t>(hunk.before.size());
+    }
+    result.insert(result.end(), snapshot.begin() + pos, snapshot.end());
+    snapshot.swap(result);
+}
+
+void DeltaHistory::moveTo(size_t index) {
+    while (cursorIndex_ < index) {
+        apply(cursor_, deltas_[cursorIndex_], true);
+        ++cursorIndex_;
+    }
+    while (cursorIndex_ > index) {
+        --cursorIndex_;
+        apply(cursor_, deltas_[cursorIndex_], false);
+    }
+}
+
+void DeltaHistory::enforceBudget() {
+    while (!deltas_.empty() && memoryUsage() > budget_) {
+        if (cursorIndex_ == 0) moveTo(1);
+        deltaMemory_ -= deltas_.front().memoryUsage();
+        deltas_.pop_front();
+        --cursorIndex_;
+    }
+}
+
+}  // namespace inviwo
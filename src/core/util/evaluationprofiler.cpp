@@ -0,0 +1,307 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/evaluationprofiler.h>
+
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/zip.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <fmt/std.h>
+
+namespace inviwo {
+
+std::atomic<EvaluationProfiler*> EvaluationProfiler::instance_ = nullptr;
+
+namespace {
+
+std::atomic<std::uint64_t> nextProfilerId{1};
+
+bool needsEscape(char c) { return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20; }
+
+std::string_view escapeJson(std::string_view str, std::string& buffer) {
+    if (std::ranges::none_of(str, needsEscape)) return str;
+    buffer.clear();
+    for (const auto c : str) {
+        switch (c) {
+            case '"':
+                buffer.append("\\\"");
+                break;
+            case '\\':
+                buffer.append("\\\\");
+                break;
+            case '\b':
+                buffer.append("\\b");
+                break;
+            case '\f':
+                buffer.append("\\f");
+                break;
+            case '\n':
+                buffer.append("\\n");
+                break;
+            case '\r':
+                buffer.append("\\r");
+                break;
+            case '\t':
+                buffer.append("\\t");
+                break;
+            default:
+                if (needsEscape(c)) {
+                    fmt::format_to(std::back_inserter(buffer), "\\u{:04x}",
+                                   static_cast<unsigned char>(c));
+                } else {
+                    buffer.push_back(c);
+                }
+        }
+    }
+    return buffer;
+}
+
+EvaluationProfiler::Stats computeStats(
+    std::vector<EvaluationProfiler::clock::duration>& durations) {
+    EvaluationProfiler::Stats stats{};
+    if (durations.empty()) return stats;
+
+    stats.count = durations.size();
+    for (const auto& d : durations) {
+        stats.total += d;
+        stats.max = std::max(stats.max, d);
+    }
+    stats.mean = stats.total / static_cast<std::ptrdiff_t>(stats.count);
+    const auto p95 = std::min(durations.size() - 1, (durations.size() * 95) / 100);
+    std::ranges::nth_element(durations, durations.begin() + static_cast<std::ptrdiff_t>(p95));
+    stats.p95 = durations[p95];
+    return stats;
+}
+
+}  // namespace
+
+EvaluationProfiler::Scope::Scope(Category category, std::string_view name)
+    : profiler_{EvaluationProfiler::active()}
+    , category_{category}
+    , name_{name}
+    , start_{profiler_ ? clock::now() : clock::time_point{}} {}
+
+EvaluationProfiler::Scope::~Scope() {
+    if (profiler_) profiler_->record(category_, name_, start_, clock::now());
+}
+
+EvaluationProfiler::EvaluationProfiler(size_t capacity)
+    : id_{nextProfilerId.fetch_add(1, std::memory_order_relaxed)}
+    , enabled_{false}
+    , capacity_{std::max(capacity, size_t{1})} {}
+
+EvaluationProfiler* EvaluationProfiler::active() {
+    auto* profiler = instance_.load(std::memory_order_acquire);
+    if (profiler && profiler->isEnabled()) return profiler;
+    return nullptr;
+}
+
+void EvaluationProfiler::setEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void EvaluationProfiler::setCapacity(size_t capacity) {
+    const std::scoped_lock lock{mutex_};
+    capacity_ = std::max(capacity, size_t{1});
+    for (auto& buffer : buffers_) {
+        const std::scoped_lock bufferLock{buffer->mutex};
+        buffer->slots.clear();
+        buffer->slots.resize(capacity_);
+        buffer->next = 0;
+        buffer->size = 0;
+    }
+}
+
+size_t EvaluationProfiler::getCapacity() const {
+    const std::scoped_lock lock{mutex_};
+    return capacity_;
+}
+
+void EvaluationProfiler::record(Category category, std::string_view name, clock::time_point start,
+                                clock::time_point end) {
+    auto& buffer = threadBuffer();
+    const auto nameId = intern(buffer, name);
+
+    const std::scoped_lock lock{buffer.mutex};
+    buffer.slots[buffer.next] = Slot{nameId, category, start, end - start};
+    buffer.next = (buffer.next + 1) % buffer.slots.size();
+    buffer.size = std::min(buffer.size + 1, buffer.slots.size());
+}
+
+void EvaluationProfiler::clear() {
+    const std::scoped_lock lock{mutex_};
+    for (auto& buffer : buffers_) {
+        const std::scoped_lock bufferLock{buffer->mutex};
+        buffer->next = 0;
+        buffer->size = 0;
+    }
+}
+
+template <typename Func>
+void EvaluationProfiler::forEachSlot(Func&& func) const {
+    for (auto&& [thread, buffer] : util::enumerate(buffers_)) {
+        const std::scoped_lock bufferLock{buffer->mutex};
+        const auto capacity = buffer->slots.size();
+        const auto first = (buffer->next + capacity - buffer->size) % capacity;
+        for (size_t i = 0; i < buffer->size; ++i) {
+            func(static_cast<std::uint32_t>(thread), buffer->slots[(first + i) % capacity]);
+        }
+    }
+}
+
+std::vector<EvaluationProfiler::Event> EvaluationProfiler::getEvents() const {
+    std::vector<Event> events;
+    {
+        const std::scoped_lock lock{mutex_};
+        forEachSlot([&](std::uint32_t thread, const Slot& slot) {
+            events.push_back(
+                Event{names_[slot.name], slot.category, slot.start, slot.duration, thread});
+        });
+    }
+    std::ranges::stable_sort(events, std::less<>{}, &Event::start);
+    return events;
+}
+
+auto EvaluationProfiler::getStats(std::string_view name, Category category) const -> Stats {
+    std::vector<clock::duration> durations;
+    {
+        const std::scoped_lock lock{mutex_};
+        const auto it = nameIds_.find(name);
+        if (it == nameIds_.end()) return Stats{};
+        forEachSlot([&, nameId = it->second](std::uint32_t, const Slot& slot) {
+            if (slot.category == category && slot.name == nameId) {
+                durations.push_back(slot.duration);
+            }
+        });
+    }
+    return computeStats(durations);
+}
+
+auto EvaluationProfiler::getStats(Category category) const
+    -> std::vector<std::pair<std::string, Stats>> {
+    std::unordered_map<std::string, std::vector<clock::duration>> durations;
+    {
+        const std::scoped_lock lock{mutex_};
+        forEachSlot([&](std::uint32_t, const Slot& slot) {
+            if (slot.category == category) {
+                durations[names_[slot.name]].push_back(slot.duration);
+            }
+        });
+    }
+
+    std::vector<std::pair<std::string, Stats>> stats;
+    stats.reserve(durations.size());
+    for (auto& [name, items] : durations) {
+        stats.emplace_back(name, computeStats(items));
+    }
+    std::ranges::sort(stats, std::greater<>{},
+                      [](const auto& item) { return item.second.total; });
+    return stats;
+}
+
+void EvaluationProfiler::exportChromeTrace(std::ostream& os) const {
+    const auto events = getEvents();
+    const auto origin = events.empty() ? clock::time_point{} : events.front().start;
+    const auto toMicro = [](clock::duration d) {
+        return std::chrono::duration<double, std::micro>(d).count();
+    };
+
+    std::string buffer;
+    os << "{\"traceEvents\":[";
+    for (auto&& [i, event] : util::enumerate(events)) {
+        fmt::print(os,
+                   "{}\n{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+                   "\"pid\":0,\"tid\":{}}}",
+                   i == 0 ? "" : ",", escapeJson(event.name, buffer), event.category,
+                   toMicro(event.start - origin), toMicro(event.duration), event.thread);
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void EvaluationProfiler::exportChromeTrace(const std::filesystem::path& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        throw FileException(SourceContext{}, "Could not open file '{}' for writing", path);
+    }
+    exportChromeTrace(file);
+}
+
+auto EvaluationProfiler::threadBuffer() -> ThreadBuffer& {
+    // Buffers are never removed while the profiler lives, so the cached pointer stays valid
+    thread_local std::pair<std::uint64_t, ThreadBuffer*> cached{0, nullptr};
+    if (cached.first == id_) return *cached.second;
+
+    const std::scoped_lock lock{mutex_};
+    auto [it, inserted] = threads_.try_emplace(std::this_thread::get_id(),
+                                               static_cast<std::uint32_t>(buffers_.size()));
+    if (inserted) buffers_.push_back(std::make_unique<ThreadBuffer>(capacity_));
+    cached = {id_, buffers_[it->second].get()};
+    return *cached.second;
+}
+
+std::uint32_t EvaluationProfiler::intern(ThreadBuffer& buffer, std::string_view name) {
+    if (auto it = buffer.names.find(name); it != buffer.names.end()) return it->second;
+
+    const std::scoped_lock lock{mutex_};
+    auto [it, inserted] =
+        nameIds_.try_emplace(std::string{name}, static_cast<std::uint32_t>(names_.size()));
+    if (inserted) names_.emplace_back(name);
+    buffer.names.try_emplace(std::string{name}, it->second);
+    return it->second;
+}
+
+std::string_view enumToStr(EvaluationProfiler::Category category) {
+    switch (category) {
+        case EvaluationProfiler::Category::Evaluation:
+            return "Evaluation";
+        case EvaluationProfiler::Category::InitializeResources:
+            return "InitializeResources";
+        case EvaluationProfiler::Category::PortOnChange:
+            return "PortOnChange";
+        case EvaluationProfiler::Category::Process:
+            return "Process";
+        case EvaluationProfiler::Category::Conversion:
+            return "Conversion";
+        case EvaluationProfiler::Category::BackgroundJob:
+            return "BackgroundJob";
+        case EvaluationProfiler::Category::Linking:
+            return "Linking";
+    }
+    throw Exception(SourceContext{}, "Found invalid EvaluationProfiler::Category enum value '{}'",
+                    static_cast<int>(category));
+}
+
+}  // namespace inviwo
@@ -29,18 +29,59 @@
 
 #include <inviwo/core/util/imagecache.h>
 #include <inviwo/core/datastructures/image/image.h>
+#include <inviwo/core/datastructures/image/layer.h>
 #include <inviwo/core/util/stdextensions.h>
 
 #include <glm/gtx/component_wise.hpp>
 
 namespace inviwo {
 
-ImageCache::ImageCache(std::shared_ptr<const Image> master) : valid_(true), master_(master) {}
+namespace {
+
+size_t sizeInBytes(const Layer* layer) {
+    if (!layer) return 0;
+    return glm::compMul(layer->getDimensions()) * layer->getDataFormat()->getSizeInBytes();
+}
+
+size_t sizeInBytes(const Image& image) {
+    size_t bytes = sizeInBytes(image.getDepthLayer()) + sizeInBytes(image.getPickingLayer());
+    for (size_t i = 0; i < image.getNumberOfColorLayers(); ++i) {
+        bytes += sizeInBytes(image.getColorLayer(i));
+    }
+    return bytes;
+}
+
+bool sameFormat(const Layer* a, const Layer* b) {
+    if (!a || !b) return a == b;
+    return a->getDataFormat() == b->getDataFormat();
+}
+
+/**
+ * Images are compatible if they have the same layers with the same formats, i.e. a clone of
+ * @p master can be replaced by @p image.
+ */
+bool isCompatible(const Image& master, const Image& image) {
+    if (master.getNumberOfColorLayers() != image.getNumberOfColorLayers()) return false;
+    if (!sameFormat(master.getDepthLayer(), image.getDepthLayer())) return false;
+    if (!sameFormat(master.getPickingLayer(), image.getPickingLayer())) return false;
+    for (size_t i = 0; i < master.getNumberOfColorLayers(); ++i) {
+        if (!sameFormat(master.getColorLayer(i), image.getColorLayer(i))) return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+ImageCache::ImageCache(std::shared_ptr<const Image> master, size_t budget)
+    : valid_(true)
+    , master_(master)
+    , pool_{"ImageCache", [](const Image& image) { return sizeInBytes(image); }, budget} {}
 
 void ImageCache::setMaster(std::shared_ptr<const Image> master) {
-    // Clear cache if format changes.
+    // Clear cache if format changes, the images stay in the pool until evicted.
     if (master_ && master && master_->getDataFormat() != master->getDataFormat()) {
         cache_.clear();
+        pool_.trim();
     }
     master_ = master;
     valid_ = false;
@@ -63,11 +104,18 @@ std::shared_ptr<const Image> ImageCache::getImage(const size2_t dimensions) cons
     auto it = cache_.find(dimensions);
     if (it != cache_.end()) {
         return it->second;
+    } else if (auto image = pool_.acquire([&](const Image& img) {
+                   return img.getDimensions() == dimensions && isCompatible(*master_, img);
+               })) {
+        master_->copyRepresentationsTo(image.get());
+        cache_[dimensions] = image;
+        return image;
     } else {
         auto newImage = std::shared_ptr<Image>(master_->clone());
         newImage->setDimensions(dimensions);
         master_->copyRepresentationsTo(newImage.get());
         cache_[newImage->getDimensions()] = newImage;
+        pool_.add(newImage);
         return newImage;
     }
 }
@@ -80,15 +128,13 @@ void ImageCache::prune(const std::vector<size2_t>& dimensions) const {
             ++it;
         }
     }
+    pool_.trim();
 }
 
 void ImageCache::update(std::vector<size2_t> dimensions) {
-    std::vector<std::shared_ptr<Image>> unusedImages;
-
     for (auto it = cache_.begin(); it != cache_.end();) {
         auto dim = std::find(dimensions.begin(), dimensions.end(), it->first);
         if (dim == dimensions.end() || it->first == master_->getDimensions()) {
-            unusedImages.push_back(std::move(it->second));
             it = cache_.erase(it);
         } else {
             std::erase(dimensions, *dim);
@@ -100,19 +146,21 @@ void ImageCache::update(std::vector<size2_t> dimensions) {
     for (auto dim : dimensions) {
         if (dim == master_->getDimensions()) continue;
 
-        if (!unusedImages.empty()) {
-            auto img = unusedImages.back();
-            unusedImages.pop_back();
-            img->setDimensions(dim);
-            cache_[dim] = img;
-            valid_ = false;
-        } else {
-            auto newImage = std::shared_ptr<Image>(master_->clone());
-            newImage->setDimensions(dim);
-            cache_[newImage->getDimensions()] = newImage;
-            valid_ = false;
+        // Prefer an image of the right size, then any image that can be resized.
+        auto img = pool_.acquire(
+            [&](const Image& image) {
+                return image.getDimensions() == dim && isCompatible(*master_, image);
+            },
+            [&](const Image& image) { return isCompatible(*master_, image); });
+        if (!img) {
+            img = std::shared_ptr<Image>(master_->clone());
         }
+        img->setDimensions(dim);
+        cache_[dim] = img;
+        pool_.add(img);
+        valid_ = false;
     }
+    pool_.trim();
 }
 
 void ImageCache::setInvalid() const { valid_ = false; }
@@ -121,13 +169,17 @@ bool ImageCache::hasImage(const size2_t dimensions) {
     return cache_.find(dimensions) != cache_.end();
 }
 
-void ImageCache::addImage(std::shared_ptr<Image> image) { cache_[image->getDimensions()] = image; }
+void ImageCache::addImage(std::shared_ptr<Image> image) {
+    cache_[image->getDimensions()] = image;
+    pool_.add(image);
+}
 
 std::shared_ptr<Image> ImageCache::releaseImage(const size2_t dimensions) {
     auto it = cache_.find(dimensions);
     if (it != cache_.end()) {
         auto ptr = it->second;
         cache_.erase(it);
+        pool_.remove(ptr.get());
         return ptr;
     } else {
         return std::shared_ptr<Image>();
@@ -143,6 +195,7 @@ std::shared_ptr<Image> ImageCache::getUnusedImage(const std::vector<size2_t>& di
     if (it != cache_.end()) {
         auto ptr = it->second;
         cache_.erase(it);
+        pool_.remove(ptr.get());
         return ptr;
     } else {
         return std::shared_ptr<Image>();
@@ -34,6 +34,7 @@
 #include <inviwo/core/util/commandlineparser.h>
 
 #include <inviwo/core/resourcemanager/resourcemanager.h>
+#include <inviwo/core/util/evaluationprofiler.h>
 
 namespace inviwo {
 
@@ -70,6 +71,27 @@ SystemSettings::SystemSettings(InviwoApplication* app)
                               "Useful for gettting a overview of memory usage, "
                               "but comes with a small runtime overhead"_help,
                               false}
+    , ramBudget_{"ramBudget", "RAM Budget (MB)",
+                 "Memory budget for RAM representations. When exceeded, representations that "
+                 "can be reloaded from disk are evicted in least recently used order. "
+                 "0 means unlimited. Requires resource tracking"_help,
+                 0, {0, ConstraintBehavior::Immutable}, {1024 * 1024, ConstraintBehavior::Ignore}}
+    , glBudget_{"glBudget", "GL Budget (MB)",
+                "Memory budget for OpenGL representations. When exceeded, representations that "
+                "can be recreated from RAM are evicted in least recently used order. "
+                "0 means unlimited. Requires resource tracking"_help,
+                0, {0, ConstraintBehavior::Immutable}, {64 * 1024, ConstraintBehavior::Ignore}}
+    , enableProfiling_{"enableProfiling", "Record evaluation timings",
+                       "Record the time spent in each processor, in representation conversions, "
+                       "and in background jobs. The timings are available from the "
+                       "EvaluationProfiler and can be exported as a Chrome trace"_help,
+                       false}
+    , batchedLinking_{"batchedLinking", "Batch property links",
+                      "Collect the changes of linked properties while the network is locked, "
+                      "for example during animations and camera interaction, and propagate them "
+                      "once when it is unlocked. Each linked property is then only set once "
+                      "per frame"_help,
+                      false}
     , redirectCout_{"redirectCout", "Redirect cout to LogCentral",
                     "Enabling this means that any std::cout messages will no longer end up in the "
                     "console, which can be confusing. "
@@ -87,7 +109,8 @@ SystemSettings::SystemSettings(InviwoApplication* app)
                   enableGesturesProperty_, enablePickingProperty_, enableSoundProperty_,
                   logStackTraceProperty_, moduleSearchPaths_, runtimeModuleReloading_,
                   breakOnMessage_, breakOnException_, stackTraceInException_,
-                  enableResourceTracking_, redirectCout_, redirectCerr_);
+                  enableResourceTracking_, ramBudget_, glBudget_, enableProfiling_, batchedLinking_,
+                  redirectCout_, redirectCerr_);
 
     logStackTraceProperty_.onChange(
         [this]() { LogCentral::getPtr()->setLogStacktrace(logStackTraceProperty_.get()); });
@@ -111,6 +134,23 @@ SystemSettings::SystemSettings(InviwoApplication* app)
         }
     });
 
+    const auto updateBudgets = [this]() {
+        constexpr size_t megabyte = 1024 * 1024;
+        auto* rm = app_->getResourceManager();
+        rm->setBudget(util::index_of<resource::RAM, ResourceManager::Keys>(),
+                      ramBudget_.get() * megabyte);
+        rm->setBudget(util::index_of<resource::GL, ResourceManager::Keys>(),
+                      glBudget_.get() * megabyte);
+    };
+    ramBudget_.onChange(updateBudgets);
+    glBudget_.onChange(updateBudgets);
+
+    enableProfiling_.onChange([this]() {
+        if (EvaluationProfiler::isInitialized()) {
+            EvaluationProfiler::getPtr()->setEnabled(enableProfiling_);
+        }
+    });
+
     redirectCout_.onChange([this]() {
         if (redirectCout_ && !cout_) {
             if (app_->getCommandLineParser().getLogToConsole()) {
@@ -148,6 +188,7 @@ SystemSettings::SystemSettings(InviwoApplication* app)
     });
 
     load();
+    updateBudgets();
 }
 
 SystemSettings::~SystemSettings() = default;
@@ -32,6 +32,8 @@
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/threadutil.h>
 
+#include <algorithm>
+
 namespace inviwo {
 
 // the constructor just launches some amount of workers
@@ -71,6 +73,12 @@ size_t ThreadPool::trySetSize(size_t size) {
 
 size_t ThreadPool::getSize() const { return workers.size(); }
 
+size_t ThreadPool::getActiveCount() const {
+    return static_cast<size_t>(std::ranges::count_if(workers, [](const auto& worker) {
+        return worker->state == State::Working;
+    }));
+}
+
 size_t ThreadPool::getQueueSize() {
     std::unique_lock<std::mutex> lock(queue_mutex);
     return tasks.size();
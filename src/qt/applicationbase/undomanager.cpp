@@ -28,7 +28,11 @@
  *********************************************************************************/
 
 #include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/io/serialization/binaryxml.h>
 #include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/io/serialization/serializer.h>
 #include <inviwo/qt/applicationbase/undomanager.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/filesystem.h>
@@ -42,6 +46,7 @@
 #include <QTouchEvent>
 #include <QTimer>
 
+#include <algorithm>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -91,7 +96,7 @@ public:
             util::setThreadDescription("Inviwo AutoSave");
             for (;;) {
 
-                std::shared_ptr<const std::pmr::string> str;
+                std::shared_ptr<const std::pmr::vector<std::byte>> data;
                 {
                     std::unique_lock<std::mutex> lock(mutex_);
                     while (!quit_ && toSave_.empty()) {
@@ -101,18 +106,23 @@ public:
                     if (quit_) return;
 
                     if (!toSave_.empty()) {
-                        str = std::move(toSave_.back());
+                        data = std::move(toSave_.back());
                         toSave_.clear();
                     }
                 }
 
-                if (str) {
+                if (data) {
                     try {
+                        // The undo states are stored in the binary format, convert to XML here
+                        // to keep the work off the main thread.
+                        std::pmr::string str;
+                        binaryxml::toXML(*data, str, true);
+
                         std::filesystem::create_directories(path_ / "autosaves");
                         {
                             // make sure we have closed the file _before_ we copy it.
                             auto ofstream = std::ofstream(path_ / "autosave.inv.tmp");
-                            ofstream << *str;
+                            ofstream << str;
                         }
 
                         std::filesystem::copy(path_ / "autosave.inv.tmp", path_ / "autosave.inv",
@@ -142,10 +152,10 @@ public:
 
     const std::optional<std::pmr::string>& getRestored() const { return restored_; }
 
-    void save(std::shared_ptr<const std::pmr::string> str) {
+    void save(std::shared_ptr<const std::pmr::vector<std::byte>> data) {
         {
             std::unique_lock<std::mutex> lock(mutex_);
-            toSave_.push_back(str);
+            toSave_.push_back(std::move(data));
         }
         condition_.notify_one();
     }
@@ -177,17 +187,19 @@ private:
     std::atomic<bool> quit_;
     std::condition_variable condition_;
     std::mutex mutex_;
-    std::vector<std::shared_ptr<const std::pmr::string>> toSave_;
+    std::vector<std::shared_ptr<const std::pmr::vector<std::byte>>> toSave_;
 
     std::thread saver_;
 };
 
 UndoManager::UndoManager(WorkspaceManager* wm, ProcessorNetwork* network,
                          std::function<int()> numRestoreFiles,
-                         std::function<int()> restoreFrequency)
+                         std::function<int()> restoreFrequency,
+                         std::function<int()> historyBudget)
     : network_{network}
     , manager_{wm}
     , refPath_{filesystem::findBasePath()}
+    , historyBudget_{std::move(historyBudget)}
     , autoSaver_{std::make_unique<AutoSaver>(numRestoreFiles, restoreFrequency)} {
 
     QApplication::instance()->installEventFilter(this);
@@ -200,6 +212,12 @@ UndoManager::UndoManager(WorkspaceManager* wm, ProcessorNetwork* network,
     redoAction_->setShortcut(QKeySequence::Redo);
     redoAction_->connect(redoAction_, &QAction::triggered, [this]() { redoState(); });
 
+    // Property steps do not produce a full workspace, coalesce the auto saves for those.
+    autoSaveTimer_ = new QTimer(this);
+    autoSaveTimer_->setSingleShot(true);
+    autoSaveTimer_->setInterval(5000);
+    autoSaveTimer_->connect(autoSaveTimer_, &QTimer::timeout, [this]() { autoSave(); });
+
     clearHandle_ = manager_->onClear([&]() {
         clear();
         pushState();
@@ -230,59 +248,223 @@ void UndoManager::markDirty() { dirty_ = true; }
 void UndoManager::pushState() {
     if (isRestoring) return;
 
-    auto str = std::make_shared<std::pmr::string>();
-    str->reserve(8 * 1024);
+    std::pmr::vector<std::byte> structure;
+    try {
+        structure = serializeStructure();
+    } catch (...) {
+        return;
+    }
+    dirty_ = false;
+
+    if (head_ < 0 || !std::ranges::equal(structure, structure_) ||
+        static_cast<size_t>(head_ - findBase(head_)) >= maxPropertySteps) {
+        pushSnapshot(std::move(structure));
+        return;
+    }
+
+    // Only properties have changed, store the properties of the modified processors.
+    std::vector<OwnerState> owners;
+    bool unknownProcessor = false;
+    network_->forEachProcessor([&](Processor* processor) {
+        const auto it = modificationCounts_.find(processor);
+        if (it == modificationCounts_.end()) {
+            unknownProcessor = true;
+        } else if (it->second != processor->getModificationCount()) {
+            auto data = serializeProperties(*processor);
+            const auto* previous = findPrevious(head_, processor->getIdentifier());
+            if (!previous || !std::ranges::equal(previous->data, data)) {
+                owners.push_back(OwnerState{processor->getIdentifier(), std::move(data)});
+            }
+        }
+    });
+    if (unknownProcessor) {
+        // A processor was replaced by one with the same identifier
+        pushSnapshot(std::move(structure));
+        return;
+    }
+
+    recordModificationCounts();
+    if (owners.empty()) return;  // No Change
+
+    const auto snapshot = states_[head_].snapshot;
+    states_.resize(static_cast<size_t>(head_ + 1));
+    history_.truncate(snapshot + 1);
+    states_.push_back(State{snapshot, std::move(owners)});
+    head_ = static_cast<DiffType>(states_.size()) - 1;
+
+    autoSaveTimer_->start();
+    updateActions();
+}
+
+void UndoManager::pushSnapshot(std::pmr::vector<std::byte> structure) {
+    auto data = std::make_shared<std::pmr::vector<std::byte>>();
+    data->reserve(8 * 1024);
 
     try {
         manager_->save(
-            *str, refPath_, [](SourceContext) -> void { throw; }, WorkspaceSaveMode::Undo);
+            *data, refPath_, [](SourceContext) -> void { throw; }, WorkspaceSaveMode::Undo);
     } catch (...) {
         return;
     }
 
-    dirty_ = false;
-    if (head_ >= 0 && *str == *undoBuffer_[head_]) return;  // No Change
+    structure_ = std::move(structure);
+    recordModificationCounts();
+
+    if (head_ >= 0 && states_[head_].owners.empty() &&
+        std::ranges::equal(*data, history_.at(states_[head_].snapshot))) {
+        return;  // No Change
+    }
 
-    ++head_;
-    auto offset = std::min(std::distance(undoBuffer_.begin(), undoBuffer_.end()), head_);
-    undoBuffer_.erase(undoBuffer_.begin() + offset, undoBuffer_.end());
-    undoBuffer_.push_back(str);
+    states_.resize(static_cast<size_t>(head_ + 1));
+    history_.truncate(states_.empty() ? 0 : states_.back().snapshot + 1);
+    const auto size = history_.size();
+    history_.setBudget(static_cast<size_t>(std::max(1, historyBudget_())) * 1024 * 1024);
+    const auto pushed = history_.push(*data);
+
+    // Drop the states of any snapshots that did not fit in the budget
+    if (const auto dropped = size + (pushed ? 1 : 0) - history_.size(); dropped > 0) {
+        const auto first = std::ranges::find_if(
+            states_, [&](const State& state) { return state.snapshot >= dropped; });
+        states_.erase(states_.begin(), first);
+        for (auto& state : states_) state.snapshot -= dropped;
+    }
+    states_.push_back(State{history_.size() - 1, {}});
+    head_ = static_cast<DiffType>(states_.size()) - 1;
 
+    autoSaveTimer_->stop();
     if (!network_->empty()) {
-        autoSaver_->save(str);
+        autoSaver_->save(data);
     }
 
     updateActions();
 }
-void UndoManager::undoState() {
-    if (head_ > 0) {
-        util::KeepTrueWhileInScope restore(&isRestoring);
-        --head_;
 
-        manager_->load(*undoBuffer_[head_], refPath_, StandardExceptionHandler{},
+void UndoManager::restoreState(DiffType index) {
+    util::KeepTrueWhileInScope restore(&isRestoring);
+
+    const auto base = findBase(index);
+    const bool sameBase = head_ >= 0 && findBase(head_) == base;
+
+    if (sameBase && index == head_ + 1) {
+        // Redo of a property step
+        applyOwners(states_[index].owners);
+    } else if (sameBase && index == head_ - 1 &&
+               std::ranges::all_of(states_[head_].owners, [&](const OwnerState& owner) {
+                   return findPrevious(index, owner.processor) != nullptr;
+               })) {
+        // Undo of a property step where all the previous property states are known
+        std::vector<OwnerState> owners;
+        for (const auto& owner : states_[head_].owners) {
+            owners.push_back(*findPrevious(index, owner.processor));
+        }
+        applyOwners(owners);
+    } else {
+        manager_->load(history_.at(states_[base].snapshot), refPath_, StandardExceptionHandler{},
                        WorkspaceSaveMode::Undo);
+        for (auto i = base + 1; i <= index; ++i) {
+            applyOwners(states_[i].owners);
+        }
+        try {
+            structure_ = serializeStructure();
+        } catch (...) {
+            structure_.clear();
+        }
+    }
 
-        dirty_ = false;
-        updateActions();
+    head_ = index;
+    recordModificationCounts();
+    dirty_ = false;
+    updateActions();
+}
+
+void UndoManager::applyOwners(const std::vector<OwnerState>& owners) {
+    NetworkLock lock(network_);
+    for (const auto& owner : owners) {
+        if (auto* processor = network_->getProcessorByIdentifier(owner.processor)) {
+            try {
+                auto d = manager_->createWorkspaceDeserializerAndInfo(owner.data, refPath_).first;
+                processor->PropertyOwner::deserialize(d);
+            } catch (...) {
+                StandardExceptionHandler{}(SourceContext{});
+            }
+        }
     }
 }
-void UndoManager::redoState() {
-    if (head_ >= -1 && head_ < static_cast<DiffType>(undoBuffer_.size()) - 1) {
 
-        util::KeepTrueWhileInScope restore(&isRestoring);
-        ++head_;
+auto UndoManager::findPrevious(DiffType index, std::string_view processor) const
+    -> const OwnerState* {
+    for (auto i = index; i >= 0 && !states_[i].owners.empty(); --i) {
+        const auto it = std::ranges::find(states_[i].owners, processor, &OwnerState::processor);
+        if (it != states_[i].owners.end()) return &*it;
+    }
+    return nullptr;
+}
+
+auto UndoManager::findBase(DiffType index) const -> DiffType {
+    while (index > 0 && !states_[index].owners.empty()) --index;
+    return index;
+}
 
-        manager_->load(*undoBuffer_[head_], refPath_, StandardExceptionHandler{},
-                       WorkspaceSaveMode::Undo);
+std::pmr::vector<std::byte> UndoManager::serializeStructure() const {
+    std::pmr::vector<std::byte> structure;
+    structure.reserve(8 * 1024);
+    manager_->save(
+        structure, refPath_, [](SourceContext) -> void { throw; }, WorkspaceSaveMode::Undo,
+        [this](const PropertyOwner& owner) { return !isNetworkProcessor(owner); });
+    return structure;
+}
+
+std::pmr::vector<std::byte> UndoManager::serializeProperties(const Processor& processor) const {
+    Serializer serializer(refPath_);
+    serializer.setWorkspaceSaveMode(WorkspaceSaveMode::Undo);
+    processor.PropertyOwner::serialize(serializer);
+    std::pmr::vector<std::byte> data;
+    serializer.write(data);
+    return data;
+}
+
+bool UndoManager::isNetworkProcessor(const PropertyOwner& owner) const {
+    const auto* processor = owner.getProcessor();
+    return processor && processor == &owner && processor->getNetwork() == network_;
+}
 
-        dirty_ = false;
-        updateActions();
+void UndoManager::recordModificationCounts() {
+    modificationCounts_.clear();
+    network_->forEachProcessor([&](const Processor* processor) {
+        modificationCounts_[processor] = processor->getModificationCount();
+    });
+}
+
+void UndoManager::autoSave() {
+    if (network_->empty()) return;
+
+    auto data = std::make_shared<std::pmr::vector<std::byte>>();
+    try {
+        manager_->save(
+            *data, refPath_, [](SourceContext) -> void { throw; }, WorkspaceSaveMode::Undo);
+    } catch (...) {
+        return;
+    }
+    autoSaver_->save(data);
+}
+
+void UndoManager::undoState() {
+    if (head_ > 0) {
+        restoreState(head_ - 1);
+    }
+}
+void UndoManager::redoState() {
+    if (head_ >= -1 && head_ < static_cast<DiffType>(states_.size()) - 1) {
+        restoreState(head_ + 1);
     }
 }
 
 void UndoManager::clear() {
     head_ = -1;
-    undoBuffer_.clear();
+    states_.clear();
+    history_.clear();
+    structure_.clear();
+    modificationCounts_.clear();
 }
 
 QAction* UndoManager::getUndoAction() const { return undoAction_; }
@@ -306,7 +488,7 @@ void UndoManager::restore() {
 
 void UndoManager::updateActions() {
     undoAction_->setEnabled(head_ > 0);
-    redoAction_->setEnabled(head_ >= -1 && head_ < static_cast<DiffType>(undoBuffer_.size()) - 1);
+    redoAction_->setEnabled(head_ >= -1 && head_ < static_cast<DiffType>(states_.size()) - 1);
 }
 
 #include <warn/push>
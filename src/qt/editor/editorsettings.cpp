@@ -51,6 +51,13 @@ EditorSettings::EditorSettings(InviwoApplication* app)
                        10,
                        {1, ConstraintBehavior::Immutable},
                        {100, ConstraintBehavior::Ignore}}
+    , undoHistoryBudget{"undoHistoryBudget",
+                        "Undo History Budget (MB)",
+                        "The maximum amount of memory used for the undo history, the oldest "
+                        "states will be removed first"_help,
+                        256,
+                        {1, ConstraintBehavior::Immutable},
+                        {4096, ConstraintBehavior::Ignore}}
     , workspaceDirectories{"workspaceDirectories", "Workspace Directories",
                            std::make_unique<FileProperty>("directory", "Directory",
                                                           "Workspace directory"_help, "",
@@ -59,7 +66,7 @@ EditorSettings::EditorSettings(InviwoApplication* app)
                                     "Show Processor Evaluation Counts", true} {
 
     addProperties(workspaceAuthor, numRecentFiles, numRestoreFiles, restoreFrequency,
-                  workspaceDirectories, showProcessorEvaluationCounts);
+                  undoHistoryBudget, workspaceDirectories, showProcessorEvaluationCounts);
 
 #ifndef IVW_PROFILING
     showProcessorEvaluationCounts.set(false);
@@ -274,6 +274,9 @@ InviwoMainWindow::InviwoMainWindow(InviwoApplication* app)
           [&]() -> int { return app_->getSettingsByType<EditorSettings>()->numRestoreFiles.get(); },
           [&]() -> int {
               return app_->getSettingsByType<EditorSettings>()->restoreFrequency.get();
+          },
+          [&]() -> int {
+              return app_->getSettingsByType<EditorSettings>()->undoHistoryBudget.get();
           })
     , visibleWidgetsClearHandle_{
           app->getWorkspaceManager()->onClear([&]() { visibleWidgetState_.processors.clear(); })} {
@@ -57,6 +57,7 @@
 #include <QIcon>
 #include <QCheckBox>
 #include <QSortFilterProxyModel>
+#include <QTimer>
 #include <warn/pop>
 
 namespace inviwo {
@@ -73,6 +74,8 @@ public:
                                          std::string_view{"Source"}};
 
     static constexpr quintptr root = std::numeric_limits<quintptr>::max();
+    // The pools are listed as an extra group after the resource groups
+    static constexpr size_t pools = ResourceManager::groups;
 
     ResourceManagerItemModel(ResourceManager* manager, QObject* parent)
         : QAbstractItemModel(parent), manager_(manager) {
@@ -84,7 +87,7 @@ public:
         if (parent == QModelIndex{}) {
             return createIndex(row, column, root);
         } else if (parent.parent() == QModelIndex{}) {
-            if (row < static_cast<int>(manager_->size(static_cast<size_t>(parent.row())))) {
+            if (row < groupSize(static_cast<size_t>(parent.row()))) {
                 return createIndex(row, column, parent.row());
             }
         }
@@ -94,7 +97,7 @@ public:
 
     virtual QModelIndex parent(const QModelIndex& index) const override {
         const auto parent = index.internalId();
-        if (parent < std::tuple_size_v<ResourceManager::Keys>) {
+        if (parent <= pools) {
             return createIndex(static_cast<int>(parent), 0, root);
         }
         return {};
@@ -102,9 +105,9 @@ public:
 
     virtual int rowCount(const QModelIndex& parent) const override {
         if (parent == QModelIndex{}) {
-            return std::tuple_size_v<ResourceManager::Keys>;
+            return static_cast<int>(pools + 1);
         } else if (parent.parent() == QModelIndex{}) {
-            return static_cast<int>(manager_->size(static_cast<size_t>(parent.row())));
+            return groupSize(static_cast<size_t>(parent.row()));
         } else {
             return 0;
         }
@@ -125,7 +128,17 @@ public:
             const auto group = index.parent().row();
             const auto item = index.row();
 
-            if (const auto* resource = manager_->get(group, item)) {
+            if (static_cast<size_t>(group) == pools) {
+                if (const auto* stats = manager_->getPool(static_cast<size_t>(item))) {
+                    if (index.column() == Cols::Dims) {
+                        return static_cast<qulonglong>(stats->items.load());
+                    } else if (index.column() == Cols::Desc) {
+                        return utilqt::toQString(stats->name);
+                    } else if (index.column() == Cols::Size) {
+                        return static_cast<qulonglong>(stats->bytes.load());
+                    }
+                }
+            } else if (const auto* resource = manager_->get(group, item)) {
                 if (index.column() == Cols::Dims) {
                     return static_cast<qulonglong>(
                         glm::compMul(glm::max(resource->dims, glm::size4_t{1, 1, 1, 1})));
@@ -146,11 +159,31 @@ public:
     }
 
     QVariant displayGroup(const QModelIndex& index) const {
-        if (index.row() < static_cast<int>(ResourceManager::names.size())) {
+        if (static_cast<size_t>(index.row()) == pools) {
+            if (index.column() == 0) {
+                return QString("Pools");
+            } else if (index.column() == 1) {
+                return static_cast<int>(manager_->poolCount());
+            } else if (index.column() == 3) {
+                size_t bytes = 0;
+                for (size_t i = 0; i < manager_->poolCount(); ++i) {
+                    bytes += manager_->getPool(i)->bytes;
+                }
+                return utilqt::toQString(util::formatBytesToString(bytes));
+            }
+        } else if (index.row() < static_cast<int>(ResourceManager::names.size())) {
             if (index.column() == 0) {
                 return utilqt::toQString(ResourceManager::names[index.row()]);
             } else if (index.column() == 1) {
                 return static_cast<int>(manager_->size(static_cast<size_t>(index.row())));
+            } else if (index.column() == 2) {
+                const auto& stats = manager_->getStats(static_cast<size_t>(index.row()));
+                return utilqt::toQString(fmt::format(
+                    "Peak: {}, Budget: {}, Evicted: {} ({})",
+                    util::formatBytesToString(stats.peakUsage),
+                    stats.budget == 0 ? std::string{"Unlimited"}
+                                      : util::formatBytesToString(stats.budget),
+                    stats.evictions, util::formatBytesToString(stats.evictedBytes)));
             } else if (index.column() == 3) {
                 return utilqt::toQString(util::formatBytesToString(
                     manager_->totalByteSize(static_cast<size_t>(index.row()))));
@@ -159,6 +192,28 @@ public:
         return {};
     }
 
+    QVariant displayPool(const QModelIndex& index) const {
+        if (const auto* stats = manager_->getPool(static_cast<size_t>(index.row()))) {
+            if (index.column() == Cols::Dims) {
+                return utilqt::toQString(fmt::format("{} items", stats->items.load()));
+            } else if (index.column() == Cols::Desc) {
+                return utilqt::toQString(fmt::format("{} Hits: {}, Misses: {}, Evicted: {}",
+                                                     stats->name, stats->hits.load(),
+                                                     stats->misses.load(),
+                                                     stats->evictions.load()));
+            } else if (index.column() == Cols::Size) {
+                return utilqt::toQString(util::formatBytesToString(stats->bytes));
+            } else if (index.column() == Cols::Meta) {
+                const auto budget = stats->budget.load();
+                return utilqt::toQString(fmt::format(
+                    "Budget: {}", budget == std::numeric_limits<size_t>::max()
+                                      ? std::string{"Unlimited"}
+                                      : util::formatBytesToString(budget)));
+            }
+        }
+        return {};
+    }
+
     QVariant displayResource(const QModelIndex& index) const {
         const auto group = index.parent().row();
         const auto item = index.row();
@@ -197,6 +252,8 @@ public:
     QVariant displayData(const QModelIndex& index) const {
         if (!index.parent().isValid()) {
             return displayGroup(index);
+        } else if (static_cast<size_t>(index.parent().row()) == pools) {
+            return displayPool(index);
         } else {
             return displayResource(index);
         }
@@ -230,7 +287,35 @@ public:
     }
     virtual void onDidRemoveResource(size_t, size_t, const Resource&) override { endRemoveRows(); }
 
+    virtual void onWillAddPool(size_t item) override {
+        const auto parentIndex = index(static_cast<int>(pools), 0, QModelIndex{});
+        beginInsertRows(parentIndex, static_cast<int>(item), static_cast<int>(item));
+    }
+    virtual void onDidAddPool(size_t) override { endInsertRows(); }
+    virtual void onWillRemovePool(size_t item) override {
+        const auto parentIndex = index(static_cast<int>(pools), 0, QModelIndex{});
+        beginRemoveRows(parentIndex, static_cast<int>(item), static_cast<int>(item));
+    }
+    virtual void onDidRemovePool(size_t) override { endRemoveRows(); }
+
+    /**
+     * The pool statistics change without notifications, refresh them periodically.
+     */
+    void updatePools() {
+        const auto count = static_cast<int>(manager_->poolCount());
+        if (count == 0) return;
+        const auto parentIndex = index(static_cast<int>(pools), 0, QModelIndex{});
+        dataChanged(index(static_cast<int>(pools), 0, QModelIndex{}),
+                    index(static_cast<int>(pools), 3, QModelIndex{}));
+        dataChanged(index(0, 0, parentIndex), index(count - 1, 4, parentIndex));
+    }
+
 private:
+    int groupSize(size_t group) const {
+        if (group == pools) return static_cast<int>(manager_->poolCount());
+        return static_cast<int>(manager_->size(group));
+    }
+
     ResourceManager* manager_;  // should not be null
 };
 
@@ -269,6 +354,10 @@ ResourceManagerDockWidget::ResourceManagerDockWidget(QWidget* parent, ResourceMa
     setContents(layout);
     widget()->setContentsMargins(0, 0, 0, 0);
 
+    auto* poolTimer = new QTimer(this);
+    connect(poolTimer, &QTimer::timeout, this, [this]() { model_->updatePools(); });
+    poolTimer->start(1000);
+
     callback_ = settings.enableResourceTracking_.onChangeScoped([&settings, enable]() {
         const QSignalBlocker block{enable};
         enable->setChecked(settings.enableResourceTracking_.get());
@@ -0,0 +1,88 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/workspacemanager.h>
+#include <inviwo/core/properties/transferfunctionproperty.h>
+#include <inviwo/core/util/deltahistory.h>
+#include <inviwo/core/util/exception.h>
+#include <modules/base/processors/cubeproxygeometryprocessor.h>
+#include <modules/base/processors/volumesliceextractor.h>
+#include <modules/base/processors/volumesource.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <algorithm>
+#include <memory_resource>
+#include <vector>
+
+namespace inviwo {
+
+TEST(DeltaHistory, WorkspacePropertyEdit) {
+    auto* app = InviwoApplication::getPtr();
+    auto* network = app->getProcessorNetwork();
+    auto* workspace = app->getWorkspaceManager();
+
+    auto source = network->emplaceProcessor<VolumeSource>();
+    auto cube = network->emplaceProcessor<CubeProxyGeometry>();
+    auto slice = network->emplaceProcessor<VolumeSliceExtractor>();
+    network->addConnection(source->getOutport("data"), cube->getInport("volume"));
+    network->addConnection(source->getOutport("data"), slice->getInport("inputVolume"));
+
+    const auto save = [&]() {
+        std::pmr::vector<std::byte> data;
+        workspace->save(data, {}, StandardExceptionHandler{}, WorkspaceSaveMode::Undo);
+        return data;
+    };
+
+    const auto before = save();
+    // Adding a point changes the size of the transfer function, and the length fields of all
+    // enclosing elements in the serialized workspace.
+    auto tfs = slice->getPropertiesByType<TransferFunctionProperty>(true);
+    ASSERT_FALSE(tfs.empty());
+    tfs.front()->get().add(0.25, vec4{0.1f, 0.2f, 0.3f, 0.4f});
+    const auto after = save();
+    ASSERT_NE(before.size(), after.size());
+
+    DeltaHistory history;
+    history.push(before);
+    history.push(after);
+    EXPECT_LT(history.memoryUsage() - after.size(), 1024)
+        << "snapshot size " << after.size() << " bytes";
+    EXPECT_TRUE(std::ranges::equal(before, history.at(0)));
+    EXPECT_TRUE(std::ranges::equal(after, history.at(1)));
+
+    network->clear();
+}
+
+}  // namespace inviwo
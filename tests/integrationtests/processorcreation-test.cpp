@@ -44,6 +44,7 @@
 #include <modules/opengl/openglcapabilities.h>
 
 #include <algorithm>
+#include <future>
 
 namespace inviwo {
 
@@ -130,6 +131,22 @@ TEST_P(ProcessorCreationTests, ProcesorCreateAndResetAndAddToNetwork) {
     }
 }
 
+TEST(ProcessorCreation, ThreadSafeConstruction) {
+    const auto* factory = InviwoApplication::getPtr()->getProcessorFactory();
+
+    size_t threadSafe = 0;
+    for (const auto& key : factory->getKeys()) {
+        if (!factory->isThreadSafe(key)) continue;
+        ++threadSafe;
+
+        auto processor = std::async(std::launch::async, [&]() {
+                             return factory->createShared(key);
+                         }).get();
+        EXPECT_TRUE(processor) << "Could not create processor " << key << " on a worker thread";
+    }
+    EXPECT_GT(threadSafe, 0u);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     RegisteredProcessors, ProcessorCreationTests,
     ::testing::ValuesIn(InviwoApplication::getPtr()->getProcessorFactory()->getKeys()),